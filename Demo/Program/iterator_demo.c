@@ -0,0 +1,199 @@
+//------------------------------------------------------------------------------
+// GraphBLAS/Demo/Program/iterator_demo: parallel iteration over a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// This demo computes the row sums of a matrix with user threads, each with
+// its own row iterator.  GxB_Iterator_partition splits the rows into ranges
+// with about the same number of entries, and GxB_Iterator_getBlock gives each
+// thread the entries of a row in bulk.  The result is compared with
+// GrB_reduce, for a matrix held in each of the four formats.
+//
+//  iterator_demo [nthreads]
+
+#include "graphblas_demos.h"
+#include "simple_rand.c"
+#if defined ( _OPENMP )
+#include <omp.h>
+#endif
+
+#define NROWS 10000
+#define NCOLS 10000
+#define NTUPLES 200000
+
+// macro used by OK(...) to free workspace if an error occurs
+#undef  FREE_ALL
+#define FREE_ALL                            \
+    GrB_Matrix_free (&A) ;                  \
+    GrB_Vector_free (&w) ;                  \
+    if (I != NULL) free (I) ;               \
+    if (J != NULL) free (J) ;               \
+    if (X != NULL) free (X) ;               \
+    if (rowsum != NULL) free (rowsum) ;     \
+    if (Slice != NULL) free (Slice) ;       \
+    GrB_finalize ( ) ;
+
+//------------------------------------------------------------------------------
+// rowsums: compute the row sums of A with user threads
+//------------------------------------------------------------------------------
+
+// A is a GrB_FP64 matrix held by row.  rowsum [i] is the sum of the entries
+// in A(i,:), or zero if the row is empty.  The rows are split into ntasks
+// ranges, which are computed by nthreads threads.  Returns the number of
+// ranges used, which is less than ntasks if A has fewer rows than that.
+
+static int rowsums (double *rowsum, GrB_Index *Slice, int ntasks,
+    int nthreads, GrB_Matrix A, GrB_Index nrows)
+{
+    GxB_Iterator it = NULL ;
+    GxB_Iterator_new (&it) ;
+    GxB_rowIterator_attach (it, A, NULL) ;
+    GxB_Iterator_partition (Slice, &ntasks, it) ;
+    GxB_Iterator_free (&it) ;
+
+    for (GrB_Index i = 0 ; i < nrows ; i++)
+    {
+        rowsum [i] = 0 ;
+    }
+
+    int tid ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+    for (tid = 0 ; tid < ntasks ; tid++)
+    {
+        // each thread has its own iterator, attached to the same matrix
+        GxB_Iterator iterator = NULL ;
+        GxB_Iterator_new (&iterator) ;
+        GxB_rowIterator_attach (iterator, A, NULL) ;
+        for (GrB_Index k = Slice [tid] ; k < Slice [tid+1] ; k++)
+        {
+            // move to the first entry of the kth row; skip it if empty
+            if (GxB_rowIterator_kseek (iterator, k) != GrB_SUCCESS) continue ;
+            GrB_Index i = GxB_rowIterator_getRowIndex (iterator), n ;
+            const void *X ;
+            const int8_t *B ;
+            bool iso ;
+            GxB_Iterator_getBlock (iterator, NULL, &X, &B, &n, &iso) ;
+            const double *Ax = (const double *) X ;
+            double s = 0 ;
+            for (GrB_Index t = 0 ; t < n ; t++)
+            {
+                // B is non-NULL only if A is bitmap
+                if (B != NULL && !B [t]) continue ;
+                s += Ax [iso ? 0 : t] ;
+            }
+            rowsum [i] = s ;
+        }
+        GxB_Iterator_free (&iterator) ;
+    }
+    return (ntasks) ;
+}
+
+//------------------------------------------------------------------------------
+// iterator_demo main program
+//------------------------------------------------------------------------------
+
+int main (int argc, char **argv)
+{
+    GrB_Matrix A = NULL ;
+    GrB_Vector w = NULL ;
+    GrB_Index *I = NULL, *J = NULL, *Slice = NULL ;
+    double *X = NULL, *rowsum = NULL ;
+    GrB_Info info ;
+
+    OK (GrB_init (GrB_NONBLOCKING)) ;
+    int nthreads ;
+    OK (GxB_Global_Option_get (GxB_GLOBAL_NTHREADS, &nthreads)) ;
+    if (argc > 1)
+    {
+        nthreads = atoi (argv [1]) ;
+    }
+    nthreads = MAX (nthreads, 1) ;
+    printf ("iterator demo: nthreads %d\n", nthreads) ;
+
+    //--------------------------------------------------------------------------
+    // create a random matrix, with the first rows denser than the rest
+    //--------------------------------------------------------------------------
+
+    I = (GrB_Index *) malloc (NTUPLES * sizeof (GrB_Index)) ;
+    J = (GrB_Index *) malloc (NTUPLES * sizeof (GrB_Index)) ;
+    X = (double *) malloc (NTUPLES * sizeof (double)) ;
+    rowsum = (double *) malloc (NROWS * sizeof (double)) ;
+    // room for more tasks than rows
+    Slice = (GrB_Index *) malloc ((NROWS + 2) * sizeof (GrB_Index)) ;
+    CHECK (I != NULL && J != NULL && X != NULL && rowsum != NULL
+        && Slice != NULL, GrB_OUT_OF_MEMORY) ;
+
+    simple_rand_seed (1) ;
+    for (int64_t k = 0 ; k < NTUPLES ; k++)
+    {
+        GrB_Index i = simple_rand_i ( ) % NROWS ;
+        I [k] = (k % 2 == 0) ? (i % 100) : i ;
+        J [k] = simple_rand_i ( ) % NCOLS ;
+        X [k] = (double) (simple_rand_i ( ) % 100) ;
+    }
+    OK (GrB_Matrix_new (&A, GrB_FP64, NROWS, NCOLS)) ;
+    OK (GrB_Matrix_build_FP64 (A, I, J, X, NTUPLES, GrB_PLUS_FP64)) ;
+    OK (GrB_Matrix_set_INT32 (A, GrB_ROWMAJOR, GrB_STORAGE_ORIENTATION_HINT)) ;
+    OK (GrB_Vector_new (&w, GrB_FP64, NROWS)) ;
+
+    //--------------------------------------------------------------------------
+    // compute the row sums with each format
+    //--------------------------------------------------------------------------
+
+    int sparsities [4] = { GxB_SPARSE, GxB_HYPERSPARSE, GxB_BITMAP, GxB_FULL } ;
+    char *names [4] = { "sparse", "hypersparse", "bitmap", "full" } ;
+
+    for (int s = 0 ; s < 4 ; s++)
+    {
+        if (sparsities [s] == GxB_FULL)
+        {
+            // add an explicit zero to each missing entry, so A can be full
+            OK (GrB_Matrix_assign_FP64 (A, A, NULL, 0, GrB_ALL, NROWS,
+                GrB_ALL, NCOLS, GrB_DESC_SC)) ;
+        }
+        OK (GxB_Matrix_Option_set (A, GxB_SPARSITY_CONTROL, sparsities [s])) ;
+        OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+
+        // w = sum (A,2), for comparison
+        OK (GrB_Matrix_reduce_Monoid (w, NULL, NULL, GrB_PLUS_MONOID_FP64, A,
+            NULL)) ;
+
+        // one task per thread, and more tasks than rows
+        int ntasks_list [2] = { nthreads, NROWS + 1 } ;
+        for (int trial = 0 ; trial < 2 ; trial++)
+        {
+            #if defined ( _OPENMP )
+            double t = omp_get_wtime ( ) ;
+            #endif
+
+            int ntasks = rowsums (rowsum, Slice, ntasks_list [trial],
+                nthreads, A, NROWS) ;
+
+            #if defined ( _OPENMP )
+            t = omp_get_wtime ( ) - t ;
+            #else
+            double t = 0 ;
+            #endif
+
+            // check the result
+            double err = 0 ;
+            for (GrB_Index i = 0 ; i < NROWS ; i++)
+            {
+                double x = 0 ;
+                OK (GrB_Vector_extractElement_FP64 (&x, w, i)) ;
+                err = MAX (err, fabs (x - rowsum [i])) ;
+            }
+            printf ("%-12s tasks requested: %6d used: %6d time: %10.6f "
+                "err: %g\n", names [s], ntasks_list [trial], ntasks, t, err) ;
+            CHECK (err == 0, GrB_PANIC) ;
+        }
+    }
+
+    FREE_ALL ;
+    printf ("iterator demo: all tests passed\n") ;
+    return (0) ;
+}
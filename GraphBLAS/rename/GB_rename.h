@@ -161,6 +161,7 @@
 #define GB_bitmap_M_scatter GM_bitmap_M_scatter
 #define GB_bitmap_M_scatter_whole GM_bitmap_M_scatter_whole
 #define GB_bitmap_subref GM_bitmap_subref
+#define GB_bitmap_subref_jit GM_bitmap_subref_jit
 #define GB_bitset_int16 GM_bitset_int16
 #define GB_bitset_int32 GM_bitset_int32
 #define GB_bitset_int64 GM_bitset_int64
@@ -183,6 +184,7 @@
 #define GB_boolean_rename GM_boolean_rename
 #define GB_boolean_rename_op GM_boolean_rename_op
 #define GB_builder GM_builder
+#define GB_build_file GM_build_file
 #define GB_build GM_build
 #define GB_build_jit GM_build_jit
 #define GB_callback GM_callback
@@ -207,6 +209,7 @@
 #define GB_cfloorf GM_cfloorf
 #define GB_cfloor GM_cfloor
 #define GB_check_if_iso GM_check_if_iso
+#define GB_chunk_calibrate GM_chunk_calibrate
 #define GB_cisfinitef GM_cisfinitef
 #define GB_cisfinite GM_cisfinite
 #define GB_cisinff GM_cisinff
@@ -240,10 +243,13 @@
 #define GB_concat_sparse_jit GM_concat_sparse_jit
 #define GB_conform GM_conform
 #define GB_conform_hyper GM_conform_hyper
+#define GB_Context_bind GM_Context_bind
 #define GB_Context_check GM_Context_check
+#define GB_Context_chunk_family GM_Context_chunk_family
 #define GB_Context_chunk_get GM_Context_chunk_get
 #define GB_Context_chunk GM_Context_chunk
 #define GB_Context_chunk_set GM_Context_chunk_set
+#define GB_Context_cpus_set GM_Context_cpus_set
 #define GB_Context_disengage GM_Context_disengage
 #define GB_Context_engage GM_Context_engage
 #define GB_Context_gpu_id_get GM_Context_gpu_id_get
@@ -252,6 +258,8 @@
 #define GB_Context_nthreads_max_get GM_Context_nthreads_max_get
 #define GB_Context_nthreads_max GM_Context_nthreads_max
 #define GB_Context_nthreads_max_set GM_Context_nthreads_max_set
+#define GB_Context_numa_node GM_Context_numa_node
+#define GB_Context_numa_set GM_Context_numa_set
 #define GB_CONTEXT_THREAD GM_CONTEXT_THREAD
 #define GB_convert_any_to_bitmap GM_convert_any_to_bitmap
 #define GB_convert_any_to_full GM_convert_any_to_full
@@ -311,8 +319,10 @@
 #define GB_encodify_assign GM_encodify_assign
 #define GB_encodify_build GM_encodify_build
 #define GB_encodify_ewise GM_encodify_ewise
+#define GB_encodify_ewise_axpby GM_encodify_ewise_axpby
 #define GB_encodify_mxm GM_encodify_mxm
 #define GB_encodify_reduce GM_encodify_reduce
+#define GB_encodify_reduce_select_apply GM_encodify_reduce_select_apply
 #define GB_encodify_select GM_encodify_select
 #define GB_encodify_user_op GM_encodify_user_op
 #define GB_encodify_user_type GM_encodify_user_type
@@ -323,17 +333,21 @@
 #define GB_enumify_build GM_enumify_build
 #define GB_enumify_cuda_atomic GM_enumify_cuda_atomic
 #define GB_enumify_ewise GM_enumify_ewise
+#define GB_enumify_ewise_axpby GM_enumify_ewise_axpby
 #define GB_enumify_identity GM_enumify_identity
 #define GB_enumify_mask GM_enumify_mask
 #define GB_enumify_monoid GM_enumify_monoid
 #define GB_enumify_mxm GM_enumify_mxm
 #define GB_enumify_reduce GM_enumify_reduce
+#define GB_enumify_reduce_select_apply GM_enumify_reduce_select_apply
 #define GB_enumify_select GM_enumify_select
 #define GB_enumify_sparsity GM_enumify_sparsity
 #define GB_enumify_terminal GM_enumify_terminal
 #define GB_enumify_unop GM_enumify_unop
 #define GB_ERR_getErrorString GM_ERR_getErrorString
 #define GB_eslice GM_eslice
+#define GB_ewise_axpby GM_ewise_axpby
+#define GB_ewise_axpby_jit GM_ewise_axpby_jit
 #define GB_ewise_fulla GM_ewise_fulla
 #define GB_ewise_fulla_jit GM_ewise_fulla_jit
 #define GB_ewise_fulln GM_ewise_fulln
@@ -387,6 +401,9 @@
 #define GB_Global_burble_set GM_Global_burble_set
 #define GB_Global_calloc_function_get GM_Global_calloc_function_get
 #define GB_Global_calloc_function_set GM_Global_calloc_function_set
+#define GB_Global_chunk_family_default GM_Global_chunk_family_default
+#define GB_Global_chunk_family_get GM_Global_chunk_family_get
+#define GB_Global_chunk_family_set GM_Global_chunk_family_set
 #define GB_Global_cpu_features_avx2 GM_Global_cpu_features_avx2
 #define GB_Global_cpu_features_avx512f GM_Global_cpu_features_avx512f
 #define GB_Global_cpu_features_query GM_Global_cpu_features_query
@@ -438,6 +455,10 @@
 #define GB_Global_mode_set GM_Global_mode_set
 #define GB_Global_nmalloc_clear GM_Global_nmalloc_clear
 #define GB_Global_nmalloc_get GM_Global_nmalloc_get
+#define GB_Global_numa_nodes_get GM_Global_numa_nodes_get
+#define GB_Global_numa_nodes_set GM_Global_numa_nodes_set
+#define GB_Global_numa_policy_get GM_Global_numa_policy_get
+#define GB_Global_numa_policy_set GM_Global_numa_policy_set
 #define GB_Global_persistent_free GM_Global_persistent_free
 #define GB_Global_persistent_malloc GM_Global_persistent_malloc
 #define GB_Global_persistent_set GM_Global_persistent_set
@@ -498,6 +519,7 @@
 #define GB_hyper_hash_build GM_hyper_hash_build
 #define GB_hyper_hash_free GM_hyper_hash_free
 #define GB_hyper_hash_need GM_hyper_hash_need
+#define GB_hyper_hash_update GM_hyper_hash_update
 #define GB_hypermatrix_prune GM_hypermatrix_prune
 #define GB_hyper_prune GM_hyper_prune
 #define GB_hyper_realloc GM_hyper_realloc
@@ -903,6 +925,7 @@
 #define GB_macrofy_cast_output GM_macrofy_cast_output
 #define GB_macrofy_defn GM_macrofy_defn
 #define GB_macrofy_ewise GM_macrofy_ewise
+#define GB_macrofy_ewise_axpby GM_macrofy_ewise_axpby
 #define GB_macrofy_family GM_macrofy_family
 #define GB_macrofy_id GM_macrofy_id
 #define GB_macrofy_input GM_macrofy_input
@@ -916,6 +939,7 @@
 #define GB_macrofy_preface GM_macrofy_preface
 #define GB_macrofy_query GM_macrofy_query
 #define GB_macrofy_reduce GM_macrofy_reduce
+#define GB_macrofy_reduce_select_apply GM_macrofy_reduce_select_apply
 #define GB_macrofy_select GM_macrofy_select
 #define GB_macrofy_sparsity GM_macrofy_sparsity
 #define GB_macrofy_string GM_macrofy_string
@@ -937,6 +961,7 @@
 #define GB_Matrix_free GM_Matrix_free
 #define GB_Matrix_new GM_Matrix_new
 #define GB_Matrix_removeElement GM_Matrix_removeElement
+#define GB_Matrix_removeElements GM_Matrix_removeElements
 #define GB_matvec_check GM_matvec_check
 #define GB_matvec_enum_get GM_matvec_enum_get
 #define GB_matvec_name_get GM_matvec_name_get
@@ -966,6 +991,8 @@
 #define GB_nnz_held GM_nnz_held
 #define GB_nnz_max GM_nnz_max
 #define GB_nonzombie_func GM_nonzombie_func
+#define GB_numa_bind GM_numa_bind
+#define GB_numa_policy_set GM_numa_policy_set
 #define GB_nvals GM_nvals
 #define GB_nvec_nonempty GM_nvec_nonempty
 #define GB_omp_get_max_threads GM_omp_get_max_threads
@@ -983,6 +1010,7 @@
 #define GB_op_string_set GM_op_string_set
 #define GB_Pending_alloc GM_Pending_alloc
 #define GB_Pending_free GM_Pending_free
+#define GB_Pending_lookup GM_Pending_lookup
 #define GB_Pending_n GM_Pending_n
 #define GB_Pending_realloc GM_Pending_realloc
 #define GB_phybix_free GM_phybix_free
@@ -1021,6 +1049,11 @@
 #define GB_qsort_2 GM_qsort_2
 #define GB_qsort_3 GM_qsort_3
 #define GB_realloc_memory GM_realloc_memory
+#define GB_reduce_each_vector GM_reduce_each_vector
+#define GB_reduce_each_vector_jit GM_reduce_each_vector_jit
+#define GB_reduce_multi GM_reduce_multi
+#define GB_reduce_select_apply GM_reduce_select_apply
+#define GB_reduce_select_apply_jit GM_reduce_select_apply_jit
 #define GB_reduce_to_scalar GM_reduce_to_scalar
 #define GB_reduce_to_scalar_iso GM_reduce_to_scalar_iso
 #define GB_reduce_to_scalar_jit GM_reduce_to_scalar_jit
@@ -1030,6 +1063,7 @@
 #define GB_resize GM_resize
 #define GB_rowscale GM_rowscale
 #define GB_rowscale_jit GM_rowscale_jit
+#define GB_rsort GM_rsort
 #define GB_Scalar_check GM_Scalar_check
 #define GB_Scalar_reduce GM_Scalar_reduce
 #define GB_Scalar_wrap GM_Scalar_wrap
@@ -1049,6 +1083,7 @@
 #define GB_select_positional_phase1 GM_select_positional_phase1
 #define GB_select_positional_phase2 GM_select_positional_phase2
 #define GB_select_sparse GM_select_sparse
+#define GB_select_topk GM_select_topk
 #define GB_select_value_iso GM_select_value_iso
 #define GB_Semiring_check GM_Semiring_check
 #define GB_semiring_name_get GM_semiring_name_get
@@ -1059,12 +1094,15 @@
 #define GB_serialize_method GM_serialize_method
 #define GB_serialize_to_blob GM_serialize_to_blob
 #define GB_setElement GM_setElement
+#define GB_setElements GM_setElements
 #define GB_shallow_copy GM_shallow_copy
 #define GB_shallow_op GM_shallow_op
 #define GB_signumf GM_signumf
 #define GB_signum GM_signum
 #define GB_slice_vector GM_slice_vector
 #define GB_sort GM_sort
+#define GB_sparsity_adapt_test GM_sparsity_adapt_test
+#define GB_sparsity_adapt_use GM_sparsity_adapt_use
 #define GB_sparsity_control GM_sparsity_control
 #define GB_split_bitmap GM_split_bitmap
 #define GB_split_bitmap_jit GM_split_bitmap_jit
@@ -1114,15 +1152,20 @@
 #define GB_subref_phase2 GM_subref_phase2
 #define GB_subref_phase3 GM_subref_phase3
 #define GB_subref_slice GM_subref_slice
+#define GB_subref_sparse_jit GM_subref_sparse_jit
+#define GB_sysfs_list GM_sysfs_list
 #define GB_task_cumsum GM_task_cumsum
 #define GB_transplant_conform GM_transplant_conform
 #define GB_transplant GM_transplant
 #define GB_transpose_bind1st_jit GM_transpose_bind1st_jit
 #define GB_transpose_bind2nd_jit GM_transpose_bind2nd_jit
 #define GB_transpose_bucket GM_transpose_bucket
+#define GB_transpose_cache_build GM_transpose_cache_build
+#define GB_transpose_cache_free GM_transpose_cache_free
 #define GB_transpose_cast GM_transpose_cast
 #define GB_transpose GM_transpose
 #define GB_transpose_in_place GM_transpose_in_place
+#define GB_transpose_in_place_full GM_transpose_in_place_full
 #define GB_transpose_ix GM_transpose_ix
 #define GB_transpose_method GM_transpose_method
 #define GB_transpose_op GM_transpose_op
@@ -1146,6 +1189,7 @@
 #define GB_Vector_diag GM_Vector_diag
 #define GB_Vector_removeElement GM_Vector_removeElement
 #define GB_wait GM_wait
+#define GB_wait_merge GM_wait_merge
 #define GB_werk_pop GM_werk_pop
 #define GB_werk_push GM_werk_push
 #define GB_xalloc_memory GM_xalloc_memory
@@ -2997,6 +3041,7 @@
 #define GxB_CIMAG_FC64 GxM_CIMAG_FC64
 #define GxB_CMPLX_FP32 GxM_CMPLX_FP32
 #define GxB_CMPLX_FP64 GxM_CMPLX_FP64
+#define GxB_chunk_calibrate GxM_chunk_calibrate
 #define GxB_Col_subassign GxM_Col_subassign
 #define GxB_CONJ_FC32 GxM_CONJ_FC32
 #define GxB_CONJ_FC64 GxM_CONJ_FC64
@@ -3571,8 +3616,10 @@
 #define GxB_Matrix_apply_IndexOp_FC64 GxM_Matrix_apply_IndexOp_FC64
 #define GxB_Matrix_assign_FC32 GxM_Matrix_assign_FC32
 #define GxB_Matrix_assign_FC64 GxM_Matrix_assign_FC64
+#define GxB_Matrix_axpby GxM_Matrix_axpby
 #define GxB_Matrix_build_FC32 GxM_Matrix_build_FC32
 #define GxB_Matrix_build_FC64 GxM_Matrix_build_FC64
+#define GxB_Matrix_build_File GxM_Matrix_build_File
 #define GxB_Matrix_build_Scalar GxM_Matrix_build_Scalar
 #define GxB_Matrix_concat GxM_Matrix_concat
 #define GxB_Matrix_deserialize GxM_Matrix_deserialize
@@ -3614,6 +3661,7 @@
 #define GxB_Matrix_Option_set_INT32 GxM_Matrix_Option_set_INT32
 #define GxB_Matrix_pack_BitmapC GxM_Matrix_pack_BitmapC
 #define GxB_Matrix_pack_BitmapR GxM_Matrix_pack_BitmapR
+#define GxB_Matrix_pack_COO GxM_Matrix_pack_COO
 #define GxB_Matrix_pack_CSC GxM_Matrix_pack_CSC
 #define GxB_Matrix_pack_CSR GxM_Matrix_pack_CSR
 #define GxB_Matrix_pack_FullC GxM_Matrix_pack_FullC
@@ -3622,15 +3670,33 @@
 #define GxB_Matrix_pack_HyperCSR GxM_Matrix_pack_HyperCSR
 #define GxB_Matrix_reduce_FC32 GxM_Matrix_reduce_FC32
 #define GxB_Matrix_reduce_FC64 GxM_Matrix_reduce_FC64
+#define GxB_Matrix_reduce_Monoids GxM_Matrix_reduce_Monoids
+#define GxB_Matrix_reduce_SelectApply GxM_Matrix_reduce_SelectApply
+#define GxB_Matrix_removeElements GxM_Matrix_removeElements
 #define GxB_Matrix_reshapeDup GxM_Matrix_reshapeDup
 #define GxB_Matrix_reshape GxM_Matrix_reshape
 #define GxB_Matrix_resize GxM_Matrix_resize
 #define GxB_Matrix_select_FC32 GxM_Matrix_select_FC32
 #define GxB_Matrix_select_FC64 GxM_Matrix_select_FC64
 #define GxB_Matrix_select GxM_Matrix_select
+#define GxB_Matrix_selectTopK GxM_Matrix_selectTopK
 #define GxB_Matrix_serialize GxM_Matrix_serialize
 #define GxB_Matrix_setElement_FC32 GxM_Matrix_setElement_FC32
 #define GxB_Matrix_setElement_FC64 GxM_Matrix_setElement_FC64
+#define GxB_Matrix_setElements_BOOL GxM_Matrix_setElements_BOOL
+#define GxB_Matrix_setElements_FC32 GxM_Matrix_setElements_FC32
+#define GxB_Matrix_setElements_FC64 GxM_Matrix_setElements_FC64
+#define GxB_Matrix_setElements_FP32 GxM_Matrix_setElements_FP32
+#define GxB_Matrix_setElements_FP64 GxM_Matrix_setElements_FP64
+#define GxB_Matrix_setElements_INT16 GxM_Matrix_setElements_INT16
+#define GxB_Matrix_setElements_INT32 GxM_Matrix_setElements_INT32
+#define GxB_Matrix_setElements_INT64 GxM_Matrix_setElements_INT64
+#define GxB_Matrix_setElements_INT8 GxM_Matrix_setElements_INT8
+#define GxB_Matrix_setElements_UDT GxM_Matrix_setElements_UDT
+#define GxB_Matrix_setElements_UINT16 GxM_Matrix_setElements_UINT16
+#define GxB_Matrix_setElements_UINT32 GxM_Matrix_setElements_UINT32
+#define GxB_Matrix_setElements_UINT64 GxM_Matrix_setElements_UINT64
+#define GxB_Matrix_setElements_UINT8 GxM_Matrix_setElements_UINT8
 #define GxB_Matrix_sort GxM_Matrix_sort
 #define GxB_Matrix_split GxM_Matrix_split
 #define GxB_Matrix_subassign_BOOL GxM_Matrix_subassign_BOOL
@@ -4839,6 +4905,7 @@
 #define GxB_Vector_apply_IndexOp_FC64 GxM_Vector_apply_IndexOp_FC64
 #define GxB_Vector_assign_FC32 GxM_Vector_assign_FC32
 #define GxB_Vector_assign_FC64 GxM_Vector_assign_FC64
+#define GxB_Vector_axpby GxM_Vector_axpby
 #define GxB_Vector_build_FC32 GxM_Vector_build_FC32
 #define GxB_Vector_build_FC64 GxM_Vector_build_FC64
 #define GxB_Vector_build_Scalar GxM_Vector_build_Scalar
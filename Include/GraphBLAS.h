@@ -1,4 +1,4 @@
-// SuiteSparse:GraphBLAS 9.1.0
+// SuiteSparse:GraphBLAS 9.2.0
 //------------------------------------------------------------------------------
 // GraphBLAS.h: definitions for the GraphBLAS package
 //------------------------------------------------------------------------------
@@ -234,9 +234,9 @@
 
 // The version of this implementation, and the GraphBLAS API version:
 #define GxB_IMPLEMENTATION_NAME "SuiteSparse:GraphBLAS"
-#define GxB_IMPLEMENTATION_DATE "Mar 22, 2024"
+#define GxB_IMPLEMENTATION_DATE "Oct 18, 2026"
 #define GxB_IMPLEMENTATION_MAJOR 9
-#define GxB_IMPLEMENTATION_MINOR 1
+#define GxB_IMPLEMENTATION_MINOR 2
 #define GxB_IMPLEMENTATION_SUB   0
 #define GxB_SPEC_DATE "Dec 22, 2023"
 #define GxB_SPEC_MAJOR 2
@@ -3069,6 +3069,29 @@ GrB_Info GxB_Matrix_build_Scalar    // build a matrix from (I,J,scalar) tuples
     GrB_Index nvals                 // number of tuples
 ) ;
 
+//------------------------------------------------------------------------------
+// GxB_Matrix_build_File: build a matrix from a file of tuples
+//------------------------------------------------------------------------------
+
+// GxB_Matrix_build_File builds a matrix from a binary file of tuples, read
+// from the current position of f until the end of the file.  Each tuple is
+// held as (int64_t row, int64_t col, value), with no padding, where the value
+// has type xtype.  The result is the same as GrB_Matrix_build with the same
+// tuples, but the tuples are never all held in memory at once.  Instead,
+// chunks of tuples are sorted and written to temporary files, which are then
+// merged into C.  The memory parameter gives the size of the workspace, in
+// bytes; if zero, a default of 1 GB is used.
+
+GrB_Info GxB_Matrix_build_File      // build a matrix from a file of tuples
+(
+    GrB_Matrix C,                   // matrix to build
+    FILE *f,                        // file of binary (row,col,value) tuples
+    const GrB_Type xtype,           // type of the values in the file
+    const GrB_BinaryOp dup,         // binary function to assemble duplicates
+    size_t memory,                  // workspace limit in bytes (0: default)
+    const GrB_Descriptor desc       // currently unused
+) ;
+
 // Type-generic version:  X can be a pointer to any supported C type or void *
 // for a user-defined type.
 
@@ -3420,6 +3443,195 @@ GrB_Info GrB_Matrix_removeElement
     GrB_Index j                     // column index
 ) ;
 
+//------------------------------------------------------------------------------
+// GxB_Matrix_setElements and GxB_Matrix_removeElements
+//------------------------------------------------------------------------------
+
+// GxB_Matrix_setElements (C, Ilist, J, X, n, dup) sets a list of n entries in
+// the matrix C, C(Ilist(k),J(k)) = X(k) for k = 0:n-1, with the same result as
+// calling GrB_Matrix_setElement once for each tuple, in order.  If dup is
+// NULL, existing entries are overwritten, and the last tuple is used if an
+// entry appears more than once.  Otherwise, dup is used as an accumulator:
+// C(i,j) = dup (C(i,j), X(k)) for each tuple whose entry is already present.
+// New entries are added as a single sorted block of pending tuples.
+
+// GxB_Matrix_removeElements (C, Ilist, J, n) removes the n entries
+// C(Ilist(k),J(k)) from C, with the same result as calling
+// GrB_Matrix_removeElement once for each entry.
+
+GrB_Info GxB_Matrix_setElements_BOOL // C(Ilist,J) = X
+(
+    GrB_Matrix C,                   // matrix to modify
+    const GrB_Index *Ilist,         // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const bool *X,                  // array of values of tuples
+    GrB_Index n,                    // number of tuples
+    const GrB_BinaryOp dup          // accum operator for existing entries
+) ;
+
+GrB_Info GxB_Matrix_setElements_INT8 // C(Ilist,J) = X
+(
+    GrB_Matrix C,                   // matrix to modify
+    const GrB_Index *Ilist,         // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const int8_t *X,                // array of values of tuples
+    GrB_Index n,                    // number of tuples
+    const GrB_BinaryOp dup          // accum operator for existing entries
+) ;
+
+GrB_Info GxB_Matrix_setElements_UINT8 // C(Ilist,J) = X
+(
+    GrB_Matrix C,                   // matrix to modify
+    const GrB_Index *Ilist,         // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const uint8_t *X,               // array of values of tuples
+    GrB_Index n,                    // number of tuples
+    const GrB_BinaryOp dup          // accum operator for existing entries
+) ;
+
+GrB_Info GxB_Matrix_setElements_INT16 // C(Ilist,J) = X
+(
+    GrB_Matrix C,                   // matrix to modify
+    const GrB_Index *Ilist,         // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const int16_t *X,               // array of values of tuples
+    GrB_Index n,                    // number of tuples
+    const GrB_BinaryOp dup          // accum operator for existing entries
+) ;
+
+GrB_Info GxB_Matrix_setElements_UINT16 // C(Ilist,J) = X
+(
+    GrB_Matrix C,                   // matrix to modify
+    const GrB_Index *Ilist,         // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const uint16_t *X,              // array of values of tuples
+    GrB_Index n,                    // number of tuples
+    const GrB_BinaryOp dup          // accum operator for existing entries
+) ;
+
+GrB_Info GxB_Matrix_setElements_INT32 // C(Ilist,J) = X
+(
+    GrB_Matrix C,                   // matrix to modify
+    const GrB_Index *Ilist,         // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const int32_t *X,               // array of values of tuples
+    GrB_Index n,                    // number of tuples
+    const GrB_BinaryOp dup          // accum operator for existing entries
+) ;
+
+GrB_Info GxB_Matrix_setElements_UINT32 // C(Ilist,J) = X
+(
+    GrB_Matrix C,                   // matrix to modify
+    const GrB_Index *Ilist,         // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const uint32_t *X,              // array of values of tuples
+    GrB_Index n,                    // number of tuples
+    const GrB_BinaryOp dup          // accum operator for existing entries
+) ;
+
+GrB_Info GxB_Matrix_setElements_INT64 // C(Ilist,J) = X
+(
+    GrB_Matrix C,                   // matrix to modify
+    const GrB_Index *Ilist,         // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const int64_t *X,               // array of values of tuples
+    GrB_Index n,                    // number of tuples
+    const GrB_BinaryOp dup          // accum operator for existing entries
+) ;
+
+GrB_Info GxB_Matrix_setElements_UINT64 // C(Ilist,J) = X
+(
+    GrB_Matrix C,                   // matrix to modify
+    const GrB_Index *Ilist,         // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const uint64_t *X,              // array of values of tuples
+    GrB_Index n,                    // number of tuples
+    const GrB_BinaryOp dup          // accum operator for existing entries
+) ;
+
+GrB_Info GxB_Matrix_setElements_FP32 // C(Ilist,J) = X
+(
+    GrB_Matrix C,                   // matrix to modify
+    const GrB_Index *Ilist,         // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const float *X,                 // array of values of tuples
+    GrB_Index n,                    // number of tuples
+    const GrB_BinaryOp dup          // accum operator for existing entries
+) ;
+
+GrB_Info GxB_Matrix_setElements_FP64 // C(Ilist,J) = X
+(
+    GrB_Matrix C,                   // matrix to modify
+    const GrB_Index *Ilist,         // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const double *X,                // array of values of tuples
+    GrB_Index n,                    // number of tuples
+    const GrB_BinaryOp dup          // accum operator for existing entries
+) ;
+
+GrB_Info GxB_Matrix_setElements_FC32 // C(Ilist,J) = X
+(
+    GrB_Matrix C,                   // matrix to modify
+    const GrB_Index *Ilist,         // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const GxB_FC32_t *X,            // array of values of tuples
+    GrB_Index n,                    // number of tuples
+    const GrB_BinaryOp dup          // accum operator for existing entries
+) ;
+
+GrB_Info GxB_Matrix_setElements_FC64 // C(Ilist,J) = X
+(
+    GrB_Matrix C,                   // matrix to modify
+    const GrB_Index *Ilist,         // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const GxB_FC64_t *X,            // array of values of tuples
+    GrB_Index n,                    // number of tuples
+    const GrB_BinaryOp dup          // accum operator for existing entries
+) ;
+
+GrB_Info GxB_Matrix_setElements_UDT // C(Ilist,J) = X
+(
+    GrB_Matrix C,                   // matrix to modify
+    const GrB_Index *Ilist,         // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const void *X,                  // array of values of tuples
+    GrB_Index n,                    // number of tuples
+    const GrB_BinaryOp dup          // accum operator for existing entries
+) ;
+
+// Type-generic version:  X can be a pointer to any supported C type or void *
+// for a user-defined type.
+
+/*
+GrB_Info GxB_Matrix_setElements     // C(Ilist,J) = X
+(
+    GrB_Matrix C,                   // matrix to modify
+    const GrB_Index *Ilist,         // array of row indices of tuples
+    const GrB_Index *J,             // array of column indices of tuples
+    const <type> *X,                // array of values of tuples
+    GrB_Index n,                    // number of tuples
+    const GrB_BinaryOp dup          // accum operator for existing entries
+) ;
+*/
+
+#if GxB_STDC_VERSION >= 201112L
+#define GxB_Matrix_setElements(C,Ilist,J,X,n,dup)       \
+    _Generic                                            \
+    (                                                   \
+        (X),                                            \
+            GB_PCASES (GxB, Matrix_setElements)         \
+    )                                                   \
+    (C, Ilist, J, ((const void *) (X)), n, dup)
+#endif
+
+GrB_Info GxB_Matrix_removeElements
+(
+    GrB_Matrix C,                   // matrix to remove entries from
+    const GrB_Index *Ilist,         // array of row indices
+    const GrB_Index *J,             // array of column indices
+    GrB_Index n                     // number of entries to remove
+) ;
+
 //------------------------------------------------------------------------------
 // GrB_Matrix_extractTuples
 //------------------------------------------------------------------------------
@@ -3772,6 +3984,9 @@ typedef enum            // for global options or matrix options
     GxB_JIT_USE_CMAKE = 7032,        // CPU JIT: use cmake or direct compile
     GxB_JIT_ERROR_LOG = 7033,        // CPU JIT: error log file
 
+    GxB_CHUNK_FAMILY = 7052,         // chunk for each kernel family (double *)
+    GxB_NUMA_POLICY = 7056,          // NUMA policy for large blocks of memory
+
     GxB_JIT_CUDA_PREFACE = 7100,     // CUDA JIT C++ preface
 
     //------------------------------------------------------------
@@ -3786,6 +4001,9 @@ typedef enum            // for global options or matrix options
     //------------------------------------------------------------
 
     GxB_SPARSITY_CONTROL = 7036,    // sparsity control: 0 to 15; see below
+    GxB_TRANSPOSE_CACHE = 7049,     // if true, keep A' once computed
+    GxB_SPARSITY_ADAPTIVE = 7050,   // if true, choose sparsity by cost model
+    GxB_HYPER_PIN = 7051,           // if true, keep A hypersparse
 
 } GxB_Option_Field ;
 
@@ -3827,6 +4045,38 @@ GB_GLOBAL const double GxB_HYPER_DEFAULT ;
 // size of b array for GxB_set/get (GxB_BITMAP_SWITCH, b)
 #define GxB_NBITMAP_SWITCH 8    // size of bitmap_switch parameter array
 
+// kernel families for GrB_set/get (GrB_GLOBAL, c, GxB_CHUNK_FAMILY, ...),
+// where c [GxB_CHUNK_APPLY] is the chunk for GrB_apply, and so on:
+typedef enum
+{
+    GxB_CHUNK_APPLY = 0,        // GrB_apply
+    GxB_CHUNK_ADD = 1,          // GrB_eWiseAdd, GxB_eWiseUnion
+    GxB_CHUNK_EMULT = 2,        // GrB_eWiseMult
+    GxB_CHUNK_SAXPY3 = 3,       // GrB_mxm, mxv, vxm: saxpy methods
+    GxB_CHUNK_DOT = 4,          // GrB_mxm, mxv, vxm: dot product methods
+    GxB_CHUNK_REDUCE = 5,       // GrB_reduce to scalar
+    GxB_CHUNK_BUILD = 6,        // GrB_Matrix_build, GrB_Vector_build
+    GxB_CHUNK_TRANSPOSE = 7,    // GrB_transpose
+}
+GxB_Chunk_Family ;
+
+// size of c array for GrB_set/get (GrB_GLOBAL, c, GxB_CHUNK_FAMILY, ...)
+#define GxB_NCHUNK_FAMILY 8     // # of kernel families
+
+// GxB_chunk_calibrate: measure the chunk of each kernel family on this machine,
+// and set the GxB_CHUNK_FAMILY table.
+GrB_Info GxB_chunk_calibrate (void) ;
+
+// for GrB_set/get (GrB_GLOBAL, policy, GxB_NUMA_POLICY):
+typedef enum
+{
+    GxB_NUMA_DEFAULT = 0,       // use the policy of the operating system
+    GxB_NUMA_INTERLEAVE = 1,    // interleave pages across all NUMA nodes
+    GxB_NUMA_FIRST_TOUCH = 2,   // first-touch each block with all threads
+    GxB_NUMA_LOCAL = 3,         // prefer the NUMA node of the Context
+}
+GxB_NUMA_Policy ;
+
 // any sparsity value:
 #define GxB_ANY_SPARSITY (GxB_HYPERSPARSE + GxB_SPARSE + GxB_BITMAP + GxB_FULL)
 
@@ -3908,6 +4158,12 @@ typedef enum
     GxB_CONTEXT_CHUNK = GxB_CHUNK,   // chunk size for small problems.
                     // If < 1, then the default is used.
 
+    // CPU binding (Linux only):
+    GxB_CONTEXT_CPUS = 7054,        // list of CPUs (int32_t array) to bind the
+                    // threads to when the Context is engaged.
+    GxB_CONTEXT_NUMA_NODE = 7055,   // bind the threads to the CPUs of a NUMA
+                    // node (int32_t).  If < 0, the Context is not bound.
+
     // GPU control (DRAFT: in progress, do not use)
     GxB_CONTEXT_GPU_ID      = GxB_GPU_ID,
 }
@@ -4933,6 +5189,65 @@ GrB_Info GxB_Matrix_eWiseUnion      // C<M> = accum (C, A+B)
     (C, Mask, accum, op, A, alpha, B, beta, desc)
 #endif
 
+//==============================================================================
+// GxB_axpby: fused alpha*A+beta*B
+//==============================================================================
+
+// GxB_axpby computes C<M> = accum (C, alpha*A+beta*B) in a single call, where
+// '+' and '*' are the additive monoid and multiplicative operator of a
+// semiring.  The result T = alpha*A+beta*B has the pattern of the set union
+// of A and B, as in GrB_eWiseAdd:
+
+//      if A(i,j) and B(i,j) are both present:
+//          T(i,j) = (alpha * A(i,j)) + (beta * B(i,j))
+//      else if A(i,j) is present but not B(i,j)
+//          T(i,j) = alpha * A(i,j)
+//      else if B(i,j) is present but not A(i,j)
+//          T(i,j) = beta * B(i,j)
+
+// This is identical to GrB_apply (AS, NULL, NULL, mult, alpha, A), followed by
+// GrB_apply (BS, NULL, NULL, mult, beta, B) and GrB_eWiseAdd (C, M, accum,
+// add, AS, BS), but the temporary matrices AS and BS are not constructed.  If
+// A and B have the same pattern, T is computed in a single pass.  The
+// multiplicative operator cannot be positional.
+
+GrB_Info GxB_Vector_axpby           // w<mask> = accum (w, alpha*u+beta*v)
+(
+    GrB_Vector w,                   // input/output vector for results
+    const GrB_Vector mask,          // optional mask for w, unused if NULL
+    const GrB_BinaryOp accum,       // optional accum for z=accum(w,t)
+    const GrB_Semiring semiring,    // defines '+' and '*' for alpha*u+beta*v
+    const GrB_Scalar alpha,         // scalar to multiply with u
+    const GrB_Vector u,             // first input:  vector u
+    const GrB_Scalar beta,          // scalar to multiply with v
+    const GrB_Vector v,             // second input: vector v
+    const GrB_Descriptor desc       // descriptor for w and mask
+) ;
+
+GrB_Info GxB_Matrix_axpby           // C<M> = accum (C, alpha*A+beta*B)
+(
+    GrB_Matrix C,                   // input/output matrix for results
+    const GrB_Matrix Mask,          // optional mask for C, unused if NULL
+    const GrB_BinaryOp accum,       // optional accum for Z=accum(C,T)
+    const GrB_Semiring semiring,    // defines '+' and '*' for alpha*A+beta*B
+    const GrB_Scalar alpha,         // scalar to multiply with A
+    const GrB_Matrix A,             // first input:  matrix A
+    const GrB_Scalar beta,          // scalar to multiply with B
+    const GrB_Matrix B,             // second input: matrix B
+    const GrB_Descriptor desc       // descriptor for C, M, A, and B
+) ;
+
+#if GxB_STDC_VERSION >= 201112L
+#define GxB_axpby(C,Mask,accum,semiring,alpha,A,beta,B,desc)                \
+    _Generic                                                                \
+    (                                                                       \
+        (C),                                                                \
+                  GrB_Matrix : GxB_Matrix_axpby ,                           \
+                  GrB_Vector : GxB_Vector_axpby                             \
+    )                                                                       \
+    (C, Mask, accum, semiring, alpha, A, beta, B, desc)
+#endif
+
 //==============================================================================
 // GrB_extract: extract a submatrix or subvector
 //==============================================================================
@@ -7637,6 +7952,44 @@ GrB_Info GrB_Matrix_reduce_BinaryOp // w<mask> = accum (w,reduce(A))
     const GrB_Descriptor desc       // descriptor for w, mask, and A
 ) ;
 
+// GxB_Matrix_reduce_Monoids reduces A with n monoids at once, in a single pass
+// over the entries of A: w [k] = reduce (A) and s [k] = reduce (A) with
+// monoid [k], for k = 0 to n-1.  Either w or s may be NULL, and any w [k] or
+// s [k] may be NULL, if that result is not needed.  If monoid [k] is NULL,
+// the entries are counted instead.  No mask or accum is used.  Only GrB_INP0
+// of the descriptor is used, to reduce the columns of A instead of the rows.
+
+GrB_Info GxB_Matrix_reduce_Monoids  // w [k] = reduce (A), s [k] = reduce (A)
+(
+    GrB_Vector *w,                  // array of n vectors, or NULL
+    GrB_Scalar *s,                  // array of n scalars, or NULL
+    const GrB_Monoid *monoid,       // array of n monoids
+    int n,                          // # of reductions
+    const GrB_Matrix A,             // matrix to reduce
+    const GrB_Descriptor desc       // descriptor for A
+) ;
+
+// GxB_Matrix_reduce_SelectApply computes w<mask> = accum (w, reduce (op
+// (select (A)))), with the same result as GrB_select, GrB_apply, and
+// GrB_reduce, but without constructing the intermediate matrices when the
+// three steps can be fused into a single pass over A (if the rows of a matrix
+// held by row are reduced, or the columns of a matrix held by column, and the
+// operators are built-in).  Either op or selectop may be NULL to skip that
+// step.  GrB_INP0 of the descriptor selects the columns of A to be reduced.
+
+GrB_Info GxB_Matrix_reduce_SelectApply  // w<M> = accum (w,reduce(op(sel(A))))
+(
+    GrB_Vector w,                   // input/output vector for results
+    const GrB_Vector mask,          // optional mask for w, unused if NULL
+    const GrB_BinaryOp accum,       // optional accum for z=accum(w,t)
+    const GrB_Monoid monoid,        // reduce monoid for t=reduce(...)
+    const GrB_UnaryOp op,           // unary op to apply, or NULL
+    const GrB_IndexUnaryOp selectop,    // op to select entries, or NULL
+    const GrB_Scalar Thunk,         // thunk for selectop
+    const GrB_Matrix A,             // first input:  matrix A
+    const GrB_Descriptor desc       // descriptor for w, mask, and A
+) ;
+
 //------------------------------------------------------------------------------
 // reduce a vector to a scalar
 //------------------------------------------------------------------------------
@@ -9710,6 +10063,36 @@ GrB_Info GxB_Matrix_pack_FullC  // pack a full matrix, held by column
     //      Ax is an array of size nrows*ncols, where A(i,j) is held in
     //      Ax [i+j*nrows].  All entries in A are present.
 
+//------------------------------------------------------------------------------
+// GxB_Matrix_pack_COO: pack a matrix from sorted COO tuples
+//------------------------------------------------------------------------------
+
+GrB_Info GxB_Matrix_pack_COO      // pack a matrix from sorted COO tuples
+(
+    GrB_Matrix A,       // matrix to create (type, nrows, ncols unchanged)
+    GrB_Index **Ai,     // row indices, Ai_size >= nvals*sizeof(int64_t)
+    GrB_Index **Aj,     // column indices, Aj_size >= nvals*sizeof(int64_t)
+    void **Ax,          // values, Ax_size >= nvals * (type size)
+                        // or Ax_size >= (type size), if iso is true
+    GrB_Index Ai_size,  // size of Ai in bytes
+    GrB_Index Aj_size,  // size of Aj in bytes
+    GrB_Index Ax_size,  // size of Ax in bytes
+    bool iso,           // if true, A is iso
+    GrB_Index nvals,    // number of tuples
+    const GrB_Descriptor desc
+) ;
+
+    // COO: an nrows-by-ncols matrix with nvals entries, held as a list of
+    // tuples (Ai [k], Aj [k], Ax [k]) for k = 0:nvals-1, which must be sorted
+    // in the same order as the format of A: by column, then by row, if A is
+    // held by column, or by row, then by column, if A is held by row.  No
+    // duplicates may appear.  The tuples are checked (in parallel), and an
+    // error is returned if they are out of bounds or out of order, with A and
+    // the arrays unchanged.  On success, A takes ownership of Ax and of Ai
+    // (if A is held by column) or Aj (if held by row), and the other index
+    // array is freed.  No copy of the tuples is made.  If nvals is zero, the
+    // Ai, Aj, and Ax arrays need not be present and can be NULL.
+
 //------------------------------------------------------------------------------
 // GxB_Vector_pack_CSC: import/pack a vector in CSC format
 //------------------------------------------------------------------------------
@@ -10949,6 +11332,29 @@ GrB_Info GxB_Matrix_sort
     )                                                       \
     (arg1, __VA_ARGS__)
 
+//==============================================================================
+// GxB_Matrix_selectTopK: select the first k entries in each row or column
+//==============================================================================
+
+// C(i,:) holds the k entries of A(i,:) that come first in the order defined
+// by the comparator op, for each row i (or each column, if desc has GrB_INP0
+// set to GrB_TRAN), with the same rules for op and the tie-breaking as
+// GxB_Matrix_sort.  With op = GrB_GT_FP64, for example, C(i,:) holds the k
+// largest entries of A(i,:), in their original positions.  Each row or column
+// is only partially sorted, in O(nnz(A)) expected time.  C and A must have the
+// same type and dimensions; C may be aliased with A.
+
+GrB_Info GxB_Matrix_selectTopK
+(
+    // output:
+    GrB_Matrix C,           // matrix with the selected entries
+    // input
+    GrB_BinaryOp op,        // comparator op
+    GrB_Matrix A,           // matrix to select from
+    uint64_t k,             // # of entries to select in each row or column
+    const GrB_Descriptor desc
+) ;
+
 //==============================================================================
 // GxB_Matrix_reshape and GxB_Matrix_reshapeDup:  reshape a matrix
 //==============================================================================
@@ -11969,6 +12375,80 @@ void       GxB_Iterator_get_UDT    (GxB_Iterator iterator,
         (iterator)->type_size)                                              \
 )
 
+//==============================================================================
+// GxB_Iterator_partition and GxB_Iterator_getBlock: parallel iteration
+//==============================================================================
+
+// GxB_Iterator_partition splits the rows (or columns) of a matrix A into
+// ntasks contiguous ranges, each with about the same number of entries, for
+// use by ntasks user threads.  The iterator must be a row or column iterator
+// attached to A.  On input, ntasks is the number of ranges requested, and
+// Slice has size at least ntasks+1.  On output, ntasks is the number of
+// ranges (which may be smaller), and task tid is given the range of k =
+// Slice [tid] to Slice [tid+1]-1, for use in GxB_rowIterator_kseek or
+// GxB_colIterator_kseek.
+
+// GxB_Iterator_getBlock returns pointers to the entries of the current row
+// (or column) of a row (or column) iterator, from the current entry to the
+// end of the row, without moving the iterator.  The prior seek or next must
+// have returned GrB_SUCCESS.  Ilist is NULL if A is bitmap or full, in which
+// case the indices are implicit:  the index of position t is that of the
+// current entry, plus t.  Blist is NULL unless A is bitmap, in which case
+// position t is an entry only if Blist [t] is nonzero.  If iso is true, all
+// entries have the value Xlist [0].  The arrays belong to A and must not be
+// modified.  Any output parameter may be NULL.
+
+// Example: parallel row sums of a sparse GrB_FP64 matrix A held by row, with
+// no error checking:
+/*
+    GxB_Iterator it ;
+    GxB_Iterator_new (&it) ;
+    GxB_rowIterator_attach (it, A, NULL) ;
+    int ntasks = nthreads ;
+    GrB_Index Slice [ntasks+1] ;
+    GxB_Iterator_partition (Slice, &ntasks, it) ;
+    #pragma omp parallel for num_threads(ntasks) schedule(static,1)
+    for (int tid = 0 ; tid < ntasks ; tid++)
+    {
+        GxB_Iterator iterator ;
+        GxB_Iterator_new (&iterator) ;
+        GxB_rowIterator_attach (iterator, A, NULL) ;
+        for (GrB_Index k = Slice [tid] ; k < Slice [tid+1] ; k++)
+        {
+            if (GxB_rowIterator_kseek (iterator, k) != GrB_SUCCESS) continue ;
+            GrB_Index i = GxB_rowIterator_getRowIndex (iterator), n ;
+            const void *X ;
+            bool iso ;
+            GxB_Iterator_getBlock (iterator, NULL, &X, NULL, &n, &iso) ;
+            double s = 0 ;
+            for (GrB_Index t = 0 ; t < n ; t++)
+            {
+                s += ((const double *) X) [iso ? 0 : t] ;
+            }
+            rowsum [i] = s ;
+        }
+        GxB_Iterator_free (&iterator) ;
+    }
+    GxB_Iterator_free (&it) ;
+*/
+
+GrB_Info GxB_Iterator_partition
+(
+    GrB_Index *Slice,               // size ntasks+1
+    int *ntasks,                    // # of tasks requested and returned
+    GxB_Iterator iterator           // row or column iterator attached to A
+) ;
+
+GrB_Info GxB_Iterator_getBlock
+(
+    GxB_Iterator iterator,          // row or column iterator at an entry
+    const GrB_Index **Ilist,        // indices of the block, or NULL
+    const void **Xlist,             // values of the block
+    const int8_t **Blist,           // bitmap of the block, or NULL
+    GrB_Index *n,                   // # of positions in the block
+    bool *iso                       // if true, all entries have Xlist [0]
+) ;
+
 #if defined ( __cplusplus )
 }
 #endif
@@ -19,7 +19,11 @@
 // 13 built-in types, and the _UDT method for all user-defined types.
 // It also constructs GxB_Matrix_isStoredElement.
 
-// FUTURE: tolerate zombies
+// Zombies in A and a small number of pending tuples are not assembled first.
+// They are treated as a delta to A: zombies are deleted entries, and the
+// pending tuples are searched directly by GB_Pending_lookup.  Only if A is
+// jumbled, or if the pending tuples are too many (see GB_PENDING_LOOKUP_OK),
+// is all pending work finished first with GB_wait.
 
 GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry, x = A(row,col)
 (
@@ -41,12 +45,9 @@ GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry, x = A(row,col)
     GB_RETURN_IF_NULL (x) ;
     #endif
 
-    // TODO: do not wait unless jumbled.  First try to find the element.
-    // If found (live or zombie), no need to wait.  If not found and pending
-    // tuples exist, wait and then extractElement again.
-
-    // delete any lingering zombies, assemble any pending tuples, and unjumble
-    if (A->Pending != NULL || A->nzombies > 0 || A->jumbled)
+    // delete any lingering zombies, assemble any pending tuples, and unjumble,
+    // if A is jumbled or has too many pending tuples
+    if (A->jumbled || (A->Pending != NULL && !GB_PENDING_LOOKUP_OK (A)))
     { 
         GrB_Info info ;
         GB_WHERE1 (GB_WHERE_STRING) ;
@@ -55,7 +56,9 @@ GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry, x = A(row,col)
         GB_BURBLE_END ;
     }
 
-    ASSERT (!GB_ANY_PENDING_WORK (A)) ;
+    ASSERT (!GB_JUMBLED (A)) ;
+    ASSERT (GB_ZOMBIES_OK (A)) ;
+    ASSERT (GB_PENDING_OK (A)) ;
 
     // look for index i in vector j
     int64_t i, j ;
@@ -109,13 +112,14 @@ GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry, x = A(row,col)
             const int64_t A_hash_bits = (A->Y == NULL) ? 0 : (A->Y->vdim - 1) ;
             int64_t k = GB_hyper_hash_lookup (Ah, A->nvec, Ap, A_Yp, A_Yi, A_Yx,
                 A_hash_bits, j, &pA_start, &pA_end) ;
-            found = (k >= 0) ;
-            if (!found)
+            if (k < 0 && A->Pending == NULL)
             { 
-                // vector j is empty
+                // vector j is empty, and A has no pending tuples
                 return (GrB_NO_VALUE) ;
             }
-            ASSERT (j == Ah [k]) ;
+            // if vector j is not present, pA_start and pA_end are
+            // returned so that A(:,j) is empty
+            ASSERT (GB_IMPLIES (k >= 0, j == Ah [k])) ;
 
         }
         else
@@ -135,7 +139,11 @@ GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry, x = A(row,col)
 
         // Time taken for this step is at most O(log(nnz(A(:,j))).
         const int64_t *restrict Ai = A->i ;
-        GB_BINARY_SEARCH (i, Ai, pleft, pright, found) ;
+        bool is_zombie ;
+        GB_BINARY_SEARCH_ZOMBIE (i, Ai, pleft, pright, found, A->nzombies,
+            is_zombie) ;
+        // a zombie is a deleted entry
+        found = found && !is_zombie ;
 
     }
     else
@@ -193,6 +201,35 @@ GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry, x = A(row,col)
         #endif
         return (GrB_SUCCESS) ;
     }
+    else if (A->Pending != NULL)
+    {
+        // A(i,j) is not in A itself; look for it in the pending tuples
+        GrB_Info info ;
+        #ifdef GB_XTYPE
+        GB_Type_code acode = A->type->code ;
+        size_t asize = A->type->size ;
+        GB_void ascalar [GB_VLA(asize)] ;
+        GB_OK (GB_Pending_lookup (ascalar, &found, A, i, j)) ;
+        #else
+        GB_OK (GB_Pending_lookup (NULL, &found, A, i, j)) ;
+        #endif
+        if (!found)
+        { 
+            // entry not found
+            return (GrB_NO_VALUE) ;
+        }
+        #ifdef GB_XTYPE
+        if (!GB_code_compatible (GB_XCODE, acode))
+        { 
+            // x (GB_XCODE) and A (acode) must be compatible
+            return (GrB_DOMAIN_MISMATCH) ;
+        }
+        // typecast the value from the pending tuples into x
+        GB_cast_scalar (x, GB_XCODE, ascalar, acode, asize) ;
+        #pragma omp flush
+        #endif
+        return (GrB_SUCCESS) ;
+    }
     else
     { 
         // entry not found
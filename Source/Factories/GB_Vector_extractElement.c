@@ -19,7 +19,8 @@
 // 13 built-in types, and the _UDT method for all user-defined types.
 // It also constructs GxB_Vector_isStoredElement.
 
-// FUTURE: tolerate zombies
+// Zombies in V and a small number of pending tuples are not assembled first;
+// see GB_Matrix_extractElement.c.
 
 GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry, x = V(i)
 (
@@ -40,8 +41,9 @@ GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry, x = V(i)
     GB_RETURN_IF_NULL (x) ;
     #endif
 
-    // delete any lingering zombies, assemble any pending tuples, and unjumble
-    if (GB_ANY_PENDING_WORK (V))
+    // delete any lingering zombies, assemble any pending tuples, and unjumble,
+    // if V is jumbled or has too many pending tuples
+    if (V->jumbled || (V->Pending != NULL && !GB_PENDING_LOOKUP_OK (V)))
     { 
         GrB_Info info ;
         GB_WHERE1 (GB_WHERE_STRING) ;
@@ -50,7 +52,9 @@ GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry, x = V(i)
         GB_BURBLE_END ;
     }
 
-    ASSERT (!GB_ANY_PENDING_WORK (V)) ;
+    ASSERT (!GB_JUMBLED (V)) ;
+    ASSERT (GB_ZOMBIES_OK (V)) ;
+    ASSERT (GB_PENDING_OK (V)) ;
 
     // check index
     if (i >= V->vlen)
@@ -73,7 +77,11 @@ GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry, x = V(i)
         int64_t pright = Vp [1] - 1 ;
         // Time taken for this step is at most O(log(nnz(V))).
         const int64_t *restrict Vi = V->i ;
-        GB_BINARY_SEARCH (i, Vi, pleft, pright, found) ;
+        bool is_zombie ;
+        GB_BINARY_SEARCH_ZOMBIE (i, Vi, pleft, pright, found, V->nzombies,
+            is_zombie) ;
+        // a zombie is a deleted entry
+        found = found && !is_zombie ;
     }
     else
     {
@@ -126,6 +134,35 @@ GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry, x = V(i)
         #endif
         return (GrB_SUCCESS) ;
     }
+    else if (V->Pending != NULL)
+    {
+        // V(i) is not in V itself; look for it in the pending tuples
+        GrB_Info info ;
+        #ifdef GB_XTYPE
+        GB_Type_code vcode = V->type->code ;
+        size_t vsize = V->type->size ;
+        GB_void vscalar [GB_VLA(vsize)] ;
+        GB_OK (GB_Pending_lookup (vscalar, &found, (GrB_Matrix) V, i, 0)) ;
+        #else
+        GB_OK (GB_Pending_lookup (NULL, &found, (GrB_Matrix) V, i, 0)) ;
+        #endif
+        if (!found)
+        { 
+            // entry not found
+            return (GrB_NO_VALUE) ;
+        }
+        #ifdef GB_XTYPE
+        if (!GB_code_compatible (GB_XCODE, vcode))
+        { 
+            // x (GB_XCODE) and V (vcode) must be compatible
+            return (GrB_DOMAIN_MISMATCH) ;
+        }
+        // typecast the value from the pending tuples into x
+        GB_cast_scalar (x, GB_XCODE, vscalar, vcode, vsize) ;
+        #pragma omp flush
+        #endif
+        return (GrB_SUCCESS) ;
+    }
     else
     { 
         // entry not found
@@ -7,6 +7,11 @@
 
 //------------------------------------------------------------------------------
 
+// Each task checks its entries in blocks of GB_ISO_BLOCK entries.  The check
+// of a single block, GB_CHECK_BLOCK, has no early exit so that it can be
+// vectorized by the compiler.  Each task checks the shared iso flag between
+// blocks, and exits early if any other task has found an entry that differs.
+
 {
 
     //--------------------------------------------------------------------------
@@ -28,16 +33,18 @@
         bool my_iso ;
         GB_ATOMIC_READ
         my_iso = iso ;
-        if (my_iso)
+        for (int64_t p1 = pstart ; my_iso && p1 < pend ; p1 += GB_ISO_BLOCK)
         {
-            // GB_A_TYPE a = Ax [0] ;
-            GB_GET_FIRST_VALUE (GB_A_TYPE, a, Ax) ;
-            for (int64_t p = pstart ; my_iso && p < pend ; p++)
+            // my_iso = all entries in Ax [p1:p2-1] are equal to Ax [0]
+            int64_t p2 = GB_IMIN (p1 + GB_ISO_BLOCK, pend) ;
+            GB_CHECK_BLOCK (my_iso, p1, p2) ;
+            if (my_iso)
             { 
-                // my_iso = my_iso && (a == Ax [p])
-                GB_COMPARE_WITH_FIRST_VALUE (my_iso, a, Ax, p) ;
+                // check if any other task has found an entry that differs
+                GB_ATOMIC_READ
+                my_iso = iso ;
             }
-            if (!my_iso)
+            else
             { 
                 // tell the other tasks to exit early
                 GB_ATOMIC_WRITE
@@ -0,0 +1,232 @@
+//------------------------------------------------------------------------------
+// GB_topk_template: select the first k entries of each vector of a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+//  macros:
+//  GB_TOPK (func)      defined as GB_topk_func_TYPE_ascend or _descend,
+//                      or GB_topk_func_UDT
+//  GB_TYPE             bool, int8_, ... or GB_void for UDT
+//  GB_ADDR(A,p)        A+p for builtin, A + p * csize otherwise
+//  GB_GET(x,X,i)       x = X [i] for built-in, memcpy for UDT
+//  GB_SWAP(A,i,k)      swap A[i] and A[k]
+//  GB_LT               compare two entries, x < y, or x > y for descending
+
+// These methods are the same as GB_sort_template, except that each vector is
+// only partially sorted, with quickselect instead of quicksort.
+
+//------------------------------------------------------------------------------
+// GB_TOPK (partition): use a pivot to partition an array
+//------------------------------------------------------------------------------
+
+// C.A.R Hoare partition method, partitions an array in-place via a pivot.
+// s = partition (A, n) partitions A [0:n-1] such that all entries in
+// A [0:s-1] are <= all entries in A [s:n-1].  This is identical to the
+// GB_SORT (partition) method in GB_sort_template.c.
+
+static inline int64_t GB_TOPK (partition)
+(
+    GB_TYPE *restrict A_0,  // size n arrays to partition
+    int64_t *restrict A_1,  // size n array
+    const int64_t n,        // size of the array(s) to partition
+    uint64_t *seed          // random number seed, modified on output
+    #if GB_SORT_UDT
+    , size_t csize              // size of GB_TYPE
+    , size_t xsize              // size of op->xtype
+    , GxB_binary_function flt   // function to test for < (ascend), > (descend)
+    , GB_cast_function fcast    // cast entry to inputs of flt
+    #endif
+)
+{
+
+    // select a pivot at random
+    int64_t pivot = ((n < GB_RAND_MAX) ? GB_rand15 (seed) : GB_rand (seed)) % n;
+
+    // Pivot = A [pivot]
+    GB_GET (Pivot0, A_0, pivot) ;       // Pivot0 = A_0 [pivot]
+    int64_t Pivot1 = A_1 [pivot] ;
+
+    int64_t left = -1 ;
+    int64_t right = n ;
+
+    // keep partitioning until the left and right sides meet
+    while (true)
+    {
+        // loop invariant:  A [0..left] < pivot and A [right..n-1] > Pivot,
+        // so the region to be considered is A [left+1 ... right-1].
+
+        // increment left until finding an entry A [left] >= Pivot
+        bool less ;
+        do
+        {
+            left++ ;
+            GB_GET (a0, A_0, left) ;
+            GB_LT (less, a0, A_1 [left],    Pivot0, Pivot1) ;
+        }
+        while (less) ;
+
+        // decrement right until finding an entry A [right] <= Pivot
+        do
+        {
+            right-- ;
+            GB_GET (a1, A_0, right) ;
+            GB_LT (less, Pivot0, Pivot1,    a1, A_1 [right]) ;
+        }
+        while (less) ;
+
+        if (left >= right)
+        {
+            // A has been partitioned into A [0:right] and A [right+1:n-1]
+            return (right + 1) ;
+        }
+
+        // since A [left] > pivot and A [right] < pivot, swap them
+        GB_SWAP (A_0, left, right) ;
+        int64_t t1 = A_1 [left] ; A_1 [left] = A_1 [right] ; A_1 [right] = t1 ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_TOPK (quickselect): single-threaded partial sort
+//------------------------------------------------------------------------------
+
+// On output, A [0:k-1] holds the k smallest entries of A [0:n-1], in no
+// particular order, where k < n.  The ties in the values are broken by the
+// indices in A_1, so the entries A [0:n-1] are all distinct.  The expected
+// time is O(n).
+
+static void GB_TOPK (quickselect)
+(
+    GB_TYPE *restrict A_0,  // size n arrays to partially sort
+    int64_t *restrict A_1,  // size n array
+    int64_t n,              // size of the array(s)
+    int64_t k,              // # of entries to select
+    uint64_t *seed          // random number seed
+    #if GB_SORT_UDT
+    , size_t csize              // size of GB_TYPE
+    , size_t xsize              // size of op->xtype
+    , GxB_binary_function flt   // function to test for < (ascend), > (descend)
+    , GB_cast_function fcast    // cast entry to inputs of flt
+    #endif
+)
+{
+
+    while (k > 0 && k < n)
+    {
+        if (n < 20)
+        {
+            // in-place insertion sort on A [0:n-1], where n is small
+            for (int64_t i = 1 ; i < n ; i++)
+            {
+                for (int64_t j = i ; j > 0 ; j--)
+                {
+                    GB_GET (a0, A_0, j) ;
+                    GB_GET (a1, A_0, j-1) ;
+                    bool less ;
+                    GB_LT (less, a0, A_1 [j],    a1, A_1 [j-1]) ;
+                    if (!less) break ;
+                    GB_SWAP (A_0, j-1, j) ;
+                    int64_t t1 = A_1 [j-1] ; A_1 [j-1] = A_1 [j] ; A_1 [j] = t1;
+                }
+            }
+            return ;
+        }
+
+        // partition A [0:n-1] into A [0:s-1] and A [s:n-1]
+        int64_t s = GB_TOPK (partition) (A_0, A_1, n, seed
+            #if GB_SORT_UDT
+            , csize, xsize, flt, fcast
+            #endif
+            ) ;
+
+        if (s > k)
+        {
+            // the k smallest entries are all in A [0:s-1]
+            n = s ;
+        }
+        else
+        {
+            // A [0:s-1] are all selected; select k-s more from A [s:n-1]
+            A_0 = GB_ADDR (A_0, s) ;
+            A_1 += s ;
+            n -= s ;
+            k -= s ;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_TOPK (matrix): partially sort all vectors of a matrix
+//------------------------------------------------------------------------------
+
+// Each vector C(:,j) with more than k entries is partially sorted in place,
+// so that its first k entries are the k entries that come first in the order
+// defined by the comparator.  Each vector is selected by a single thread.
+
+static void GB_TOPK (matrix)
+(
+    GrB_Matrix C,               // matrix partially sorted in-place
+    const int64_t k,            // # of entries to select in each vector
+    const int64_t *restrict C_slice,    // how C is sliced
+    const int ntasks,           // # of tasks
+    const int nthreads          // # of threads
+    #if GB_SORT_UDT
+    , GrB_BinaryOp op           // comparator for user-defined types only
+    #endif
+)
+{
+
+    //--------------------------------------------------------------------------
+    // get C
+    //--------------------------------------------------------------------------
+
+    ASSERT (GB_IS_SPARSE (C) || GB_IS_HYPERSPARSE (C)) ;
+    ASSERT (!C->iso) ;
+    const int64_t *restrict Cp = C->p ;
+    int64_t *restrict Ci = C->i ;
+    GB_TYPE *restrict Cx = (GB_TYPE *) C->x ;
+
+    #if GB_SORT_UDT
+    // get typesize, and function pointers for operators and typecasting
+    GrB_Type ctype = C->type ;
+    size_t csize = ctype->size ;
+    size_t xsize = op->xtype->size ;
+    GxB_binary_function flt = op->binop_function ;
+    GB_cast_function fcast = GB_cast_factory (op->xtype->code, ctype->code) ;
+    #endif
+
+    //--------------------------------------------------------------------------
+    // select the first k entries of each vector
+    //--------------------------------------------------------------------------
+
+    int tid ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+    for (tid = 0 ; tid < ntasks ; tid++)
+    {
+        const int64_t kfirst = C_slice [tid] ;
+        const int64_t klast  = C_slice [tid+1] ;
+        for (int64_t kk = kfirst ; kk < klast ; kk++)
+        {
+            const int64_t pC_start = Cp [kk] ;
+            const int64_t cknz = Cp [kk+1] - pC_start ;
+            if (cknz > k)
+            {
+                uint64_t seed = kk ;
+                GB_TOPK (quickselect) (GB_ADDR (Cx, pC_start), Ci + pC_start,
+                    cknz, k, &seed
+                    #if GB_SORT_UDT
+                    , csize, xsize, flt, fcast
+                    #endif
+                    ) ;
+            }
+        }
+    }
+}
+
+#undef GB_TOPK
+#undef GB_TYPE
+
@@ -0,0 +1,210 @@
+//------------------------------------------------------------------------------
+// GB_transpose_in_place_full_template: transpose a dense array in-place
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The nr-by-nc row-major array X is overwritten with its nc-by-nr row-major
+// transpose.  See GB_transpose_in_place_full.c for a description of the
+// method.
+
+{
+
+    //--------------------------------------------------------------------------
+    // get X and the workspace
+    //--------------------------------------------------------------------------
+
+    #ifdef GB_TRANSPOSE_GENERIC
+        // user-defined types of arbitrary size
+        #define GB_A_TYPE GB_void
+        #define GB_COPY(Z,pz,Y,py)                                          \
+            memcpy (Z + (pz)*asize, Y + (py)*asize, asize)
+        #define GB_SWAP(p,q)                                                \
+        {                                                                   \
+            GB_void t [GB_VLA(asize)] ;                                     \
+            memcpy (t, X + (p)*asize, asize) ;                              \
+            GB_COPY (X, p, X, q) ;                                          \
+            memcpy (X + (q)*asize, t, asize) ;                              \
+        }
+    #else
+        #define GB_COPY(Z,pz,Y,py) Z [pz] = Y [py]
+        #define GB_SWAP(p,q)                                                \
+        {                                                                   \
+            GB_A_TYPE t = X [p] ;                                           \
+            X [p] = X [q] ;                                                 \
+            X [q] = t ;                                                     \
+        }
+    #endif
+
+    GB_A_TYPE *restrict X = (GB_A_TYPE *) X_in ;
+    GB_A_TYPE *restrict W = (GB_A_TYPE *) W_in ;
+    int tid ;
+
+    if (nr == nc)
+    {
+
+        //----------------------------------------------------------------------
+        // X is square: swap X (i,j) and X (j,i), one pair of tiles at a time
+        //----------------------------------------------------------------------
+
+        const int64_t n = nr ;
+        const int64_t ntiles = (n + GB_TILE - 1) / GB_TILE ;
+        int64_t ti ;
+        #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+        for (ti = 0 ; ti < ntiles ; ti++)
+        {
+            const int64_t i1 = ti * GB_TILE ;
+            const int64_t i2 = GB_IMIN (i1 + GB_TILE, n) ;
+            for (int64_t tj = ti ; tj < ntiles ; tj++)
+            {
+                const int64_t j1 = tj * GB_TILE ;
+                const int64_t j2 = GB_IMIN (j1 + GB_TILE, n) ;
+                for (int64_t i = i1 ; i < i2 ; i++)
+                {
+                    for (int64_t j = GB_IMAX (j1, i+1) ; j < j2 ; j++)
+                    {
+                        GB_SWAP (i*n + j, j*n + i) ;
+                    }
+                }
+            }
+        }
+
+    }
+    else
+    {
+
+        //----------------------------------------------------------------------
+        // phase 1: rotate each column c down by c/b rows, if g > 1
+        //----------------------------------------------------------------------
+
+        if (g > 1)
+        {
+            #pragma omp parallel for num_threads(nthreads_col) schedule(static)
+            for (tid = 0 ; tid < nthreads_col ; tid++)
+            {
+                const int64_t pW = tid * nr * w ;
+                int64_t kfirst, klast ;
+                GB_PARTITION (kfirst, klast, nblocks, tid, nthreads_col) ;
+                for (int64_t k = kfirst ; k < klast ; k++)
+                {
+                    // W = X (:,c1:c2-1)
+                    const int64_t c1 = k * w ;
+                    const int64_t c2 = GB_IMIN (c1 + w, nc) ;
+                    const int64_t cw = c2 - c1 ;
+                    for (int64_t r = 0 ; r < nr ; r++)
+                    {
+                        for (int64_t c = c1 ; c < c2 ; c++)
+                        {
+                            GB_COPY (W, pW + r*cw + (c-c1), X, r*nc + c) ;
+                        }
+                    }
+                    // X (s,c) = W (r,c) where r = (s - c/b) mod nr
+                    for (int64_t s = 0 ; s < nr ; s++)
+                    {
+                        for (int64_t c = c1 ; c < c2 ; c++)
+                        {
+                            int64_t r = s - c / b ;
+                            if (r < 0) r += nr ;
+                            GB_COPY (X, s*nc + c, W, pW + r*cw + (c-c1)) ;
+                        }
+                    }
+                }
+            }
+        }
+
+        //----------------------------------------------------------------------
+        // phase 2: shuffle the entries in each row s
+        //----------------------------------------------------------------------
+
+        // The entry in column c = q*b+t of row s came from row r = (s-q) mod
+        // nr of the original X, and it moves to column (c*nr + r) mod nc.
+
+        const int64_t nr_mod = nr % nc ;
+        #pragma omp parallel for num_threads(nthreads_row) schedule(static)
+        for (tid = 0 ; tid < nthreads_row ; tid++)
+        {
+            const int64_t pW = tid * nc ;
+            int64_t sfirst, slast ;
+            GB_PARTITION (sfirst, slast, nr, tid, nthreads_row) ;
+            for (int64_t s = sfirst ; s < slast ; s++)
+            {
+                int64_t c = 0, cnr = 0 ;        // cnr = (c*nr) mod nc
+                for (int64_t q = 0 ; q < g ; q++)
+                {
+                    int64_t r = s - q ;
+                    if (r < 0) r += nr ;
+                    const int64_t r_mod = r % nc ;
+                    for (int64_t t = 0 ; t < b ; t++, c++)
+                    {
+                        int64_t c_new = cnr + r_mod ;
+                        if (c_new >= nc) c_new -= nc ;
+                        GB_COPY (W, pW + c_new, X, s*nc + c) ;
+                        cnr += nr_mod ;
+                        if (cnr >= nc) cnr -= nc ;
+                    }
+                }
+                for (c = 0 ; c < nc ; c++)
+                {
+                    GB_COPY (X, s*nc + c, W, pW + c) ;
+                }
+            }
+        }
+
+        //----------------------------------------------------------------------
+        // phase 3: shuffle the entries in each column c
+        //----------------------------------------------------------------------
+
+        // The entry X (s_new,c) of the transpose comes from position l =
+        // s_new*nc + c of the original X, in row r = l mod nr and column c0 =
+        // l / nr, and it is now in row s = (r + c0/b) mod nr of column c.
+        // Each row of a block of X is filled at a time, with W (s,c).
+
+        #pragma omp parallel for num_threads(nthreads_col) schedule(static)
+        for (tid = 0 ; tid < nthreads_col ; tid++)
+        {
+            const int64_t pW = tid * nr * w ;
+            int64_t kfirst, klast ;
+            GB_PARTITION (kfirst, klast, nblocks, tid, nthreads_col) ;
+            for (int64_t k = kfirst ; k < klast ; k++)
+            {
+                // W = X (:,c1:c2-1)
+                const int64_t c1 = k * w ;
+                const int64_t c2 = GB_IMIN (c1 + w, nc) ;
+                const int64_t cw = c2 - c1 ;
+                for (int64_t r = 0 ; r < nr ; r++)
+                {
+                    for (int64_t c = c1 ; c < c2 ; c++)
+                    {
+                        GB_COPY (W, pW + r*cw + (c-c1), X, r*nc + c) ;
+                    }
+                }
+                // X (s_new,c1:c2-1) = W (s,c1:c2-1)
+                for (int64_t s_new = 0 ; s_new < nr ; s_new++)
+                {
+                    const int64_t l = s_new * nc + c1 ;
+                    int64_t c0 = l / nr, r = l % nr, q = c0 / b ;
+                    for (int64_t c = c1 ; c < c2 ; c++)
+                    {
+                        int64_t s = r + q ;
+                        if (s >= nr) s -= nr ;
+                        GB_COPY (X, s_new*nc + c, W, pW + s*cw + (c-c1)) ;
+                        if (++r == nr)
+                        { 
+                            r = 0 ;
+                            q = (++c0) / b ;
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+#undef GB_A_TYPE
+#undef GB_COPY
+#undef GB_SWAP
+#undef GB_TRANSPOSE_GENERIC
+
@@ -148,7 +148,7 @@ GrB_Info GB (_AsaxbitB__any_div_fc32)
     return (GrB_NO_VALUE) ;
     #else
     int nthreads_max = GB_Context_nthreads_max ( ) ;
-    double chunk = GB_Context_chunk ( ) ;
+    double chunk = GB_Context_chunk_family (GxB_CHUNK_SAXPY3) ;
     #include "GB_AxB_saxbit_template.c"
     return (GrB_SUCCESS) ;
     #endif
@@ -217,7 +217,7 @@ GrB_Info GB (_Asaxpy3B__any_div_fc32)
     )
     {
         int nthreads_max = GB_Context_nthreads_max ( ) ;
-        double chunk = GB_Context_chunk ( ) ;
+        double chunk = GB_Context_chunk_family (GxB_CHUNK_SAXPY3) ;
         if (GB_IS_SPARSE (A) && GB_IS_SPARSE (B))
         {
             // both A and B are sparse
@@ -267,7 +267,7 @@ GrB_Info GB (_Asaxpy3B__any_div_fc32)
     )
     {
         int nthreads_max = GB_Context_nthreads_max ( ) ;
-        double chunk = GB_Context_chunk ( ) ;
+        double chunk = GB_Context_chunk_family (GxB_CHUNK_SAXPY3) ;
         if (GB_IS_SPARSE (A) && GB_IS_SPARSE (B))
         {
             // both A and B are sparse
@@ -319,7 +319,7 @@ GrB_Info GB (_Asaxpy3B__any_div_fc32)
     )
     {
         int nthreads_max = GB_Context_nthreads_max ( ) ;
-        double chunk = GB_Context_chunk ( ) ;
+        double chunk = GB_Context_chunk_family (GxB_CHUNK_SAXPY3) ;
         if (GB_IS_SPARSE (A) && GB_IS_SPARSE (B))
         {
             // both A and B are sparse
@@ -144,7 +144,7 @@ GrB_Info GB (_AsaxbitB__any_div_fc64)
     return (GrB_NO_VALUE) ;
     #else
     int nthreads_max = GB_Context_nthreads_max ( ) ;
-    double chunk = GB_Context_chunk ( ) ;
+    double chunk = GB_Context_chunk_family (GxB_CHUNK_SAXPY3) ;
     #include "GB_AxB_saxbit_template.c"
     return (GrB_SUCCESS) ;
     #endif
@@ -213,7 +213,7 @@ GrB_Info GB (_Asaxpy3B__any_div_fc64)
     )
     {
         int nthreads_max = GB_Context_nthreads_max ( ) ;
-        double chunk = GB_Context_chunk ( ) ;
+        double chunk = GB_Context_chunk_family (GxB_CHUNK_SAXPY3) ;
         if (GB_IS_SPARSE (A) && GB_IS_SPARSE (B))
         {
             // both A and B are sparse
@@ -263,7 +263,7 @@ GrB_Info GB (_Asaxpy3B__any_div_fc64)
     )
     {
         int nthreads_max = GB_Context_nthreads_max ( ) ;
-        double chunk = GB_Context_chunk ( ) ;
+        double chunk = GB_Context_chunk_family (GxB_CHUNK_SAXPY3) ;
         if (GB_IS_SPARSE (A) && GB_IS_SPARSE (B))
         {
             // both A and B are sparse
@@ -315,7 +315,7 @@ GrB_Info GB (_Asaxpy3B__any_div_fc64)
     )
     {
         int nthreads_max = GB_Context_nthreads_max ( ) ;
-        double chunk = GB_Context_chunk ( ) ;
+        double chunk = GB_Context_chunk_family (GxB_CHUNK_SAXPY3) ;
         if (GB_IS_SPARSE (A) && GB_IS_SPARSE (B))
         {
             // both A and B are sparse
@@ -146,7 +146,7 @@ GrB_Info GB (_AsaxbitB__any_div_fp32)
     return (GrB_NO_VALUE) ;
     #else
     int nthreads_max = GB_Context_nthreads_max ( ) ;
-    double chunk = GB_Context_chunk ( ) ;
+    double chunk = GB_Context_chunk_family (GxB_CHUNK_SAXPY3) ;
     #include "GB_AxB_saxbit_template.c"
     return (GrB_SUCCESS) ;
     #endif
@@ -215,7 +215,7 @@ GrB_Info GB (_Asaxpy3B__any_div_fp32)
     )
     {
         int nthreads_max = GB_Context_nthreads_max ( ) ;
-        double chunk = GB_Context_chunk ( ) ;
+        double chunk = GB_Context_chunk_family (GxB_CHUNK_SAXPY3) ;
         if (GB_IS_SPARSE (A) && GB_IS_SPARSE (B))
         {
             // both A and B are sparse
@@ -265,7 +265,7 @@ GrB_Info GB (_Asaxpy3B__any_div_fp32)
     )
     {
         int nthreads_max = GB_Context_nthreads_max ( ) ;
-        double chunk = GB_Context_chunk ( ) ;
+        double chunk = GB_Context_chunk_family (GxB_CHUNK_SAXPY3) ;
         if (GB_IS_SPARSE (A) && GB_IS_SPARSE (B))
         {
             // both A and B are sparse
@@ -317,7 +317,7 @@ GrB_Info GB (_Asaxpy3B__any_div_fp32)
     )
     {
         int nthreads_max = GB_Context_nthreads_max ( ) ;
-        double chunk = GB_Context_chunk ( ) ;
+        double chunk = GB_Context_chunk_family (GxB_CHUNK_SAXPY3) ;
         if (GB_IS_SPARSE (A) && GB_IS_SPARSE (B))
         {
             // both A and B are sparse
@@ -145,7 +145,7 @@ GrB_Info GB (_AsaxbitB__any_div_int16)
     return (GrB_NO_VALUE) ;
     #else
     int nthreads_max = GB_Context_nthreads_max ( ) ;
-    double chunk = GB_Context_chunk ( ) ;
+    double chunk = GB_Context_chunk_family (GxB_CHUNK_SAXPY3) ;
     #include "GB_AxB_saxbit_template.c"
     return (GrB_SUCCESS) ;
     #endif
@@ -214,7 +214,7 @@ GrB_Info GB (_Asaxpy3B__any_div_int16)
     )
     {
         int nthreads_max = GB_Context_nthreads_max ( ) ;
-        double chunk = GB_Context_chunk ( ) ;
+        double chunk = GB_Context_chunk_family (GxB_CHUNK_SAXPY3) ;
         if (GB_IS_SPARSE (A) && GB_IS_SPARSE (B))
         {
             // both A and B are sparse
@@ -264,7 +264,7 @@ GrB_Info GB (_Asaxpy3B__any_div_int16)
     )
     {
         int nthreads_max = GB_Context_nthreads_max ( ) ;
-        double chunk = GB_Context_chunk ( ) ;
+        double chunk = GB_Context_chunk_family (GxB_CHUNK_SAXPY3) ;
         if (GB_IS_SPARSE (A) && GB_IS_SPARSE (B))
         {
             // both A and B are sparse
@@ -316,7 +316,7 @@ GrB_Info GB (_Asaxpy3B__any_div_int16)
     )
     {
         int nthreads_max = GB_Context_nthreads_max ( ) ;
-        double chunk = GB_Context_chunk ( ) ;
+        double chunk = GB_Context_chunk_family (GxB_CHUNK_SAXPY3) ;
         if (GB_IS_SPARSE (A) && GB_IS_SPARSE (B))
         {
             // both A and B are sparse
@@ -71,3 +71,25 @@ GrB_Info GB (_red__any_bool)
     #endif
 }
 
+//------------------------------------------------------------------------------
+// reduce each vector of a non-iso matrix to a scalar, for monoids only
+//------------------------------------------------------------------------------
+
+GrB_Info GB (_red_each__any_bool)
+(
+    GB_Z_TYPE *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+)
+{ 
+    #if GB_DISABLE
+    return (GrB_NO_VALUE) ;
+    #else
+    #include "GB_reduce_each_vector_template.c"
+    return (GrB_SUCCESS) ;
+    #endif
+}
+
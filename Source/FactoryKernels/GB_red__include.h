@@ -18,6 +18,16 @@ GrB_Info GB (_red__min_int8)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__min_int8)
+(
+    int8_t *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__min_int16)
 (
     int16_t *result,
@@ -28,6 +38,16 @@ GrB_Info GB (_red__min_int16)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__min_int16)
+(
+    int16_t *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__min_int32)
 (
     int32_t *result,
@@ -38,6 +58,16 @@ GrB_Info GB (_red__min_int32)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__min_int32)
+(
+    int32_t *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__min_int64)
 (
     int64_t *result,
@@ -48,6 +78,16 @@ GrB_Info GB (_red__min_int64)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__min_int64)
+(
+    int64_t *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__min_uint8)
 (
     uint8_t *result,
@@ -58,6 +98,16 @@ GrB_Info GB (_red__min_uint8)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__min_uint8)
+(
+    uint8_t *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__min_uint16)
 (
     uint16_t *result,
@@ -68,6 +118,16 @@ GrB_Info GB (_red__min_uint16)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__min_uint16)
+(
+    uint16_t *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__min_uint32)
 (
     uint32_t *result,
@@ -78,6 +138,16 @@ GrB_Info GB (_red__min_uint32)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__min_uint32)
+(
+    uint32_t *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__min_uint64)
 (
     uint64_t *result,
@@ -88,6 +158,16 @@ GrB_Info GB (_red__min_uint64)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__min_uint64)
+(
+    uint64_t *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__min_fp32)
 (
     float *result,
@@ -98,6 +178,16 @@ GrB_Info GB (_red__min_fp32)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__min_fp32)
+(
+    float *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__min_fp64)
 (
     double *result,
@@ -108,6 +198,16 @@ GrB_Info GB (_red__min_fp64)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__min_fp64)
+(
+    double *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__max_int8)
 (
     int8_t *result,
@@ -118,6 +218,16 @@ GrB_Info GB (_red__max_int8)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__max_int8)
+(
+    int8_t *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__max_int16)
 (
     int16_t *result,
@@ -128,6 +238,16 @@ GrB_Info GB (_red__max_int16)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__max_int16)
+(
+    int16_t *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__max_int32)
 (
     int32_t *result,
@@ -138,6 +258,16 @@ GrB_Info GB (_red__max_int32)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__max_int32)
+(
+    int32_t *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__max_int64)
 (
     int64_t *result,
@@ -148,6 +278,16 @@ GrB_Info GB (_red__max_int64)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__max_int64)
+(
+    int64_t *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__max_uint8)
 (
     uint8_t *result,
@@ -158,6 +298,16 @@ GrB_Info GB (_red__max_uint8)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__max_uint8)
+(
+    uint8_t *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__max_uint16)
 (
     uint16_t *result,
@@ -168,6 +318,16 @@ GrB_Info GB (_red__max_uint16)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__max_uint16)
+(
+    uint16_t *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__max_uint32)
 (
     uint32_t *result,
@@ -178,6 +338,16 @@ GrB_Info GB (_red__max_uint32)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__max_uint32)
+(
+    uint32_t *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__max_uint64)
 (
     uint64_t *result,
@@ -188,6 +358,16 @@ GrB_Info GB (_red__max_uint64)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__max_uint64)
+(
+    uint64_t *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__max_fp32)
 (
     float *result,
@@ -198,6 +378,16 @@ GrB_Info GB (_red__max_fp32)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__max_fp32)
+(
+    float *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__max_fp64)
 (
     double *result,
@@ -208,6 +398,16 @@ GrB_Info GB (_red__max_fp64)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__max_fp64)
+(
+    double *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__any_bool)
 (
     bool *result,
@@ -218,6 +418,16 @@ GrB_Info GB (_red__any_bool)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__any_bool)
+(
+    bool *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__any_int8)
 (
     int8_t *result,
@@ -228,6 +438,16 @@ GrB_Info GB (_red__any_int8)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__any_int8)
+(
+    int8_t *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__any_int16)
 (
     int16_t *result,
@@ -238,6 +458,16 @@ GrB_Info GB (_red__any_int16)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__any_int16)
+(
+    int16_t *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__any_int32)
 (
     int32_t *result,
@@ -248,6 +478,16 @@ GrB_Info GB (_red__any_int32)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__any_int32)
+(
+    int32_t *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__any_int64)
 (
     int64_t *result,
@@ -258,6 +498,16 @@ GrB_Info GB (_red__any_int64)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__any_int64)
+(
+    int64_t *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__any_uint8)
 (
     uint8_t *result,
@@ -268,6 +518,16 @@ GrB_Info GB (_red__any_uint8)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__any_uint8)
+(
+    uint8_t *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__any_uint16)
 (
     uint16_t *result,
@@ -278,6 +538,16 @@ GrB_Info GB (_red__any_uint16)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__any_uint16)
+(
+    uint16_t *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__any_uint32)
 (
     uint32_t *result,
@@ -288,6 +558,16 @@ GrB_Info GB (_red__any_uint32)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__any_uint32)
+(
+    uint32_t *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__any_uint64)
 (
     uint64_t *result,
@@ -298,6 +578,16 @@ GrB_Info GB (_red__any_uint64)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__any_uint64)
+(
+    uint64_t *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__any_fp32)
 (
     float *result,
@@ -308,6 +598,16 @@ GrB_Info GB (_red__any_fp32)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__any_fp32)
+(
+    float *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__any_fp64)
 (
     double *result,
@@ -318,6 +618,16 @@ GrB_Info GB (_red__any_fp64)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__any_fp64)
+(
+    double *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__any_fc32)
 (
     GxB_FC32_t *result,
@@ -328,6 +638,16 @@ GrB_Info GB (_red__any_fc32)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__any_fc32)
+(
+    GxB_FC32_t *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__any_fc64)
 (
     GxB_FC64_t *result,
@@ -338,6 +658,16 @@ GrB_Info GB (_red__any_fc64)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__any_fc64)
+(
+    GxB_FC64_t *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__plus_int8)
 (
     int8_t *result,
@@ -348,6 +678,16 @@ GrB_Info GB (_red__plus_int8)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__plus_int8)
+(
+    int8_t *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__plus_int16)
 (
     int16_t *result,
@@ -358,6 +698,16 @@ GrB_Info GB (_red__plus_int16)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__plus_int16)
+(
+    int16_t *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__plus_int32)
 (
     int32_t *result,
@@ -368,6 +718,16 @@ GrB_Info GB (_red__plus_int32)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__plus_int32)
+(
+    int32_t *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__plus_int64)
 (
     int64_t *result,
@@ -378,6 +738,16 @@ GrB_Info GB (_red__plus_int64)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__plus_int64)
+(
+    int64_t *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__plus_uint8)
 (
     uint8_t *result,
@@ -388,6 +758,16 @@ GrB_Info GB (_red__plus_uint8)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__plus_uint8)
+(
+    uint8_t *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__plus_uint16)
 (
     uint16_t *result,
@@ -398,6 +778,16 @@ GrB_Info GB (_red__plus_uint16)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__plus_uint16)
+(
+    uint16_t *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__plus_uint32)
 (
     uint32_t *result,
@@ -408,6 +798,16 @@ GrB_Info GB (_red__plus_uint32)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__plus_uint32)
+(
+    uint32_t *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__plus_uint64)
 (
     uint64_t *result,
@@ -418,6 +818,16 @@ GrB_Info GB (_red__plus_uint64)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__plus_uint64)
+(
+    uint64_t *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__plus_fp32)
 (
     float *result,
@@ -428,6 +838,16 @@ GrB_Info GB (_red__plus_fp32)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__plus_fp32)
+(
+    float *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__plus_fp64)
 (
     double *result,
@@ -438,6 +858,16 @@ GrB_Info GB (_red__plus_fp64)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__plus_fp64)
+(
+    double *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__plus_fc32)
 (
     GxB_FC32_t *result,
@@ -448,6 +878,16 @@ GrB_Info GB (_red__plus_fc32)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__plus_fc32)
+(
+    GxB_FC32_t *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__plus_fc64)
 (
     GxB_FC64_t *result,
@@ -458,6 +898,16 @@ GrB_Info GB (_red__plus_fc64)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__plus_fc64)
+(
+    GxB_FC64_t *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__times_int8)
 (
     int8_t *result,
@@ -468,6 +918,16 @@ GrB_Info GB (_red__times_int8)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__times_int8)
+(
+    int8_t *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__times_int16)
 (
     int16_t *result,
@@ -478,6 +938,16 @@ GrB_Info GB (_red__times_int16)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__times_int16)
+(
+    int16_t *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__times_int32)
 (
     int32_t *result,
@@ -488,6 +958,16 @@ GrB_Info GB (_red__times_int32)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__times_int32)
+(
+    int32_t *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__times_int64)
 (
     int64_t *result,
@@ -498,6 +978,16 @@ GrB_Info GB (_red__times_int64)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__times_int64)
+(
+    int64_t *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__times_uint8)
 (
     uint8_t *result,
@@ -508,6 +998,16 @@ GrB_Info GB (_red__times_uint8)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__times_uint8)
+(
+    uint8_t *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__times_uint16)
 (
     uint16_t *result,
@@ -518,6 +1018,16 @@ GrB_Info GB (_red__times_uint16)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__times_uint16)
+(
+    uint16_t *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__times_uint32)
 (
     uint32_t *result,
@@ -528,6 +1038,16 @@ GrB_Info GB (_red__times_uint32)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__times_uint32)
+(
+    uint32_t *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__times_uint64)
 (
     uint64_t *result,
@@ -538,6 +1058,16 @@ GrB_Info GB (_red__times_uint64)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__times_uint64)
+(
+    uint64_t *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__times_fp32)
 (
     float *result,
@@ -548,6 +1078,16 @@ GrB_Info GB (_red__times_fp32)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__times_fp32)
+(
+    float *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__times_fp64)
 (
     double *result,
@@ -558,6 +1098,16 @@ GrB_Info GB (_red__times_fp64)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__times_fp64)
+(
+    double *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__times_fc32)
 (
     GxB_FC32_t *result,
@@ -568,6 +1118,16 @@ GrB_Info GB (_red__times_fc32)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__times_fc32)
+(
+    GxB_FC32_t *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__times_fc64)
 (
     GxB_FC64_t *result,
@@ -578,6 +1138,16 @@ GrB_Info GB (_red__times_fc64)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__times_fc64)
+(
+    GxB_FC64_t *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__lor_bool)
 (
     bool *result,
@@ -588,6 +1158,16 @@ GrB_Info GB (_red__lor_bool)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__lor_bool)
+(
+    bool *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__land_bool)
 (
     bool *result,
@@ -598,6 +1178,16 @@ GrB_Info GB (_red__land_bool)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__land_bool)
+(
+    bool *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__lxor_bool)
 (
     bool *result,
@@ -608,6 +1198,16 @@ GrB_Info GB (_red__lxor_bool)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__lxor_bool)
+(
+    bool *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__eq_bool)
 (
     bool *result,
@@ -618,6 +1218,16 @@ GrB_Info GB (_red__eq_bool)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__eq_bool)
+(
+    bool *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
 GrB_Info GB (_red__any_bool)
 (
     bool *result,
@@ -628,3 +1238,13 @@ GrB_Info GB (_red__any_bool)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each__any_bool)
+(
+    bool *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
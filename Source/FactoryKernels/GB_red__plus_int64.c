@@ -25,6 +25,7 @@
 #define GB_Z_TYPE int64_t
 #define GB_DECLARE_IDENTITY(z) int64_t z = 0
 #define GB_DECLARE_IDENTITY_CONST(z) const int64_t z = 0
+#define GB_PRAGMA_SIMD_REDUCTION_MONOID(z) GB_PRAGMA_SIMD_REDUCTION (+,z)
 
 // panel size
 #define GB_PANEL 32
@@ -70,3 +71,25 @@ GrB_Info GB (_red__plus_int64)
     #endif
 }
 
+//------------------------------------------------------------------------------
+// reduce each vector of a non-iso matrix to a scalar, for monoids only
+//------------------------------------------------------------------------------
+
+GrB_Info GB (_red_each__plus_int64)
+(
+    GB_Z_TYPE *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+)
+{ 
+    #if GB_DISABLE
+    return (GrB_NO_VALUE) ;
+    #else
+    #include "GB_reduce_each_vector_template.c"
+    return (GrB_SUCCESS) ;
+    #endif
+}
+
@@ -125,8 +125,9 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
     // estimate the work to transpose A, B, and C
     //--------------------------------------------------------------------------
 
-    double A_work = GB_nnz_held (A_in) ;    // work to transpose A
-    double B_work = GB_nnz_held (B_in) ;    // work to transpose B
+    // work to transpose A and B; none if the transpose is cached
+    double A_work = (A_in->transpose_cache) ? 0 : GB_nnz_held (A_in) ;
+    double B_work = (B_in->transpose_cache) ? 0 : GB_nnz_held (B_in) ;
     // work to transpose C cannot be determined; assume it is full
     double C_work =
         (double) (A_transpose ? GB_NCOLS (A_in) : GB_NROWS (A_in)) *
@@ -479,6 +480,11 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
         // unless an error occurs, but is returned to the caller.
         // If Mask_struct is true, MT = one(M') is iso.
         GBURBLE ("(M transpose) ") ;
+        if (M_in != C_in)
+        { 
+            // use the cached M_in', or construct it if requested
+            GB_OK (GB_transpose_cache_build (M_in, Werk)) ;
+        }
         GB_OK (GB_transpose_cast (MT, GrB_BOOL, C_is_csc, M_in, Mask_struct,
             Werk)) ;
         M = MT ;
@@ -561,6 +567,8 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
 
     // use GB_AxB_saxpy3 by default
     int axb_method = GB_USE_SAXPY ;
+    bool adaptive = (A_in->sparsity_adaptive || B_in->sparsity_adaptive) ;
+    double t_start = adaptive ? GB_OPENMP_GET_WTIME : 0 ;
 
     if (atrans)
     {
@@ -582,6 +590,11 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
             // converted to C=(B*A)' and C=B*A, respectively.  It is left here
             // in case the swap_rule changes.
             GB_CLEAR_STATIC_HEADER (BT, &BT_header) ;
+            if (B != C_in)
+            { 
+                // use the cached B', or construct it if requested
+                GB_OK (GB_transpose_cache_build (B, Werk)) ;
+            }
             GB_OK (GB_transpose_cast (BT, btype_cast, true, B, B_is_pattern,
                 Werk)) ;
             B = BT ;
@@ -603,6 +616,11 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
         {
             // AT = A', or AT=one(A') if only the pattern is needed.
             GB_CLEAR_STATIC_HEADER (AT, &AT_header) ;
+            if (A != C_in)
+            { 
+                // use the cached A', or construct it if requested
+                GB_OK (GB_transpose_cache_build (A, Werk)) ;
+            }
             GB_OK (GB_transpose_cast (AT, atype_cast, true, A, A_is_pattern,
                 Werk)) ;
             // do not use colscale if AT is now bitmap
@@ -684,6 +702,11 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
         {
             // BT = B', or BT=one(B') if only the pattern of B is needed
             GB_CLEAR_STATIC_HEADER (BT, &BT_header) ;
+            if (B != C_in)
+            { 
+                // use the cached B', or construct it if requested
+                GB_OK (GB_transpose_cache_build (B, Werk)) ;
+            }
             GB_OK (GB_transpose_cast (BT, btype_cast, true, B, B_is_pattern,
                 Werk)) ;
             // do not use rowscale if BT is now bitmap
@@ -716,6 +739,11 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
                 GBURBLE ("C%s=A*B', dot_product (transposed %s) "
                     "(transposed %s) ", M_str, A_str, B_str) ;
                 GB_CLEAR_STATIC_HEADER (AT, &AT_header) ;
+                if (A != C_in)
+                { 
+                    // use the cached A', or construct it if requested
+                    GB_OK (GB_transpose_cache_build (A, Werk)) ;
+                }
                 GB_OK (GB_transpose_cast (AT, atype_cast, true, A, A_is_pattern,
                     Werk)) ;
                 GB_OK (GB_AxB_dot (C, can_do_in_place ? C_in : NULL, M,
@@ -820,6 +848,11 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
                 GBURBLE ("C%s=A*B', dot_product (transposed %s) ",
                     M_str, A_str) ;
                 GB_CLEAR_STATIC_HEADER (AT, &AT_header) ;
+                if (A != C_in)
+                { 
+                    // use the cached A', or construct it if requested
+                    GB_OK (GB_transpose_cache_build (A, Werk)) ;
+                }
                 GB_OK (GB_transpose_cast (AT, atype_cast, true, A, A_is_pattern,
                     Werk)) ;
                 GB_OK (GB_AxB_dot (C, can_do_in_place ? C_in : NULL, M,
@@ -837,6 +870,21 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
         }
     }
 
+    if (adaptive)
+    { 
+        // the dot product accesses each of A and B at random, once for each
+        // entry of the other; the other methods scan them, or at least one
+        // of them.  Record the time taken per entry of A and B.
+        bool pull = (axb_method == GB_USE_DOT) ;
+        double t = GB_OPENMP_GET_WTIME - t_start ;
+        double anz_held = (double) GB_nnz_held (A_in) ;
+        double bnz_held = (double) GB_nnz_held (B_in) ;
+        double work = anz_held + bnz_held ;
+        double rate = (work > 0) ? (t / work) : 0 ;
+        GB_sparsity_adapt_use (A_in, pull, bnz_held, rate) ;
+        GB_sparsity_adapt_use (B_in, pull, anz_held, rate) ;
+    }
+
     if (*M_transposed) { GBURBLE ("(M transposed) ") ; }
     if ((M != NULL) && !(*mask_applied)) { GBURBLE ("(mask later) ") ; }
 
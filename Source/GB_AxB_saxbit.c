@@ -105,7 +105,7 @@ GrB_Info GB_AxB_saxbit        // C = A*B where C is bitmap
     bool use_atomics = false ;
 
     int nthreads_max = GB_Context_nthreads_max ( ) ;
-    double chunk = GB_Context_chunk ( ) ;
+    double chunk = GB_Context_chunk_family (GxB_CHUNK_SAXPY3) ;
 
     //--------------------------------------------------------------------------
     // construct C
@@ -61,7 +61,7 @@ GrB_Info GB_AxB_saxbit_jit      // C<M>=A*B, saxbit, via the JIT
         NULL, C->type, A->type, B->type) ;
     if (info != GrB_SUCCESS) return (info) ;
 
-    double chunk = GB_Context_chunk ( ) ;
+    double chunk = GB_Context_chunk_family (GxB_CHUNK_SAXPY3) ;
     int nthreads_max = GB_Context_nthreads_max ( ) ;
 
     //--------------------------------------------------------------------------
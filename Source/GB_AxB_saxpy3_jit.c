@@ -57,7 +57,7 @@ GrB_Info GB_AxB_saxpy3_jit      // C<M>=A*B, saxpy3, via the JIT
     if (info != GrB_SUCCESS) return (info) ;
 
     int nthreads_max = GB_Context_nthreads_max ( ) ;
-    double chunk = GB_Context_chunk ( ) ;
+    double chunk = GB_Context_chunk_family (GxB_CHUNK_SAXPY3) ;
 
     //--------------------------------------------------------------------------
     // call the jit kernel and return result
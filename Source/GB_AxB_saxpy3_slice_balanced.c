@@ -243,7 +243,7 @@ GrB_Info GB_AxB_saxpy3_slice_balanced
     //--------------------------------------------------------------------------
 
     int nthreads_max = GB_Context_nthreads_max ( ) ;
-    double chunk = GB_Context_chunk ( ) ;
+    double chunk = GB_Context_chunk_family (GxB_CHUNK_SAXPY3) ;
     bool bitmap_or_full = (GB_IS_FULL (A) || GB_IS_BITMAP (A)
                         || GB_IS_FULL (B) || GB_IS_BITMAP (B)) ;
     if (builtin_semiring && bitmap_or_full)
@@ -33,7 +33,7 @@ void GB_AxB_saxpy4_tasks
     //--------------------------------------------------------------------------
 
     int nthreads_max = GB_Context_nthreads_max ( ) ;
-    double chunk = GB_Context_chunk ( ) ;
+    double chunk = GB_Context_chunk_family (GxB_CHUNK_SAXPY3) ;
     double work = ((double) anz) * (double) bvdim ;
     int nthreads = GB_nthreads (work, chunk, nthreads_max) ;
     int nfine_tasks_per_vector = 0, ntasks ;
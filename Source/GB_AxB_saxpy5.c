@@ -140,7 +140,7 @@ GrB_Info GB_AxB_saxpy5              // C += A*B
     int64_t bnz = GB_nnz_held (B) ;
     int64_t bnvec = B->nvec ;
     int nthreads_max = GB_Context_nthreads_max ( ) ;
-    double chunk = GB_Context_chunk ( ) ;
+    double chunk = GB_Context_chunk_family (GxB_CHUNK_SAXPY3) ;
     int nthreads = GB_nthreads (anz + bnz, chunk, nthreads_max) ;
     int ntasks = (nthreads == 1) ? 1 : 4 * nthreads ;
     ntasks = GB_IMIN (ntasks, bnvec) ;
@@ -72,6 +72,14 @@ GrB_Info GB_Context_engage (GxB_Context Context)
     #if defined ( NO_THREAD_LOCAL_STORAGE )
     return ((Context == NULL) ? GrB_SUCCESS : GrB_NOT_IMPLEMENTED) ;
     #else
+    // bind the threads of this user thread to the CPUs of the Context, if any
+    GrB_Info info = GB_Context_bind (Context) ;
+    if (info != GrB_SUCCESS)
+    { 
+        // restore the binding of the current Context
+        GB_Context_bind (GB_CONTEXT_THREAD) ;
+        return (info) ;
+    }
     GB_CONTEXT_THREAD = Context ;
     return (GrB_SUCCESS) ;
     #endif
@@ -96,7 +104,7 @@ GrB_Info GB_Context_disengage (GxB_Context Context)
             // must match the Context that is currently engaged to this user
             // thread to be disengaged.
             GB_CONTEXT_THREAD = NULL ;
-            return (GrB_SUCCESS) ;
+            return (GB_Context_bind (NULL)) ;
         }
         else
         { 
@@ -107,6 +115,15 @@ GrB_Info GB_Context_disengage (GxB_Context Context)
     #endif
 }
 
+//------------------------------------------------------------------------------
+// GB_Context_current: return the Context engaged for this user thread
+//------------------------------------------------------------------------------
+
+GxB_Context GB_Context_current (void)
+{ 
+    return (GB_CONTEXT_THREAD) ;
+}
+
 //------------------------------------------------------------------------------
 // Context->nthreads_max: # of OpenMP threads to use
 //------------------------------------------------------------------------------
@@ -130,7 +147,22 @@ int GB_Context_nthreads_max_get (GxB_Context Context)
 //  GB_Context_nthreads_max: get max # of threads from the current Context
 int GB_Context_nthreads_max (void)
 { 
-    return (GB_Context_nthreads_max_get (GB_CONTEXT_THREAD)) ;
+    // if the Context is bound to a list of CPUs, use at most one thread each
+    GxB_Context Context = GB_CONTEXT_THREAD ;
+    int nthreads_max = GB_Context_nthreads_max_get (Context) ;
+    if (Context != NULL && Context->ncpus > 0)
+    { 
+        nthreads_max = GB_IMIN (nthreads_max, Context->ncpus) ;
+    }
+    return (nthreads_max) ;
+}
+
+//  GB_Context_numa_node: get the NUMA node of the current Context, or -1
+int GB_Context_numa_node (void)
+{ 
+    GxB_Context Context = GB_CONTEXT_THREAD ;
+    return ((Context == NULL || Context->ncpus == 0) ? -1 :
+        Context->numa_node) ;
 }
 
 //   GB_Context_nthreads_max_set: set max # of threads in a Context
@@ -200,6 +232,24 @@ void GB_Context_chunk_set
     }
 }
 
+//     GB_Context_chunk_family: get chunk for a kernel family
+double GB_Context_chunk_family
+(
+    int family          // GxB_CHUNK_APPLY, GxB_CHUNK_ADD, ...
+)
+{
+    // If the family has been tuned (see GB_chunk_calibrate), its chunk is
+    // scaled by the ratio of the Context chunk to the default chunk, so that
+    // the Context chunk still controls the # of threads for all families.
+    double chunk = GB_Context_chunk ( ) ;
+    double chunk_family = GB_Global_chunk_family_get (family) ;
+    if (chunk_family > 0)
+    { 
+        chunk = chunk_family * (chunk / GB_CHUNK_DEFAULT) ;
+    }
+    return (chunk) ;
+}
+
 //------------------------------------------------------------------------------
 // Context->gpu_id: which GPU to use
 //------------------------------------------------------------------------------
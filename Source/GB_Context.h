@@ -12,6 +12,7 @@
 
 GrB_Info GB_Context_engage    (GxB_Context Context) ;
 GrB_Info GB_Context_disengage (GxB_Context Context) ;
+GxB_Context GB_Context_current (void) ;
 
 int    GB_Context_nthreads_max (void) ;
 int    GB_Context_nthreads_max_get (GxB_Context Context) ;
@@ -20,6 +21,15 @@ void   GB_Context_nthreads_max_set (GxB_Context Context, int nthreads_max) ;
 double GB_Context_chunk (void) ;
 double GB_Context_chunk_get (GxB_Context Context) ;
 void   GB_Context_chunk_set (GxB_Context Context, double chunk) ;
+double GB_Context_chunk_family (int family) ;
+GrB_Info GB_chunk_calibrate (void) ;
+
+GrB_Info GB_Context_bind (GxB_Context Context) ;
+GrB_Info GB_Context_cpus_set (GxB_Context Context, const int32_t *cpus,
+    int ncpus, int numa_node) ;
+GrB_Info GB_Context_numa_set (GxB_Context Context, int numa_node) ;
+int    GB_Context_numa_node (void) ;
+int    GB_sysfs_list (bool *member, const int n, const char *filename) ;
 
 int    GB_Context_gpu_id (void) ;
 int    GB_Context_gpu_id_get (GxB_Context Context) ;
@@ -0,0 +1,156 @@
+//------------------------------------------------------------------------------
+// GB_Context_bind: bind the threads of a user thread to the CPUs of a Context
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// JIT: not needed.  Only one variant possible.
+
+// When a user thread engages a Context with a list of CPUs (Context->cpus),
+// the OpenMP threads it uses are bound to those CPUs.  The user thread itself
+// is restricted to the CPUs in the list; this part of the binding is exact.
+// Each OpenMP thread 1 to nthreads-1 of the parallel region below is also
+// bound to a single CPU of the list.
+
+// The binding of the OpenMP threads is only a best-effort hint.  OpenMP does
+// not promise that a later parallel region of this user thread will use the
+// same pool threads, nor that a pool thread keeps the same omp_get_thread_num
+// from one region to the next (libgomp and the LLVM runtime do reuse the pool
+// in practice, for the same num_threads).  A pool thread may thus end up with
+// a different CPU of the list than its thread number suggests, and any OpenMP
+// threads created later inherit the CPUs of the user thread, so all threads
+// remain on the CPUs of the Context.  As a result, user threads that engage
+// Contexts with disjoint lists of CPUs do not compete for the same CPUs, and
+// memory first touched by their threads is allocated on the NUMA node of
+// those CPUs.
+
+// When the Context is disengaged (GB_Context_bind (NULL)), or freed by the
+// user thread that has it engaged, the user thread and its OpenMP threads are
+// restored to the CPUs the user thread had before it was first bound.  The
+// OpenMP threads are restored in the same best-effort manner.
+
+// The binding is done with sched_setaffinity, so it is only available on
+// Linux, with OpenMP.  It should not be combined with OMP_PROC_BIND, which
+// may move the threads of OpenMP to other CPUs.
+
+#if defined ( __linux__ ) && defined ( _OPENMP )
+    #ifndef _GNU_SOURCE
+    #define _GNU_SOURCE
+    #endif
+    #define GB_HAVE_CPU_BIND
+#endif
+
+#include "GB.h"
+
+#ifdef GB_HAVE_CPU_BIND
+
+    #include <sched.h>
+
+    // The CPUs of this user thread before it was bound, and the # of its
+    // OpenMP threads that have been bound to a single CPU (zero if the user
+    // thread is not bound).
+    static cpu_set_t GB_cpus_prior ;
+    static int GB_nthreads_bound = 0 ;
+    #pragma omp threadprivate (GB_cpus_prior, GB_nthreads_bound)
+
+#endif
+
+GrB_Info GB_Context_bind
+(
+    GxB_Context Context         // Context to bind to, or NULL to unbind
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    bool bind = (Context != NULL && Context != GxB_CONTEXT_WORLD &&
+        Context->ncpus > 0) ;
+
+    #ifndef GB_HAVE_CPU_BIND
+    {
+        return (bind ? GrB_NOT_IMPLEMENTED : GrB_SUCCESS) ;
+    }
+    #else
+    {
+
+        if (!bind)
+        {
+
+            //------------------------------------------------------------------
+            // restore the CPUs of this user thread and its OpenMP threads
+            //------------------------------------------------------------------
+
+            int nthreads = GB_nthreads_bound ;
+            if (nthreads > 0)
+            {
+                cpu_set_t cpus_prior = GB_cpus_prior ;
+                #pragma omp parallel num_threads(nthreads)
+                {
+                    sched_setaffinity (0, sizeof (cpu_set_t), &cpus_prior) ;
+                }
+                sched_setaffinity (0, sizeof (cpu_set_t), &cpus_prior) ;
+                GB_nthreads_bound = 0 ;
+            }
+            return (GrB_SUCCESS) ;
+        }
+
+        //----------------------------------------------------------------------
+        // save the CPUs of this user thread, if not already bound
+        //----------------------------------------------------------------------
+
+        if (GB_nthreads_bound == 0 &&
+            sched_getaffinity (0, sizeof (cpu_set_t), &GB_cpus_prior) != 0)
+        {
+            return (GrB_INVALID_VALUE) ;
+        }
+
+        //----------------------------------------------------------------------
+        // bind each OpenMP thread of this user thread to a single CPU
+        //----------------------------------------------------------------------
+
+        const int32_t *cpus = Context->cpus ;
+        const int ncpus = Context->ncpus ;
+        int nthreads = GB_IMAX (1, GB_IMIN (Context->nthreads_max, ncpus)) ;
+        GB_nthreads_bound = GB_IMAX (GB_nthreads_bound, nthreads) ;
+        int nfail = 0 ;
+        #pragma omp parallel num_threads(nthreads) reduction(+:nfail)
+        {
+            cpu_set_t mask ;
+            CPU_ZERO (&mask) ;
+            CPU_SET (cpus [omp_get_thread_num ( ) % ncpus], &mask) ;
+            if (sched_setaffinity (0, sizeof (cpu_set_t), &mask) != 0)
+            {
+                nfail++ ;
+            }
+        }
+
+        //----------------------------------------------------------------------
+        // this user thread may run on any CPU of the Context
+        //----------------------------------------------------------------------
+
+        cpu_set_t mask ;
+        CPU_ZERO (&mask) ;
+        for (int k = 0 ; k < ncpus ; k++)
+        {
+            CPU_SET (cpus [k], &mask) ;
+        }
+        if (sched_setaffinity (0, sizeof (cpu_set_t), &mask) != 0)
+        {
+            nfail++ ;
+        }
+
+        if (nfail > 0)
+        {
+            // a CPU is offline, or not available to this process
+            GB_Context_bind (NULL) ;
+            return (GrB_INVALID_VALUE) ;
+        }
+        return (GrB_SUCCESS) ;
+    }
+    #endif
+}
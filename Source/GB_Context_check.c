@@ -44,6 +44,16 @@ GrB_Info GB_Context_check       // check a GraphBLAS Context
     double chunk = GB_Context_chunk_get (Context) ;
     GBPR0 ("    Context.chunk:    %g\n", chunk) ;
 
+    if (Context->ncpus > 0)
+    { 
+        GBPR0 ("    Context.cpus:     %d", Context->ncpus) ;
+        if (Context->numa_node >= 0)
+        { 
+            GBPR0 (" (NUMA node %d)", Context->numa_node) ;
+        }
+        GBPR0 ("\n") ;
+    }
+
     int gpu_id = GB_Context_gpu_id_get (Context) ;
     if (gpu_id >= 0) GBPR0 ("    Context.gpu_id:   %d\n", gpu_id) ;
 
@@ -0,0 +1,144 @@
+//------------------------------------------------------------------------------
+// GB_Context_cpus: set the CPUs of a Context
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// JIT: not needed.  Only one variant possible.
+
+// GB_Context_cpus_set sets the list of CPUs that the threads of a Context are
+// bound to when the Context is engaged (see GB_Context_bind).
+// GB_Context_numa_set sets the list to the CPUs of a NUMA node, as given by
+// Linux in /sys/devices/system/node/node<node>/cpulist.  If the list is NULL
+// or empty, or if the node is negative, the Context is not bound to any CPUs.
+// Binding is only available on Linux, with OpenMP.
+
+#if defined ( __linux__ ) && defined ( _OPENMP )
+    #ifndef _GNU_SOURCE
+    #define _GNU_SOURCE
+    #endif
+    #define GB_HAVE_CPU_BIND
+#endif
+
+#include "GB.h"
+
+#ifdef GB_HAVE_CPU_BIND
+#include <sched.h>
+#endif
+
+//------------------------------------------------------------------------------
+// GB_Context_cpus_set: set the list of CPUs of a Context
+//------------------------------------------------------------------------------
+
+GrB_Info GB_Context_cpus_set
+(
+    GxB_Context Context,
+    const int32_t *cpus,            // list of CPUs, or NULL
+    int ncpus,                      // # of CPUs in the list
+    int numa_node                   // NUMA node of the CPUs, or -1
+)
+{
+
+    ASSERT (Context != NULL && Context != GxB_CONTEXT_WORLD) ;
+
+    if (cpus == NULL || ncpus <= 0)
+    {
+        // the Context is not bound to any CPUs
+        GB_FREE (&(Context->cpus), Context->cpus_size) ;
+        Context->ncpus = 0 ;
+        Context->numa_node = -1 ;
+        return (GrB_SUCCESS) ;
+    }
+
+    #ifndef GB_HAVE_CPU_BIND
+    {
+        return (GrB_NOT_IMPLEMENTED) ;
+    }
+    #else
+    {
+        for (int k = 0 ; k < ncpus ; k++)
+        {
+            if (cpus [k] < 0 || cpus [k] >= CPU_SETSIZE)
+            {
+                // invalid CPU
+                return (GrB_INVALID_VALUE) ;
+            }
+        }
+        size_t cpus_size ;
+        int32_t *cpus_new = GB_MALLOC (ncpus, int32_t, &cpus_size) ;
+        if (cpus_new == NULL)
+        {
+            // out of memory
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        memcpy (cpus_new, cpus, ncpus * sizeof (int32_t)) ;
+        GB_FREE (&(Context->cpus), Context->cpus_size) ;
+        Context->cpus = cpus_new ;
+        Context->cpus_size = cpus_size ;
+        Context->ncpus = ncpus ;
+        Context->numa_node = numa_node ;
+        return (GrB_SUCCESS) ;
+    }
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// GB_Context_numa_set: set the CPUs of a Context to those of a NUMA node
+//------------------------------------------------------------------------------
+
+GrB_Info GB_Context_numa_set
+(
+    GxB_Context Context,
+    int numa_node                   // NUMA node, or negative for none
+)
+{
+
+    if (numa_node < 0)
+    {
+        // the Context is not bound to any CPUs
+        return (GB_Context_cpus_set (Context, NULL, 0, -1)) ;
+    }
+
+    #ifndef GB_HAVE_CPU_BIND
+    {
+        return (GrB_NOT_IMPLEMENTED) ;
+    }
+    #else
+    {
+
+        //----------------------------------------------------------------------
+        // read the list of CPUs of the node, such as "0-7,16-23"
+        //----------------------------------------------------------------------
+
+        char filename [256] ;
+        snprintf (filename, 256, "/sys/devices/system/node/node%d/cpulist",
+            numa_node) ;
+        bool member [CPU_SETSIZE] ;
+        int ncpus = GB_sysfs_list (member, CPU_SETSIZE, filename) ;
+        if (ncpus <= 0)
+        {
+            // no such NUMA node, the node has no CPUs, or its list cannot be
+            // read
+            return (GrB_INVALID_VALUE) ;
+        }
+
+        //----------------------------------------------------------------------
+        // set the CPUs of the Context
+        //----------------------------------------------------------------------
+
+        int32_t cpus [CPU_SETSIZE] ;
+        ncpus = 0 ;
+        for (int cpu = 0 ; cpu < CPU_SETSIZE ; cpu++)
+        {
+            if (member [cpu])
+            {
+                cpus [ncpus++] = cpu ;
+            }
+        }
+        return (GB_Context_cpus_set (Context, cpus, ncpus, numa_node)) ;
+    }
+    #endif
+}
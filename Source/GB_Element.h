@@ -22,6 +22,28 @@ GrB_Info GB_setElement              // set a single entry, C(row,col) = scalar
     GB_Werk Werk
 ) ;
 
+GrB_Info GB_setElements             // C(I(k),J(k)) = X(k), for k = 0:n-1
+(
+    GrB_Matrix C,                   // matrix to modify
+    const GrB_BinaryOp accum,       // if NULL: C(i,j) = x
+                                    // else: C(i,j) += x
+    const GrB_Index *I,             // row indices
+    const GrB_Index *J,             // column indices
+    const void *X,                  // values, of type scalar_code
+    const GrB_Index n,              // number of tuples
+    const GB_Type_code scalar_code, // type of X
+    GB_Werk Werk
+) ;
+
+GrB_Info GB_Matrix_removeElements
+(
+    GrB_Matrix C,               // matrix to remove entries from
+    const GrB_Index *I,         // row indices
+    const GrB_Index *J,         // column indices
+    const GrB_Index n,          // number of entries to remove
+    GB_Werk Werk
+) ;
+
 GrB_Info GB_Vector_removeElement
 (
     GrB_Vector V,               // vector to remove entry from
@@ -37,5 +59,63 @@ GrB_Info GB_Matrix_removeElement
     GB_Werk Werk
 ) ;
 
+//------------------------------------------------------------------------------
+// GB_Element_find: find the position of C(i,j), which may be a zombie
+//------------------------------------------------------------------------------
+
+// Returns the position p of the entry with index i in vector j of C, or -1 if
+// it is not present.  C must not be jumbled.  If C is bitmap or full, the
+// position is always returned, whether or not C(i,j) is present in the bitmap.
+// If C is sparse or hypersparse, the entry at C->i [p] may be a zombie.
+
+static inline int64_t GB_Element_find
+(
+    const GrB_Matrix C,
+    const int64_t i,            // index into vector j
+    const int64_t j             // vector index
+)
+{
+
+    if (C->p == NULL)
+    { 
+        // C is bitmap or full
+        return (i + j * C->vlen) ;
+    }
+
+    const int64_t *restrict Cp = C->p ;
+    const int64_t *restrict Ch = C->h ;
+    int64_t pC_start, pC_end ;
+    if (C->nvals == 0)
+    { 
+        // C is empty
+        return (-1) ;
+    }
+    else if (Ch != NULL)
+    { 
+        // C is hypersparse: look for j in the hyperlist
+        const int64_t *restrict C_Yp = (C->Y == NULL) ? NULL : C->Y->p ;
+        const int64_t *restrict C_Yi = (C->Y == NULL) ? NULL : C->Y->i ;
+        const int64_t *restrict C_Yx = (C->Y == NULL) ? NULL : C->Y->x ;
+        const int64_t C_hash_bits = (C->Y == NULL) ? 0 : (C->Y->vdim - 1) ;
+        int64_t k = GB_hyper_hash_lookup (Ch, C->nvec, Cp, C_Yp, C_Yi, C_Yx,
+            C_hash_bits, j, &pC_start, &pC_end) ;
+        if (k < 0) return (-1) ;
+    }
+    else
+    { 
+        // C is sparse
+        pC_start = Cp [j] ;
+        pC_end   = Cp [j+1] ;
+    }
+
+    // binary search in C(:,j) for index i; time is O(log(nnz(C(:,j))))
+    int64_t pleft = pC_start ;
+    int64_t pright = pC_end - 1 ;
+    bool found, is_zombie ;
+    GB_BINARY_SEARCH_ZOMBIE (i, C->i, pleft, pright, found, C->nzombies,
+        is_zombie) ;
+    return (found ? pleft : -1) ;
+}
+
 #endif
 
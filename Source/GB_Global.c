@@ -40,6 +40,25 @@ typedef struct
     bool is_csc ;               // default CSR/CSC format for new matrices
     int64_t hyper_hash ;        // controls when A->Y hyper_hash is created
 
+    //--------------------------------------------------------------------------
+    // chunk size for each kernel family
+    //--------------------------------------------------------------------------
+
+    // chunk_family [k] is the chunk for kernel family k, for the default
+    // Context chunk.  It is zero if family k has not been tuned.
+
+    double chunk_family [GxB_NCHUNK_FAMILY] ;
+
+    //--------------------------------------------------------------------------
+    // NUMA policy for large blocks of memory
+    //--------------------------------------------------------------------------
+
+    // numa_policy is a GxB_NUMA_Policy.  numa_nodes is the set of NUMA nodes
+    // that GxB_NUMA_INTERLEAVE spreads memory across (bit k for node k).
+
+    int numa_policy ;
+    uint64_t numa_nodes ;
+
     //--------------------------------------------------------------------------
     // abort function: only used for debugging
     //--------------------------------------------------------------------------
@@ -178,6 +197,10 @@ static GB_Global_struct GB_Global =
 
     .hyper_hash = GB_HYPER_HASH_DEFAULT,
 
+    // NUMA policy: use the policy of the operating system
+    .numa_policy = GxB_NUMA_DEFAULT,
+    .numa_nodes = 0,
+
     // abort function for debugging only
     .abort_function   = abort,
 
@@ -402,6 +425,66 @@ void GB_Global_bitmap_switch_default (void)
     GB_Global.bitmap_switch [7] = GB_BITSWITCH_gt_than_64 ;
 }
 
+//------------------------------------------------------------------------------
+// chunk_family
+//------------------------------------------------------------------------------
+
+void GB_Global_chunk_family_set (int k, double chunk)
+{ 
+    ASSERT (k >= 0 && k < GxB_NCHUNK_FAMILY) ;
+    GB_ATOMIC_WRITE
+    GB_Global.chunk_family [k] = GB_IMAX (chunk, 0) ;
+}
+
+void GB_Global_chunk_family_default (void)
+{ 
+    for (int k = 0 ; k < GxB_NCHUNK_FAMILY ; k++)
+    {
+        GB_Global_chunk_family_set (k, 0) ;
+    }
+}
+
+double GB_Global_chunk_family_get (int k)
+{ 
+    ASSERT (k >= 0 && k < GxB_NCHUNK_FAMILY) ;
+    double chunk ;
+    GB_ATOMIC_READ
+    chunk = GB_Global.chunk_family [k] ;
+    return (chunk) ;
+}
+
+//------------------------------------------------------------------------------
+// numa_policy and numa_nodes
+//------------------------------------------------------------------------------
+
+void GB_Global_numa_policy_set (int numa_policy)
+{ 
+    GB_ATOMIC_WRITE
+    GB_Global.numa_policy = numa_policy ;
+}
+
+int GB_Global_numa_policy_get (void)
+{ 
+    int numa_policy ;
+    GB_ATOMIC_READ
+    numa_policy = GB_Global.numa_policy ;
+    return (numa_policy) ;
+}
+
+void GB_Global_numa_nodes_set (uint64_t numa_nodes)
+{ 
+    GB_ATOMIC_WRITE
+    GB_Global.numa_nodes = numa_nodes ;
+}
+
+uint64_t GB_Global_numa_nodes_get (void)
+{ 
+    uint64_t numa_nodes ;
+    GB_ATOMIC_READ
+    numa_nodes = GB_Global.numa_nodes ;
+    return (numa_nodes) ;
+}
+
 //------------------------------------------------------------------------------
 // is_csc
 //------------------------------------------------------------------------------
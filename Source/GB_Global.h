@@ -39,6 +39,15 @@ float    GB_Global_bitmap_switch_matrix_get
                         (int64_t vlen, int64_t vdim) ;
 void     GB_Global_bitmap_switch_default (void) ;
 
+void     GB_Global_chunk_family_set (int k, double chunk) ;
+double   GB_Global_chunk_family_get (int k) ;
+void     GB_Global_chunk_family_default (void) ;
+
+void     GB_Global_numa_policy_set (int numa_policy) ;
+int      GB_Global_numa_policy_get (void) ;
+void     GB_Global_numa_nodes_set (uint64_t numa_nodes) ;
+uint64_t GB_Global_numa_nodes_get (void) ;
+
 void     GB_Global_is_csc_set (bool is_csc) ;
 bool     GB_Global_is_csc_get (void) ;
 
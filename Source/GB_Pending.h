@@ -41,6 +41,23 @@ void GB_Pending_free        // free a list of pending tuples
     GB_Pending *PHandle
 ) ;
 
+GrB_Info GB_Pending_lookup
+(
+    GB_void *ax,            // output: value of A(i,j), if found (may be NULL)
+    bool *found,            // output: true if A(i,j) is a pending tuple
+    GrB_Matrix A,           // matrix to search
+    const int64_t i,        // index into vector j
+    const int64_t j         // vector index
+) ;
+
+// GB_PENDING_LOOKUP_OK (A) is true if the pending tuples of A are few enough
+// to be searched directly by GB_Pending_lookup, as a delta to A.  Otherwise,
+// the pending tuples are assembled into A with GB_wait, first.  This is the
+// same size ratio at which GB_wait merges the pending tuples into A in place.
+#define GB_PENDING_LOOKUP_OK(A)                     \
+    (GB_Pending_n ((GrB_Matrix) (A)) <=             \
+        GB_nnz ((GrB_Matrix) (A)) / GB_WAIT_MERGE_RATIO)
+
 //------------------------------------------------------------------------------
 // GB_Pending_ensure: make sure the list of pending tuples is large enough
 //------------------------------------------------------------------------------
@@ -0,0 +1,251 @@
+//------------------------------------------------------------------------------
+// GB_Pending_lookup: find A(i,j) in the pending tuples of A
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// JIT: not needed.  Only one variant possible.
+
+// The pending tuples of A act as a small sorted delta to A, which can be
+// searched directly by GrB_*_extractElement and GxB_*_isStoredElement without
+// assembling them into A with GB_wait.  Zombies in A act as deletions.  If
+// the pending tuples are not yet sorted, they are sorted in place first; the
+// order of duplicate tuples is preserved, so GB_wait can later assemble them
+// with the same result, and can skip the sort in GB_builder.
+
+// If A(i,j) appears in the pending tuples, found is returned as true, and the
+// value of A(i,j) is returned in ax, of type A->type, computed exactly as
+// GB_builder would assemble the duplicate tuples: the first tuple is
+// typecasted to A->type, and any subsequent ones are combined with the
+// Pending->op, if present, or with the implied SECOND operator otherwise.
+// If ax is NULL, only found is returned.
+
+// The caller must ensure that A(i,j) is not a live entry in A itself.  This
+// is the case for all entries in the pending tuples, since GrB_setElement and
+// GrB_assign modify entries already in A in place.
+
+#include "GB_Pending.h"
+#include "GB_sort.h"
+
+#define GB_FREE_ALL                         \
+{                                           \
+    GB_FREE_WORK (&K, K_size) ;             \
+    GB_FREE (&x_new, x_new_size) ;          \
+}
+
+//------------------------------------------------------------------------------
+// GB_Pending_sort: sort the pending tuples in place, keeping duplicates in order
+//------------------------------------------------------------------------------
+
+static GrB_Info GB_Pending_sort
+(
+    GB_Pending Pending
+)
+{
+
+    GrB_Info info ;
+    int64_t *restrict K = NULL ; size_t K_size = 0 ;
+    GB_void *restrict x_new = NULL ; size_t x_new_size = 0 ;
+
+    const int64_t n = Pending->n ;
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+    int nthreads = GB_nthreads (n, chunk, nthreads_max) ;
+
+    //--------------------------------------------------------------------------
+    // sort the tuples by (j,i,k), where k is the original position
+    //--------------------------------------------------------------------------
+
+    K = GB_MALLOC_WORK (n, int64_t, &K_size) ;
+    if (K == NULL)
+    {
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    int64_t k ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (k = 0 ; k < n ; k++)
+    {
+        K [k] = k ;
+    }
+
+    if (Pending->j == NULL)
+    {
+        GB_OK (GB_msort_2 (Pending->i, K, n, nthreads)) ;
+    }
+    else
+    {
+        GB_OK (GB_msort_3 (Pending->j, Pending->i, K, n, nthreads)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // permute the values
+    //--------------------------------------------------------------------------
+
+    if (Pending->x != NULL)
+    {
+        size_t size = Pending->size ;
+        x_new = GB_MALLOC (Pending->nmax * size, GB_void, &x_new_size) ;
+        if (x_new == NULL)
+        {
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        const GB_void *restrict x = Pending->x ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (k = 0 ; k < n ; k++)
+        {
+            memcpy (x_new + k * size, x + K [k] * size, size) ;
+        }
+        GB_FREE (&(Pending->x), Pending->x_size) ;
+        Pending->x = x_new ;
+        Pending->x_size = x_new_size ;
+        x_new = NULL ;
+    }
+
+    Pending->sorted = true ;
+    GB_FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_Pending_lookup: find A(i,j) in the pending tuples
+//------------------------------------------------------------------------------
+
+GrB_Info GB_Pending_lookup
+(
+    GB_void *ax,            // output: value of A(i,j), if found (may be NULL)
+    bool *found,            // output: true if A(i,j) is a pending tuple
+    GrB_Matrix A,           // matrix to search
+    const int64_t i,        // index into vector j
+    const int64_t j         // vector index
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (A != NULL && found != NULL) ;
+    (*found) = false ;
+    GB_Pending Pending = A->Pending ;
+    if (Pending == NULL || Pending->n == 0)
+    {
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // sort the pending tuples, if needed
+    //--------------------------------------------------------------------------
+
+    if (!Pending->sorted)
+    {
+        info = GB_Pending_sort (Pending) ;
+        if (info != GrB_SUCCESS)
+        { 
+            // out of memory
+            return (info) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // find the first tuple (i,j)
+    //--------------------------------------------------------------------------
+
+    const int64_t *restrict Pending_i = Pending->i ;
+    const int64_t *restrict Pending_j = Pending->j ;
+    const int64_t n = Pending->n ;
+
+    // binary search for the first tuple k with (Pending_j [k], Pending_i [k])
+    // not less than (j,i)
+    int64_t pleft = 0, pright = n ;
+    while (pleft < pright)
+    {
+        int64_t pmiddle = pleft + (pright - pleft) / 2 ;
+        int64_t jk = (Pending_j == NULL) ? 0 : Pending_j [pmiddle] ;
+        if (jk < j || (jk == j && Pending_i [pmiddle] < i))
+        {
+            pleft = pmiddle + 1 ;
+        }
+        else
+        {
+            pright = pmiddle ;
+        }
+    }
+
+    int64_t kfirst = pleft ;
+    int64_t klast = kfirst ;
+    while (klast < n && Pending_i [klast] == i &&
+        (Pending_j == NULL || Pending_j [klast] == j))
+    {
+        klast++ ;
+    }
+
+    if (kfirst == klast)
+    {
+        // A(i,j) is not a pending tuple
+        return (GrB_SUCCESS) ;
+    }
+    (*found) = true ;
+    if (ax == NULL)
+    {
+        // value not needed
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // assemble the value of A(i,j) from its tuples, kfirst:klast-1
+    //--------------------------------------------------------------------------
+
+    GrB_Type atype = A->type ;
+    size_t asize = atype->size ;
+    GB_Type_code acode = atype->code ;
+
+    if (A->iso)
+    {
+        // all pending tuples have the iso value of A
+        memcpy (ax, A->x, asize) ;
+        return (GrB_SUCCESS) ;
+    }
+
+    const GB_void *restrict Pending_x = Pending->x ;
+    size_t ssize = Pending->size ;
+    GB_Type_code scode = Pending->type->code ;
+    GrB_BinaryOp op = Pending->op ;
+
+    if (op == NULL || GB_op_is_second (op, atype))
+    {
+        // A(i,j) = (atype) the last tuple
+        GB_cast_scalar (ax, acode, Pending_x + (klast-1) * ssize, scode, ssize);
+    }
+    else
+    {
+        // A(i,j) = (atype) the first tuple, then A(i,j) = op (A(i,j), s)
+        // for each subsequent tuple s, with typecasting as in GB_builder
+        GB_cast_scalar (ax, acode, Pending_x + kfirst * ssize, scode, ssize) ;
+        GxB_binary_function fop = op->binop_function ;
+        GB_cast_function cast_S_to_Y, cast_A_to_X, cast_Z_to_A ;
+        cast_S_to_Y = GB_cast_factory (op->ytype->code, scode) ;
+        cast_A_to_X = GB_cast_factory (op->xtype->code, acode) ;
+        cast_Z_to_A = GB_cast_factory (acode, op->ztype->code) ;
+        GB_void xwork [GB_VLA(op->xtype->size)] ;
+        GB_void ywork [GB_VLA(op->ytype->size)] ;
+        GB_void zwork [GB_VLA(op->ztype->size)] ;
+        for (int64_t k = kfirst + 1 ; k < klast ; k++)
+        {
+            cast_S_to_Y (ywork, Pending_x + k * ssize, ssize) ;
+            cast_A_to_X (xwork, ax, asize) ;
+            fop (zwork, xwork, ywork) ;
+            cast_Z_to_A (ax, zwork, op->ztype->size) ;
+        }
+    }
+
+    return (GrB_SUCCESS) ;
+}
+
@@ -57,6 +57,10 @@ GrB_Scalar GB_Scalar_wrap   // create a new GrB_Scalar with one entry
 
     s->Y = NULL ;
     s->Y_shallow = false ;
+    s->AT = NULL ;
+    s->transpose_cache = false ;
+    s->hyper_pin = false ;
+    s->sparsity_adaptive = false ;
 
     s->nvals = 0 ;
 
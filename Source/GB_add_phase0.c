@@ -204,7 +204,7 @@ GrB_Info GB_add_phase0          // find vectors in C for C=A+B or C<M>=A+B
     //--------------------------------------------------------------------------
 
     int nthreads_max = GB_Context_nthreads_max ( ) ;
-    double chunk = GB_Context_chunk ( ) ;
+    double chunk = GB_Context_chunk_family (GxB_CHUNK_ADD) ;
     int nthreads = 1 ;      // nthreads depends on Cnvec, computed below
 
     //--------------------------------------------------------------------------
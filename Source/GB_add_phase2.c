@@ -296,7 +296,7 @@ GrB_Info GB_add_phase2      // C=A+B, C<M>=A+B, or C<!M>=A+B
         // if C is bitmap/full, then each matrix M, A, and B needs to be sliced
         // if they are sparse/hyper
         int nthreads_max = GB_Context_nthreads_max ( ) ;
-        double chunk = GB_Context_chunk ( ) ;
+        double chunk = GB_Context_chunk_family (GxB_CHUNK_ADD) ;
         if (M != NULL && (GB_IS_SPARSE (M) || GB_IS_HYPERSPARSE (M)))
         { 
             GB_SLICE_MATRIX (M, 8) ;
@@ -53,6 +53,9 @@ GrB_Info GB_apply                   // C<M> = accum (C, op(A)) or op(A')
     ASSERT_MATRIX_OK (A, "A input for GB_apply", GB0) ;
     ASSERT_OP_OK (op_in, "op for GB_apply", GB0) ;
 
+    // A is scanned, for adaptive sparsity
+    GB_sparsity_adapt_use (A, false, 0, 0) ;
+
     GB_Operator op = op_in ;
     GB_Opcode opcode = op->opcode ;
     GrB_Type T_type = op->ztype ;
@@ -197,6 +200,9 @@ GrB_Info GB_apply                   // C<M> = accum (C, op(A)) or op(A')
         GB_ERROR (GrB_EMPTY_OBJECT, "%s", "Scalar must contain an entry") ;
     }
 
+    // C is about to be modified, so its cached transpose is no longer valid
+    GB_transpose_cache_free (C) ;
+
     //--------------------------------------------------------------------------
     // rename binop and idxunop operators
     //--------------------------------------------------------------------------
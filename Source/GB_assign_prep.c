@@ -193,6 +193,17 @@ GrB_Info GB_assign_prep
     ASSERT (GB_JUMBLED_OK (C)) ;
     ASSERT (GB_PENDING_OK (C)) ;
 
+    // C is about to be modified, so its cached transpose is no longer valid
+    GB_transpose_cache_free (C) ;
+
+    // C is accessed at random, once for each entry of A or M (or of the
+    // submatrix C(Rows,Cols) if both are NULL), and A is scanned, for
+    // adaptive sparsity
+    GB_sparsity_adapt_use (C, true, (A != NULL) ? (double) GB_nnz_held (A) :
+        ((M != NULL) ? (double) GB_nnz_held (M) :
+        ((double) nRows_in) * ((double) nCols_in)), 0) ;
+    GB_sparsity_adapt_use (A, false, 0, 0) ;
+
     //--------------------------------------------------------------------------
     // check domains of C, M, A, and accum
     //--------------------------------------------------------------------------
@@ -7,17 +7,24 @@
 
 //------------------------------------------------------------------------------
 
+// JIT: done.
+
 // C=A(I,J), where A is bitmap or full, symbolic and numeric.
 // See GB_subref for details.
 
-// JIT: needed.
-
 #include "GB_subref.h"
 #include "GB_subassign_IxJ_slice.h"
+#include "GB_stringify.h"
 
-#define GB_FREE_ALL             \
-{                               \
-    GB_phybix_free (C) ;        \
+#define GB_FREE_WORKSPACE                       \
+{                                               \
+    GB_FREE_WORK (&TaskList, TaskList_size) ;   \
+}
+
+#define GB_FREE_ALL                             \
+{                                               \
+    GB_FREE_WORKSPACE ;                         \
+    GB_phybix_free (C) ;                        \
 }
 
 GrB_Info GB_bitmap_subref       // C = A(I,J): either symbolic or numeric
@@ -43,6 +50,7 @@ GrB_Info GB_bitmap_subref       // C = A(I,J): either symbolic or numeric
     //--------------------------------------------------------------------------
 
     GrB_Info info ;
+    GB_task_struct *TaskList = NULL ; size_t TaskList_size = 0 ;
     ASSERT (C != NULL && (C->static_header || GBNSTATIC)) ;
     ASSERT_MATRIX_OK (A, "A for C=A(I,J) bitmap subref", GB0) ;
     ASSERT (GB_IS_BITMAP (A) || GB_IS_FULL (A)) ;
@@ -109,21 +117,34 @@ GrB_Info GB_bitmap_subref       // C = A(I,J): either symbolic or numeric
     //--------------------------------------------------------------------------
 
     int8_t *restrict Cb = C->b ;
+    int64_t cnvals = 0 ;
+
+    if (sparsity == GxB_FULL && C_iso && !symbolic)
+    { 
+
+        //----------------------------------------------------------------------
+        // C=A(I,J) iso numeric with A and C full
+        //----------------------------------------------------------------------
+
+        memcpy (C->x, cscalar, ctype->size) ;
+        C->magic = GB_MAGIC ;
+        ASSERT_MATRIX_OK (C, "C output for bitmap subref C=A(I,J)", GB0) ;
+        return (GrB_SUCCESS) ;
+    }
 
-    // In GB_bitmap_assign_IxJ_template, vlen is the vector length of the
-    // submatrix C(I,J), but here the template is used to access A(I,J), and so
-    // the vector length is A->vlen, not C->vlen.  The pointers pA and pC are
-    // swapped in the macros below, since C=A(I,J) is being computed, instead
-    // of C(I,J)=A for the bitmap assignment.
+    //--------------------------------------------------------------------------
+    // create the tasks to iterate over IxJ
+    //--------------------------------------------------------------------------
 
-    int64_t vlen = avlen ;
+    int ntasks = 0, nthreads ;
+    GB_OK (GB_subassign_IxJ_slice (&TaskList, &TaskList_size, &ntasks,
+        &nthreads, /* I, */ nI, /* Ikind, Icolon, J, */ nJ,
+        /* Jkind, Jcolon, */ Werk)) ;
 
     //--------------------------------------------------------------------------
     // C = A(I,J)
     //--------------------------------------------------------------------------
 
-    int64_t cnvals = 0 ;
-
     if (sparsity == GxB_BITMAP)
     {
 
@@ -134,30 +155,10 @@ GrB_Info GB_bitmap_subref       // C = A(I,J): either symbolic or numeric
         // symbolic subref is only used by GB_subassign_symbolic, which only
         // operates on a matrix that is hypersparse, sparse, or full, but not
         // bitmap.  As a result, the symbolic subref C=A(I,J) where both A and
-        // C are bitmap is not needed.  The code is left here in case it is
-        // needed in the future.
+        // C are bitmap is not needed.
 
         ASSERT (!symbolic) ;
 
-        #if 0
-        if (symbolic)
-        {
-            // C=A(I,J) symbolic with A and C bitmap
-            ASSERT (GB_DEAD_CODE) ;
-            int64_t *restrict Cx = (int64_t *) C->x ;
-            #undef  GB_IXJ_WORK
-            #define GB_IXJ_WORK(pA,pC)                                      \
-            {                                                               \
-                int8_t ab = Ab [pA] ;                                       \
-                Cb [pC] = ab ;                                              \
-                Cx [pC] = pA ;                                              \
-                task_cnvals += ab ;                                         \
-            }
-            #include "GB_bitmap_assign_IxJ_template.c"
-        }
-        else
-        #endif
-
         if (C_iso)
         { 
 
@@ -166,39 +167,129 @@ GrB_Info GB_bitmap_subref       // C = A(I,J): either symbolic or numeric
             //------------------------------------------------------------------
 
             memcpy (C->x, cscalar, ctype->size) ;
-            #undef  GB_IXJ_WORK
-            #define GB_IXJ_WORK(pA,pC)                                      \
+            #define GB_IXJ_WORK(pC,pA)                                      \
             {                                                               \
                 int8_t ab = Ab [pA] ;                                       \
                 Cb [pC] = ab ;                                              \
                 task_cnvals += ab ;                                         \
             }
-            #include "GB_bitmap_assign_IxJ_template.c"
+            #include "GB_bitmap_subref_template.c"
+            #undef GB_IXJ_WORK
+            info = GrB_SUCCESS ;
 
         }
         else
-        { 
+        {
 
             //------------------------------------------------------------------
             // C=A(I,J) non-iso numeric with A and C bitmap; both non-iso
             //------------------------------------------------------------------
 
-            const GB_void *restrict Ax = (GB_void *) A->x ;
-                  GB_void *restrict Cx = (GB_void *) C->x ;
-            #undef  GB_IXJ_WORK
-            #define GB_IXJ_WORK(pA,pC)                                      \
-            {                                                               \
-                int8_t ab = Ab [pA] ;                                       \
-                Cb [pC] = ab ;                                              \
-                if (ab)                                                     \
+            info = GrB_NO_VALUE ;
+
+            #ifndef GBCOMPACT
+            GB_IF_FACTORY_KERNELS_ENABLED
+            { 
+                // C and A have the same type; no typecasting needed
+                #define GB_IXJ_WORK(pC,pA)                                  \
                 {                                                           \
-                    /* Cx [pC] = Ax [pA] */                                 \
-                    memcpy (Cx +((pC)*asize), Ax +((pA)*asize), asize) ;    \
-                    task_cnvals++ ;                                         \
-                }                                                           \
+                    int8_t ab = Ab [pA] ;                                   \
+                    Cb [pC] = ab ;                                          \
+                    if (ab)                                                 \
+                    {                                                       \
+                        Cx [pC] = Ax [pA] ;                                 \
+                        task_cnvals++ ;                                     \
+                    }                                                       \
+                }
+                switch (asize)
+                {
+                    case GB_1BYTE : // uint8, int8, bool, or 1-byte user
+                    {
+                        const uint8_t *restrict Ax = (uint8_t *) A->x ;
+                              uint8_t *restrict Cx = (uint8_t *) C->x ;
+                        #include "GB_bitmap_subref_template.c"
+                        info = GrB_SUCCESS ;
+                    }
+                    break ;
+
+                    case GB_2BYTE : // uint16, int16, or 2-byte user
+                    {
+                        const uint16_t *restrict Ax = (uint16_t *) A->x ;
+                              uint16_t *restrict Cx = (uint16_t *) C->x ;
+                        #include "GB_bitmap_subref_template.c"
+                        info = GrB_SUCCESS ;
+                    }
+                    break ;
+
+                    case GB_4BYTE : // uint32, int32, float, or 4-byte user
+                    {
+                        const uint32_t *restrict Ax = (uint32_t *) A->x ;
+                              uint32_t *restrict Cx = (uint32_t *) C->x ;
+                        #include "GB_bitmap_subref_template.c"
+                        info = GrB_SUCCESS ;
+                    }
+                    break ;
+
+                    case GB_8BYTE : // uint64, int64, double, float
+                                    // complex, or 8-byte user
+                    {
+                        const uint64_t *restrict Ax = (uint64_t *) A->x ;
+                              uint64_t *restrict Cx = (uint64_t *) C->x ;
+                        #include "GB_bitmap_subref_template.c"
+                        info = GrB_SUCCESS ;
+                    }
+                    break ;
+
+                    case GB_16BYTE : // double complex or 16-byte user
+                    {
+                        const GB_blob16 *restrict Ax = (GB_blob16 *) A->x ;
+                              GB_blob16 *restrict Cx = (GB_blob16 *) C->x ;
+                        #include "GB_bitmap_subref_template.c"
+                        info = GrB_SUCCESS ;
+                    }
+                    break ;
+
+                    default:;
+                }
+                #undef GB_IXJ_WORK
             }
-            #include "GB_bitmap_assign_IxJ_template.c"
+            #endif
 
+            //------------------------------------------------------------------
+            // via the JIT or PreJIT kernel
+            //------------------------------------------------------------------
+
+            if (info == GrB_NO_VALUE)
+            { 
+                info = GB_bitmap_subref_jit (C, A, I, nI, Ikind, Icolon,
+                    J, Jkind, Jcolon, TaskList, ntasks, nthreads) ;
+                // the JIT kernel computes C->nvals itself
+                cnvals = C->nvals ;
+            }
+
+            //------------------------------------------------------------------
+            // via the generic kernel
+            //------------------------------------------------------------------
+
+            if (info == GrB_NO_VALUE)
+            { 
+                const GB_void *restrict Ax = (GB_void *) A->x ;
+                      GB_void *restrict Cx = (GB_void *) C->x ;
+                #define GB_IXJ_WORK(pC,pA)                                  \
+                {                                                           \
+                    int8_t ab = Ab [pA] ;                                   \
+                    Cb [pC] = ab ;                                          \
+                    if (ab)                                                 \
+                    {                                                       \
+                        /* Cx [pC] = Ax [pA] */                             \
+                        memcpy (Cx +((pC)*asize), Ax +((pA)*asize), asize) ; \
+                        task_cnvals++ ;                                     \
+                    }                                                       \
+                }
+                #include "GB_bitmap_subref_template.c"
+                #undef GB_IXJ_WORK
+                info = GrB_SUCCESS ;
+            }
         }
 
         C->nvals = cnvals ;
@@ -219,47 +310,128 @@ GrB_Info GB_bitmap_subref       // C = A(I,J): either symbolic or numeric
             //------------------------------------------------------------------
 
             int64_t *restrict Cx = (int64_t *) C->x ;
-            #undef  GB_IXJ_WORK
-            #define GB_IXJ_WORK(pA,pC)                                      \
+            #define GB_IXJ_WORK(pC,pA)                                      \
             {                                                               \
                 Cx [pC] = pA ;                                              \
             }
-            #include "GB_bitmap_assign_IxJ_template.c"
+            #include "GB_bitmap_subref_template.c"
+            #undef GB_IXJ_WORK
+            info = GrB_SUCCESS ;
 
         }
-        else if (C_iso)
-        { 
+        else
+        {
 
             //------------------------------------------------------------------
-            // C=A(I,J) iso numeric with A and C full
+            // C=A(I,J) non-iso numeric with A and C full, both are non-iso
             //------------------------------------------------------------------
 
-            memcpy (C->x, cscalar, ctype->size) ;
+            info = GrB_NO_VALUE ;
 
-        }
-        else
-        { 
+            #ifndef GBCOMPACT
+            GB_IF_FACTORY_KERNELS_ENABLED
+            { 
+                // C and A have the same type; no typecasting needed
+                #define GB_IXJ_WORK(pC,pA)                                  \
+                {                                                           \
+                    Cx [pC] = Ax [pA] ;                                     \
+                }
+                switch (asize)
+                {
+                    case GB_1BYTE : // uint8, int8, bool, or 1-byte user
+                    {
+                        const uint8_t *restrict Ax = (uint8_t *) A->x ;
+                              uint8_t *restrict Cx = (uint8_t *) C->x ;
+                        #include "GB_bitmap_subref_template.c"
+                        info = GrB_SUCCESS ;
+                    }
+                    break ;
+
+                    case GB_2BYTE : // uint16, int16, or 2-byte user
+                    {
+                        const uint16_t *restrict Ax = (uint16_t *) A->x ;
+                              uint16_t *restrict Cx = (uint16_t *) C->x ;
+                        #include "GB_bitmap_subref_template.c"
+                        info = GrB_SUCCESS ;
+                    }
+                    break ;
+
+                    case GB_4BYTE : // uint32, int32, float, or 4-byte user
+                    {
+                        const uint32_t *restrict Ax = (uint32_t *) A->x ;
+                              uint32_t *restrict Cx = (uint32_t *) C->x ;
+                        #include "GB_bitmap_subref_template.c"
+                        info = GrB_SUCCESS ;
+                    }
+                    break ;
+
+                    case GB_8BYTE : // uint64, int64, double, float
+                                    // complex, or 8-byte user
+                    {
+                        const uint64_t *restrict Ax = (uint64_t *) A->x ;
+                              uint64_t *restrict Cx = (uint64_t *) C->x ;
+                        #include "GB_bitmap_subref_template.c"
+                        info = GrB_SUCCESS ;
+                    }
+                    break ;
+
+                    case GB_16BYTE : // double complex or 16-byte user
+                    {
+                        const GB_blob16 *restrict Ax = (GB_blob16 *) A->x ;
+                              GB_blob16 *restrict Cx = (GB_blob16 *) C->x ;
+                        #include "GB_bitmap_subref_template.c"
+                        info = GrB_SUCCESS ;
+                    }
+                    break ;
+
+                    default:;
+                }
+                #undef GB_IXJ_WORK
+            }
+            #endif
 
             //------------------------------------------------------------------
-            // C=A(I,J) non-iso numeric with A and C full, both are non-iso
+            // via the JIT or PreJIT kernel
             //------------------------------------------------------------------
 
-            const GB_void *restrict Ax = (GB_void *) A->x ;
-                  GB_void *restrict Cx = (GB_void *) C->x ;
-            #undef  GB_IXJ_WORK
-            #define GB_IXJ_WORK(pA,pC)                                      \
-            {                                                               \
-                /* Cx [pC] = Ax [pA] */                                     \
-                memcpy (Cx +((pC)*asize), Ax +((pA)*asize), asize) ;        \
+            if (info == GrB_NO_VALUE)
+            { 
+                info = GB_bitmap_subref_jit (C, A, I, nI, Ikind, Icolon,
+                    J, Jkind, Jcolon, TaskList, ntasks, nthreads) ;
+            }
+
+            //------------------------------------------------------------------
+            // via the generic kernel
+            //------------------------------------------------------------------
+
+            if (info == GrB_NO_VALUE)
+            { 
+                const GB_void *restrict Ax = (GB_void *) A->x ;
+                      GB_void *restrict Cx = (GB_void *) C->x ;
+                #define GB_IXJ_WORK(pC,pA)                                  \
+                {                                                           \
+                    /* Cx [pC] = Ax [pA] */                                 \
+                    memcpy (Cx +((pC)*asize), Ax +((pA)*asize), asize) ;    \
+                }
+                #include "GB_bitmap_subref_template.c"
+                #undef GB_IXJ_WORK
+                info = GrB_SUCCESS ;
             }
-            #include "GB_bitmap_assign_IxJ_template.c"
         }
     }
 
+    if (info != GrB_SUCCESS)
+    { 
+        // out of memory, or other error
+        GB_FREE_ALL ;
+        return (info) ;
+    }
+
     //--------------------------------------------------------------------------
     // return result
     //--------------------------------------------------------------------------
 
+    GB_FREE_WORKSPACE ;
     C->magic = GB_MAGIC ;
     ASSERT_MATRIX_OK (C, "C output for bitmap subref C=A(I,J)", GB0) ;
     return (GrB_SUCCESS) ;
@@ -55,6 +55,7 @@ GB_CALLBACK_BIX_ALLOC_PROTO (GB_bix_alloc)
     { 
         // sparsity: sparse / hyper / auto 
         A->i = GB_MALLOC (nzmax, int64_t, &(A->i_size)) ;
+        GB_numa_bind (A->i, A->i_size) ;
         ok = (A->i != NULL) ;
         if (ok) A->i [0] = 0 ;
     }
@@ -75,5 +75,8 @@ void GB_bix_free                // free A->b, A->i, and A->x of a matrix
 
     // free the list of pending tuples
     GB_Pending_free (&(A->Pending)) ;
+
+    // the cached transpose of A is no longer valid
+    GB_transpose_cache_free (A) ;
 }
 
@@ -57,4 +57,19 @@ GrB_Info GB_builder                 // build a matrix from tuples
     GB_Werk Werk
 ) ;
 
+// GB_build_file reads tuples in blocks of GB_BUILD_FILE_BLOCK tuples, and
+// uses GB_BUILD_FILE_MEMORY bytes of workspace by default
+#define GB_BUILD_FILE_BLOCK  (64 * 1024)
+#define GB_BUILD_FILE_MEMORY ((size_t) 1024 * 1024 * 1024)
+
+GrB_Info GB_build_file          // build a matrix from a file of tuples
+(
+    GrB_Matrix C,               // matrix to build
+    FILE *f,                    // file of binary (row,col,value) tuples
+    const GrB_Type xtype,       // type of the values in the file
+    const GrB_BinaryOp dup,     // binary op to assemble duplicates
+    size_t memory,              // workspace limit in bytes (0: default)
+    GB_Werk Werk
+) ;
+
 #endif
@@ -0,0 +1,743 @@
+//------------------------------------------------------------------------------
+// GB_build_file: build a matrix from a file of tuples, in bounded memory
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// JIT: not needed.  Only one variant possible.
+
+// CALLED BY: GxB_Matrix_build_File
+// CALLS:     GB_builder
+
+// GB_build_file constructs a matrix C from a file of binary tuples, read from
+// the current position of the file f until the end of the file.  Each tuple
+// is held as (int64_t row, int64_t col, value), with no padding, where the
+// value has type xtype.  The result is the same as GB_build on the same list
+// of tuples, but the whole list is never held in memory.
+
+// The tuples are read in chunks, each of which fits in the memory workspace
+// limit.  Each chunk is built by GB_builder into a hypersparse matrix T,
+// assembling any duplicates in the chunk.  If the whole file fits in a single
+// chunk, T is the result, and no temporary files are used.  Otherwise, the
+// entries of T are written as a sorted run of (j,i,x) tuples to a temporary
+// file (created by tmpfile), and T is freed.  The runs are then merged with a
+// k-way merge, using a heap, with ties broken by the run number so that
+// duplicates are assembled in the same order as GB_build.  The merge is done
+// twice: once to count the entries and vectors of the result, and once more
+// to fill in the hypersparse result, which is allocated at its exact size.
+// The peak memory is thus the workspace limit, or the size of the final
+// matrix plus a small buffer for each run, whichever is larger.
+
+// Duplicates are assembled with the dup operator in the type of dup, with no
+// typecasting, as in GB_build.  If dup is NULL, any duplicates are an error.
+// If dup is GxB_IGNORE_DUP, the last tuple for each (i,j) is kept.
+
+// Errors in the input file (a partial tuple at the end, or a read error) are
+// returned as GrB_INVALID_VALUE.  Failure to create, write, or read back a
+// temporary file is returned as GrB_OUT_OF_MEMORY, since the temporary files
+// act as external memory.  The file f is not closed.
+
+#include "GB_build.h"
+
+#define GB_FREE_WORKSPACE                                   \
+{                                                           \
+    GB_FREE_WORK (&Buf, Buf_size) ;                         \
+    GB_FREE (&I_work, I_work_size) ;                        \
+    GB_FREE (&J_work, J_work_size) ;                        \
+    GB_FREE (&S_work, S_work_size) ;                        \
+    GB_build_file_free_runs (&Runs, &Runs_size, nruns) ;    \
+    GB_FREE_WORK (&Heap, Heap_size) ;                       \
+}
+
+#define GB_FREE_ALL                                         \
+{                                                           \
+    GB_FREE_WORKSPACE ;                                     \
+    GB_phybix_free (T) ;                                    \
+}
+
+//------------------------------------------------------------------------------
+// GB_build_run: a sorted run of tuples, held in a temporary file
+//------------------------------------------------------------------------------
+
+typedef struct
+{
+    FILE *f ;               // temporary file holding the run
+    int64_t n ;             // # of tuples in the run
+    int64_t nleft ;         // # of tuples in the file not yet read
+    GB_void *buf ;          // buffer of tuples read from the file
+    size_t buf_size ;
+    int64_t nbuf ;          // # of tuples in the buffer
+    int64_t k ;             // current tuple in the buffer
+}
+GB_build_run ;
+
+//------------------------------------------------------------------------------
+// GB_build_file_free_runs: close and free all runs
+//------------------------------------------------------------------------------
+
+static void GB_build_file_free_runs
+(
+    GB_build_run **Runs_handle,
+    size_t *Runs_size_handle,
+    int64_t nruns
+)
+{
+    GB_build_run *Runs = (*Runs_handle) ;
+    if (Runs == NULL) return ;
+    for (int64_t r = 0 ; r < nruns ; r++)
+    {
+        if (Runs [r].f != NULL) fclose (Runs [r].f) ;
+        GB_FREE_WORK (&(Runs [r].buf), Runs [r].buf_size) ;
+    }
+    GB_FREE_WORK (Runs_handle, *Runs_size_handle) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_build_run_next: advance to the next tuple in a run
+//------------------------------------------------------------------------------
+
+// Returns 1 if the next tuple is available, 0 if the run is exhausted, or -1
+// if the temporary file cannot be read.
+
+static inline int GB_build_run_next
+(
+    GB_build_run *run,
+    size_t qsize,           // size of each tuple in the run
+    int64_t nbuf_max        // size of the buffer, in # of tuples
+)
+{
+    run->k++ ;
+    if (run->k < run->nbuf) return (1) ;
+    // refill the buffer from the file
+    int64_t nb = GB_IMIN (nbuf_max, run->nleft) ;
+    if (nb == 0) return (0) ;
+    if (fread (run->buf, qsize, nb, run->f) != (size_t) nb) return (-1) ;
+    run->nleft -= nb ;
+    run->nbuf = nb ;
+    run->k = 0 ;
+    return (1) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_build_run_less: compare the current tuples of two runs
+//------------------------------------------------------------------------------
+
+// Tuples are ordered by (j,i), with ties broken by the run number, so that
+// duplicates in earlier runs come first.
+
+static inline bool GB_build_run_less
+(
+    const GB_build_run *Runs,
+    const int64_t a,
+    const int64_t b,
+    const size_t qsize
+)
+{
+    int64_t ka [2], kb [2] ;
+    memcpy (ka, Runs [a].buf + Runs [a].k * qsize, 2 * sizeof (int64_t)) ;
+    memcpy (kb, Runs [b].buf + Runs [b].k * qsize, 2 * sizeof (int64_t)) ;
+    if (ka [0] != kb [0]) return (ka [0] < kb [0]) ;
+    if (ka [1] != kb [1]) return (ka [1] < kb [1]) ;
+    return (a < b) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_build_heap_down: restore the heap property from position p downwards
+//------------------------------------------------------------------------------
+
+static inline void GB_build_heap_down
+(
+    int64_t *restrict Heap,
+    const int64_t nheap,
+    int64_t p,
+    const GB_build_run *Runs,
+    const size_t qsize
+)
+{
+    const int64_t r = Heap [p] ;
+    while (true)
+    {
+        int64_t c = 2*p + 1 ;
+        if (c >= nheap) break ;
+        if (c+1 < nheap && GB_build_run_less (Runs, Heap [c+1], Heap [c],
+            qsize))
+        {
+            c++ ;
+        }
+        if (!GB_build_run_less (Runs, Heap [c], r, qsize)) break ;
+        Heap [p] = Heap [c] ;
+        p = c ;
+    }
+    Heap [p] = r ;
+}
+
+//------------------------------------------------------------------------------
+// GB_build_file_merge: merge all runs into T, or just count the result
+//------------------------------------------------------------------------------
+
+static GrB_Info GB_build_file_merge
+(
+    GrB_Matrix T,               // result, or NULL to just count
+    int64_t *tnvals,            // # of entries in the result
+    int64_t *tnvec,             // # of vectors in the result
+    int64_t *ndupl,             // # of duplicates found
+    GB_build_run *Runs,
+    const int64_t nruns,
+    int64_t *restrict Heap,     // workspace of size nruns
+    const int64_t nbuf_max,     // size of each run buffer, in # of tuples
+    const size_t qsize,         // size of each tuple in a run
+    const size_t tsize,         // size of each value
+    GxB_binary_function fdup    // dup operator, or NULL to keep the last one
+)
+{
+
+    //--------------------------------------------------------------------------
+    // rewind each run and load its first tuple
+    //--------------------------------------------------------------------------
+
+    int64_t nheap = 0 ;
+    for (int64_t r = 0 ; r < nruns ; r++)
+    {
+        GB_build_run *run = &(Runs [r]) ;
+        rewind (run->f) ;
+        run->nleft = run->n ;
+        run->nbuf = 0 ;
+        run->k = -1 ;
+        int status = GB_build_run_next (run, qsize, nbuf_max) ;
+        if (status < 0)
+        {
+            // unable to read the temporary file
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        if (status > 0) Heap [nheap++] = r ;
+    }
+
+    for (int64_t p = nheap / 2 - 1 ; p >= 0 ; p--)
+    {
+        GB_build_heap_down (Heap, nheap, p, Runs, qsize) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // merge the runs
+    //--------------------------------------------------------------------------
+
+    int64_t *restrict Tp = (T == NULL) ? NULL : T->p ;
+    int64_t *restrict Th = (T == NULL) ? NULL : T->h ;
+    int64_t *restrict Ti = (T == NULL) ? NULL : T->i ;
+    GB_void *restrict Tx = (T == NULL) ? NULL : (GB_void *) T->x ;
+
+    int64_t jlast = -1, ilast = -1, nvals = 0, nvec = 0, nd = 0 ;
+    while (nheap > 0)
+    {
+
+        //----------------------------------------------------------------------
+        // get the smallest tuple (j,i,x) from the run at the top of the heap
+        //----------------------------------------------------------------------
+
+        GB_build_run *run = &(Runs [Heap [0]]) ;
+        const GB_void *q = run->buf + run->k * qsize ;
+        int64_t ji [2] ;
+        memcpy (ji, q, 2 * sizeof (int64_t)) ;
+        const int64_t j = ji [0] ;
+        const int64_t i = ji [1] ;
+        const GB_void *x = q + 2 * sizeof (int64_t) ;
+
+        //----------------------------------------------------------------------
+        // append the tuple to T, or assemble it as a duplicate
+        //----------------------------------------------------------------------
+
+        if (j == jlast && i == ilast)
+        {
+            // T(i,j) = dup (T(i,j), x)
+            nd++ ;
+            if (Tx != NULL)
+            {
+                GB_void *t = Tx + (nvals-1) * tsize ;
+                if (fdup == NULL)
+                {
+                    memcpy (t, x, tsize) ;
+                }
+                else
+                {
+                    fdup (t, t, x) ;
+                }
+            }
+        }
+        else
+        {
+            if (j != jlast)
+            {
+                // vector j starts at position nvals
+                if (Th != NULL)
+                {
+                    Th [nvec] = j ;
+                    Tp [nvec] = nvals ;
+                }
+                nvec++ ;
+                jlast = j ;
+            }
+            if (Ti != NULL)
+            {
+                Ti [nvals] = i ;
+                memcpy (Tx + nvals * tsize, x, tsize) ;
+            }
+            nvals++ ;
+            ilast = i ;
+        }
+
+        //----------------------------------------------------------------------
+        // advance the run and restore the heap
+        //----------------------------------------------------------------------
+
+        int status = GB_build_run_next (run, qsize, nbuf_max) ;
+        if (status < 0)
+        {
+            // unable to read the temporary file
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        if (status == 0)
+        {
+            // the run is exhausted
+            Heap [0] = Heap [--nheap] ;
+        }
+        if (nheap > 0)
+        {
+            GB_build_heap_down (Heap, nheap, 0, Runs, qsize) ;
+        }
+    }
+
+    if (Tp != NULL)
+    {
+        Tp [nvec] = nvals ;
+    }
+    (*tnvals) = nvals ;
+    (*tnvec) = nvec ;
+    (*ndupl) = nd ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_build_file
+//------------------------------------------------------------------------------
+
+GrB_Info GB_build_file          // build a matrix from a file of tuples
+(
+    GrB_Matrix C,               // matrix to build
+    FILE *f,                    // file of binary (row,col,value) tuples
+    const GrB_Type xtype,       // type of the values in the file
+    const GrB_BinaryOp dup,     // binary op to assemble duplicates
+    size_t memory,              // workspace limit in bytes (0: default)
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (C != NULL) ;
+    GB_void *restrict Buf = NULL ; size_t Buf_size = 0 ;
+    int64_t *I_work = NULL ; size_t I_work_size = 0 ;
+    int64_t *J_work = NULL ; size_t J_work_size = 0 ;
+    GB_void *S_work = NULL ; size_t S_work_size = 0 ;
+    GB_build_run *Runs = NULL ; size_t Runs_size = 0 ;
+    int64_t *restrict Heap = NULL ; size_t Heap_size = 0 ;
+    int64_t nruns = 0, nruns_max = 0 ;
+    struct GB_Matrix_opaque T_header ;
+    GrB_Matrix T = NULL ;
+    GB_CLEAR_STATIC_HEADER (T, &T_header) ;
+
+    if (GB_nnz (C) > 0 || GB_PENDING (C))
+    {
+        GB_ERROR (GrB_OUTPUT_NOT_EMPTY,
+            "Output already has %s", "existing entries") ;
+    }
+
+    GB_RETURN_IF_NULL (f) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (xtype) ;
+    if (!GB_Type_compatible (xtype, C->type))
+    {
+        GB_ERROR (GrB_DOMAIN_MISMATCH,
+            "Value(s) of type [%s] cannot be typecast to matrix of type"
+            " [%s]\n", xtype->name, C->type->name) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // check the dup operator
+    //--------------------------------------------------------------------------
+
+    GrB_BinaryOp dup2 = NULL ;
+    bool discard_duplicates = (dup == NULL || dup == GxB_IGNORE_DUP) ;
+    if (!discard_duplicates)
+    {
+        dup2 = dup ;
+        GB_RETURN_IF_FAULTY (dup) ;
+        if (GB_OP_IS_POSITIONAL (dup))
+        {
+            GB_ERROR (GrB_DOMAIN_MISMATCH, "Positional op z=%s(x,y) "
+                "not supported as dup op\n", dup->name) ;
+        }
+        if (dup->xtype != dup->ztype || dup->ytype != dup->ztype)
+        {
+            GB_ERROR (GrB_DOMAIN_MISMATCH, "All domains of dup "
+                "operator for assembling duplicates must be identical.\n"
+                "operator is: [%s] = %s ([%s],[%s])", dup->ztype->name,
+                dup->name, dup->xtype->name, dup->ytype->name) ;
+        }
+        if (!GB_Type_compatible (C->type, dup->ztype))
+        {
+            GB_ERROR (GrB_DOMAIN_MISMATCH,
+                "Operator [%s] for assembling duplicates has type [%s],\n"
+                "cannot be typecast to entries in output of type [%s]",
+                dup->name, dup->ztype->name, C->type->name) ;
+        }
+    }
+
+    // C has no entries on input, and it is not modified until T is
+    // transplanted into it, so C is unchanged if an error is found partway
+    // through the file.
+
+    //--------------------------------------------------------------------------
+    // determine the chunk size
+    //--------------------------------------------------------------------------
+
+    // Each tuple in a chunk takes about 64 + xsize + tsize bytes of memory:
+    // I_work, J_work, and S_work, the K_work and sort workspace in
+    // GB_builder, and T->i and T->x.
+
+    const int64_t vlen = C->vlen ;
+    const int64_t vdim = C->vdim ;
+    const bool is_csc = C->is_csc ;
+    const int64_t nrows = GB_NROWS (C) ;
+    const int64_t ncols = GB_NCOLS (C) ;
+    GrB_Type ttype = (discard_duplicates) ? xtype : dup->ztype ;
+    const size_t xsize = xtype->size ;
+    const size_t tsize = ttype->size ;
+    const size_t rsize = 2 * sizeof (int64_t) + xsize ;     // file tuple
+    const size_t qsize = 2 * sizeof (int64_t) + tsize ;     // run tuple
+    if (memory == 0) memory = GB_BUILD_FILE_MEMORY ;
+    const int64_t chunk = GB_IMAX (GB_BUILD_FILE_BLOCK,
+        (int64_t) (memory / (64 + xsize + tsize))) ;
+
+    Buf = GB_MALLOC_WORK (GB_BUILD_FILE_BLOCK * GB_IMAX (rsize, qsize),
+        GB_void, &Buf_size) ;
+    if (Buf == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // read and build each chunk, and spill each one to a run
+    //--------------------------------------------------------------------------
+
+    int64_t ntuples = 0 ;
+    bool done = false ;
+    while (!done)
+    {
+
+        //----------------------------------------------------------------------
+        // allocate the tuples for this chunk
+        //----------------------------------------------------------------------
+
+        I_work = GB_MALLOC (chunk, int64_t, &I_work_size) ;
+        J_work = (vdim > 1) ? GB_MALLOC (chunk, int64_t, &J_work_size) : NULL ;
+        S_work = GB_MALLOC (chunk * xsize, GB_void, &S_work_size) ;
+        if (I_work == NULL || (vdim > 1 && J_work == NULL) || S_work == NULL)
+        {
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+
+        //----------------------------------------------------------------------
+        // read the next chunk of tuples, one block at a time
+        //----------------------------------------------------------------------
+
+        int64_t n = 0 ;
+        while (n < chunk && !done)
+        {
+            int64_t nb = GB_IMIN (GB_BUILD_FILE_BLOCK, chunk - n) ;
+            size_t nbytes = fread (Buf, 1, nb * rsize, f) ;
+            if (nbytes % rsize != 0 || (nbytes < nb * rsize && ferror (f)))
+            {
+                GB_FREE_ALL ;
+                GB_ERROR (GrB_INVALID_VALUE, "Unable to read tuple " GBd
+                    " from the input file", ntuples + n + nbytes / rsize) ;
+            }
+            int64_t ngot = nbytes / rsize ;
+            for (int64_t t = 0 ; t < ngot ; t++, n++)
+            {
+                const GB_void *q = Buf + t * rsize ;
+                int64_t rc [2] ;
+                memcpy (rc, q, 2 * sizeof (int64_t)) ;
+                int64_t row = rc [0] ;
+                int64_t col = rc [1] ;
+                if (row < 0 || row >= nrows || col < 0 || col >= ncols)
+                {
+                    GB_FREE_ALL ;
+                    GB_ERROR (GrB_INDEX_OUT_OF_BOUNDS,
+                        "index (" GBd "," GBd ") out of bounds,"
+                        " must be < (" GBd ", " GBd ")",
+                        row, col, nrows, ncols) ;
+                }
+                I_work [n] = is_csc ? row : col ;
+                if (J_work != NULL) J_work [n] = is_csc ? col : row ;
+                memcpy (S_work + n * xsize, q + 2 * sizeof (int64_t), xsize) ;
+            }
+            if (ngot < nb)
+            {
+                // end of the input file
+                done = true ;
+            }
+        }
+
+        if (!done)
+        {
+            // check if the chunk ends exactly at the end of the input file
+            int c = getc (f) ;
+            if (c == EOF)
+            {
+                done = true ;
+            }
+            else
+            {
+                ungetc (c, f) ;
+            }
+        }
+
+        if (n == 0 && nruns > 0)
+        {
+            // the last run has already been written
+            GB_FREE (&I_work, I_work_size) ;
+            GB_FREE (&J_work, J_work_size) ;
+            GB_FREE (&S_work, S_work_size) ;
+            break ;
+        }
+
+        //----------------------------------------------------------------------
+        // build the chunk T from the tuples
+        //----------------------------------------------------------------------
+
+        // I_work, J_work, and S_work are transplanted into T or freed
+        GB_OK (GB_builder (
+            T,              // create T using a static header
+            ttype,          // the type of T
+            vlen,           // T->vlen = C->vlen
+            vdim,           // T->vdim = C->vdim
+            is_csc,         // T has the same CSR/CSC format as C
+            &I_work,        // I_work_handle, freed on output
+            &I_work_size,
+            &J_work,        // J_work_handle, freed on output
+            &J_work_size,
+            &S_work,        // S_work_handle, freed or transplanted into T
+            &S_work_size,
+            false,          // known_sorted: not yet known
+            false,          // known_no_duplicates: not yet known
+            chunk,          // size of I_work, J_work, and S_work
+            true,           // T is a GrB_Matrix
+            NULL, NULL, NULL, false,
+            n,              // number of tuples
+            dup2,           // operator to assemble duplicates (may be NULL)
+            xtype,          // type of the S_work array
+            nruns == 0,     // burble only for the first chunk
+            Werk
+        )) ;
+
+        int64_t tnvals = GB_nnz (T) ;
+        if (dup == NULL && n != tnvals)
+        {
+            GB_FREE_ALL ;
+            GB_ERROR (GrB_INVALID_VALUE, "Duplicates appear (" GBd ") but dup "
+                "is NULL", n - tnvals) ;
+        }
+        ntuples += n ;
+
+        if (done && nruns == 0)
+        {
+            // the whole file fits in a single chunk; T is the result
+            break ;
+        }
+
+        //----------------------------------------------------------------------
+        // write T to a new run
+        //----------------------------------------------------------------------
+
+        if (nruns == nruns_max)
+        {
+            int64_t nruns_new = GB_IMAX (2 * nruns_max, 16) ;
+            if (Runs == NULL)
+            {
+                Runs = GB_MALLOC_WORK (nruns_new, GB_build_run, &Runs_size) ;
+            }
+            else
+            {
+                bool ok ;
+                GB_REALLOC_WORK (Runs, nruns_new, GB_build_run, &Runs_size,
+                    &ok) ;
+                if (!ok)
+                {
+                    // out of memory
+                    GB_FREE_ALL ;
+                    return (GrB_OUT_OF_MEMORY) ;
+                }
+            }
+            if (Runs == NULL)
+            {
+                // out of memory
+                GB_FREE_ALL ;
+                return (GrB_OUT_OF_MEMORY) ;
+            }
+            nruns_max = nruns_new ;
+        }
+
+        GB_build_run *run = &(Runs [nruns++]) ;
+        memset (run, 0, sizeof (GB_build_run)) ;
+        run->f = tmpfile ( ) ;
+        run->n = tnvals ;
+        if (run->f == NULL)
+        {
+            GB_FREE_ALL ;
+            GB_ERROR (GrB_OUT_OF_MEMORY, "Unable to create %s",
+                "temporary file") ;
+        }
+
+        const int64_t *restrict Tp = T->p ;
+        const int64_t *restrict Th = T->h ;
+        const int64_t *restrict Ti = T->i ;
+        const GB_void *restrict Tx = (GB_void *) T->x ;
+        const bool T_iso = T->iso ;
+        size_t nq = 0 ;
+        bool ok = true ;
+        for (int64_t k = 0 ; k < T->nvec && ok ; k++)
+        {
+            int64_t j = Th [k] ;
+            for (int64_t p = Tp [k] ; p < Tp [k+1] ; p++)
+            {
+                GB_void *q = Buf + nq * qsize ;
+                int64_t ji [2] = { j, Ti [p] } ;
+                memcpy (q, ji, 2 * sizeof (int64_t)) ;
+                memcpy (q + 2 * sizeof (int64_t), Tx + (T_iso ? 0 : p) * tsize,
+                    tsize) ;
+                if (++nq == GB_BUILD_FILE_BLOCK)
+                {
+                    ok = ok && (fwrite (Buf, qsize, nq, run->f) == nq) ;
+                    nq = 0 ;
+                }
+            }
+        }
+        ok = ok && (fwrite (Buf, qsize, nq, run->f) == nq) ;
+        ok = ok && (fflush (run->f) == 0) ;
+        GB_phybix_free (T) ;
+        if (!ok)
+        {
+            GB_FREE_ALL ;
+            GB_ERROR (GrB_OUT_OF_MEMORY, "Unable to write %s",
+                "temporary file") ;
+        }
+    }
+
+    GB_FREE_WORK (&Buf, Buf_size) ;
+
+    //--------------------------------------------------------------------------
+    // merge the runs into T
+    //--------------------------------------------------------------------------
+
+    if (nruns > 0)
+    {
+
+        GBURBLE ("(merge " GBd " runs) ", nruns) ;
+
+        //----------------------------------------------------------------------
+        // allocate a buffer for each run, and the heap
+        //----------------------------------------------------------------------
+
+        int64_t nbuf_max = GB_IMAX (1, (int64_t) (memory / (nruns * qsize))) ;
+        nbuf_max = GB_IMIN (nbuf_max, GB_BUILD_FILE_BLOCK) ;
+        Heap = GB_MALLOC_WORK (nruns, int64_t, &Heap_size) ;
+        bool ok = (Heap != NULL) ;
+        for (int64_t r = 0 ; r < nruns && ok ; r++)
+        {
+            int64_t nb = GB_IMAX (1, GB_IMIN (nbuf_max, Runs [r].n)) ;
+            Runs [r].buf = GB_MALLOC_WORK (nb * qsize, GB_void,
+                &(Runs [r].buf_size)) ;
+            ok = (Runs [r].buf != NULL) ;
+        }
+        if (!ok)
+        {
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+
+        //----------------------------------------------------------------------
+        // count the entries and vectors in the result
+        //----------------------------------------------------------------------
+
+        GxB_binary_function fdup = (dup2 == NULL) ? NULL :
+            dup2->binop_function ;
+        int64_t tnvals, tnvec, ndupl ;
+        info = GB_build_file_merge (NULL, &tnvals, &tnvec, &ndupl, Runs, nruns,
+            Heap, nbuf_max, qsize, tsize, fdup) ;
+        if (info != GrB_SUCCESS)
+        {
+            GB_FREE_ALL ;
+            GB_ERROR (GrB_OUT_OF_MEMORY, "Unable to read %s",
+                "temporary file") ;
+        }
+        if (dup == NULL && ndupl > 0)
+        {
+            GB_FREE_ALL ;
+            GB_ERROR (GrB_INVALID_VALUE, "Duplicates appear (" GBd ") but dup "
+                "is NULL", ndupl) ;
+        }
+
+        //----------------------------------------------------------------------
+        // allocate T and merge the runs into it
+        //----------------------------------------------------------------------
+
+        GB_OK (GB_new_bix (&T, // hyper, existing header
+            ttype, vlen, vdim, GB_Ap_malloc, is_csc, GxB_HYPERSPARSE, false,
+            C->hyper_switch, tnvec, tnvals, true, false)) ;
+        info = GB_build_file_merge (T, &tnvals, &tnvec, &ndupl, Runs, nruns,
+            Heap, nbuf_max, qsize, tsize, fdup) ;
+        if (info != GrB_SUCCESS)
+        {
+            GB_FREE_ALL ;
+            GB_ERROR (GrB_OUT_OF_MEMORY, "Unable to read %s",
+                "temporary file") ;
+        }
+        T->nvec = tnvec ;
+        T->nvec_nonempty = tnvec ;
+        T->nvals = tnvals ;
+        T->magic = GB_MAGIC ;
+    }
+
+    GB_FREE_WORKSPACE ;
+
+    //--------------------------------------------------------------------------
+    // determine if T is iso
+    //--------------------------------------------------------------------------
+
+    if (GB_check_if_iso (T))
+    {
+        // All entries in T are the same; convert T to iso
+        GBURBLE ("(post iso) ") ;
+        T->iso = true ;
+        GB_OK (GB_convert_any_to_iso (T, NULL)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // transplant and typecast T into C, conform C, and free T
+    //--------------------------------------------------------------------------
+
+    ASSERT_MATRIX_OK (T, "T built from file", GB0) ;
+    ASSERT (GB_IS_HYPERSPARSE (T)) ;
+    return (GB_transplant_conform (C, C->type, &T, Werk)) ;
+}
+
@@ -30,7 +30,9 @@
 // STEP 1: copy user input.  O(e/p) read/write per thread, or skipped.
 
 // STEP 2: sort the tuples.  Time: O((e log e)/p), read/write, or skipped if
-//         the tuples are already sorted.
+//         the tuples are already sorted.  For large e, if the (j,i) indices
+//         fit in a 64-bit key, a radix sort is used instead, in O(e*b/p)
+//         time, where b is the number of radix passes (at most 6).
 
 // STEP 3: count vectors and duplicates.  O(e/p) reads, per thread, if no
 //         duplicates, or skipped if already done.  O(e/p) read/writes
@@ -215,7 +217,7 @@ GrB_Info GB_builder                 // build a matrix from tuples
     //--------------------------------------------------------------------------
 
     int nthreads_max = GB_Context_nthreads_max ( ) ;
-    double chunk = GB_Context_chunk ( ) ;
+    double chunk = GB_Context_chunk_family (GxB_CHUNK_BUILD) ;
     int nthreads = GB_nthreads (nvals, chunk, nthreads_max) ;
 
     //--------------------------------------------------------------------------
@@ -561,7 +563,25 @@ GrB_Info GB_builder                 // build a matrix from tuples
         // sort all the tuples
         //----------------------------------------------------------------------
 
-        if (vdim > 1)
+        bool use_rsort = (nvals >= GB_RSORT_MIN) &&
+            (GB_rsort_nbits (vlen) +
+             ((vdim > 1) ? GB_rsort_nbits (vdim) : 0) <= 64) ;
+
+        if (use_rsort)
+        { 
+
+            //------------------------------------------------------------------
+            // radix sort of the (j,i,k) or (i,k) tuples
+            //------------------------------------------------------------------
+
+            // The (j,i) indices fit in a single 64-bit key.  K_work is NULL
+            // if Sx is iso.
+            if (do_burble) GBURBLE ("(radix sort) ") ;
+            info = GB_rsort (I_work, (vdim > 1) ? J_work : NULL, K_work, nvals,
+                vlen, vdim, nthreads) ;
+
+        }
+        else if (vdim > 1)
         {
 
             //------------------------------------------------------------------
@@ -973,6 +993,7 @@ GrB_Info GB_builder                 // build a matrix from tuples
     {
         // duplicates exist, so allocate a new T->i.  I_work must be freed later
         T->i = GB_MALLOC (tnz, int64_t, &(T->i_size)) ;
+        GB_numa_bind (T->i, T->i_size) ;
         if (T->i == NULL)
         { 
             // out of memory
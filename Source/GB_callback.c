@@ -26,6 +26,7 @@ GB_callback_struct GB_callback =
     .GB_malloc_memory_func          = GB_malloc_memory,
     .GB_memset_func                 = GB_memset,
     .GB_qsort_1_func                = GB_qsort_1,
+    .GB_qsort_1b_func               = GB_qsort_1b,
     .GB_werk_pop_func               = GB_werk_pop,
     .GB_werk_push_func              = GB_werk_push
 } ;
@@ -18,6 +18,7 @@ GB_CALLBACK_FREE_MEMORY_PROTO (GB_free_memory) ;
 GB_CALLBACK_MEMSET_PROTO (GB_memset) ;
 GB_CALLBACK_BIX_ALLOC_PROTO (GB_bix_alloc) ;
 GB_CALLBACK_QSORT_1_PROTO (GB_qsort_1) ; 
+GB_CALLBACK_QSORT_1B_PROTO (GB_qsort_1b) ;
 GB_CALLBACK_WERK_PUSH_PROTO (GB_werk_push) ;
 GB_CALLBACK_WERK_POP_PROTO (GB_werk_pop) ;
 GB_CALLBACK_BITMAP_M_SCATTER_PROTO (GB_bitmap_M_scatter) ;
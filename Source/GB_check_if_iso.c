@@ -7,7 +7,8 @@
 
 //------------------------------------------------------------------------------
 
-// JIT: needed.
+// JIT: not needed.  The entries are compared bitwise, so the kernels depend
+// only on the size of the type, not the type itself.
 
 // Returns true if all entries in A are the same, and A can then be converted
 // to iso if currently non-iso.  Returns false if A is bitmap, has any zombies,
@@ -59,6 +60,25 @@ bool GB_check_if_iso        // return true if A is iso, false otherwise
     int64_t anz = GB_nnz_held (A) ;
     bool iso = true ;       // A is iso until proven otherwise
 
+    //--------------------------------------------------------------------------
+    // quick check of a few entries
+    //--------------------------------------------------------------------------
+
+    // Most non-iso matrices can be detected by comparing just a few entries,
+    // without the cost of starting a parallel region.
+
+    const GB_void *restrict Ax0 = (GB_void *) A->x ;
+    const int64_t pprobe [3] = { 1, anz/2, anz-1 } ;
+    for (int k = 0 ; k < 3 ; k++)
+    {
+        int64_t p = pprobe [k] ;
+        if (p > 0 && p < anz && memcmp (Ax0, Ax0 + p*asize, asize) != 0)
+        { 
+            // Ax [0] and Ax [p] differ, so A is not iso
+            return (false) ;
+        }
+    }
+
     //--------------------------------------------------------------------------
     // determine the number of threads to use
     //--------------------------------------------------------------------------
@@ -76,14 +96,21 @@ bool GB_check_if_iso        // return true if A is iso, false otherwise
     //--------------------------------------------------------------------------
 
     bool done = false ;
+    #define GB_ISO_BLOCK 4096
 
-    // TODO: disable these kernels for the compact case:
     {
 
-        #define GB_GET_FIRST_VALUE(atype_t, a, Ax)                      \
-            const atype_t a = Ax [0]
-        #define GB_COMPARE_WITH_FIRST_VALUE(my_iso, a, Ax, p)           \
-            my_iso = my_iso & (a == Ax [p])
+        // diff = the bitwise OR of (Ax [0] ^ Ax [p]) for all p in the block
+        #define GB_CHECK_BLOCK(my_iso, p1, p2)                          \
+        {                                                               \
+            const GB_A_TYPE a = Ax [0] ;                                \
+            GB_A_TYPE diff = 0 ;                                        \
+            for (int64_t p = p1 ; p < p2 ; p++)                         \
+            {                                                           \
+                diff |= (a ^ Ax [p]) ;                                  \
+            }                                                           \
+            my_iso = (diff == 0) ;                                      \
+        }
 
         switch (asize)
         {
@@ -110,14 +137,18 @@ bool GB_check_if_iso        // return true if A is iso, false otherwise
 
             case GB_16BYTE : // double complex or 16-byte user
                 #define GB_A_TYPE uint64_t
-                #undef  GB_GET_FIRST_VALUE
-                #define GB_GET_FIRST_VALUE(atype_t, a, Ax)              \
-                    const atype_t a ## 0 = Ax [0] ;                     \
-                    const atype_t a ## 1 = Ax [1] ;
-                #undef  GB_COMPARE_WITH_FIRST_VALUE
-                #define GB_COMPARE_WITH_FIRST_VALUE(my_iso, a, Ax, p)   \
-                    my_iso = my_iso & (a ## 0 == Ax [2*p  ])            \
-                                    & (a ## 1 == Ax [2*p+1])
+                #undef  GB_CHECK_BLOCK
+                #define GB_CHECK_BLOCK(my_iso, p1, p2)                  \
+                {                                                       \
+                    const uint64_t a0 = Ax [0] ;                        \
+                    const uint64_t a1 = Ax [1] ;                        \
+                    uint64_t diff = 0 ;                                 \
+                    for (int64_t p = p1 ; p < p2 ; p++)                 \
+                    {                                                   \
+                        diff |= (a0 ^ Ax [2*p]) | (a1 ^ Ax [2*p+1]) ;   \
+                    }                                                   \
+                    my_iso = (diff == 0) ;                              \
+                }
                 #include "GB_check_if_iso_template.c"
                 break ;
 
@@ -125,22 +156,21 @@ bool GB_check_if_iso        // return true if A is iso, false otherwise
         }
     }
 
-    // TODO: JIT would go here
-
     if (!done)
     { 
-        // with user-defined types of any size
+        // with user-defined types of any size: all entries in Ax [p1:p2-1]
+        // are equal to Ax [0] if each entry Ax [p] is equal to Ax [p-1], for
+        // all p in the range, which can be done with a single memcmp.
         #define GB_A_TYPE GB_void
-        #undef  GB_GET_FIRST_VALUE
-        #define GB_GET_FIRST_VALUE(atype_t, a, Ax)                      \
-            GB_void a [GB_VLA(asize)] ;                                 \
-            memcpy (a, Ax, asize) ;
-        #undef  GB_COMPARE_WITH_FIRST_VALUE
-        #define GB_COMPARE_WITH_FIRST_VALUE(my_iso, a, Ax, p)           \
-            my_iso = my_iso & (memcmp (a, Ax + (p)*asize, asize) == 0)
+        #undef  GB_CHECK_BLOCK
+        #define GB_CHECK_BLOCK(my_iso, p1, p2)                          \
+        {                                                               \
+            int64_t p0 = GB_IMAX (p1, 1) ;                              \
+            my_iso = (p0 >= p2) || (memcmp (Ax + p0*asize,              \
+                Ax + (p0-1)*asize, (p2-p0)*asize) == 0) ;               \
+        }
         #include "GB_check_if_iso_template.c"
     }
 
     return (iso) ;
 }
-
@@ -0,0 +1,305 @@
+//------------------------------------------------------------------------------
+// GB_chunk_calibrate: tune the chunk for each kernel family
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// JIT: not needed.  Only one variant possible.
+
+// The chunk for each kernel family (GxB_CHUNK_APPLY, GxB_CHUNK_ADD, ...) is
+// chosen so that the fork/join overhead of a parallel region is a small
+// fraction of the time each thread spends in it.  The overhead t_fork of a
+// parallel region is measured on this machine, for the current maximum # of
+// threads.  The time t_work per unit of work of each kernel family is measured
+// on a single thread, for a sparse n-by-n matrix A with GB_CALIBRATE_NZ
+// entries in each row and column.  The work is counted the same way each
+// family counts it when it selects the # of threads to use: the # of entries
+// in the input matrices, or the # of flops for the saxpy methods.  Then:
+
+//      chunk = GB_CALIBRATE_RATIO * t_fork / t_work
+
+// so that the overhead is at most 1/GB_CALIBRATE_RATIO of the time a thread
+// spends in a parallel region.  The chunk for each family is held in the
+// global table, for use by GB_Context_chunk_family.
+
+// The kernels are timed on a single thread by engaging a private Context with
+// one thread for the calling user thread, so the global state seen by other
+// user threads is not changed while the kernels are timed.  The new table is
+// computed locally, and published to the global table only once it is
+// complete.  The first trial of each kernel may compile a JIT kernel; only
+// the fastest trial is used.  Without OpenMP, or if the Context cannot be
+// engaged (no thread-local storage), the table is not modified.
+
+#include "GB.h"
+
+#define GB_FREE_ALL                                                     \
+{                                                                       \
+    GB_FREE_WORK (&Ti, Ti_size) ;                                       \
+    GB_FREE_WORK (&Tj, Tj_size) ;                                       \
+    GB_FREE_WORK (&Tx, Tx_size) ;                                       \
+    GrB_Matrix_free (&A) ;                                              \
+    GrB_Matrix_free (&B) ;                                              \
+    GrB_Matrix_free (&C) ;                                              \
+    GrB_Vector_free (&x) ;                                              \
+    GrB_Vector_free (&w) ;                                              \
+    GrB_Descriptor_free (&desc_saxpy) ;                                 \
+    GrB_Descriptor_free (&desc_dot) ;                                   \
+    if (engaged)                                                        \
+    {                                                                   \
+        GB_Context_engage (Context_saved) ;                             \
+    }                                                                   \
+    GxB_Context_free (&Context) ;                                       \
+}
+
+// A is n-by-n with GB_CALIBRATE_NZ entries in each row and column
+#define GB_CALIBRATE_N (32*1024)
+#define GB_CALIBRATE_NZ 8
+
+// each kernel is timed GB_CALIBRATE_TRIALS times, and the fastest is used
+#define GB_CALIBRATE_TRIALS 3
+
+// # of parallel regions for each trial of t_fork
+#define GB_CALIBRATE_NFORK 64
+
+// fork/join overhead is at most 1/GB_CALIBRATE_RATIO of each thread's time
+#define GB_CALIBRATE_RATIO 4
+
+// time a kernel, with t_work [family] = (fastest time) / work
+#define GB_CALIBRATE_TIME(family,work,kernel)                           \
+{                                                                       \
+    double t_min = INFINITY ;                                           \
+    for (int trial = 0 ; trial < GB_CALIBRATE_TRIALS ; trial++)         \
+    {                                                                   \
+        double t = GB_OPENMP_GET_WTIME ;                                \
+        GB_OK (kernel) ;                                                \
+        t = GB_OPENMP_GET_WTIME - t ;                                   \
+        t_min = GB_IMIN (t_min, t) ;                                    \
+    }                                                                   \
+    t_work [family] = t_min / ((double) (work)) ;                       \
+}
+
+//------------------------------------------------------------------------------
+// GB_fork_time: time per parallel region with nthreads threads
+//------------------------------------------------------------------------------
+
+#if defined ( _OPENMP )
+static double GB_fork_time (int nthreads)
+{
+    double t_min = INFINITY ;
+    for (int trial = 0 ; trial < GB_CALIBRATE_TRIALS ; trial++)
+    {
+        int64_t count = 0 ;
+        double t = GB_OPENMP_GET_WTIME ;
+        for (int k = 0 ; k < GB_CALIBRATE_NFORK ; k++)
+        {
+            #pragma omp parallel num_threads(nthreads) reduction(+:count)
+            {
+                count++ ;
+            }
+        }
+        t = GB_OPENMP_GET_WTIME - t ;
+        if (count > 0)
+        {
+            t_min = GB_IMIN (t_min, t) ;
+        }
+    }
+    return (t_min / GB_CALIBRATE_NFORK) ;
+}
+#endif
+
+//------------------------------------------------------------------------------
+// GB_chunk_calibrate
+//------------------------------------------------------------------------------
+
+GrB_Info GB_chunk_calibrate (void)
+{
+
+    #if !defined ( _OPENMP )
+    {
+        // no OpenMP: all kernels use one thread
+        GBURBLE ("(chunk not calibrated: no OpenMP) ") ;
+        return (GrB_SUCCESS) ;
+    }
+    #else
+    {
+
+        GrB_Info info ;
+        GrB_Index *Ti = NULL ; size_t Ti_size = 0 ;
+        GrB_Index *Tj = NULL ; size_t Tj_size = 0 ;
+        double *Tx = NULL ; size_t Tx_size = 0 ;
+        GrB_Matrix A = NULL, B = NULL, C = NULL ;
+        GrB_Vector x = NULL, w = NULL ;
+        GrB_Descriptor desc_saxpy = NULL, desc_dot = NULL ;
+        GxB_Context Context = NULL ;
+        GxB_Context Context_saved = GB_Context_current ( ) ;
+        bool engaged = false ;
+        double t_work [GxB_NCHUNK_FAMILY] ;
+
+        // the # of threads of the Context of the caller, for timing t_fork
+        int nthreads = GB_IMAX (2, GB_Context_nthreads_max ( )) ;
+
+        //----------------------------------------------------------------------
+        // time each kernel on a single thread, in a private Context
+        //----------------------------------------------------------------------
+
+        GB_OK (GxB_Context_new (&Context)) ;
+        GB_Context_nthreads_max_set (Context, 1) ;
+        info = GB_Context_engage (Context) ;
+        if (info != GrB_SUCCESS)
+        { 
+            // no thread-local storage: the table cannot be calibrated
+            GB_FREE_ALL ;
+            GBURBLE ("(chunk not calibrated: no thread-local Context) ") ;
+            return (GrB_SUCCESS) ;
+        }
+        engaged = true ;
+
+        //----------------------------------------------------------------------
+        // construct the tuples for A
+        //----------------------------------------------------------------------
+
+        // A (i,j) is present if i = (j + t*GB_CALIBRATE_OFFSET) mod n, for
+        // t = 0 to GB_CALIBRATE_NZ-1, so each row and column of A has
+        // GB_CALIBRATE_NZ entries.  The offset is odd and n is a power of 2,
+        // so the entries in each column are distinct.
+        #define GB_CALIBRATE_OFFSET 2654435761
+
+        const int64_t n = GB_CALIBRATE_N ;
+        const int64_t anz = n * GB_CALIBRATE_NZ ;
+        const double flops = ((double) anz) * GB_CALIBRATE_NZ ;
+        Ti = GB_MALLOC_WORK (anz, GrB_Index, &Ti_size) ;
+        Tj = GB_MALLOC_WORK (anz, GrB_Index, &Tj_size) ;
+        Tx = GB_MALLOC_WORK (anz, double, &Tx_size) ;
+        if (Ti == NULL || Tj == NULL || Tx == NULL)
+        {
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        for (int64_t p = 0 ; p < anz ; p++)
+        {
+            int64_t j = p / GB_CALIBRATE_NZ ;
+            int64_t t = p % GB_CALIBRATE_NZ ;
+            Ti [p] = (GrB_Index) ((j + t * GB_CALIBRATE_OFFSET) % n) ;
+            Tj [p] = (GrB_Index) j ;
+            Tx [p] = (double) (1 + p % 7) ;
+        }
+
+        //----------------------------------------------------------------------
+        // build: A = sparse (Ti, Tj, Tx)
+        //----------------------------------------------------------------------
+
+        double t_build = INFINITY ;
+        for (int trial = 0 ; trial < GB_CALIBRATE_TRIALS ; trial++)
+        {
+            GrB_Matrix_free (&A) ;
+            GB_OK (GrB_Matrix_new (&A, GrB_FP64, n, n)) ;
+            double t = GB_OPENMP_GET_WTIME ;
+            GB_OK (GrB_Matrix_build_FP64 (A, Ti, Tj, Tx, anz, GrB_PLUS_FP64)) ;
+            t = GB_OPENMP_GET_WTIME - t ;
+            t_build = GB_IMIN (t_build, t) ;
+        }
+        t_work [GxB_CHUNK_BUILD] = t_build / anz ;
+
+        //----------------------------------------------------------------------
+        // time each kernel family
+        //----------------------------------------------------------------------
+
+        GB_OK (GrB_Matrix_new (&B, GrB_FP64, n, n)) ;
+        GB_OK (GrB_Matrix_new (&C, GrB_FP64, n, n)) ;
+        GB_OK (GrB_Vector_new (&x, GrB_FP64, n)) ;
+        GB_OK (GrB_Vector_new (&w, GrB_FP64, n)) ;
+        GB_OK (GrB_Descriptor_new (&desc_saxpy)) ;
+        GB_OK (GrB_Descriptor_set_INT32 (desc_saxpy, GxB_AxB_SAXPY,
+            (GrB_Field) GxB_AxB_METHOD)) ;
+        GB_OK (GrB_Descriptor_new (&desc_dot)) ;
+        GB_OK (GrB_Descriptor_set_INT32 (desc_dot, GxB_AxB_DOT,
+            (GrB_Field) GxB_AxB_METHOD)) ;
+
+        // B = A'
+        GB_CALIBRATE_TIME (GxB_CHUNK_TRANSPOSE, anz,
+            GrB_transpose (B, NULL, NULL, A, NULL)) ;
+
+        // C = -A
+        GB_CALIBRATE_TIME (GxB_CHUNK_APPLY, anz,
+            GrB_Matrix_apply (C, NULL, NULL, GrB_AINV_FP64, A, NULL)) ;
+
+        // C = A+B
+        GB_CALIBRATE_TIME (GxB_CHUNK_ADD, 2*anz,
+            GrB_Matrix_eWiseAdd_BinaryOp (C, NULL, NULL, GrB_PLUS_FP64, A, B,
+            NULL)) ;
+
+        // C = A.*B
+        GB_CALIBRATE_TIME (GxB_CHUNK_EMULT, 2*anz,
+            GrB_Matrix_eWiseMult_BinaryOp (C, NULL, NULL, GrB_TIMES_FP64, A,
+            B, NULL)) ;
+
+        // C = A*A, with a saxpy method
+        GB_CALIBRATE_TIME (GxB_CHUNK_SAXPY3, flops,
+            GrB_mxm (C, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, A,
+            desc_saxpy)) ;
+
+        // x = sum (A,2), then w = A*x with the dot product method, where B
+        // is a copy of A held by row.  B is sparse and x is full, so
+        // GB_AxB_dot2 computes w = B*x without transposing B, and counts its
+        // work as nnz (B), since only B is scanned.
+        GB_OK (GrB_Matrix_reduce_Monoid (x, NULL, NULL, GrB_PLUS_MONOID_FP64,
+            A, NULL)) ;
+        GB_OK (GxB_Vector_Option_set_INT32 (x, GxB_SPARSITY_CONTROL,
+            GxB_FULL)) ;
+        GrB_Matrix_free (&B) ;
+        GB_OK (GrB_Matrix_new (&B, GrB_FP64, n, n)) ;
+        GB_OK (GrB_Matrix_set_INT32 (B, GrB_ROWMAJOR,
+            GrB_STORAGE_ORIENTATION_HINT)) ;
+        GB_OK (GrB_Matrix_assign (B, NULL, NULL, A, GrB_ALL, n, GrB_ALL, n,
+            NULL)) ;
+        GB_OK (GrB_Matrix_wait (B, GrB_MATERIALIZE)) ;
+        GB_CALIBRATE_TIME (GxB_CHUNK_DOT, anz,
+            GrB_mxv (w, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, B, x,
+            desc_dot)) ;
+
+        // s = sum (A)
+        double s = 0 ;
+        GB_CALIBRATE_TIME (GxB_CHUNK_REDUCE, anz,
+            GrB_Matrix_reduce_FP64 (&s, NULL, GrB_PLUS_MONOID_FP64, A, NULL)) ;
+
+        //----------------------------------------------------------------------
+        // restore the Context of the caller
+        //----------------------------------------------------------------------
+
+        GB_FREE_ALL ;
+
+        //----------------------------------------------------------------------
+        // time the fork/join overhead of a parallel region
+        //----------------------------------------------------------------------
+
+        double t_fork = GB_fork_time (nthreads) - GB_fork_time (1) ;
+        t_fork = GB_IMAX (t_fork, 1e-9) ;
+
+        //----------------------------------------------------------------------
+        // compute the new table, and then publish it
+        //----------------------------------------------------------------------
+
+        double chunk_family [GxB_NCHUNK_FAMILY] ;
+        for (int k = 0 ; k < GxB_NCHUNK_FAMILY ; k++)
+        {
+            double chunk = GB_CALIBRATE_RATIO * t_fork / t_work [k] ;
+            chunk = GB_IMAX (chunk, GB_CHUNK_DEFAULT / 64) ;
+            chunk = GB_IMIN (chunk, GB_CHUNK_DEFAULT * 64) ;
+            chunk_family [k] = floor (chunk) ;
+        }
+
+        GBURBLE ("(chunk calibrated: fork %g usec,", t_fork * 1e6) ;
+        for (int k = 0 ; k < GxB_NCHUNK_FAMILY ; k++)
+        { 
+            GB_Global_chunk_family_set (k, chunk_family [k]) ;
+            GBURBLE (" %g", chunk_family [k]) ;
+        }
+        GBURBLE (") ") ;
+        return (GrB_SUCCESS) ;
+    }
+    #endif
+}
@@ -50,13 +50,14 @@ GrB_Info GB_clear           // clear a matrix, type and dimensions unchanged
     //--------------------------------------------------------------------------
 
     int nthreads_max = GB_Context_nthreads_max ( ) ;
-    int sparsity_control = GB_sparsity_control (A->sparsity_control, A->vdim) ;
+    int sparsity_control = GB_sparsity_control_pinned (A) ;
     if (((sparsity_control & (GxB_SPARSE + GxB_HYPERSPARSE)) == 0)
         && GB_IS_BITMAP (A))
     { 
         // A should remain bitmap
         GB_memset (A->b, 0, GB_nnz_held (A), nthreads_max) ;
         A->nvals = 0 ;
+        GB_transpose_cache_free (A) ;
         A->magic = GB_MAGIC ;
         return (GrB_SUCCESS) ;
     }
@@ -80,9 +81,10 @@ GrB_Info GB_clear           // clear a matrix, type and dimensions unchanged
     // By default, an empty matrix with n > 1 vectors is held in hypersparse
     // form.  A GrB_Matrix with n <= 1, or a GrB_Vector (with n == 1) is always
     // non-hypersparse.  If A->hyper_switch is negative, A will be always be
-    // non-hypersparse.
+    // non-hypersparse, unless it is pinned as hypersparse.
 
-    if (GB_convert_hyper_to_sparse_test (A->hyper_switch, 0, A->vdim))
+    if (GB_convert_hyper_to_sparse_test (A->hyper_switch, 0, A->vdim) &&
+        !(A->hyper_pin && A->vdim > 1))
     {
 
         //----------------------------------------------------------------------
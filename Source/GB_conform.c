@@ -18,6 +18,34 @@
 
 #define GB_FREE_ALL ;
 
+//------------------------------------------------------------------------------
+// GB_conform_s2b_test, GB_conform_b2s_test: sparse to/from bitmap tests
+//------------------------------------------------------------------------------
+
+// If A->sparsity_adaptive is true, the decision to convert between sparse and
+// bitmap is made by a cost model (see GB_sparsity_adapt_test).  Otherwise,
+// the A->bitmap_switch thresholds are used.
+
+static inline bool GB_conform_s2b_test (GrB_Matrix A)
+{
+    if (A->sparsity_adaptive)
+    { 
+        return (GB_sparsity_adapt_test (A, true)) ;
+    }
+    return (GB_convert_s2b_test (A->bitmap_switch, GB_nnz (A), A->vlen,
+        A->vdim)) ;
+}
+
+static inline bool GB_conform_b2s_test (GrB_Matrix A)
+{
+    if (A->sparsity_adaptive)
+    { 
+        return (GB_sparsity_adapt_test (A, false)) ;
+    }
+    return (GB_convert_bitmap_to_sparse_test (A->bitmap_switch, GB_nnz (A),
+        A->vlen, A->vdim)) ;
+}
+
 //------------------------------------------------------------------------------
 // GB_conform_hyper_or_bitmap: ensure a matrix is either hypersparse or bitmap
 //------------------------------------------------------------------------------
@@ -29,16 +57,12 @@ static inline GrB_Info GB_conform_hyper_or_bitmap
 )
 {
     GrB_Info info ;
-    if (is_full || ((is_hyper || is_sparse) &&
-        GB_convert_s2b_test (A->bitmap_switch,
-            GB_nnz (A), A->vlen, A->vdim)))
+    if (is_full || ((is_hyper || is_sparse) && GB_conform_s2b_test (A)))
     { 
         // if full or sparse/hypersparse with many entries: to bitmap
         GB_OK (GB_convert_any_to_bitmap (A, Werk)) ;
     }
-    else if (is_sparse || (is_bitmap &&
-        GB_convert_bitmap_to_sparse_test (A->bitmap_switch,
-            GB_nnz (A), A->vlen, A->vdim)))
+    else if (is_sparse || (is_bitmap && GB_conform_b2s_test (A)))
     { 
         // if sparse or bitmap with few entries: to hypersparse
         GB_OK (GB_convert_any_to_hyper (A, Werk)) ;
@@ -57,16 +81,12 @@ static inline GrB_Info GB_conform_sparse_or_bitmap
 )
 {
     GrB_Info info ;
-    if (is_full || ((is_hyper || is_sparse) &&
-        GB_convert_s2b_test (A->bitmap_switch,
-            GB_nnz (A), A->vlen, A->vdim)))
+    if (is_full || ((is_hyper || is_sparse) && GB_conform_s2b_test (A)))
     { 
         // if full or sparse/hypersparse with many entries: to bitmap
         GB_OK (GB_convert_any_to_bitmap (A, Werk)) ;
     }
-    else if (is_hyper || (is_bitmap &&
-        GB_convert_bitmap_to_sparse_test (A->bitmap_switch,
-            GB_nnz (A), A->vlen, A->vdim)))
+    else if (is_hyper || (is_bitmap && GB_conform_b2s_test (A)))
     { 
         // if hypersparse or bitmap with few entries: to sparse
         GB_OK (GB_convert_any_to_sparse (A, Werk)) ;
@@ -85,17 +105,14 @@ static inline GrB_Info GB_conform_hyper_sparse_or_bitmap
 )
 {
     GrB_Info info ;
-    if (is_full || ((is_hyper || is_sparse) &&
-        GB_convert_s2b_test (A->bitmap_switch,
-            GB_nnz (A), A->vlen, A->vdim)))
+    if (is_full || ((is_hyper || is_sparse) && GB_conform_s2b_test (A)))
     { 
         // if full or sparse/hypersparse with many entries: to bitmap
         GB_OK (GB_convert_any_to_bitmap (A, Werk)) ;
     }
     else if (is_bitmap)
     {
-        if (GB_convert_bitmap_to_sparse_test (A->bitmap_switch,
-            GB_nnz (A), A->vlen, A->vdim))
+        if (GB_conform_b2s_test (A))
         { 
             // if bitmap with few entries: to sparse
             GB_OK (GB_convert_bitmap_to_sparse (A, Werk)) ;
@@ -136,6 +153,7 @@ GrB_Info GB_conform     // conform a matrix to its desired sparsity structure
     bool is_full = GB_IS_FULL (A) ;
     bool is_bitmap = GB_IS_BITMAP (A) ;
     bool as_if_full = GB_as_if_full (A) ;
+    double t_start = (A->sparsity_adaptive) ? GB_OPENMP_GET_WTIME : 0 ;
     if (A->nvec_nonempty < 0)
     { 
         A->nvec_nonempty = GB_nvec_nonempty (A) ;
@@ -145,7 +163,7 @@ GrB_Info GB_conform     // conform a matrix to its desired sparsity structure
     // select the sparsity structure
     //--------------------------------------------------------------------------
 
-    switch (GB_sparsity_control (A->sparsity_control, A->vdim))
+    switch (GB_sparsity_control_pinned (A))
     {
 
         //----------------------------------------------------------------------
@@ -379,6 +397,25 @@ GrB_Info GB_conform     // conform a matrix to its desired sparsity structure
             break ;
     }
 
+    //--------------------------------------------------------------------------
+    // measure the time to convert between sparse/hyper and bitmap
+    //--------------------------------------------------------------------------
+
+    if (A->sparsity_adaptive && (is_bitmap != GB_IS_BITMAP (A)) &&
+        !is_full && !GB_IS_FULL (A))
+    { 
+        double t = GB_OPENMP_GET_WTIME - t_start ;
+        double work = ((double) A->vlen) * ((double) A->vdim) +
+            (double) GB_nnz (A) ;
+        if (t > 0 && work > 0)
+        { 
+            double rate = t / work ;
+            A->adapt_cvt_rate = (A->adapt_cvt_rate == 0) ? rate :
+                (GB_ADAPT_DECAY * A->adapt_cvt_rate +
+                (1 - GB_ADAPT_DECAY) * rate) ;
+        }
+    }
+
     //--------------------------------------------------------------------------
     // return result
     //--------------------------------------------------------------------------
@@ -22,6 +22,19 @@ int GB_sparsity_control     // revised sparsity_control
     int64_t vdim            // A->vdim, or -1 to ignore this condition
 ) ;
 
+// GB_sparsity_control_pinned: the sparsity_control of A, with A->hyper_pin
+static inline int GB_sparsity_control_pinned (GrB_Matrix A)
+{
+    int sparsity_control = GB_sparsity_control (A->sparsity_control, A->vdim) ;
+    if (A->hyper_pin && A->vdim > 1 && (sparsity_control & GxB_SPARSE))
+    { 
+        // A is pinned as hypersparse: it may never become sparse
+        sparsity_control = sparsity_control & (~GxB_SPARSE) ;
+        sparsity_control = sparsity_control | GxB_HYPERSPARSE ;
+    }
+    return (sparsity_control) ;
+}
+
 // GB_sparsity: determine the current sparsity format of a matrix
 static inline int GB_sparsity (GrB_Matrix A)
 {
@@ -90,6 +103,57 @@ bool GB_convert_s2b_test    // test for hyper/sparse to bitmap
     int64_t vdim            // A->vdim
 ) ;
 
+// decay of the usage statistics for adaptive sparsity, per use of a matrix
+#define GB_ADAPT_DECAY (0.875)
+
+// GB_sparsity_adapt_band: 1 if A has many entries, 0 if it has few
+static inline int GB_sparsity_adapt_band (const GrB_Matrix A)
+{
+    double nfull = ((double) A->vlen) * ((double) A->vdim) ;
+    return (((double) GB_nnz (A) > A->bitmap_switch * nfull) ? 1 : 0) ;
+}
+
+// GB_sparsity_adapt_work: work per use of A if sparse or bitmap.  A fraction
+// push of the uses scan all entries of A, and each use makes an average of
+// probes random accesses to A.  A scan of a sparse/hyper matrix takes
+// O(nnz(A)) time, and O(m*n) for a bitmap, but the bitmap is scanned faster,
+// per entry: A->bitmap_switch is used as the ratio, so if all uses are scans,
+// the model matches the default bitmap_switch rule.  A random access takes
+// O(1) time if A is bitmap, but a binary search of a vector if A is sparse or
+// hypersparse.
+static inline void GB_sparsity_adapt_work
+(
+    double *sparse_work,        // work per use if A is sparse or hypersparse
+    double *bitmap_work,        // work per use if A is bitmap
+    const GrB_Matrix A,
+    const double push,          // fraction of uses that scan A
+    const double probes         // # of random accesses per use
+)
+{
+    double anz = (double) GB_nnz (A) ;
+    double nfull = ((double) A->vlen) * ((double) A->vdim) ;
+    double knz = (A->nvec_nonempty > 0) ? ((double) A->nvec_nonempty) :
+        ((double) GB_IMAX (A->nvec, 1)) ;
+    double search = GB_IMAX (1, log2 (1 + anz / knz)) ;
+    (*sparse_work) = push * anz + probes * search ;
+    (*bitmap_work) = push * nfull * A->bitmap_switch + probes ;
+}
+
+void GB_sparsity_adapt_use
+(
+    GrB_Matrix A,               // matrix used as an input to an operation
+    const bool pull,            // if true, A is accessed at random
+    const double probes,        // # of random accesses to A, if pull is true
+    const double rate           // seconds per entry of the operation, if known
+) ;
+
+bool GB_sparsity_adapt_test
+(
+    GrB_Matrix A,           // matrix to test
+    const bool to_bitmap    // if true, test sparse to bitmap;
+                            // otherwise test bitmap to sparse
+) ;
+
 GrB_Info GB_convert_full_to_sparse      // convert matrix from full to sparse
 (
     GrB_Matrix A                // matrix to convert from full to sparse
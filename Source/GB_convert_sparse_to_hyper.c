@@ -21,6 +21,11 @@
 
 // If the input matrix A is hypersparse, bitmap or full, it is unchanged.
 
+// If A has far fewer entries than vectors, each task takes a slice of the
+// entries of A instead of a slice of its vectors, and finds the non-empty
+// vectors by binary search in A->p.  The work is then O(nnz(A) log (A->vdim)),
+// with no O(A->vdim) scan of A->p.
+
 #include "GB.h"
 
 GrB_Info GB_convert_sparse_to_hyper // convert from sparse to hypersparse
@@ -55,9 +60,11 @@ GrB_Info GB_convert_sparse_to_hyper // convert from sparse to hypersparse
         GB_BURBLE_N (n, "(sparse to hyper) ") ;
         int nthreads_max = GB_Context_nthreads_max ( ) ;
         double chunk = GB_Context_chunk ( ) ;
-        int nthreads = GB_nthreads (n, chunk, nthreads_max) ;
+        bool by_search = GB_nonempty_by_search (anz, n) ;
+        int64_t nslice = by_search ? anz : n ;
+        int nthreads = GB_nthreads (nslice, chunk, nthreads_max) ;
         int ntasks = (nthreads == 1) ? 1 : (8 * nthreads) ;
-        ntasks = GB_IMIN (ntasks, n) ;
+        ntasks = GB_IMIN (ntasks, nslice) ;
         ntasks = GB_IMAX (ntasks, 1) ;
 
         //----------------------------------------------------------------------
@@ -82,11 +89,27 @@ GrB_Info GB_convert_sparse_to_hyper // convert from sparse to hypersparse
         #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
         for (tid = 0 ; tid < ntasks ; tid++)
         {
-            int64_t jstart, jend, my_nvec_nonempty = 0 ; ;
-            GB_PARTITION (jstart, jend, n, tid, ntasks) ;
-            for (int64_t j = jstart ; j < jend ; j++)
-            { 
-                if (Ap_old [j] < Ap_old [j+1]) my_nvec_nonempty++ ;
+            int64_t my_nvec_nonempty = 0 ;
+            if (by_search)
+            {
+                // count the vectors whose first entry is in pstart:pend-1
+                int64_t pstart, pend, j = 0 ;
+                GB_PARTITION (pstart, pend, anz, tid, ntasks) ;
+                for (int64_t p = pstart ; p < pend ; p = Ap_old [++j])
+                { 
+                    j = GB_nonempty_search (p, Ap_old, j, n) ;
+                    if (Ap_old [j] == p) my_nvec_nonempty++ ;
+                }
+            }
+            else
+            {
+                // count the non-empty vectors in jstart:jend-1
+                int64_t jstart, jend ;
+                GB_PARTITION (jstart, jend, n, tid, ntasks) ;
+                for (int64_t j = jstart ; j < jend ; j++)
+                { 
+                    if (Ap_old [j] < Ap_old [j+1]) my_nvec_nonempty++ ;
+                }
             }
             Count [tid] = my_nvec_nonempty ;
         }
@@ -135,16 +158,37 @@ GrB_Info GB_convert_sparse_to_hyper // convert from sparse to hypersparse
         #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
         for (tid = 0 ; tid < ntasks ; tid++)
         {
-            int64_t jstart, jend, k = Count [tid] ;
-            GB_PARTITION (jstart, jend, n, tid, ntasks) ;
-            for (int64_t j = jstart ; j < jend ; j++)
+            int64_t k = Count [tid] ;
+            if (by_search)
             {
-                if (Ap_old [j] < Ap_old [j+1])
-                { 
-                    // vector index j is the kth vector in the new Ah
-                    Ap_new [k] = Ap_old [j] ;
-                    Ah_new [k] = j ;
-                    k++ ;
+                // find the vectors whose first entry is in pstart:pend-1
+                int64_t pstart, pend, j = 0 ;
+                GB_PARTITION (pstart, pend, anz, tid, ntasks) ;
+                for (int64_t p = pstart ; p < pend ; p = Ap_old [++j])
+                {
+                    j = GB_nonempty_search (p, Ap_old, j, n) ;
+                    if (Ap_old [j] == p)
+                    { 
+                        // vector index j is the kth vector in the new Ah
+                        Ap_new [k] = p ;
+                        Ah_new [k] = j ;
+                        k++ ;
+                    }
+                }
+            }
+            else
+            {
+                int64_t jstart, jend ;
+                GB_PARTITION (jstart, jend, n, tid, ntasks) ;
+                for (int64_t j = jstart ; j < jend ; j++)
+                {
+                    if (Ap_old [j] < Ap_old [j+1])
+                    { 
+                        // vector index j is the kth vector in the new Ah
+                        Ap_new [k] = Ap_old [j] ;
+                        Ah_new [k] = j ;
+                        k++ ;
+                    }
                 }
             }
             ASSERT (k == Count [tid+1]) ;
@@ -30,7 +30,7 @@ GrB_Info GB_convert_to_nonfull      // ensure a matrix is not full
     // convert to bitmap, sparse, or hypersparse
     //--------------------------------------------------------------------------
 
-    int sparsity_control = GB_sparsity_control (A->sparsity_control, A->vdim) ;
+    int sparsity_control = GB_sparsity_control_pinned (A) ;
 
     if (sparsity_control & GxB_BITMAP)
     { 
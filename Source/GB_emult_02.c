@@ -181,7 +181,7 @@ GrB_Info GB_emult_02        // C=A.*B when A is sparse/hyper, B bitmap/full
 
     int A_nthreads, A_ntasks ;
     int nthreads_max = GB_Context_nthreads_max ( ) ;
-    double chunk = GB_Context_chunk ( ) ;
+    double chunk = GB_Context_chunk_family (GxB_CHUNK_EMULT) ;
     GB_SLICE_MATRIX (A, 8) ;
 
     //--------------------------------------------------------------------------
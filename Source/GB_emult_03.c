@@ -181,7 +181,7 @@ GrB_Info GB_emult_03        // C=A.*B when A bitmap/full, B is sparse/hyper
 
     int B_nthreads, B_ntasks ;
     int nthreads_max = GB_Context_nthreads_max ( ) ;
-    double chunk = GB_Context_chunk ( ) ;
+    double chunk = GB_Context_chunk_family (GxB_CHUNK_EMULT) ;
     GB_SLICE_MATRIX (B, 8) ;
 
     //--------------------------------------------------------------------------
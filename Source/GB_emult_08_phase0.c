@@ -403,7 +403,7 @@ GrB_Info GB_emult_08_phase0     // find vectors in C for C=A.*B or C<M>=A.*B
     //--------------------------------------------------------------------------
 
     int nthreads_max = GB_Context_nthreads_max ( ) ;
-    double chunk = GB_Context_chunk ( ) ;
+    double chunk = GB_Context_chunk_family (GxB_CHUNK_EMULT) ;
     int nthreads = GB_nthreads (Cnvec, chunk, nthreads_max) ;
 
     //--------------------------------------------------------------------------
@@ -138,7 +138,7 @@ GrB_Info GB_emult_bitmap    // C=A.*B, C<M>=A.*B, or C<!M>=A.*B
 
     int64_t cnz = GB_nnz_full (A) ;
     int nthreads_max = GB_Context_nthreads_max ( ) ;
-    double chunk = GB_Context_chunk ( ) ;
+    double chunk = GB_Context_chunk_family (GxB_CHUNK_EMULT) ;
     int C_nthreads = GB_nthreads (cnz, chunk, nthreads_max) ;
 
     // slice the M matrix for Method6
@@ -0,0 +1,134 @@
+//------------------------------------------------------------------------------
+// GB_enumify_ewise_axpby: enumerate a fused alpha*A+beta*B problem
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Enumerates T = alpha*A + beta*B, where A and B have the same pattern, and
+// '+' and '*' are the additive monoid and multiplicative operator of a
+// semiring.  Each entry is T(i,j) = add (mult (alpha, A(i,j)), mult (beta,
+// B(i,j))).  The multiplicative operator cannot be positional.  T has the
+// same pattern as A and B, so only the sparsity structure of A is encoded.
+
+#include "GB.h"
+#include "GB_stringify.h"
+
+void GB_enumify_ewise_axpby         // enumerate an alpha*A+beta*B problem
+(
+    // output:
+    uint64_t *fcode,            // unique encoding of the entire problem
+    // input:
+    GrB_Semiring semiring,      // the semiring to enumify
+    GrB_Matrix A,
+    GrB_Matrix B
+)
+{
+
+    //--------------------------------------------------------------------------
+    // get the semiring
+    //--------------------------------------------------------------------------
+
+    GrB_Monoid add = semiring->add ;
+    GrB_BinaryOp mult = semiring->multiply ;
+    GrB_BinaryOp addop = add->op ;
+    GB_Opcode mult_opcode = mult->opcode ;
+    GB_Opcode add_opcode  = addop->opcode ;
+    ASSERT (!GB_OPCODE_IS_POSITIONAL (mult_opcode)) ;
+
+    //--------------------------------------------------------------------------
+    // get the types
+    //--------------------------------------------------------------------------
+
+    GB_Type_code xcode = mult->xtype->code ;
+    GB_Type_code ycode = mult->ytype->code ;
+    GB_Type_code zcode = mult->ztype->code ;
+
+    //--------------------------------------------------------------------------
+    // rename redundant boolean operators
+    //--------------------------------------------------------------------------
+
+    if (zcode == GB_BOOL_code)
+    {
+        // rename the monoid
+        add_opcode = GB_boolean_rename (add_opcode) ;
+    }
+
+    if (xcode == GB_BOOL_code)  // && (ycode == GB_BOOL_code)
+    {
+        // rename the multiplicative operator
+        mult_opcode = GB_boolean_rename (mult_opcode) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // determine if the values of A and B are used
+    //--------------------------------------------------------------------------
+
+    // alpha and beta are always passed to the kernel as the x input of the
+    // multiplicative operator, so xcode is never zero.  The values of A and B
+    // are not accessed if the operator ignores its y input.
+
+    if (mult_opcode == GB_FIRST_binop_code || mult_opcode == GB_PAIR_binop_code)
+    {
+        // y is not used
+        ycode = 0 ;
+    }
+
+    //--------------------------------------------------------------------------
+    // enumify the multiplier and the monoid
+    //--------------------------------------------------------------------------
+
+    int mult_ecode ;
+    GB_enumify_binop (&mult_ecode, mult_opcode, xcode, true) ;
+
+    int add_ecode, id_ecode, term_ecode ;
+    GB_enumify_monoid (&add_ecode, &id_ecode, &term_ecode, add_opcode, zcode) ;
+
+    //--------------------------------------------------------------------------
+    // enumify the types, iso status, and sparsity structure of A and B
+    //--------------------------------------------------------------------------
+
+    int acode = (ycode == 0) ? 0 : A->type->code ;  // 0 to 14
+    int bcode = (ycode == 0) ? 0 : B->type->code ;  // 0 to 14
+    int A_iso_code = (ycode == 0 || A->iso) ? 1 : 0 ;
+    int B_iso_code = (ycode == 0 || B->iso) ? 1 : 0 ;
+
+    int asparsity ;
+    GB_enumify_sparsity (&asparsity, GB_sparsity (A)) ;
+
+    //--------------------------------------------------------------------------
+    // construct the fcode
+    //--------------------------------------------------------------------------
+
+    // total fcode bits: 63 (16 hex digits)
+
+    (*fcode) =
+                                               // range        bits
+                // monoid: 4 hex digits
+                // unused bit            63                    1
+                GB_LSHIFT (add_ecode  , 58) |  // 0 to 22      5
+                GB_LSHIFT (id_ecode   , 53) |  // 0 to 31      5
+                GB_LSHIFT (term_ecode , 48) |  // 0 to 31      5
+
+                // A and B iso: 1 hex digit
+                GB_LSHIFT (A_iso_code , 47) |  // 0 or 1       1
+                GB_LSHIFT (B_iso_code , 46) |  // 0 or 1       1
+                // unused bits           44                    2
+
+                // multiplier: 5 hex digits
+                GB_LSHIFT (mult_ecode , 36) |  // 0 to 139     8
+                GB_LSHIFT (zcode      , 32) |  // 1 to 14      4
+                GB_LSHIFT (xcode      , 28) |  // 1 to 14      4
+                GB_LSHIFT (ycode      , 24) |  // 0 to 14      4
+
+                // types of A and B: 2 hex digits
+                GB_LSHIFT (acode      , 20) |  // 0 to 14      4
+                GB_LSHIFT (bcode      , 16) |  // 0 to 14      4
+
+                // sparsity structure of A and B: 4 hex digits
+                // unused bits           2                     14
+                GB_LSHIFT (asparsity  ,  0) ;  // 0 to 3       2
+}
+
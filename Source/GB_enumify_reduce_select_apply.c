@@ -0,0 +1,116 @@
+//------------------------------------------------------------------------------
+// GB_enumify_reduce_select_apply: enumerate a fused select/apply/reduce
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Enumerates T(k) = reduce (op (select (A(:,k)))) for each vector k of A.  The
+// problem is the same as GB_enumify_reduce, with a built-in unary operator op
+// applied to each entry and a built-in index unary operator to select the
+// entries to reduce.  If op is NULL, the identity operator is used, for the
+// type of A.  If selectop is NULL, all entries are kept.  Both operators must
+// be built-in, so they are fully described by the fcode.
+
+#include "GB.h"
+#include "GB_stringify.h"
+
+void GB_enumify_reduce_select_apply // enumerate a fused reduce problem
+(
+    // output:
+    uint64_t *fcode,            // unique encoding of the entire problem
+    // input:
+    GrB_Monoid monoid,          // the monoid to enumify
+    GrB_UnaryOp op,             // built-in unary op to apply, or NULL
+    GrB_IndexUnaryOp selectop,  // built-in select op, or NULL
+    GrB_Matrix A                // input matrix to reduce
+)
+{
+
+    //--------------------------------------------------------------------------
+    // enumify the monoid, and the type and sparsity structure of A
+    //--------------------------------------------------------------------------
+
+    uint64_t rcode ;
+    GB_enumify_reduce (&rcode, monoid, A) ;
+
+    //--------------------------------------------------------------------------
+    // enumify the unary operator
+    //--------------------------------------------------------------------------
+
+    bool depends_on_x, depends_on_i, depends_on_j, depends_on_y ;
+    int uop_ecode, uop_xcode, uop_zcode ;
+
+    if (op == NULL)
+    {
+        // z = x, for the type of A
+        uop_ecode = 2 ;
+        uop_xcode = A->type->code ;
+        uop_zcode = A->type->code ;
+    }
+    else
+    {
+        ASSERT (op->hash == 0) ;
+        ASSERT (!GB_OPCODE_IS_POSITIONAL (op->opcode)) ;
+        uop_xcode = op->xtype->code ;
+        uop_zcode = op->ztype->code ;
+        GB_enumify_unop (&uop_ecode, &depends_on_x, &depends_on_i,
+            &depends_on_j, &depends_on_y, false, op->opcode, uop_xcode) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // enumify the index unary operator
+    //--------------------------------------------------------------------------
+
+    int sel_ecode = 0, sel_xcode = 0, sel_ycode = 0, flipij = 0 ;
+
+    if (selectop != NULL)
+    {
+        ASSERT (selectop->hash == 0) ;
+        // The kernel passes the index of A(:,k) as i, and k as j.  The i and
+        // j indices are flipped if A is held by row.
+        bool flip = !(A->is_csc) ;
+        sel_xcode = (selectop->xtype == NULL) ? 0 : selectop->xtype->code ;
+        sel_ycode = selectop->ytype->code ;
+        GB_enumify_unop (&sel_ecode, &depends_on_x, &depends_on_i,
+            &depends_on_j, &depends_on_y, flip, selectop->opcode, sel_xcode) ;
+        ASSERT (sel_ecode >= 231 && sel_ecode <= 253) ;
+        if (!depends_on_x)
+        {
+            // the positional ops do not depend on x
+            sel_xcode = 0 ;
+        }
+        if (depends_on_i || depends_on_j)
+        {
+            flipij = (flip) ? 1 : 0 ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // construct the fcode
+    //--------------------------------------------------------------------------
+
+    // total fcode bits: 64 (16 hex digits)
+
+    (*fcode) =
+                                               // range        bits
+                // select op: 4 hex digits
+                GB_LSHIFT (sel_xcode  , 60) |  // 0 to 14      4
+                GB_LSHIFT (sel_ecode  , 52) |  // 0, 231..253  8
+                GB_LSHIFT (sel_ycode  , 48) |  // 0 to 14      4
+
+                // apply op: 4 hex digits
+                GB_LSHIFT (uop_zcode  , 44) |  // 1 to 14      4
+                GB_LSHIFT (uop_xcode  , 40) |  // 1 to 14      4
+                GB_LSHIFT (uop_ecode  , 32) |  // 1 to 160     8
+
+                // flipij: 1 hex digit
+                // unused bits           29                    3
+                GB_LSHIFT (flipij     , 28) |  // 0 or 1       1
+
+                // monoid, and type and sparsity of A: 7 hex digits
+                rcode ;                        // 28 bits      28
+}
+
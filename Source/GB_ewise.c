@@ -67,6 +67,10 @@ GrB_Info GB_ewise                   // C<M> = accum (C, A+B) or A.*B
     ASSERT_MATRIX_OK (A, "A for GB_ewise", GB0) ;
     ASSERT_MATRIX_OK (B, "B for GB_ewise", GB0) ;
 
+    // A and B are scanned, for adaptive sparsity
+    GB_sparsity_adapt_use (A, false, 0, 0) ;
+    GB_sparsity_adapt_use (B, false, 0, 0) ;
+
     // T has the same type as the output z for z=op(a,b)
     GrB_BinaryOp op = op_in ;
     GrB_Type T_type = op->ztype ;
@@ -158,6 +162,9 @@ GrB_Info GB_ewise                   // C<M> = accum (C, A+B) or A.*B
     // quick return if an empty mask M is complemented
     GB_RETURN_IF_QUICK_MASK (C, C_replace, M, Mask_comp, Mask_struct) ;
 
+    // C is about to be modified, so its cached transpose is no longer valid
+    GB_transpose_cache_free (C) ;
+
     //--------------------------------------------------------------------------
     // handle CSR and CSC formats
     //--------------------------------------------------------------------------
@@ -32,6 +32,28 @@ GrB_Info GB_ewise                   // C<M> = accum (C, A+B) or A.*B
     GB_Werk Werk
 ) ;
 
+//------------------------------------------------------------------------------
+// GB_ewise_axpby: C<M> = accum (C, alpha*A+beta*B)
+//------------------------------------------------------------------------------
+
+GrB_Info GB_ewise_axpby             // C<M> = accum (C, alpha*A+beta*B)
+(
+    GrB_Matrix C,                   // input/output matrix for results
+    const bool C_replace,           // if true, clear C before writing to it
+    const GrB_Matrix M,             // optional mask for C, unused if NULL
+    const bool Mask_comp,           // if true, complement the mask M
+    const bool Mask_struct,         // if true, use the only structure of M
+    const GrB_BinaryOp accum,       // optional accum for Z=accum(C,T)
+    const GrB_Semiring semiring,    // defines '+' and '*' for alpha*A+beta*B
+    const GrB_Scalar alpha,         // scalar to multiply with A
+    const GrB_Matrix A,             // input matrix
+    bool A_transpose,               // if true, use A' instead of A
+    const GrB_Scalar beta,          // scalar to multiply with B
+    const GrB_Matrix B,             // input matrix
+    bool B_transpose,               // if true, use B' instead of B
+    GB_Werk Werk
+) ;
+
 //------------------------------------------------------------------------------
 // GB_ewise_fulla: C += A+B, all 3 matrices full
 //------------------------------------------------------------------------------
@@ -0,0 +1,306 @@
+//------------------------------------------------------------------------------
+// GB_ewise_axpby: C<M> = accum (C, alpha*A+beta*B)
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// JIT: done.
+
+// C<M> = accum (C,T) where T = alpha*A + beta*B, and where '+' and '*' are the
+// additive monoid and multiplicative operator of a semiring.  The input
+// matrices A and B are optionally transposed.  The result is the same as the
+// three steps:
+
+//      AS = mult (alpha, A)                GrB_apply with bind1st
+//      BS = mult (beta, B)                 GrB_apply with bind1st
+//      C<M> = accum (C, AS + BS)           GrB_eWiseAdd with the monoid
+
+// If A and B have the same pattern, and are held in the same orientation,
+// then T has that same pattern, and the three steps are fused into a single
+// pass over the entries of A and B by a JIT kernel.  T is constructed as a
+// shallow copy of the pattern of A, and no pattern merge is needed.
+// Otherwise, or if the JIT is disabled, AS and BS are constructed with the
+// pattern of A and B, and then added with GB_ewise.
+
+#define GB_FREE_ALL             \
+{                               \
+    GB_Matrix_free (&T) ;       \
+    GB_Matrix_free (&AS) ;      \
+    GB_Matrix_free (&BS) ;      \
+}
+
+#include "GB_ewise.h"
+#include "GB_apply.h"
+#include "GB_accum_mask.h"
+#include "GB_aliased.h"
+#include "GB_transpose.h"
+#include "GB_stringify.h"
+
+//------------------------------------------------------------------------------
+// GB_same_pattern: determine if A and B have the same pattern
+//------------------------------------------------------------------------------
+
+// A and B have the same dimensions, are held in the same orientation, and have
+// no pending work.
+
+static bool GB_same_pattern
+(
+    const GrB_Matrix A,
+    const GrB_Matrix B
+)
+{
+
+    if (GB_all_aliased (A, B) || (GB_as_if_full (A) && GB_as_if_full (B)))
+    {
+        // A and B have identical patterns, or are both full
+        return (true) ;
+    }
+
+    int A_sparsity = GB_sparsity (A) ;
+    if (A_sparsity != GB_sparsity (B) || GB_nnz (A) != GB_nnz (B))
+    {
+        return (false) ;
+    }
+
+    if (A_sparsity == GxB_BITMAP)
+    {
+        // compare the bitmaps of A and B
+        return (memcmp (A->b, B->b, GB_nnz_held (A) * sizeof (int8_t)) == 0) ;
+    }
+
+    // compare the vector pointers, hyperlists, and indices of A and B
+    ASSERT (A_sparsity == GxB_SPARSE || A_sparsity == GxB_HYPERSPARSE) ;
+    int64_t anvec = A->nvec ;
+    return ((anvec == B->nvec) &&
+        (A->p == B->p ||
+            memcmp (A->p, B->p, (anvec+1) * sizeof (int64_t)) == 0) &&
+        (A->h == B->h ||
+            memcmp (A->h, B->h, anvec * sizeof (int64_t)) == 0) &&
+        (A->i == B->i ||
+            memcmp (A->i, B->i, GB_nnz (A) * sizeof (int64_t)) == 0)) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_ewise_axpby
+//------------------------------------------------------------------------------
+
+GrB_Info GB_ewise_axpby             // C<M> = accum (C, alpha*A+beta*B)
+(
+    GrB_Matrix C,                   // input/output matrix for results
+    const bool C_replace,           // if true, clear C before writing to it
+    const GrB_Matrix M,             // optional mask for C, unused if NULL
+    const bool Mask_comp,           // if true, complement the mask M
+    const bool Mask_struct,         // if true, use the only structure of M
+    const GrB_BinaryOp accum,       // optional accum for Z=accum(C,T)
+    const GrB_Semiring semiring,    // defines '+' and '*' for alpha*A+beta*B
+    const GrB_Scalar alpha,         // scalar to multiply with A
+    const GrB_Matrix A,             // input matrix
+    bool A_transpose,               // if true, use A' instead of A
+    const GrB_Scalar beta,          // scalar to multiply with B
+    const GrB_Matrix B,             // input matrix
+    bool B_transpose,               // if true, use B' instead of B
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    // C may be aliased with M, A, and/or B
+
+    GrB_Info info ;
+    GrB_Matrix T = NULL, AS = NULL, BS = NULL ;
+    struct GB_Matrix_opaque T_header, AS_header, BS_header ;
+
+    GB_RETURN_IF_FAULTY_OR_POSITIONAL (accum) ;
+
+    ASSERT_MATRIX_OK (C, "C input for GB_ewise_axpby", GB0) ;
+    ASSERT_MATRIX_OK_OR_NULL (M, "M for GB_ewise_axpby", GB0) ;
+    ASSERT_BINARYOP_OK_OR_NULL (accum, "accum for GB_ewise_axpby", GB0) ;
+    ASSERT_SEMIRING_OK (semiring, "semiring for GB_ewise_axpby", GB0) ;
+    ASSERT_MATRIX_OK (A, "A for GB_ewise_axpby", GB0) ;
+    ASSERT_MATRIX_OK (B, "B for GB_ewise_axpby", GB0) ;
+
+    GrB_BinaryOp mult = semiring->multiply ;
+    GrB_BinaryOp add = semiring->add->op ;
+    GrB_Type xtype = mult->xtype ;
+    GrB_Type ztype = add->ztype ;
+
+    if (GB_OP_IS_POSITIONAL (mult))
+    {
+        GB_ERROR (GrB_DOMAIN_MISMATCH,
+            "Positional op z=%s(x,y) not supported for alpha*A+beta*B\n",
+            mult->name) ;
+    }
+
+    // check domains and dimensions for C<M> = accum (C,T)
+    GB_OK (GB_compatible (C->type, C, M, Mask_struct, accum, ztype, Werk)) ;
+
+    // alpha and beta must be present
+    GB_MATRIX_WAIT (alpha) ;
+    GB_MATRIX_WAIT (beta) ;
+    if (GB_nnz ((GrB_Matrix) alpha) == 0)
+    {
+        GB_ERROR (GrB_EMPTY_OBJECT, "%s\n",
+            "alpha cannot be an empty scalar") ;
+    }
+    if (GB_nnz ((GrB_Matrix) beta) == 0)
+    {
+        GB_ERROR (GrB_EMPTY_OBJECT, "%s\n",
+            "beta cannot be an empty scalar") ;
+    }
+
+    // alpha and beta are typecasted to the x input of the multiplier
+    if (!GB_Type_compatible (xtype, alpha->type))
+    {
+        GB_ERROR (GrB_DOMAIN_MISMATCH,
+            "alpha scalar of type [%s]\n"
+            "cannot be typecast to op input of type [%s]",
+            alpha->type->name, xtype->name) ;
+    }
+    if (!GB_Type_compatible (xtype, beta->type))
+    {
+        GB_ERROR (GrB_DOMAIN_MISMATCH,
+            "beta scalar of type [%s]\n"
+            "cannot be typecast to op input of type [%s]",
+            beta->type->name, xtype->name) ;
+    }
+
+    // A and B are typecasted to the y input of the multiplier
+    GB_OK (GB_BinaryOp_compatible (mult, NULL, xtype, A->type,
+        GB_ignore_code, Werk)) ;
+    GB_OK (GB_BinaryOp_compatible (mult, NULL, xtype, B->type,
+        GB_ignore_code, Werk)) ;
+
+    // check the dimensions
+    int64_t anrows = (A_transpose) ? GB_NCOLS (A) : GB_NROWS (A) ;
+    int64_t ancols = (A_transpose) ? GB_NROWS (A) : GB_NCOLS (A) ;
+    int64_t bnrows = (B_transpose) ? GB_NCOLS (B) : GB_NROWS (B) ;
+    int64_t bncols = (B_transpose) ? GB_NROWS (B) : GB_NCOLS (B) ;
+    int64_t cnrows = GB_NROWS (C) ;
+    int64_t cncols = GB_NCOLS (C) ;
+    if (anrows != bnrows || ancols != bncols ||
+        cnrows != anrows || cncols != bncols)
+    {
+        GB_ERROR (GrB_DIMENSION_MISMATCH,
+            "Dimensions not compatible:\n"
+            "output is " GBd "-by-" GBd "\n"
+            "first input is " GBd "-by-" GBd "%s\n"
+            "second input is " GBd "-by-" GBd "%s",
+            cnrows, cncols,
+            anrows, ancols, A_transpose ? " (transposed)" : "",
+            bnrows, bncols, B_transpose ? " (transposed)" : "") ;
+    }
+
+    // quick return if an empty mask M is complemented
+    GB_RETURN_IF_QUICK_MASK (C, C_replace, M, Mask_comp, Mask_struct) ;
+
+    // the pattern of A and B is needed, with no pending work
+    GB_MATRIX_WAIT (A) ;
+    GB_MATRIX_WAIT (B) ;
+
+    //--------------------------------------------------------------------------
+    // T = alpha*A+beta*B in a single pass, if A and B have the same pattern
+    //--------------------------------------------------------------------------
+
+    // A' held by column has the same layout as A held by row
+    bool A_is_csc = (A->is_csc != A_transpose) ;
+    bool B_is_csc = (B->is_csc != B_transpose) ;
+
+    if (A_is_csc == B_is_csc && GB_same_pattern (A, B))
+    {
+
+        //----------------------------------------------------------------------
+        // cast alpha and beta to the x input of the multiplier
+        //----------------------------------------------------------------------
+
+        size_t xsize = xtype->size ;
+        GB_void alpha_scalar [GB_VLA(xsize)] ;
+        GB_void beta_scalar  [GB_VLA(xsize)] ;
+        GB_cast_scalar (alpha_scalar, xtype->code, alpha->x, alpha->type->code,
+            alpha->type->size) ;
+        GB_cast_scalar (beta_scalar, xtype->code, beta->x, beta->type->code,
+            beta->type->size) ;
+
+        //----------------------------------------------------------------------
+        // T = shallow copy of the pattern of A, with new values
+        //----------------------------------------------------------------------
+
+        GBURBLE ("(fused alpha*A+beta*B) ") ;
+        GB_CLEAR_STATIC_HEADER (T, &T_header) ;
+        // if A is transposed, T = A' is held in the opposite format as A
+        GB_OK (GB_shallow_copy (T, A_is_csc, A, Werk)) ;
+        T->type = ztype ;
+        T->iso = false ;
+        T->x = NULL ;
+        T->x_size = 0 ;
+        T->x_shallow = false ;
+
+        int64_t anz = GB_nnz_held (A) ;
+        if (anz > 0)
+        {
+            // allocate T->x; use calloc if bitmap
+            T->x = GB_XALLOC (GB_IS_BITMAP (T), false, anz,  // x:OK
+                ztype->size, &(T->x_size)) ;
+            if (T->x == NULL)
+            {
+                // out of memory
+                GB_FREE_ALL ;
+                return (GrB_OUT_OF_MEMORY) ;
+            }
+            int nthreads_max = GB_Context_nthreads_max ( ) ;
+            double chunk = GB_Context_chunk ( ) ;
+            int nthreads = GB_nthreads (2 * anz, chunk, nthreads_max) ;
+            info = GB_ewise_axpby_jit (T, semiring, alpha_scalar, A,
+                beta_scalar, B, nthreads) ;
+        }
+        else
+        {
+            // T has no entries
+            info = GrB_SUCCESS ;
+        }
+
+        if (info == GrB_SUCCESS)
+        {
+            // C<M> = accum (C,T)
+            ASSERT_MATRIX_OK (T, "T for GB_ewise_axpby", GB0) ;
+            return (GB_accum_mask (C, M, NULL, accum, &T, C_replace,
+                Mask_comp, Mask_struct, Werk)) ;
+        }
+        else if (info != GrB_NO_VALUE)
+        {
+            // the JIT kernel failed
+            GB_FREE_ALL ;
+            return (info) ;
+        }
+
+        // the JIT kernel is not available; use the three steps instead
+        GB_Matrix_free (&T) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // AS = mult (alpha, A) and BS = mult (beta, B)
+    //--------------------------------------------------------------------------
+
+    // AS and BS have the same pattern and format as A and B, respectively
+    GB_CLEAR_STATIC_HEADER (AS, &AS_header) ;
+    GB_OK (GB_shallow_op (AS, A->is_csc, (GB_Operator) mult, alpha, true,
+        false, A, Werk)) ;
+    GB_CLEAR_STATIC_HEADER (BS, &BS_header) ;
+    GB_OK (GB_shallow_op (BS, B->is_csc, (GB_Operator) mult, beta, true,
+        false, B, Werk)) ;
+
+    //--------------------------------------------------------------------------
+    // C<M> = accum (C, AS+BS)
+    //--------------------------------------------------------------------------
+
+    info = GB_ewise (C, C_replace, M, Mask_comp, Mask_struct, accum, add,
+        AS, A_transpose, BS, B_transpose, true, false, NULL, NULL, Werk) ;
+    GB_FREE_ALL ;
+    return (info) ;
+}
+
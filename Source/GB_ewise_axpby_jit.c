@@ -0,0 +1,56 @@
+//------------------------------------------------------------------------------
+// GB_ewise_axpby_jit: T=alpha*A+beta*B via the JIT
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB.h"
+#include "GB_stringify.h"
+
+typedef GB_JIT_KERNEL_EWISE_AXPBY_PROTO ((*GB_jit_dl_function)) ;
+
+GrB_Info GB_ewise_axpby_jit         // T = alpha*A+beta*B via the JIT
+(
+    // input/output:
+    GrB_Matrix T,               // T->x computed; same pattern as A and B
+    // input:
+    const GrB_Semiring semiring,    // add monoid and multiply operator
+    const GB_void *alpha_scalar,    // alpha, of type semiring->multiply->xtype
+    const GrB_Matrix A,
+    const GB_void *beta_scalar,     // beta, of type semiring->multiply->xtype
+    const GrB_Matrix B,
+    const int nthreads
+)
+{
+
+    //--------------------------------------------------------------------------
+    // encodify the problem
+    //--------------------------------------------------------------------------
+
+    GB_jit_encoding encoding ;
+    char *suffix ;
+    uint64_t hash = GB_encodify_ewise_axpby (&encoding, &suffix,
+        GB_JIT_KERNEL_EWISE_AXPBY, semiring, A, B) ;
+
+    //--------------------------------------------------------------------------
+    // get the kernel function pointer, loading or compiling it if needed
+    //--------------------------------------------------------------------------
+
+    void *dl_function ;
+    GrB_Info info = GB_jitifyer_load (&dl_function,
+        GB_jit_fused_family, "ewise_axpby",
+        hash, &encoding, suffix, semiring, NULL,
+        NULL, A->type, B->type, NULL) ;
+    if (info != GrB_SUCCESS) return (info) ;
+
+    //--------------------------------------------------------------------------
+    // call the jit kernel and return result
+    //--------------------------------------------------------------------------
+
+    GB_jit_dl_function GB_jit_kernel = (GB_jit_dl_function) dl_function ;
+    return (GB_jit_kernel (T, alpha_scalar, A, beta_scalar, B, nthreads)) ;
+}
+
@@ -68,7 +68,7 @@ GrB_Info GB_ewise_fulla        // C += A+B, all matrices full
 
     int64_t cnz = GB_nnz (C) ;
     int nthreads_max = GB_Context_nthreads_max ( ) ;
-    double chunk = GB_Context_chunk ( ) ;
+    double chunk = GB_Context_chunk_family (GxB_CHUNK_ADD) ;
     int nthreads = GB_nthreads (3 * cnz, chunk, nthreads_max) ;
 
     //--------------------------------------------------------------------------
@@ -69,7 +69,7 @@ GrB_Info GB_ewise_fulln      // C = A+B
 
     int64_t anz = GB_nnz (A) ;
     int nthreads_max = GB_Context_nthreads_max ( ) ;
-    double chunk = GB_Context_chunk ( ) ;
+    double chunk = GB_Context_chunk_family (GxB_CHUNK_ADD) ;
     int nthreads = GB_nthreads (2 * anz, chunk, nthreads_max) ;
 
     //--------------------------------------------------------------------------
@@ -7,7 +7,8 @@
 
 //------------------------------------------------------------------------------
 
-// JIT: needed.
+// JIT: not needed.  The scalar is copied bitwise, so the kernels depend only
+// on the size of the type, not the type itself.
 
 #include "GB.h"
 #include "GB_is_nonzero.h"
@@ -106,11 +107,26 @@ void GB_expand_iso          // expand an iso scalar into an entire array
 
             default : // user-defined types of arbitrary size
             {
+                // Each task copies the scalar into the first entry of its
+                // part of X, and then doubles the part it has filled with a
+                // single memcpy, so that only O(log(n)) memcpy's are needed.
                 GB_void *restrict Z = (GB_void *) X ;
+                int tid ;
                 #pragma omp parallel for num_threads(nthreads) schedule(static)
-                for (p = 0 ; p < n ; p++)
+                for (tid = 0 ; tid < nthreads ; tid++)
                 {
-                    memcpy (Z + p*size, scalar, size) ;
+                    int64_t pstart, pend ;
+                    GB_PARTITION (pstart, pend, n, tid, nthreads) ;
+                    int64_t len = pend - pstart ;
+                    if (len <= 0) continue ;
+                    GB_void *restrict Zt = Z + pstart*size ;
+                    memcpy (Zt, scalar, size) ;
+                    for (int64_t k = 1 ; k < len ; k *= 2)
+                    { 
+                        // Zt [k:k+kcopy-1] = Zt [0:kcopy-1]
+                        int64_t kcopy = GB_IMIN (k, len - k) ;
+                        memcpy (Zt + k*size, Zt, kcopy*size) ;
+                    }
                 }
             }
             break ;
@@ -99,6 +99,10 @@ GrB_Info GB_extract                 // C<M> = accum (C, A(I,J))
     GB_MATRIX_WAIT (M) ;        // cannot be jumbled
     GB_MATRIX_WAIT (A) ;        // cannot be jumbled
 
+    // A is accessed at random, once for each entry of A(Rows,Cols), for
+    // adaptive sparsity
+    GB_sparsity_adapt_use (A, true, ((double) nRows) * ((double) nCols), 0) ;
+
     GB_BURBLE_DENSE (C, "(C %s) ") ;
     GB_BURBLE_DENSE (M, "(M %s) ") ;
     GB_BURBLE_DENSE (A, "(A %s) ") ;
@@ -59,6 +59,87 @@ bool GB_hyper_hash_need         // return true if A needs a hyper hash
     GrB_Matrix A
 ) ;
 
+GrB_Info GB_hyper_hash_update   // update A->Y after A->h has changed
+(
+    GrB_Matrix A,               // hypersparse matrix with its new A->h
+    const int64_t *restrict Del,    // vectors removed from A->h, sorted
+    const int64_t ndel,
+    const int64_t *restrict Ins,    // vectors added to A->h, sorted
+    const int64_t nins,
+    GB_Werk Werk
+) ;
+
+//------------------------------------------------------------------------------
+// GB_hyper_hash_size: # of buckets in the A->Y hyper_hash
+//------------------------------------------------------------------------------
+
+// A->Y has one vector per hash bucket, and the # of buckets is always a power
+// of 2, with a load factor of 2 to 4 vectors of A per bucket.
+
+static inline int64_t GB_hyper_hash_size
+(
+    int64_t anvec                   // # of vectors in A->h
+)
+{
+    // this ensures a load factor of 0.5 to 1:
+    int64_t yvdim = ((uint64_t) 1) << (GB_FLOOR_LOG2 (anvec) + 1) ;
+    // divide by 4 to get a load factor of 2 to 4:
+    yvdim = yvdim / 4 ;
+    return (GB_IMAX (yvdim, 4)) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_nonempty_search: find the next non-empty vector of a sparse matrix
+//------------------------------------------------------------------------------
+
+// Returns the vector k that contains the entry p of a sparse matrix, with
+// kfirst <= k < n and Ap [k] <= p < Ap [k+1].  If Ap [kfirst] <= p on input,
+// this is a binary search for the first k with Ap [k+1] > p, so it takes
+// O(log n) time even if many vectors are empty.
+
+static inline int64_t GB_nonempty_search
+(
+    const int64_t p,                // entry to find, with p < Ap [n]
+    const int64_t *restrict Ap,     // vector pointers, of size n+1
+    int64_t kfirst,                 // first vector to search
+    const int64_t n                 // # of vectors
+)
+{
+    int64_t klast = n - 1 ;
+    while (kfirst < klast)
+    {
+        int64_t kmiddle = kfirst + (klast - kfirst) / 2 ;
+        if (Ap [kmiddle+1] > p)
+        { 
+            klast = kmiddle ;
+        }
+        else
+        { 
+            kfirst = kmiddle + 1 ;
+        }
+    }
+    return (kfirst) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_nonempty_by_search: true if the non-empty vectors should be searched for
+//------------------------------------------------------------------------------
+
+// The k non-empty vectors of a sparse matrix with anz entries and n vectors
+// can be found by a scan of Ap in O(n) time, or by one GB_nonempty_search for
+// each, in O(k log n) time, where k <= anz.  The latter is used if A has far
+// fewer entries than vectors (a matrix with a huge dimension, for example),
+// so that the work is proportional to anz, not n.
+
+static inline bool GB_nonempty_by_search
+(
+    const int64_t anz,              // # of entries in A
+    const int64_t n                 // # of vectors in A
+)
+{
+    return (((double) anz) * (1 + log2 ((double) n + 1)) < ((double) n)) ;
+}
+
 //------------------------------------------------------------------------------
 // GB_lookup: find k so that j == Ah [k], without using the A->Y hyper_hash
 //------------------------------------------------------------------------------
@@ -60,11 +60,8 @@ GrB_Info GB_hyper_hash_build    // construct A->Y if not already constructed
 
     const int64_t *restrict Ah = A->h ;
     int64_t anvec = A->nvec ;
-    // this ensures a load factor of 0.5 to 1:
-    int64_t yvdim = ((uint64_t) 1) << (GB_FLOOR_LOG2 (anvec) + 1) ;
-    // divide by 4 to get a load factor of 2 to 4:
-    yvdim = yvdim / 4 ;
-    yvdim = GB_IMAX (yvdim, 4) ;
+    // this ensures a load factor of 2 to 4:
+    int64_t yvdim = GB_hyper_hash_size (anvec) ;
     int64_t yvlen = A->vdim ;
     int64_t hash_bits = (yvdim - 1) ;   // yvdim is always a power of 2
 
@@ -0,0 +1,286 @@
+//------------------------------------------------------------------------------
+// GB_hyper_hash_update: update A->Y after vectors are added to or removed from A
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// JIT: not needed.  Only one variant possible.
+
+// A->h has been modified: the vectors in Del [0:ndel-1] have been removed from
+// it, and those in Ins [0:nins-1] have been added.  Both lists are sorted.  A
+// vector j may appear in both lists, if it was removed and then added back.
+// A->Y is still the hyper_hash of the old A->h, and is updated here to reflect
+// the new A->h, rather than being freed and later rebuilt from scratch by
+// GB_hyper_hash_build.
+
+// Each entry (j,k) in A->Y, for a vector j still in A->h, is moved to its new
+// position, k + (# of vectors in Ins less than j) - (# in Del less than j).
+// Entries for vectors in Del are removed, and the vectors in Ins are added to
+// their buckets.  The entries in each bucket remain sorted.  This takes
+// O((|Y| log (nins+ndel))/p + yvdim/p) time with p threads, and no sort of
+// the whole hyperlist is needed.  The hash function, and the layout of A->Y
+// used by GB_hyper_hash_lookup and GxB_unpack_HyperHash, are not changed.
+
+// The number of buckets of A->Y is kept as-is, as long as it is within a
+// factor of 2 of what GB_hyper_hash_build would use for the new A->nvec (a
+// load factor of 1 to 8).  Otherwise, or if A->Y is shallow, A->Y is freed
+// instead, and it will be rebuilt by GB_hyper_hash_build when needed.  A->Y
+// is also freed if the update runs out of memory, so this method never fails;
+// A remains valid.
+
+#include "GB.h"
+#include "GB_sort.h"
+#include "GB_cumsum.h"
+
+#define GB_FREE_WORKSPACE                   \
+{                                           \
+    GB_FREE_WORK (&InsB, InsB_size) ;       \
+    GB_FREE_WORK (&InsJ, InsJ_size) ;       \
+    GB_FREE_WORK (&DelB, DelB_size) ;       \
+    GB_FREE_WORK (&DelJ, DelJ_size) ;       \
+}
+
+#define GB_FREE_ALL                         \
+{                                           \
+    GB_FREE_WORKSPACE ;                     \
+    GB_FREE (&Yp_new, Yp_new_size) ;        \
+    GB_FREE (&Yi_new, Yi_new_size) ;        \
+    GB_FREE (&Yx_new, Yx_new_size) ;        \
+    GB_hyper_hash_free (A) ;                \
+}
+
+//------------------------------------------------------------------------------
+// GB_rank: # of entries in the sorted list X [0:n-1] that are less than j
+//------------------------------------------------------------------------------
+
+static inline int64_t GB_rank
+(
+    const int64_t *restrict X,
+    const int64_t n,
+    const int64_t j
+)
+{
+    int64_t pleft = 0, pright = n ;
+    while (pleft < pright)
+    {
+        int64_t pmiddle = pleft + (pright - pleft) / 2 ;
+        if (X [pmiddle] < j)
+        {
+            pleft = pmiddle + 1 ;
+        }
+        else
+        {
+            pright = pmiddle ;
+        }
+    }
+    return (pleft) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_bucket_range: find the entries of bucket b in a list sorted by bucket
+//------------------------------------------------------------------------------
+
+static inline void GB_bucket_range
+(
+    int64_t *pstart,
+    int64_t *pend,
+    const int64_t *restrict B,      // bucket of each entry, sorted
+    const int64_t n,
+    const int64_t b
+)
+{
+    (*pstart) = GB_rank (B, n, b) ;
+    (*pend) = GB_rank (B, n, b+1) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_hyper_hash_update
+//------------------------------------------------------------------------------
+
+GrB_Info GB_hyper_hash_update   // update A->Y after A->h has changed
+(
+    GrB_Matrix A,               // hypersparse matrix with its new A->h
+    const int64_t *restrict Del,    // vectors removed from A->h, sorted
+    const int64_t ndel,
+    const int64_t *restrict Ins,    // vectors added to A->h, sorted
+    const int64_t nins,
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (A != NULL) ;
+    GrB_Matrix Y = A->Y ;
+    if (Y == NULL || (ndel == 0 && nins == 0))
+    {
+        // nothing to do
+        return (GrB_SUCCESS) ;
+    }
+
+    const int64_t anvec = A->nvec ;
+    const int64_t yvdim = Y->vdim ;
+    if (A->Y_shallow || GB_is_shallow (Y) || A->h == NULL ||
+        anvec <= GB_Global_hyper_hash_get ( ) ||
+        yvdim > 2 * GB_hyper_hash_size (anvec) ||
+        yvdim < GB_hyper_hash_size (anvec) / 2)
+    {
+        // A->Y cannot be updated, or it has too few or too many buckets, or
+        // it is no longer needed; it will be rebuilt later, if needed
+        GB_hyper_hash_free (A) ;
+        return (GrB_SUCCESS) ;
+    }
+
+    GBURBLE ("(update hyper hash) ") ;
+
+    int64_t *restrict InsB = NULL ; size_t InsB_size = 0 ;
+    int64_t *restrict InsJ = NULL ; size_t InsJ_size = 0 ;
+    int64_t *restrict DelB = NULL ; size_t DelB_size = 0 ;
+    int64_t *restrict DelJ = NULL ; size_t DelJ_size = 0 ;
+    int64_t *restrict Yp_new = NULL ; size_t Yp_new_size = 0 ;
+    int64_t *restrict Yi_new = NULL ; size_t Yi_new_size = 0 ;
+    uint64_t *restrict Yx_new = NULL ; size_t Yx_new_size = 0 ;
+
+    const int64_t *restrict Ah = A->h ;
+    const int64_t *restrict Yp = Y->p ;
+    const int64_t *restrict Yi = Y->i ;
+    const uint64_t *restrict Yx = (uint64_t *) Y->x ;
+    const int64_t hash_bits = yvdim - 1 ;
+    const int64_t ynz_new = Yp [yvdim] - ndel + nins ;
+    ASSERT (ynz_new == anvec) ;
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+    int nthreads = GB_nthreads (ynz_new + yvdim, chunk, nthreads_max) ;
+
+    //--------------------------------------------------------------------------
+    // sort the inserted and deleted vectors by (bucket, j)
+    //--------------------------------------------------------------------------
+
+    InsB = GB_MALLOC_WORK (nins + 1, int64_t, &InsB_size) ;
+    InsJ = GB_MALLOC_WORK (nins + 1, int64_t, &InsJ_size) ;
+    DelB = GB_MALLOC_WORK (ndel + 1, int64_t, &DelB_size) ;
+    DelJ = GB_MALLOC_WORK (ndel + 1, int64_t, &DelJ_size) ;
+    Yp_new = GB_MALLOC (yvdim + 1, int64_t, &Yp_new_size) ;
+    Yi_new = GB_MALLOC (ynz_new, int64_t, &Yi_new_size) ;
+    Yx_new = GB_MALLOC (ynz_new, uint64_t, &Yx_new_size) ;
+    if (InsB == NULL || InsJ == NULL || DelB == NULL || DelJ == NULL ||
+        Yp_new == NULL || Yi_new == NULL || Yx_new == NULL)
+    {
+        // out of memory; A->Y is freed, and A remains valid
+        GB_FREE_ALL ;
+        return (GrB_SUCCESS) ;
+    }
+
+    for (int64_t t = 0 ; t < nins ; t++)
+    {
+        InsJ [t] = Ins [t] ;
+        InsB [t] = GB_HASHF2 (Ins [t], hash_bits) ;
+    }
+    for (int64_t t = 0 ; t < ndel ; t++)
+    {
+        DelJ [t] = Del [t] ;
+        DelB [t] = GB_HASHF2 (Del [t], hash_bits) ;
+    }
+    if (GB_msort_2 (InsB, InsJ, nins, 1) != GrB_SUCCESS ||
+        GB_msort_2 (DelB, DelJ, ndel, 1) != GrB_SUCCESS)
+    {
+        // out of memory; A->Y is freed, and A remains valid
+        GB_FREE_ALL ;
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // count the entries in each bucket of the new A->Y
+    //--------------------------------------------------------------------------
+
+    int64_t b ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (b = 0 ; b < yvdim ; b++)
+    {
+        int64_t pI_start, pI_end, pD_start, pD_end ;
+        GB_bucket_range (&pI_start, &pI_end, InsB, nins, b) ;
+        GB_bucket_range (&pD_start, &pD_end, DelB, ndel, b) ;
+        Yp_new [b] = (Yp [b+1] - Yp [b]) + (pI_end - pI_start)
+            - (pD_end - pD_start) ;
+    }
+
+    int64_t ynvec_nonempty ;
+    GB_cumsum (Yp_new, yvdim, &ynvec_nonempty, nthreads, Werk) ;
+    ASSERT (Yp_new [yvdim] == ynz_new) ;
+
+    //--------------------------------------------------------------------------
+    // merge each bucket with its inserted vectors, and renumber its entries
+    //--------------------------------------------------------------------------
+
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (b = 0 ; b < yvdim ; b++)
+    {
+        int64_t pI, pI_end, pD, pD_end ;
+        GB_bucket_range (&pI, &pI_end, InsB, nins, b) ;
+        GB_bucket_range (&pD, &pD_end, DelB, ndel, b) ;
+        int64_t pY = Yp [b] ;
+        int64_t pY_end = Yp [b+1] ;
+        int64_t pC = Yp_new [b] ;
+        while (pY < pY_end || pI < pI_end)
+        {
+            int64_t jY = (pY < pY_end) ? Yi [pY] : INT64_MAX ;
+            int64_t jI = (pI < pI_end) ? InsJ [pI] : INT64_MAX ;
+            if (jY <= jI && pY < pY_end)
+            {
+                // get the old entry (jY,k) in the bucket
+                while (pD < pD_end && DelJ [pD] < jY) pD++ ;
+                if (pD < pD_end && DelJ [pD] == jY)
+                {
+                    // vector jY has been removed from A->h
+                    pD++ ;
+                }
+                else
+                {
+                    // vector jY is still in A->h, at its new position k
+                    int64_t k = (int64_t) Yx [pY] + GB_rank (Ins, nins, jY)
+                        - GB_rank (Del, ndel, jY) ;
+                    ASSERT (k >= 0 && k < anvec && Ah [k] == jY) ;
+                    Yi_new [pC] = jY ;
+                    Yx_new [pC] = (uint64_t) k ;
+                    pC++ ;
+                }
+                pY++ ;
+            }
+            else
+            {
+                // vector jI has been added to A->h; find its position k
+                int64_t k = GB_rank (Ah, anvec, jI) ;
+                ASSERT (k < anvec && Ah [k] == jI) ;
+                Yi_new [pC] = jI ;
+                Yx_new [pC] = (uint64_t) k ;
+                pC++ ;
+                pI++ ;
+            }
+        }
+        ASSERT (pC == Yp_new [b+1]) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // replace the content of A->Y
+    //--------------------------------------------------------------------------
+
+    GB_FREE (&(Y->p), Y->p_size) ;
+    GB_FREE (&(Y->i), Y->i_size) ;
+    GB_FREE (&(Y->x), Y->x_size) ;
+    Y->p = Yp_new ; Y->p_size = Yp_new_size ; Yp_new = NULL ;
+    Y->i = Yi_new ; Y->i_size = Yi_new_size ; Yi_new = NULL ;
+    Y->x = Yx_new ; Y->x_size = Yx_new_size ; Yx_new = NULL ;
+    Y->nvals = ynz_new ;
+    Y->nvec_nonempty = ynvec_nonempty ;
+
+    GB_FREE_WORKSPACE ;
+    ASSERT_MATRIX_OK (Y, "Y updated", GB0) ;
+    return (GrB_SUCCESS) ;
+}
+
@@ -55,6 +55,14 @@ GrB_Matrix GB_hyper_shallow         // return C
     C->Y = NULL ;
     C->Y_shallow = false ;
 
+    // the cached transpose of A is not shared
+    C->AT = NULL ;
+    C->transpose_cache = false ;
+    C->hyper_pin = false ;
+
+    // the usage statistics of A are not shared
+    C->sparsity_adaptive = false ;
+
     // flag all content of C as shallow
     C->p_shallow = true ;
     C->i_shallow = true ;
@@ -170,6 +170,8 @@ GrB_Info GB_init            // start up GraphBLAS
 
     GB_Global_hyper_switch_set (GB_HYPER_SWITCH_DEFAULT) ;
     GB_Global_bitmap_switch_default ( ) ;
+    GB_Global_chunk_family_default ( ) ;
+    GB_Global_numa_policy_set (GxB_NUMA_DEFAULT) ;
     GB_Global_is_csc_set (false) ;
 
     //--------------------------------------------------------------------------
@@ -55,6 +55,7 @@ GrB_Info GB_ix_realloc      // reallocate space in a matrix
     size_t nzmax_new1 = GB_IMAX (nzmax_new, 1) ;
     bool ok1 = true, ok2 = true ;
     GB_REALLOC (A->i, nzmax_new1, int64_t, &(A->i_size), &ok1) ;
+    GB_numa_bind (A->i, A->i_size) ;
     size_t asize = A->type->size ;
     if (A->iso)
     { 
@@ -65,6 +66,7 @@ GrB_Info GB_ix_realloc      // reallocate space in a matrix
     { 
         // reallocate A->x from its current size to nzmax_new1 entries
         GB_REALLOC (A->x, nzmax_new1*asize, GB_void, &(A->x_size), &ok2) ;
+        GB_numa_bind (A->x, A->x_size) ;
     }
     bool ok = ok1 && ok2 ;
 
@@ -423,9 +423,13 @@ GrB_Info GB_jitifyer_init (void)
         else if (IS ("emult_04"     )) c = GB_JIT_KERNEL_EMULT4 ;
         else if (IS ("emult_08"     )) c = GB_JIT_KERNEL_EMULT8 ;
         else if (IS ("emult_bitmap" )) c = GB_JIT_KERNEL_EMULT_BITMAP ;
+        else if (IS ("ewise_axpby"  )) c = GB_JIT_KERNEL_EWISE_AXPBY ;
         else if (IS ("ewise_fulla"  )) c = GB_JIT_KERNEL_EWISEFA ;
         else if (IS ("ewise_fulln"  )) c = GB_JIT_KERNEL_EWISEFN ;
         else if (IS ("reduce"       )) c = GB_JIT_KERNEL_REDUCE ;
+        else if (IS ("reduce_each_vector")) c = GB_JIT_KERNEL_REDUCE_EACH ;
+        else if (IS ("reduce_select_apply"))
+                                       c = GB_JIT_KERNEL_REDUCE_SELECT_APPLY ;
         else if (IS ("rowscale"     )) c = GB_JIT_KERNEL_ROWSCALE ;
         else if (IS ("select_bitmap")) c = GB_JIT_KERNEL_SELECT_BITMAP ;
         else if (IS ("select_phase1")) c = GB_JIT_KERNEL_SELECT1 ;
@@ -438,6 +442,8 @@ GrB_Info GB_jitifyer_init (void)
         else if (IS ("subassign_22" )) c = GB_JIT_KERNEL_SUBASSIGN_22 ;
         else if (IS ("subassign_23" )) c = GB_JIT_KERNEL_SUBASSIGN_23 ;
         else if (IS ("subassign_25" )) c = GB_JIT_KERNEL_SUBASSIGN_25 ;
+        else if (IS ("subref_bitmap")) c = GB_JIT_KERNEL_SUBREF_BITMAP ;
+        else if (IS ("subref_sparse")) c = GB_JIT_KERNEL_SUBREF_SPARSE ;
         else if (IS ("trans_bind1st")) c = GB_JIT_KERNEL_TRANSBIND1 ;
         else if (IS ("trans_bind2nd")) c = GB_JIT_KERNEL_TRANSBIND2 ;
         else if (IS ("trans_unop"   )) c = GB_JIT_KERNEL_TRANSUNOP ;
@@ -1725,6 +1731,17 @@ GrB_Info GB_jitifyer_worker
             op1 = op ;
             break ;
 
+        case GB_jit_fused_family : 
+            if (semiring != NULL)
+            { 
+                // alpha*A+beta*B uses the semiring
+                monoid = semiring->add ;
+                op2 = (GB_Operator) semiring->multiply ;
+            }
+            op1 = (GB_Operator) monoid->op ;
+            scode_digits = 16 ;
+            break ;
+
         default: ;
     }
 
@@ -30,15 +30,16 @@ void GB_prejit
 
 typedef enum
 {
-    GB_jit_reduce_family    = 1,    // kcode 1
+    GB_jit_reduce_family    = 1,    // kcodes 1 and 88
     GB_jit_mxm_family       = 2,    // kcodes 2 to 9
     GB_jit_ewise_family     = 3,    // kcodes 10 to 24
-    GB_jit_apply_family     = 4,    // kcodes 25 to 33
+    GB_jit_apply_family     = 4,    // kcodes 25 to 33, 79 and 80
     GB_jit_build_family     = 5,    // kcode 34
     GB_jit_select_family    = 6,    // kcodes 35 to 37
     GB_jit_user_op_family   = 7,    // kcode 38
     GB_jit_user_type_family = 8,    // kcode 39
     GB_jit_assign_family    = 9,    // kcodes 40 to 44 (future:: to 78)
+    GB_jit_fused_family     = 10,   // kcodes 89 and 90
 }
 GB_jit_family ;
 
@@ -153,9 +154,9 @@ typedef enum
     GB_JIT_KERNEL_ASSIGN_BITMAP_NM_NOACC        = 77, // GB_bitmap_assign_notM_noaccum
     GB_JIT_KERNEL_ASSIGN_BITMAP_NM_NOACC_WHOLE  = 78, // GB_bitmap_assign_notM_noaccum_whole
 
-    // future:: subref methods:
-    GB_JIT_KERNEL_SUBREF        = 79, // GB_bitmap_subref
-    GB_JIT_KERNEL_SUBREF_PHASE3 = 80, // GB_subref_phase3
+    // subref methods (in the apply family):
+    GB_JIT_KERNEL_SUBREF_BITMAP = 79, // GB_bitmap_subref
+    GB_JIT_KERNEL_SUBREF_SPARSE = 80, // GB_subref_phase3
 
     // future:: masker methods:
     GB_JIT_KERNEL_MASKER_PHASE1 = 81, // GB_masker_phase1
@@ -170,6 +171,15 @@ typedef enum
     GB_JIT_KERNEL_EXPANDISO     = 86, // GB_expand_iso
     GB_JIT_KERNEL_SORT          = 87, // GB_sort
 
+    // reduce each vector to a scalar (in the reduce family):
+    GB_JIT_KERNEL_REDUCE_EACH   = 88, // GB_reduce_each_vector
+
+    // fused select, apply, and reduce each vector (in the fused family):
+    GB_JIT_KERNEL_REDUCE_SELECT_APPLY = 89, // GB_reduce_each_vector
+
+    // fused alpha*A+beta*B (in the fused family):
+    GB_JIT_KERNEL_EWISE_AXPBY   = 90, // GB_ewise_axpby
+
     //--------------------------------------------------------------------------
     // future:: CUDA kernels
     //--------------------------------------------------------------------------
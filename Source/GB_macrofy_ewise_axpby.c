@@ -0,0 +1,117 @@
+//------------------------------------------------------------------------------
+// GB_macrofy_ewise_axpby: construct macros for a fused alpha*A+beta*B
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The semiring is macrofied as in GB_macrofy_mxm, with GB_ADD for the
+// additive monoid and GB_MULT for the multiplicative operator (never flipped).
+// A and B are both typecasted to the y input of the multiplicative operator,
+// and alpha and beta have the type of its x input.
+
+#include "GB.h"
+#include "GB_stringify.h"
+
+void GB_macrofy_ewise_axpby         // construct macros for alpha*A+beta*B
+(
+    FILE *fp,                   // target file to write, already open
+    // input:
+    uint64_t fcode,             // encoded problem
+    GrB_Semiring semiring,      // semiring to macrofy
+    GrB_Type atype,             // type of the A matrix
+    GrB_Type btype              // type of the B matrix
+)
+{
+
+    //--------------------------------------------------------------------------
+    // extract the fcode
+    //--------------------------------------------------------------------------
+
+    // monoid
+    int add_ecode   = GB_RSHIFT (fcode, 58, 5) ;
+    int id_ecode    = GB_RSHIFT (fcode, 53, 5) ;
+    int term_ecode  = GB_RSHIFT (fcode, 48, 5) ;
+
+    // A and B iso
+    int A_iso_code  = GB_RSHIFT (fcode, 47, 1) ;
+    int B_iso_code  = GB_RSHIFT (fcode, 46, 1) ;
+
+    // multiplier
+    int mult_ecode  = GB_RSHIFT (fcode, 36, 8) ;
+//  int zcode       = GB_RSHIFT (fcode, 32, 4) ;
+//  int xcode       = GB_RSHIFT (fcode, 28, 4) ;
+    int ycode       = GB_RSHIFT (fcode, 24, 4) ;    // if 0: ignored
+
+    // types of A and B
+    int acode       = GB_RSHIFT (fcode, 20, 4) ;    // if 0: A is pattern
+    int bcode       = GB_RSHIFT (fcode, 16, 4) ;    // if 0: B is pattern
+
+    // sparsity structure of A and B
+    int asparsity   = GB_RSHIFT (fcode,  0, 2) ;
+
+    //--------------------------------------------------------------------------
+    // describe the problem
+    //--------------------------------------------------------------------------
+
+    GrB_Monoid monoid = semiring->add ;
+    GrB_BinaryOp mult = semiring->multiply ;
+    GrB_BinaryOp addop = monoid->op ;
+
+    fprintf (fp, "// alpha*A+beta*B, semiring: (%s, %s, %s)\n",
+        addop->name, mult->name, mult->xtype->name) ;
+
+    //--------------------------------------------------------------------------
+    // construct the typedefs
+    //--------------------------------------------------------------------------
+
+    GrB_Type xtype = mult->xtype ;
+    GrB_Type ytype = (ycode == 0) ? NULL : mult->ytype ;
+    GrB_Type ztype = mult->ztype ;
+
+    GB_macrofy_typedefs (fp, NULL,
+        (acode == 0) ? NULL : atype,
+        (bcode == 0) ? NULL : btype,
+        xtype, ytype, ztype) ;
+
+    fprintf (fp, "\n// semiring types:\n") ;
+    GB_macrofy_type (fp, "Z", "_", ztype->name) ;
+    GB_macrofy_type (fp, "X", "_", xtype->name) ;
+    GB_macrofy_type (fp, "Y", "_", (ytype == NULL) ? "void" : ytype->name) ;
+
+    //--------------------------------------------------------------------------
+    // construct the monoid macros
+    //--------------------------------------------------------------------------
+
+    fprintf (fp, "\n// monoid:\n") ;
+    GB_macrofy_monoid (fp, add_ecode, id_ecode, term_ecode, false, monoid,
+        false, NULL, NULL) ;
+
+    //--------------------------------------------------------------------------
+    // construct macros for the multiply operator
+    //--------------------------------------------------------------------------
+
+    fprintf (fp, "\n// multiplicative operator:\n") ;
+    GB_macrofy_binop (fp, "GB_MULT", false, false, false, mult_ecode, false,
+        mult, NULL, NULL, NULL) ;
+
+    //--------------------------------------------------------------------------
+    // construct the macros for A and B
+    //--------------------------------------------------------------------------
+
+    // A and B have the same pattern, so the sparsity structure of A is used
+    // for both.  Both are typecasted to the y input of the multiplier.
+    GB_macrofy_input (fp, "a", "A", "A", true, ytype,
+        atype, asparsity, acode, A_iso_code, -1) ;
+    GB_macrofy_input (fp, "b", "B", "B", true, ytype,
+        btype, asparsity, bcode, B_iso_code, -1) ;
+
+    //--------------------------------------------------------------------------
+    // include the final default definitions
+    //--------------------------------------------------------------------------
+
+    fprintf (fp, "\n#include \"GB_monoid_shared_definitions.h\"\n") ;
+}
+
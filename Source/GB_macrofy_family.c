@@ -66,6 +66,17 @@ void GB_macrofy_family
             GB_macrofy_user_type (fp, type1) ;
             break ;
 
+        case GB_jit_fused_family  : 
+            if (semiring != NULL)
+            { 
+                GB_macrofy_ewise_axpby (fp, scode, semiring, type1, type2) ;
+            }
+            else
+            { 
+                GB_macrofy_reduce_select_apply (fp, scode, monoid, type1) ;
+            }
+            break ;
+
         default: ;
     }
 }
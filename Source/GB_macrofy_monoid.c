@@ -183,7 +183,7 @@ void GB_macrofy_monoid  // construct the macros for a monoid
             // #pragma omp simd reduction(+:z)
             redop = "+" ;
         }
-        else if (opcode == GB_LXOR_binop_code || opcode == GB_BXOR_binop_code)
+        else if (opcode == GB_BXOR_binop_code)
         { 
             // #pragma omp simd reduction(^:z)
             redop = "^" ;
@@ -204,6 +204,13 @@ void GB_macrofy_monoid  // construct the macros for a monoid
             fprintf (fp, "#define GB_PRAGMA_SIMD_REDUCTION_MONOID(z) "
                 "GB_PRAGMA_SIMD_REDUCTION (%s,z)\n", redop) ;
         }
+        else if (opcode == GB_LXOR_binop_code)
+        { 
+            // #pragma omp simd reduction(^:z), except for gcc 12, which
+            // miscompiles it (see GB_compiler.h)
+            fprintf (fp, "#define GB_PRAGMA_SIMD_REDUCTION_MONOID(z) "
+                "GB_PRAGMA_SIMD_REDUCTION_LXOR (z)\n") ;
+        }
     }
 
     //--------------------------------------------------------------------------
@@ -0,0 +1,261 @@
+//------------------------------------------------------------------------------
+// GB_macrofy_reduce_select_apply: construct macros for a fused reduction
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The monoid and the A matrix are macrofied as in GB_macrofy_reduce, the unary
+// operator as in GB_macrofy_apply, and the index unary operator as in
+// GB_macrofy_select.  The unary and index unary operators are built-in, so
+// they are constructed from the fcode alone.
+
+#include "GB.h"
+#include "GB_stringify.h"
+
+// print "z = (ztype) x", with the expression f from GB_macrofy_cast_expression,
+// or with a C11 typecast if f is NULL
+static void GB_macrofy_cast_assign
+(
+    FILE *fp,
+    const char *f,              // cast expression, or NULL
+    int nargs,                  // # of arguments of f
+    const char *z,              // name of the output
+    const char *x,              // name of the input
+    GrB_Type ztype              // type of the output
+)
+{
+    if (f == NULL)
+    {
+        // C11 typecasting
+        fprintf (fp, "%s = (%s) (%s)", z, ztype->name, x) ;
+    }
+    else if (nargs == 3)
+    {
+        fprintf (fp, f, z, x, x) ;
+    }
+    else
+    {
+        fprintf (fp, f, z, x) ;
+    }
+}
+
+void GB_macrofy_reduce_select_apply // construct macros for a fused reduce
+(
+    FILE *fp,                   // target file to write, already open
+    // input:
+    uint64_t fcode,             // encoded problem
+    GrB_Monoid monoid,          // monoid to macrofy
+    GrB_Type atype              // type of the A matrix to reduce
+)
+{
+
+    //--------------------------------------------------------------------------
+    // extract the fcode
+    //--------------------------------------------------------------------------
+
+    // select op
+    int sel_xcode   = GB_RSHIFT (fcode, 60, 4) ;
+    int sel_ecode   = GB_RSHIFT (fcode, 52, 8) ;
+    int sel_ycode   = GB_RSHIFT (fcode, 48, 4) ;
+
+    // apply op
+    int uop_zcode   = GB_RSHIFT (fcode, 44, 4) ;
+    int uop_xcode   = GB_RSHIFT (fcode, 40, 4) ;
+    int uop_ecode   = GB_RSHIFT (fcode, 32, 8) ;
+
+    // flipij
+    bool flipij     = GB_RSHIFT (fcode, 28, 1) ;
+
+    // monoid
+    int red_ecode   = GB_RSHIFT (fcode, 22, 5) ;
+    int id_ecode    = GB_RSHIFT (fcode, 17, 5) ;
+    int term_ecode  = GB_RSHIFT (fcode, 12, 5) ;
+
+    // type of A
+    int acode       = GB_RSHIFT (fcode, 4, 4) ;
+
+    // zombies
+    int azombies    = GB_RSHIFT (fcode, 2, 1) ;
+
+    // format of A
+    int asparsity   = GB_RSHIFT (fcode, 0, 2) ;
+
+    //--------------------------------------------------------------------------
+    // get the types
+    //--------------------------------------------------------------------------
+
+    GrB_Type ztype = monoid->op->ztype ;
+    GrB_Type uop_xtype = GB_code_type (uop_xcode, atype) ;
+    GrB_Type uop_ztype = GB_code_type (uop_zcode, atype) ;
+    GrB_Type sel_xtype = (sel_xcode == 0) ? NULL :
+        GB_code_type (sel_xcode, atype) ;
+    GrB_Type sel_ytype = (sel_ecode == 0) ? GrB_INT64 :
+        GB_code_type (sel_ycode, NULL) ;
+
+    // the ROWINDEX, COLINDEX, and DIAGINDEX operators return an integer of
+    // the same type as y; all other built-in index unary ops return bool
+    bool sel_z_is_index = (sel_ecode == 232 || sel_ecode == 235 ||
+        sel_ecode == 238 || sel_ecode == 239) ;
+    GrB_Type sel_ztype = (sel_z_is_index) ? sel_ytype : GrB_BOOL ;
+
+    //--------------------------------------------------------------------------
+    // describe the problem
+    //--------------------------------------------------------------------------
+
+    fprintf (fp, "// reduce: (%s, %s)\n", monoid->op->name, ztype->name) ;
+    fprintf (fp, "// apply: (%d, %s, %s)\n", uop_ecode, uop_ztype->name,
+        uop_xtype->name) ;
+    if (sel_ecode == 0)
+    {
+        fprintf (fp, "// select: none\n") ;
+    }
+    else
+    {
+        fprintf (fp, "// select: (%d%s, %s)\n", sel_ecode,
+            flipij ? " (flipped ij)" : "",
+            (sel_xtype == NULL) ? "GB_void" : sel_xtype->name) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // construct the typedefs
+    //--------------------------------------------------------------------------
+
+    GB_macrofy_typedefs (fp, NULL, atype, NULL, NULL, NULL, ztype) ;
+
+    //--------------------------------------------------------------------------
+    // construct the monoid macros
+    //--------------------------------------------------------------------------
+
+    fprintf (fp, "\n// monoid:\n") ;
+    GB_macrofy_type (fp, "Z", "_", ztype->name) ;
+    GB_macrofy_monoid (fp, red_ecode, id_ecode, term_ecode, false, monoid,
+        false, NULL, NULL) ;
+
+    //--------------------------------------------------------------------------
+    // construct the macros for the unary operator
+    //--------------------------------------------------------------------------
+
+    fprintf (fp, "\n// unary operator types:\n") ;
+    GB_macrofy_type (fp, "UOP_Z", "_", uop_ztype->name) ;
+    GB_macrofy_type (fp, "UOP_X", "_", uop_xtype->name) ;
+
+    fprintf (fp, "\n// unary operator:\n") ;
+    GB_macrofy_unop (fp, "GB_UNARYOP", false, uop_ecode, NULL) ;
+
+    // z = (ztype) op ((xtype) Ax [p])
+    if (uop_ztype == ztype)
+    {
+        // no typecasting of the result of the unary operator
+        fprintf (fp, "#define GB_APPLY_ENTRY(z,Ax,p) \\\n"
+                     "{                                  \\\n"
+                     "    GB_DECLAREA (x) ;              \\\n"
+                     "    GB_GETA (x, Ax, p, ) ;         \\\n"
+                     "    GB_UNARYOP (z, x, , , ) ;      \\\n"
+                     "}\n") ;
+    }
+    else
+    {
+        // must typecast the result of the unary operator to the monoid type
+        int nargs ;
+        const char *cast_t_to_z = GB_macrofy_cast_expression (fp,
+            ztype, uop_ztype, &nargs) ;
+        fprintf (fp, "#define GB_APPLY_ENTRY(z,Ax,p) \\\n"
+                     "{                                  \\\n"
+                     "    GB_DECLAREA (x) ;              \\\n"
+                     "    GB_GETA (x, Ax, p, ) ;         \\\n"
+                     "    GB_UOP_Z_TYPE t ;              \\\n"
+                     "    GB_UNARYOP (t, x, , , ) ;      \\\n    ") ;
+        GB_macrofy_cast_assign (fp, cast_t_to_z, nargs, "z", "t", ztype) ;
+        fprintf (fp, " ; \\\n}\n") ;
+    }
+
+    // z += (ztype) op ((xtype) Ax [p])
+    fprintf (fp, "#define GB_APPLY_AND_UPDATE(z,Ax,p) \\\n"
+                 "{                                  \\\n"
+                 "    GB_Z_TYPE zaij ;               \\\n"
+                 "    GB_APPLY_ENTRY (zaij, Ax, p) ; \\\n"
+                 "    GB_UPDATE (z, zaij) ;          \\\n"
+                 "}\n") ;
+
+    //--------------------------------------------------------------------------
+    // construct the macros for the index unary operator
+    //--------------------------------------------------------------------------
+
+    fprintf (fp, "\n// index unary operator types:\n") ;
+    GB_macrofy_type (fp, "Y", "_", sel_ytype->name) ;
+
+    fprintf (fp, "\n// test if A(i,j) is to be kept:\n") ;
+    if (sel_ecode == 0)
+    {
+        // no select operator: all entries are kept
+        fprintf (fp,
+            "#define GB_TEST_VALUE_OF_ENTRY(keep,p) bool keep = true\n") ;
+    }
+    else
+    {
+        GB_macrofy_type (fp, "SEL_Z", "_", sel_ztype->name) ;
+        if (sel_xtype != NULL)
+        {
+            GB_macrofy_type (fp, "SEL_X", "_", sel_xtype->name) ;
+        }
+        fprintf (fp, "\n// index unary operator%s:\n",
+            flipij ? " (flipped ij)" : "") ;
+        GB_macrofy_unop (fp, "GB_IDXUNOP", flipij, sel_ecode, NULL) ;
+
+        // any typecasting functions must be defined before the macro
+        int nargs_a_to_x = 0, nargs_z_to_bool = 0 ;
+        const char *cast_a_to_x = NULL ;
+        bool cast_a = (sel_xtype != NULL && acode != sel_xcode) ;
+        if (cast_a)
+        {
+            cast_a_to_x = GB_macrofy_cast_expression (fp, sel_xtype, atype,
+                &nargs_a_to_x) ;
+        }
+        const char *cast_z_to_bool = GB_macrofy_cast_expression (fp,
+            GrB_BOOL, sel_ztype, &nargs_z_to_bool) ;
+
+        fprintf (fp, "#define GB_TEST_VALUE_OF_ENTRY(keep,p) \\\n"
+                     "    GB_SEL_Z_TYPE zkeep ;              \\\n") ;
+        if (sel_xtype == NULL)
+        {
+            // operator does not depend on x
+            fprintf (fp, "    GB_IDXUNOP (zkeep, , i, j, y) ;    \\\n") ;
+        }
+        else if (!cast_a)
+        {
+            // operator depends on x, but it has the same type as A
+            fprintf (fp, "    GB_IDXUNOP (zkeep, Ax [p], i, j, y) ; \\\n") ;
+        }
+        else
+        {
+            // must typecast from A to x
+            fprintf (fp, "    GB_SEL_X_TYPE xkeep ;              \\\n    ") ;
+            GB_macrofy_cast_assign (fp, cast_a_to_x, nargs_a_to_x, "xkeep",
+                "Ax [p]", sel_xtype) ;
+            fprintf (fp, " ; \\\n"
+                     "    GB_IDXUNOP (zkeep, xkeep, i, j, y) ; \\\n") ;
+        }
+        // keep = (bool) zkeep
+        fprintf (fp, "    ") ;
+        GB_macrofy_cast_assign (fp, cast_z_to_bool, nargs_z_to_bool,
+            "bool keep", "zkeep", GrB_BOOL) ;
+        fprintf (fp, "\n") ;
+    }
+
+    //--------------------------------------------------------------------------
+    // construct the macros for A
+    //--------------------------------------------------------------------------
+
+    GB_macrofy_input (fp, "a", "A", "A", true, uop_xtype,
+        atype, asparsity, acode, false, azombies) ;
+
+    //--------------------------------------------------------------------------
+    // include the final default definitions
+    //--------------------------------------------------------------------------
+
+    fprintf (fp, "\n#include \"GB_monoid_shared_definitions.h\"\n") ;
+}
+
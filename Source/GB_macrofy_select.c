@@ -223,7 +223,7 @@ void GB_macrofy_select          // construct all macros for GrB_select
     //--------------------------------------------------------------------------
 
     GB_macrofy_input (fp, "a", "A", "A", true, xtype,
-        atype, asparsity, acode, 0, -1) ;
+        atype, asparsity, acode, A_iso, -1) ;
 
     //--------------------------------------------------------------------------
     // include the final default definitions
@@ -348,6 +348,7 @@ GrB_Info GB_matvec_check    // check a GraphBLAS matrix or vector
         GBPR ("  ->x: %p shallow: %d size: " GBu "\n",
             A->x, A->x_shallow, (uint64_t) A->x_size) ;
         GBPR ("  ->Y: %p shallow: %d\n", A->Y, A->Y_shallow) ;
+        GBPR ("  ->AT: %p cache: %d\n", A->AT, A->transpose_cache) ;
     }
     #endif
 
@@ -906,6 +907,32 @@ GrB_Info GB_matvec_check    // check a GraphBLAS matrix or vector
         }
     }
 
+    //--------------------------------------------------------------------------
+    // check A->AT
+    //--------------------------------------------------------------------------
+
+    GrB_Matrix AT = A->AT ;
+    if (AT != NULL)
+    {
+        info = GB_matvec_check (AT, "AT cached transpose", pr_developer, f,
+            "matrix") ;
+        if (info != GrB_SUCCESS)
+        { 
+            // A->AT fails the tests in GB_matvec_check
+            GBPR0 ("  cached transpose invalid\n") ;
+            return (info) ;
+        }
+        if (AT->vlen != A->vdim || AT->vdim != A->vlen || AT->type != A->type
+            || AT->nvals != GB_nnz (A) - A->nzombies || AT->AT != NULL
+            || GB_ANY_PENDING_WORK (AT) || GB_is_shallow (AT))
+        { 
+            // AT must have the transposed dimensions of A, the same type and
+            // number of live entries, no pending work, and no shallow content
+            GBPR0 ("  cached transpose invalid\n") ;
+            return (GrB_INVALID_OBJECT) ;
+        }
+    }
+
     //--------------------------------------------------------------------------
     // return result
     //--------------------------------------------------------------------------
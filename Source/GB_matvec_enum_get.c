@@ -28,6 +28,21 @@ GrB_Info GB_matvec_enum_get (GrB_Matrix A, int32_t *value, int field)
             (*value) = A->sparsity_control ;
             break ;
 
+        case GxB_SPARSITY_ADAPTIVE : 
+
+            (*value) = (int32_t) A->sparsity_adaptive ;
+            break ;
+
+        case GxB_HYPER_PIN : 
+
+            (*value) = (int32_t) A->hyper_pin ;
+            break ;
+
+        case GxB_TRANSPOSE_CACHE : 
+
+            (*value) = (int32_t) A->transpose_cache ;
+            break ;
+
         case GxB_SPARSITY_STATUS : 
 
             (*value) = GB_sparsity (A) ;
@@ -49,6 +49,34 @@ GrB_Info GB_matvec_set
             A->sparsity_control = GB_sparsity_control (ivalue, (int64_t) (-1)) ;
             break ;
 
+        case GxB_SPARSITY_ADAPTIVE : 
+
+            A->sparsity_adaptive = (ivalue != 0) ;
+            break ;
+
+        case GxB_HYPER_PIN : 
+
+            if (is_vector)
+            { 
+                // a GrB_Vector is never hypersparse
+                return (GrB_INVALID_VALUE) ;
+            }
+            A->hyper_pin = (ivalue != 0) ;
+            break ;
+
+        case GxB_TRANSPOSE_CACHE : 
+
+            if (is_vector)
+            { 
+                return (GrB_INVALID_VALUE) ;
+            }
+            A->transpose_cache = (ivalue != 0) ;
+            if (!A->transpose_cache)
+            { 
+                GB_transpose_cache_free (A) ;
+            }
+            break ;
+
         case GrB_STORAGE_ORIENTATION_HINT : 
 
             format = (ivalue == GrB_COLMAJOR) ? GxB_BY_COL : GxB_BY_ROW ;
@@ -59,6 +59,13 @@ void *GB_xalloc_memory      // return the newly-allocated space
     size_t *size            // resulting size
 ) ;
 
+//------------------------------------------------------------------------------
+// NUMA policy for large blocks of memory
+//------------------------------------------------------------------------------
+
+GrB_Info GB_numa_policy_set (int numa_policy) ;
+void GB_numa_bind (void *p, size_t size) ;
+
 //------------------------------------------------------------------------------
 // parallel memcpy and memset
 //------------------------------------------------------------------------------
@@ -160,6 +160,19 @@ void GB_memoryUsage         // count # allocated blocks and their sizes
         }
     }
 
+    if (A->AT != NULL)
+    { 
+        // A->AT is never shallow, and has no shallow content
+        int64_t AT_nallocs = 0 ;
+        size_t AT_mem_deep = 0 ;
+        size_t AT_mem_shallow = 0 ;
+        GB_memoryUsage (&AT_nallocs, &AT_mem_deep, &AT_mem_shallow, A->AT,
+            true) ;
+        (*nallocs) += AT_nallocs ;
+        (*mem_deep) += AT_mem_deep ;
+        (*mem_shallow) += AT_mem_shallow ;
+    }
+
     #pragma omp flush
     return ;
 }
@@ -9,7 +9,9 @@
 
 // JIT: not needed.  Only one variant possible.
 
-// Note that this function uses its own hard-coded chunk size.
+// Note that this function uses its own hard-coded chunk size.  If the NUMA
+// policy is GxB_NUMA_FIRST_TOUCH, the chunks are statically partitioned so
+// that each thread sets one contiguous part of dest (see GB_numa.c).
 
 #include "GB.h"
 
@@ -41,14 +43,33 @@ GB_CALLBACK_MEMSET_PROTO (GB_memset)
         GB_void *pdest = (GB_void *) dest ;
 
         int64_t k ;
-        #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
-        for (k = 0 ; k < nchunks ; k++)
+        if (GB_Global_numa_policy_get ( ) == GxB_NUMA_FIRST_TOUCH)
         {
-            size_t start = k * GB_MEM_CHUNK ;
-            if (start < n)
-            { 
-                size_t chunk = GB_IMIN (n - start, GB_MEM_CHUNK) ;
-                memset (pdest + start, c, chunk) ;
+            // each thread first touches one contiguous part of the block, so
+            // that the pages of dest are spread across the NUMA nodes of the
+            // threads
+            #pragma omp parallel for num_threads(nthreads) schedule(static)
+            for (k = 0 ; k < nchunks ; k++)
+            {
+                size_t start = k * GB_MEM_CHUNK ;
+                if (start < n)
+                { 
+                    size_t chunk = GB_IMIN (n - start, GB_MEM_CHUNK) ;
+                    memset (pdest + start, c, chunk) ;
+                }
+            }
+        }
+        else
+        {
+            #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+            for (k = 0 ; k < nchunks ; k++)
+            {
+                size_t start = k * GB_MEM_CHUNK ;
+                if (start < n)
+                { 
+                    size_t chunk = GB_IMIN (n - start, GB_MEM_CHUNK) ;
+                    memset (pdest + start, c, chunk) ;
+                }
             }
         }
     }
@@ -112,6 +112,10 @@ GrB_Info GB_mxm                     // C<M> = A*B
 
     // quick return if a NULL mask is complemented
     GB_RETURN_IF_QUICK_MASK (C, C_replace, M, Mask_comp, Mask_struct) ;
+
+    // C is about to be modified, so its cached transpose is no longer valid
+    GB_transpose_cache_free (C) ;
+
     GB_MATRIX_WAIT_IF_PENDING_OR_ZOMBIES (A) ;
     GB_MATRIX_WAIT_IF_PENDING_OR_ZOMBIES (B) ;
 
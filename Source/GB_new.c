@@ -105,6 +105,18 @@ GrB_Info GB_new                 // create matrix, except for indices & values
     A->hyper_switch = hyper_switch ;
     A->bitmap_switch = GB_Global_bitmap_switch_matrix_get (vlen, vdim) ;
     A->sparsity_control = GxB_AUTO_SPARSITY ;
+    A->transpose_cache = false ;
+    A->hyper_pin = false ;
+    A->sparsity_adaptive = false ;
+    A->adapt_nuses [0] = 0 ;
+    A->adapt_nuses [1] = 0 ;
+    A->adapt_npulls [0] = 0 ;
+    A->adapt_npulls [1] = 0 ;
+    A->adapt_nprobes [0] = 0 ;
+    A->adapt_nprobes [1] = 0 ;
+    A->adapt_regret = 0 ;
+    A->adapt_op_rate = 0 ;
+    A->adapt_cvt_rate = 0 ;
 
     if (sparsity == GxB_HYPERSPARSE)
     { 
@@ -159,6 +171,7 @@ GrB_Info GB_new                 // create matrix, except for indices & values
     A->p = NULL ; A->p_shallow = false ; A->p_size = 0 ;
     A->h = NULL ; A->h_shallow = false ; A->h_size = 0 ;
     A->Y = NULL ; A->Y_shallow = false ;
+    A->AT = NULL ;
     A->b = NULL ; A->b_shallow = false ; A->b_size = 0 ;
     A->i = NULL ; A->i_shallow = false ; A->i_size = 0 ;
     A->x = NULL ; A->x_shallow = false ; A->x_size = 0 ;
@@ -83,6 +83,11 @@ void GB_hyper_hash_free         // free the A->Y hyper_hash of a matrix
     GrB_Matrix A                // matrix with content to free
 ) ;
 
+void GB_transpose_cache_free    // free the A->AT cached transpose of a matrix
+(
+    GrB_Matrix A                // matrix with content to free
+) ;
+
 void GB_phybix_free             // free all content of a matrix
 (
     GrB_Matrix A                // matrix with content to free
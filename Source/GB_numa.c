@@ -0,0 +1,188 @@
+//------------------------------------------------------------------------------
+// GB_numa: NUMA policy for large blocks of memory
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// JIT: not needed.  Only one variant possible.
+
+// The NUMA policy (GrB_set (GrB_GLOBAL, policy, GxB_NUMA_POLICY)) controls
+// where the pages of large blocks of memory allocated by GraphBLAS are placed,
+// on a machine with more than one NUMA node.  It applies to A->i and A->x,
+// the two arrays that hold the bulk of a matrix, for any block of GB_NUMA_MIN
+// bytes or more.  GB_numa_bind is called where those arrays are allocated
+// (GB_bix_alloc, GB_ix_realloc, GB_xalloc_memory, GB_builder, GB_transplant,
+// and GB_transpose), not in the generic malloc/calloc/realloc wrappers, so
+// the policy is not applied to blocks of memory that GraphBLAS does not own,
+// such as user arrays imported with GxB_*_pack, or to workspace:
+
+//  GxB_NUMA_DEFAULT: the pages are placed by the operating system, which
+//      normally places each page on the NUMA node of the thread that first
+//      touches it.
+
+//  GxB_NUMA_INTERLEAVE: the pages are interleaved round-robin across all NUMA
+//      nodes that are online when the policy is set.  This is useful when a
+//      large matrix is accessed by all threads, in no particular order.
+
+//  GxB_NUMA_FIRST_TOUCH: as GxB_NUMA_DEFAULT, except that GB_memset (and thus
+//      GB_calloc_memory and GB_xalloc_memory) partitions a large block into
+//      one contiguous part per thread, so that the pages of the block are
+//      spread across the NUMA nodes of those threads, in the same order that
+//      most kernels partition their work.
+
+//  GxB_NUMA_LOCAL: the pages are placed on the NUMA node of the Context
+//      engaged by the user thread that allocates the block (see
+//      GxB_CONTEXT_NUMA_NODE), if the node has free memory.  If the Context is
+//      not bound to a NUMA node, the operating system places the pages.
+
+// The policy is applied with the Linux mbind system call, so that libnuma is
+// not required.  It is a hint: if mbind fails, or if the pages of the block
+// have already been touched (such as when malloc returns a block it has used
+// before), the pages stay where they are, and the results are not affected.
+// GxB_NUMA_INTERLEAVE and GxB_NUMA_LOCAL are only available on Linux.
+
+#if defined ( __linux__ )
+    #ifndef _GNU_SOURCE
+    #define _GNU_SOURCE
+    #endif
+    #include <unistd.h>
+    #include <sys/syscall.h>
+    #if defined ( SYS_mbind )
+    #define GB_HAVE_MBIND
+    #endif
+#endif
+
+#include "GB.h"
+
+// smallest block to which the NUMA policy is applied
+#define GB_NUMA_MIN (1024*1024)
+
+// largest # of NUMA nodes for GxB_NUMA_INTERLEAVE
+#define GB_NUMA_MAX_NODES 64
+
+// memory policies for mbind, from <linux/mempolicy.h>
+#define GB_MPOL_PREFERRED  1
+#define GB_MPOL_INTERLEAVE 3
+
+//------------------------------------------------------------------------------
+// GB_numa_policy_set: set the NUMA policy
+//------------------------------------------------------------------------------
+
+GrB_Info GB_numa_policy_set
+(
+    int numa_policy                 // a GxB_NUMA_Policy
+)
+{
+
+    switch (numa_policy)
+    {
+
+        case GxB_NUMA_DEFAULT :
+        case GxB_NUMA_FIRST_TOUCH :
+            break ;
+
+        case GxB_NUMA_INTERLEAVE :
+
+            #ifndef GB_HAVE_MBIND
+            {
+                return (GrB_NOT_IMPLEMENTED) ;
+            }
+            #else
+            {
+                // find the NUMA nodes that are online
+                bool member [GB_NUMA_MAX_NODES] ;
+                int nnodes = GB_sysfs_list (member, GB_NUMA_MAX_NODES,
+                    "/sys/devices/system/node/online") ;
+                uint64_t numa_nodes = 0 ;
+                for (int node = 0 ; node < GB_NUMA_MAX_NODES ; node++)
+                {
+                    if (member [node]) numa_nodes |= (((uint64_t) 1) << node) ;
+                }
+                // if the nodes cannot be found, use the default policy
+                GB_Global_numa_nodes_set ((nnodes > 0) ? numa_nodes : 0) ;
+            }
+            #endif
+            break ;
+
+        case GxB_NUMA_LOCAL :
+
+            #ifndef GB_HAVE_MBIND
+            {
+                return (GrB_NOT_IMPLEMENTED) ;
+            }
+            #endif
+            break ;
+
+        default :
+            return (GrB_INVALID_VALUE) ;
+    }
+
+    GB_Global_numa_policy_set (numa_policy) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_numa_bind: apply the NUMA policy to a newly allocated block of memory
+//------------------------------------------------------------------------------
+
+void GB_numa_bind
+(
+    void *p,                        // block of memory
+    size_t size                     // size of the block, in bytes
+)
+{
+
+    #ifdef GB_HAVE_MBIND
+    {
+
+        //----------------------------------------------------------------------
+        // quick return if the policy does not apply
+        //----------------------------------------------------------------------
+
+        if (p == NULL || size < GB_NUMA_MIN) return ;
+        int numa_policy = GB_Global_numa_policy_get ( ) ;
+        int mode ;
+        uint64_t mask ;
+        if (numa_policy == GxB_NUMA_INTERLEAVE)
+        {
+            mode = GB_MPOL_INTERLEAVE ;
+            mask = GB_Global_numa_nodes_get ( ) ;
+        }
+        else if (numa_policy == GxB_NUMA_LOCAL)
+        {
+            int node = GB_Context_numa_node ( ) ;
+            if (node < 0 || node >= GB_NUMA_MAX_NODES) return ;
+            mode = GB_MPOL_PREFERRED ;
+            mask = ((uint64_t) 1) << node ;
+        }
+        else
+        {
+            return ;
+        }
+        if (mask == 0) return ;
+
+        //----------------------------------------------------------------------
+        // apply the policy to the whole pages inside the block
+        //----------------------------------------------------------------------
+
+        // The first and last pages of the block may be shared with other
+        // blocks, and are left as-is.
+
+        long pagesize = sysconf (_SC_PAGESIZE) ;
+        if (pagesize <= 0) pagesize = 4096 ;
+        uintptr_t first = (uintptr_t) p ;
+        uintptr_t last  = first + size ;
+        first = ((first + pagesize - 1) / pagesize) * pagesize ;
+        last  = (last / pagesize) * pagesize ;
+        if (last <= first) return ;
+
+        // mbind is a hint; if it fails, the pages are placed by the OS
+        syscall (SYS_mbind, (void *) first, (unsigned long) (last - first),
+            mode, &mask, (unsigned long) (GB_NUMA_MAX_NODES + 1), 0) ;
+    }
+    #endif
+}
+
@@ -10,7 +10,8 @@
 // JIT: not needed.  Only one variant possible.
 
 // All pending tuples are ignored.  If a vector has all zombies it is still
-// counted as non-empty.
+// counted as non-empty.  If A is sparse with far fewer entries than vectors,
+// the work is proportional to nnz(A), not A->vdim.
 
 #include "GB.h"
 
@@ -50,23 +51,57 @@ int64_t GB_nvec_nonempty        // return # of non-empty vectors
     //--------------------------------------------------------------------------
 
     int64_t anvec = A->nvec ;
+    int64_t anz = GB_nnz (A) ;
     int nthreads_max = GB_Context_nthreads_max ( ) ;
     double chunk = GB_Context_chunk ( ) ;
-    int nthreads = GB_nthreads (anvec, chunk, nthreads_max) ;
-
-    //--------------------------------------------------------------------------
-    // count the non-empty columns
-    //--------------------------------------------------------------------------
-
     int64_t nvec_nonempty = 0 ;
     const int64_t *restrict Ap = A->p ;
 
-    int64_t k ;
-    #pragma omp parallel for num_threads(nthreads) schedule(static) \
+    if (A->h == NULL && GB_nonempty_by_search (anz, anvec))
+    {
+
+        //----------------------------------------------------------------------
+        // A is sparse with few entries: search for its non-empty vectors
+        //----------------------------------------------------------------------
+
+        // Each task counts the vectors whose first entry is in its slice of
+        // the entries of A, in time proportional to anz, not A->vdim.
+
+        int nthreads = GB_nthreads (anz, chunk, nthreads_max) ;
+        int ntasks = (nthreads == 1) ? 1 : (8 * nthreads) ;
+        ntasks = GB_IMIN (ntasks, anz) ;
+        int tid ;
+        #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1) \
             reduction(+:nvec_nonempty)
-    for (k = 0 ; k < anvec ; k++)
-    { 
-        if (Ap [k] < Ap [k+1]) nvec_nonempty++ ;
+        for (tid = 0 ; tid < ntasks ; tid++)
+        {
+            int64_t pstart, pend, k = 0 ;
+            GB_PARTITION (pstart, pend, anz, tid, ntasks) ;
+            for (int64_t p = pstart ; p < pend ; p = Ap [++k])
+            { 
+                // find the vector k that contains p; it starts at p unless
+                // it starts in the slice of a prior task
+                k = GB_nonempty_search (p, Ap, k, anvec) ;
+                if (Ap [k] == p) nvec_nonempty++ ;
+            }
+        }
+
+    }
+    else
+    {
+
+        //----------------------------------------------------------------------
+        // count the non-empty columns
+        //----------------------------------------------------------------------
+
+        int nthreads = GB_nthreads (anvec, chunk, nthreads_max) ;
+        int64_t k ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static) \
+                reduction(+:nvec_nonempty)
+        for (k = 0 ; k < anvec ; k++)
+        { 
+            if (Ap [k] < Ap [k+1]) nvec_nonempty++ ;
+        }
     }
 
     ASSERT (nvec_nonempty >= 0 && nvec_nonempty <= A->vdim) ;
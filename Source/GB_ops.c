@@ -1025,6 +1025,7 @@ struct GB_Context_opaque GB_OPAQUE (CONTEXT_WORLD) =
     // revised by GxB_Context_get/set:
     (double) GB_CHUNK_DEFAULT,      // chunk
     1,                              // nthreads_max
+    NULL, 0, 0, -1,                 // not bound to any CPUs
     -1,                             // gpu_id
 } ;
 
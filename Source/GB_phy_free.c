@@ -7,9 +7,10 @@
 
 //------------------------------------------------------------------------------
 
-// Free the A->p, A->h, and A->Y content of a matrix.  The matrix becomes
-// invalid, and would generate a GrB_INVALID_OBJECT error if passed to a
-// user-callable GraphBLAS function.
+// Free the A->p, A->h, and A->Y content of a matrix, and any cached transpose
+// A->AT, which is no longer valid.  The matrix becomes invalid, and would
+// generate a GrB_INVALID_OBJECT error if passed to a user-callable GraphBLAS
+// function.
 
 #include "GB.h"
 
@@ -56,6 +57,7 @@ void GB_phy_free                // free A->p, A->h, and A->Y of a matrix
     A->nvec_nonempty = 0 ;
 
     GB_hyper_hash_free (A) ;
+    GB_transpose_cache_free (A) ;
 
     //--------------------------------------------------------------------------
     // set the status to invalid
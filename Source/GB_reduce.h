@@ -32,6 +32,42 @@ GrB_Info GB_reduce_to_vector        // C<M> = accum (C,reduce(A))
     GB_Werk Werk
 ) ;
 
+GrB_Info GB_reduce_each_vector  // T(k) = reduce (A(:,k)) for each vector
+(
+    GrB_Matrix T,               // output vector, with static header
+    const GrB_Monoid monoid,    // monoid to do the reduction
+    const GrB_UnaryOp op,       // built-in unary op to apply, or NULL
+    const GrB_IndexUnaryOp selectop,    // built-in select op, or NULL
+    const GB_void *ythunk,      // thunk for selectop, of type selectop->ytype
+    const GrB_Matrix A,         // matrix to reduce
+    GB_Werk Werk
+) ;
+
+GrB_Info GB_reduce_select_apply     // C<M> = accum (C,reduce(op(select(A))))
+(
+    GrB_Matrix C,                   // input/output for results, size n-by-1
+    const GrB_Matrix M,             // optional M for C, unused if NULL
+    const GrB_BinaryOp accum,       // optional accum for z=accum(C,T)
+    const GrB_Monoid monoid,        // reduce monoid for T=reduce(...)
+    const GrB_UnaryOp op,           // unary op to apply, or NULL
+    const GrB_IndexUnaryOp selectop,    // select op, or NULL
+    const GrB_Scalar Thunk,         // thunk for selectop
+    const GrB_Matrix A,             // first input:  matrix A
+    const GrB_Descriptor desc,      // descriptor for C, M, and A
+    GB_Werk Werk
+) ;
+
+GrB_Info GB_reduce_multi            // w [k] = reduce (A), s [k] = reduce (A)
+(
+    GrB_Vector *w,                  // array of size nouts, or NULL
+    GrB_Scalar *s,                  // array of size nouts, or NULL
+    const GrB_Monoid *monoid,       // array of size nouts
+    const int nouts,                // # of reductions
+    const GrB_Matrix A,             // matrix to reduce
+    const bool A_transpose,         // if true, reduce the columns of A
+    GB_Werk Werk
+) ;
+
 void GB_reduce_to_scalar_iso        // s = reduce (A) where A is iso
 (
     GB_void *restrict s,            // output scalar of type reduce->op->ztype
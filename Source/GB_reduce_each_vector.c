@@ -0,0 +1,289 @@
+//------------------------------------------------------------------------------
+// GB_reduce_each_vector: T(k) = reduce (A(:,k)) for each vector of A
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// JIT: done.
+
+// Reduces each vector of A to a scalar, giving the vector T of length A->vdim,
+// where T(j) = reduce (A(:,j)) if A is held by column, or T(i) = reduce
+// (A(i,:)) if A is held by row.  This is a direct segmented reduction over
+// the vectors of A, used by GB_reduce_to_vector when A is reduced in the same
+// orientation as it is held, instead of computing T = A*x with the
+// REDUCE_FIRST semiring and an iso full vector x.  T(k) is not present if
+// A(:,k) has no entries.  T is bitmap if A is sparse, bitmap, or full, and
+// sparse if A is hypersparse.
+
+// If op or selectop are present, the reduction is fused with GrB_select and
+// GrB_apply: T(k) = reduce (op (select (A(:,k)))), where only the entries of
+// A(:,k) for which selectop (aij, i, j, thunk) is true are reduced, and the
+// unary op is applied to each of them first.  T(k) is then not present if no
+// entry of A(:,k) is kept.  Both operators must be built-in.  There are no
+// factory kernels for this case, so only the JIT kernel is used.
+
+// Returns GrB_NO_VALUE if A is iso, or if no factory or JIT kernel can be
+// used (for a monoid that cannot be jitified, or if the JIT is disabled), in
+// which case the caller must use another method.  The output T has a static
+// header.  A must not have any pending work.
+
+#define GB_FREE_WORKSPACE                   \
+{                                           \
+    GB_FREE_WORK (&W, W_size) ;             \
+    GB_WERK_POP (A_slice, int64_t) ;        \
+}
+
+#define GB_FREE_ALL                         \
+{                                           \
+    GB_FREE_WORKSPACE ;                     \
+    GB_phybix_free (T) ;                    \
+}
+
+#include "GB_reduce.h"
+#include "GB_slice.h"
+#include "GB_stringify.h"
+#ifndef GBCOMPACT
+#include "GB_red__include.h"
+#endif
+
+GrB_Info GB_reduce_each_vector  // T(k) = reduce (A(:,k)) for each vector
+(
+    GrB_Matrix T,               // output vector, with static header
+    const GrB_Monoid monoid,    // monoid to do the reduction
+    const GrB_UnaryOp op,       // built-in unary op to apply, or NULL
+    const GrB_IndexUnaryOp selectop,    // built-in select op, or NULL
+    const GB_void *ythunk,      // thunk for selectop, of type selectop->ytype
+    const GrB_Matrix A,         // matrix to reduce
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (T != NULL && (T->static_header || GBNSTATIC)) ;
+    ASSERT_MONOID_OK (monoid, "monoid for reduce each vector", GB0) ;
+    ASSERT_MATRIX_OK (A, "A for reduce each vector", GB0) ;
+    ASSERT (!GB_ANY_PENDING_WORK (A)) ;
+    ASSERT (GB_IMPLIES (op != NULL, op->hash == 0)) ;
+    ASSERT (GB_IMPLIES (selectop != NULL, selectop->hash == 0)) ;
+    GB_void *restrict W = NULL ; size_t W_size = 0 ;
+    GB_WERK_DECLARE (A_slice, int64_t) ;
+
+    if (A->iso)
+    {
+        // iso case: use GB_mxm instead
+        return (GrB_NO_VALUE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // get A and the monoid
+    //--------------------------------------------------------------------------
+
+    GrB_Type ztype = monoid->op->ztype ;
+    size_t zsize = ztype->size ;
+    const int64_t *restrict Ah = A->h ;
+    const int64_t anvec = A->nvec ;
+    const int64_t avdim = A->vdim ;
+    const int64_t anz = GB_nnz_held (A) ;
+    const bool A_is_hyper = (Ah != NULL) ;
+
+    //--------------------------------------------------------------------------
+    // determine the number of threads and tasks to use
+    //--------------------------------------------------------------------------
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk_family (GxB_CHUNK_REDUCE) ;
+    int nthreads = GB_nthreads (anz + anvec, chunk, nthreads_max) ;
+    int ntasks = (nthreads == 1) ? 1 : (8 * nthreads) ;
+    ntasks = (int) GB_IMIN (ntasks, anvec) ;
+    ntasks = GB_IMAX (ntasks, 1) ;
+
+    //--------------------------------------------------------------------------
+    // allocate the result
+    //--------------------------------------------------------------------------
+
+    GB_void *restrict Tx ;
+    int8_t *restrict Tb ;
+
+    if (A_is_hyper)
+    {
+        // T(k) is computed in workspace, and then compacted into sparse T
+        W = GB_MALLOC_WORK (anvec * (zsize + 1), GB_void, &W_size) ;
+        if (W == NULL)
+        {
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        Tx = W ;
+        Tb = (int8_t *) (W + anvec * zsize) ;
+    }
+    else
+    {
+        // T is computed in place, as a bitmap vector of length avdim
+        ASSERT (anvec == avdim) ;
+        GB_OK (GB_new_bix (&T, // bitmap, existing header
+            ztype, avdim, 1, GB_Ap_null, true, GxB_BITMAP, false,
+            A->hyper_switch, 1, avdim, true, false)) ;
+        Tx = (GB_void *) T->x ;
+        Tb = T->b ;
+    }
+
+    //--------------------------------------------------------------------------
+    // slice the vectors of A
+    //--------------------------------------------------------------------------
+
+    GB_WERK_PUSH (A_slice, ntasks + 1, int64_t) ;
+    if (A_slice == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    GB_pslice (A_slice, A->p, anvec, ntasks, false) ;
+
+    //--------------------------------------------------------------------------
+    // Tx [k] = reduce (A(:,k)) for each vector k
+    //--------------------------------------------------------------------------
+
+    info = GrB_NO_VALUE ;
+    bool fused = (op != NULL || selectop != NULL) ;
+
+    if (fused)
+    {
+
+        //----------------------------------------------------------------------
+        // fused with select and apply, via the JIT or PreJIT kernel
+        //----------------------------------------------------------------------
+
+        // the thunk is not used by the kernel if selectop is NULL
+        int64_t no_thunk = 0 ;
+        info = GB_reduce_select_apply_jit (Tx, Tb, monoid, op, selectop,
+            (selectop == NULL) ? ((GB_void *) &no_thunk) : ythunk,
+            A, A_slice, ntasks, nthreads) ;
+    }
+    else if (A->type == ztype)
+    {
+
+        //----------------------------------------------------------------------
+        // via the factory kernel
+        //----------------------------------------------------------------------
+
+        #ifndef GBCOMPACT
+        GB_IF_FACTORY_KERNELS_ENABLED
+        {
+
+            //------------------------------------------------------------------
+            // define the worker for the switch factory
+            //------------------------------------------------------------------
+
+            #define GB_red(opname,aname) \
+                GB (_red_each_ ## opname ## aname)
+
+            #define GB_RED_WORKER(opname,aname,ztype)                       \
+            {                                                               \
+                info = GB_red (opname, aname) ((ztype *) Tx, Tb, A,         \
+                    A_slice, ntasks, nthreads) ;                            \
+            }                                                               \
+            break ;
+
+            //------------------------------------------------------------------
+            // launch the switch factory
+            //------------------------------------------------------------------
+
+            // controlled by opcode and typecode
+            GB_Opcode opcode = monoid->op->opcode ;
+            GB_Type_code typecode = A->type->code ;
+            ASSERT (typecode <= GB_UDT_code) ;
+
+            #include "GB_red_factory.c"
+        }
+        #endif
+    }
+
+    //--------------------------------------------------------------------------
+    // via the JIT or PreJIT kernel
+    //--------------------------------------------------------------------------
+
+    if (info == GrB_NO_VALUE && !fused)
+    {
+        info = GB_reduce_each_vector_jit (Tx, Tb, monoid, A, A_slice, ntasks,
+            nthreads) ;
+    }
+
+    if (info != GrB_SUCCESS)
+    {
+        // no kernel is available (GrB_NO_VALUE), or other error
+        GB_FREE_ALL ;
+        return (info) ;
+    }
+
+    GB_BURBLE_MATRIX (A, "(%sreduce each vector: %s) ",
+        fused ? "select/apply/" : "", monoid->op->name) ;
+
+    //--------------------------------------------------------------------------
+    // count the entries in T
+    //--------------------------------------------------------------------------
+
+    int64_t tnz = 0 ;
+    int64_t k ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static) \
+        reduction(+:tnz)
+    for (k = 0 ; k < anvec ; k++)
+    {
+        tnz += Tb [k] ;
+    }
+
+    //--------------------------------------------------------------------------
+    // finalize the result
+    //--------------------------------------------------------------------------
+
+    if (A_is_hyper)
+    {
+
+        //----------------------------------------------------------------------
+        // T is sparse: compact the result for each non-empty vector of A
+        //----------------------------------------------------------------------
+
+        GB_OK (GB_new_bix (&T, // sparse, existing header
+            ztype, avdim, 1, GB_Ap_malloc, true, GxB_SPARSE, false,
+            A->hyper_switch, 1, tnz, true, false)) ;
+        int64_t *restrict Tp = T->p ;
+        int64_t *restrict Ti = T->i ;
+        GB_void *restrict Tx_new = (GB_void *) T->x ;
+        int64_t t = 0 ;
+        for (k = 0 ; k < anvec ; k++)
+        {
+            if (Tb [k])
+            {
+                Ti [t] = Ah [k] ;
+                memcpy (Tx_new + t * zsize, Tx + k * zsize, zsize) ;
+                t++ ;
+            }
+        }
+        ASSERT (t == tnz) ;
+        Tp [0] = 0 ;
+        Tp [1] = tnz ;
+        T->nvec = 1 ;
+        T->nvec_nonempty = (tnz > 0) ? 1 : 0 ;
+    }
+
+    T->nvals = tnz ;
+
+    T->magic = GB_MAGIC ;
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_WORKSPACE ;
+    ASSERT_MATRIX_OK (T, "T = reduce each vector of A", GB0) ;
+    return (GrB_SUCCESS) ;
+}
+
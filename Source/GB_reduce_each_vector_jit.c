@@ -0,0 +1,56 @@
+//------------------------------------------------------------------------------
+// GB_reduce_each_vector_jit: reduce each vector of a matrix, via the JIT
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB.h"
+#include "GB_stringify.h"
+
+typedef GB_JIT_KERNEL_REDUCE_EACH_VECTOR_PROTO ((*GB_jit_dl_function)) ;
+
+GrB_Info GB_reduce_each_vector_jit  // Tx [k] = reduce (A(:,k)) via the JIT
+(
+    // output:
+    GB_void *restrict Tx,       // result, of size A->nvec
+    int8_t *restrict Tb,        // Tb [k] = 1 if A(:,k) has any entry
+    // input:
+    const GrB_Monoid monoid,    // monoid to do the reduction
+    const GrB_Matrix A,         // matrix to reduce
+    const int64_t *restrict A_slice,    // how A is sliced
+    int ntasks,                 // # of tasks to use
+    int nthreads                // # of threads to use
+)
+{
+
+    //--------------------------------------------------------------------------
+    // encodify the problem
+    //--------------------------------------------------------------------------
+
+    GB_jit_encoding encoding ;
+    char *suffix ;
+    uint64_t hash = GB_encodify_reduce (&encoding, &suffix,
+        GB_JIT_KERNEL_REDUCE_EACH, monoid, A) ;
+
+    //--------------------------------------------------------------------------
+    // get the kernel function pointer, loading or compiling it if needed
+    //--------------------------------------------------------------------------
+
+    void *dl_function ;
+    GrB_Info info = GB_jitifyer_load (&dl_function,
+        GB_jit_reduce_family, "reduce_each_vector",
+        hash, &encoding, suffix, NULL, monoid,
+        NULL, A->type, NULL, NULL) ;
+    if (info != GrB_SUCCESS) return (info) ;
+
+    //--------------------------------------------------------------------------
+    // call the jit kernel and return result
+    //--------------------------------------------------------------------------
+
+    GB_jit_dl_function GB_jit_kernel = (GB_jit_dl_function) dl_function ;
+    return (GB_jit_kernel (Tx, Tb, A, A_slice, ntasks, nthreads)) ;
+}
+
@@ -0,0 +1,762 @@
+//------------------------------------------------------------------------------
+// GB_reduce_multi: reduce a matrix to several vectors and scalars at once
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// JIT: not needed, but one variant possible for each list of monoids.
+
+// For each k in the range 0 to nouts-1, w [k] = reduce (A) and s [k] =
+// reduce (A) using monoid [k].  The vector w [k] reduces each row of A, or
+// each column of A if A_transpose is true, and the scalar s [k] reduces all
+// of A.  If monoid [k] is NULL, the entries are counted instead: w [k] (i) is
+// the # of entries in A(i,:) (or A(:,i)), and s [k] is nvals (A), both as
+// int64 values typecast to the type of the output.
+
+// The arrays w and s may be NULL, and any w [k] or s [k] may be NULL, if that
+// result is not needed.  No mask or accum is used, and any prior content of
+// w [k] and s [k] is discarded.  An entry w [k] (i) exists only if the ith
+// row (or column) of A has at least one entry, and s [k] has no entry if A
+// has no entries, just as GrB_reduce.
+
+// All of the results are computed in a single pass over the entries of A.  If
+// the vectors of A are its rows (if A is held by row and A_transpose is
+// false, or if A is held by column and A_transpose is true), each vector of A
+// is reduced in panels of GB_MULTI_PANEL entries, and each panel is reduced
+// by all of the monoids while it is still in cache, in the same manner as
+// GB_reduce_panel.c.  Otherwise, each task scatters the entries of its
+// vectors of A into its own dense workspace for each result, also one panel
+// at a time, and the workspaces of all tasks are then summed.  If the dense
+// workspace would be much larger than A itself, the transpose of A is reduced
+// instead.  A->AT is used if it exists, or if it is requested (see
+// GxB_TRANSPOSE_CACHE).  The scalars s [k] are reduced from the vector
+// results, which are computed even if only the scalars are requested.
+
+// A built-in monoid whose type is the same as the type of A is reduced with a
+// hard-coded loop over each panel, for the 55 real cases of GB_red_factory.c.
+// All other monoids (user-defined, complex, or with typecasting) use the
+// function pointers of the monoid and the typecast, and take more time for
+// each entry.  In either case, A is read from memory just once, instead of
+// once for each monoid.
+
+#define GB_FREE_WORKSPACE                                                   \
+{                                                                           \
+    if (Red != NULL)                                                        \
+    {                                                                       \
+        for (int r = 0 ; r < nred ; r++)                                    \
+        {                                                                   \
+            GB_FREE_WORK (&(Red [r].Z), Red [r].Z_size) ;                   \
+        }                                                                   \
+    }                                                                       \
+    GB_FREE_WORK (&Red, Red_size) ;                                         \
+    GB_FREE_WORK (&Count, Count_size) ;                                     \
+    GB_FREE_WORK (&Wi, Wi_size) ;                                           \
+    GB_FREE_WORK (&Slice, Slice_size) ;                                     \
+    GB_Matrix_free (&AT) ;                                                  \
+}
+
+#define GB_FREE_ALL                                                         \
+{                                                                           \
+    GB_FREE_WORKSPACE ;                                                     \
+    GB_Matrix_free (&T) ;                                                   \
+}
+
+#include "GB_reduce.h"
+#include "GB_transpose.h"
+#include "GB_slice.h"
+#include "GB_binop.h"
+
+// # of entries in each panel of A
+#define GB_MULTI_PANEL 1024
+
+// one reduction, for a monoid [k] with w [k] and/or s [k] requested
+typedef struct
+{
+    int k ;                         // index into w, s, and monoid
+    GrB_Type ztype ;                // type of the result
+    size_t zsize ;                  // size of ztype
+    GxB_binary_function fadd ;      // z = fadd (x,y); NULL if counting
+    GB_cast_function cast_A_to_Z ;  // z = (ztype) a
+    const GB_void *terminal ;       // terminal value, or NULL if none
+    GB_Opcode opcode ;              // opcode of the monoid
+    bool typed ;                    // true if reduced with a typed loop
+    GB_void zinit [8] ;             // initial value for the typed loops
+    GB_void *Z ;                    // workspace for the vector result
+    size_t Z_size ;
+}
+GB_reduce_multi_struct ;
+
+//------------------------------------------------------------------------------
+// typed reductions
+//------------------------------------------------------------------------------
+
+// z = op (z,a) for each built-in monoid in GB_red_factory.c.  MIN and MAX
+// ignore NaNs, as fmin and fmax do.  Each typed reduction starts with the
+// identity of the monoid, except that a floating-point MIN or MAX starts with
+// a NaN, so that the result is NaN if all entries are NaN, as it is when
+// reduced with fmin or fmax.
+#define GB_MULTI_ISNAN(z)           isnan ((double) (z))
+#define GB_MULTI_UPDATE_min(z,a)    if ((a) < (z) || GB_MULTI_ISNAN (z)) z = a
+#define GB_MULTI_UPDATE_max(z,a)    if ((a) > (z) || GB_MULTI_ISNAN (z)) z = a
+#define GB_MULTI_UPDATE_plus(z,a)   z += (a)
+#define GB_MULTI_UPDATE_times(z,a)  z *= (a)
+#define GB_MULTI_UPDATE_any(z,a)    z = (a)
+#define GB_MULTI_UPDATE_lor(z,a)    z = ((z) || (a))
+#define GB_MULTI_UPDATE_land(z,a)   z = ((z) && (a))
+#define GB_MULTI_UPDATE_lxor(z,a)   z = ((z) != (a))
+#define GB_MULTI_UPDATE_eq(z,a)     z = ((z) == (a))
+
+// the complex cases of GB_red_factory.c are not handled here
+#define GB_RED_WORKER(opname,aname,ztype) \
+    GB_MULTI_WORKER ## aname (opname, ztype)
+#define GB_MULTI_WORKER_bool(opname,ztype)   GB_MULTI_TYPED (opname, ztype)
+#define GB_MULTI_WORKER_int8(opname,ztype)   GB_MULTI_TYPED (opname, ztype)
+#define GB_MULTI_WORKER_int16(opname,ztype)  GB_MULTI_TYPED (opname, ztype)
+#define GB_MULTI_WORKER_int32(opname,ztype)  GB_MULTI_TYPED (opname, ztype)
+#define GB_MULTI_WORKER_int64(opname,ztype)  GB_MULTI_TYPED (opname, ztype)
+#define GB_MULTI_WORKER_uint8(opname,ztype)  GB_MULTI_TYPED (opname, ztype)
+#define GB_MULTI_WORKER_uint16(opname,ztype) GB_MULTI_TYPED (opname, ztype)
+#define GB_MULTI_WORKER_uint32(opname,ztype) GB_MULTI_TYPED (opname, ztype)
+#define GB_MULTI_WORKER_uint64(opname,ztype) GB_MULTI_TYPED (opname, ztype)
+#define GB_MULTI_WORKER_fp32(opname,ztype)   GB_MULTI_TYPED (opname, ztype)
+#define GB_MULTI_WORKER_fp64(opname,ztype)   GB_MULTI_TYPED (opname, ztype)
+#define GB_MULTI_WORKER_fc32(opname,ztype)   break ;
+#define GB_MULTI_WORKER_fc64(opname,ztype)   break ;
+
+//------------------------------------------------------------------------------
+// GB_reduce_multi_has_typed: true if a monoid has a typed reduction
+//------------------------------------------------------------------------------
+
+static bool GB_reduce_multi_has_typed
+(
+    GB_Opcode opcode,
+    GB_Type_code typecode
+)
+{
+    #define GB_MULTI_TYPED(opname,ztype) return (true) ;
+    #include "GB_red_factory.c"
+    #undef  GB_MULTI_TYPED
+    return (false) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_reduce_multi_panel: z = reduce (A (p0:p1-1)) with a typed loop
+//------------------------------------------------------------------------------
+
+// If first is true, z is reduced starting from zinit.
+
+static void GB_reduce_multi_panel
+(
+    GB_void *restrict z,
+    const bool first,
+    const GB_void *zinit,
+    const GB_void *restrict Ax,
+    const int8_t *restrict Ab,
+    const bool A_iso,
+    const int64_t p0,
+    const int64_t p1,
+    GB_Opcode opcode,
+    GB_Type_code typecode
+)
+{
+    #define GB_MULTI_TYPED(opname,ztype)                                    \
+    {                                                                       \
+        const ztype *restrict Ax_typed = (const ztype *) Ax ;               \
+        ztype zz = (*((const ztype *) (first ? zinit : z))) ;            \
+        for (int64_t p = p0 ; p < p1 ; p++)                                 \
+        {                                                                   \
+            if (!GBB (Ab, p)) continue ;                                    \
+            ztype a = Ax_typed [A_iso ? 0 : p] ;                            \
+            GB_MULTI_UPDATE ## opname (zz, a) ;                             \
+        }                                                                   \
+        (*((ztype *) z)) = zz ;                                             \
+        return ;                                                            \
+    }
+    #include "GB_red_factory.c"
+    #undef  GB_MULTI_TYPED
+    ASSERT (GB_DEAD_CODE) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_reduce_multi_scatter: Z (i) = op (Z (i), A (i)) with a typed loop
+//------------------------------------------------------------------------------
+
+// Z has been initialized with zinit.
+
+static void GB_reduce_multi_scatter
+(
+    GB_void *restrict Z,
+    const int64_t *restrict Ai,
+    const GB_void *restrict Ax,
+    const int8_t *restrict Ab,
+    const bool A_iso,
+    const int64_t avlen,
+    const int64_t p0,
+    const int64_t p1,
+    GB_Opcode opcode,
+    GB_Type_code typecode
+)
+{
+    #define GB_MULTI_TYPED(opname,ztype)                                    \
+    {                                                                       \
+        const ztype *restrict Ax_typed = (const ztype *) Ax ;               \
+        ztype *restrict Z_typed = (ztype *) Z ;                             \
+        for (int64_t p = p0 ; p < p1 ; p++)                                 \
+        {                                                                   \
+            if (!GBB (Ab, p)) continue ;                                    \
+            int64_t i = GBI (Ai, p, avlen) ;                                \
+            ztype a = Ax_typed [A_iso ? 0 : p] ;                            \
+            GB_MULTI_UPDATE ## opname (Z_typed [i], a) ;                    \
+        }                                                                   \
+        return ;                                                            \
+    }
+    #include "GB_red_factory.c"
+    #undef  GB_MULTI_TYPED
+    ASSERT (GB_DEAD_CODE) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_reduce_multi
+//------------------------------------------------------------------------------
+
+GrB_Info GB_reduce_multi            // w [k] = reduce (A), s [k] = reduce (A)
+(
+    GrB_Vector *w,                  // array of size nouts, or NULL
+    GrB_Scalar *s,                  // array of size nouts, or NULL
+    const GrB_Monoid *monoid,       // array of size nouts
+    const int nouts,                // # of reductions
+    const GrB_Matrix A_input,       // matrix to reduce
+    const bool A_transpose,         // if true, reduce the columns of A
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    GB_reduce_multi_struct *Red = NULL ; size_t Red_size = 0 ;
+    int64_t *Count = NULL ; size_t Count_size = 0 ;
+    int64_t *Slice = NULL ; size_t Slice_size = 0 ;
+    int64_t *Wi = NULL ; size_t Wi_size = 0 ;
+    GrB_Matrix AT = NULL, T = NULL ;
+    int nred = 0 ;
+    GrB_Matrix A = A_input ;
+
+    ASSERT (monoid != NULL) ;
+    ASSERT_MATRIX_OK (A, "A input for reduce-multi", GB0) ;
+    ASSERT (nouts >= 0) ;
+
+    //--------------------------------------------------------------------------
+    // finish any pending work in A
+    //--------------------------------------------------------------------------
+
+    GB_MATRIX_WAIT (A) ;
+
+    //--------------------------------------------------------------------------
+    // find the reductions to compute
+    //--------------------------------------------------------------------------
+
+    Red = GB_CALLOC_WORK (GB_IMAX (nouts, 1), GB_reduce_multi_struct,
+        &Red_size) ;
+    if (Red == NULL)
+    {
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    const GB_Type_code acode = A->type->code ;
+    const size_t asize = A->type->size ;
+    size_t zsize_max = 1 ;
+    for (int k = 0 ; k < nouts ; k++)
+    {
+        bool w_needed = (w != NULL && w [k] != NULL) ;
+        bool s_needed = (s != NULL && s [k] != NULL) ;
+        if (!w_needed && !s_needed) continue ;
+        GB_reduce_multi_struct *R = &(Red [nred++]) ;
+        R->k = k ;
+        if (monoid [k] == NULL)
+        {
+            // count the entries
+            R->ztype = GrB_INT64 ;
+            R->zsize = sizeof (int64_t) ;
+        }
+        else
+        {
+            // reduce the entries with the monoid
+            R->ztype = monoid [k]->op->ztype ;
+            R->zsize = R->ztype->size ;
+            R->fadd = monoid [k]->op->binop_function ;
+            R->cast_A_to_Z = GB_cast_factory (R->ztype->code, acode) ;
+            R->terminal = (GB_void *) monoid [k]->terminal ;
+            R->opcode = monoid [k]->op->opcode ;
+            GB_IF_FACTORY_KERNELS_ENABLED
+            { 
+                R->typed = (R->ztype == A->type) &&
+                    GB_reduce_multi_has_typed (R->opcode, R->ztype->code) ;
+            }
+            if (R->typed)
+            { 
+                GB_Type_code zcode = R->ztype->code ;
+                bool minmax = (R->opcode == GB_MIN_binop_code ||
+                    R->opcode == GB_MAX_binop_code) ;
+                if (minmax && zcode == GB_FP32_code)
+                { 
+                    float nan = NAN ;
+                    memcpy (R->zinit, &nan, sizeof (float)) ;
+                }
+                else if (minmax && zcode == GB_FP64_code)
+                { 
+                    double nan = NAN ;
+                    memcpy (R->zinit, &nan, sizeof (double)) ;
+                }
+                else
+                { 
+                    memcpy (R->zinit, monoid [k]->identity, R->zsize) ;
+                }
+            }
+        }
+        zsize_max = GB_IMAX (zsize_max, R->zsize) ;
+    }
+
+    if (nred == 0)
+    {
+        // no results are requested
+        GB_FREE_ALL ;
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // determine how to reduce A
+    //--------------------------------------------------------------------------
+
+    // The vectors of A are its rows if A is held by row, or its columns if A
+    // is held by column.  If the vectors of A are the ones to reduce, each
+    // vector of A is reduced on its own.  Otherwise, A is scattered.
+
+    int64_t anz = GB_nnz_held (A) ;
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk_family (GxB_CHUNK_REDUCE) ;
+    int nthreads = GB_nthreads (anz + A->nvec, chunk, nthreads_max) ;
+
+    bool scatter = (A->is_csc != A_transpose) ;
+    if (scatter)
+    {
+        // build A->AT, if requested by GrB_set (A, true, GxB_TRANSPOSE_CACHE)
+        GB_OK (GB_transpose_cache_build (A, Werk)) ;
+    }
+    if (scatter && (A->AT != NULL ||
+        A->vlen > 4 * (anz + A->nvec) + GB_MULTI_PANEL * nthreads))
+    {
+        if (A->AT == NULL)
+        {
+            // AT = A', with the same type and format as A
+            GBURBLE ("(transpose for reduce) ") ;
+            GB_OK (GB_new (&AT, // any sparsity, new header
+                A->type, A->vdim, A->vlen, GB_Ap_null, A->is_csc,
+                GxB_AUTO_SPARSITY, A->hyper_switch, 0)) ;
+            GB_OK (GB_transpose (AT, NULL, A->is_csc, A, NULL, NULL, false,
+                false, Werk)) ;
+            GB_MATRIX_WAIT (AT) ;
+            A = AT ;
+        }
+        else
+        {
+            // use the cached transpose of A
+            A = A->AT ;
+        }
+        ASSERT_MATRIX_OK (A, "A' for reduce-multi", GB0) ;
+        anz = GB_nnz_held (A) ;
+        scatter = false ;
+    }
+
+    const int64_t *restrict Ap = A->p ;
+    const int64_t *restrict Ah = A->h ;
+    const int8_t  *restrict Ab = A->b ;
+    const int64_t *restrict Ai = A->i ;
+    const GB_void *restrict Ax = (GB_void *) A->x ;
+    const bool A_iso = A->iso ;
+    const int64_t avlen = A->vlen ;
+    const int64_t anvec = A->nvec ;
+
+    // the vector results have nseg entries, one per vector of A if A is
+    // reduced vector-by-vector, or one per index 0:avlen-1 if A is scattered
+    int64_t nseg = (scatter) ? avlen : anvec ;
+    int64_t n = (scatter) ? avlen : A->vdim ;
+
+    // # of tasks: each task has its own workspace if A is scattered
+    int ntasks ;
+    if (scatter)
+    {
+        nthreads = GB_IMIN (nthreads, 1 + anz / GB_IMAX (avlen, 1)) ;
+        nthreads = GB_IMIN (nthreads, GB_IMAX (anvec, 1)) ;
+        ntasks = nthreads ;
+    }
+    else
+    {
+        ntasks = (nthreads == 1) ? 1 : (8 * nthreads) ;
+        ntasks = GB_IMIN (ntasks, GB_IMAX (anvec, 1)) ;
+    }
+    int64_t nws = (scatter) ? ntasks : 1 ;
+
+    //--------------------------------------------------------------------------
+    // allocate workspace
+    //--------------------------------------------------------------------------
+
+    Slice = GB_MALLOC_WORK (ntasks + 1, int64_t, &Slice_size) ;
+    Count = GB_CALLOC_WORK (nws * nseg + 1, int64_t, &Count_size) ;
+    if (Slice == NULL || Count == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    for (int r = 0 ; r < nred ; r++)
+    {
+        GB_reduce_multi_struct *R = &(Red [r]) ;
+        if (R->fadd == NULL) continue ;
+        R->Z = GB_MALLOC_WORK ((nws * nseg + 1) * R->zsize, GB_void,
+            &(R->Z_size)) ;
+        if (R->Z == NULL)
+        {
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+    }
+
+    GB_pslice (Slice, Ap, anvec, ntasks, false) ;
+
+    //--------------------------------------------------------------------------
+    // reduce A in a single pass
+    //--------------------------------------------------------------------------
+
+    if (!scatter)
+    {
+
+        //----------------------------------------------------------------------
+        // reduce each vector of A, one panel at a time
+        //----------------------------------------------------------------------
+
+        int tid ;
+        #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+        for (tid = 0 ; tid < ntasks ; tid++)
+        {
+            GB_void a [GB_VLA(zsize_max)] ;
+            for (int64_t k = Slice [tid] ; k < Slice [tid+1] ; k++)
+            {
+                int64_t pA_start = GBP (Ap, k, avlen) ;
+                int64_t pA_end   = GBP (Ap, k+1, avlen) ;
+                int64_t cnt = 0 ;
+                for (int64_t p0 = pA_start ; p0 < pA_end ; p0 += GB_MULTI_PANEL)
+                {
+                    int64_t p1 = GB_IMIN (p0 + GB_MULTI_PANEL, pA_end) ;
+                    // reduce A(:,k) (p0:p1-1) with each monoid
+                    for (int r = 0 ; r < nred ; r++)
+                    {
+                        GB_reduce_multi_struct *R = &(Red [r]) ;
+                        if (R->fadd == NULL) continue ;
+                        const size_t zsize = R->zsize ;
+                        GB_void *z = R->Z + k * zsize ;
+                        const GB_void *terminal = R->terminal ;
+                        bool first = (cnt == 0) ;
+                        if (!first && terminal != NULL &&
+                            memcmp (z, terminal, zsize) == 0)
+                        {
+                            // z has reached its terminal value
+                            continue ;
+                        }
+                        if (R->typed)
+                        { 
+                            // reduce the panel with a typed loop
+                            GB_reduce_multi_panel (z, first, R->zinit, Ax,
+                                Ab, A_iso, p0, p1, R->opcode, R->ztype->code) ;
+                            continue ;
+                        }
+                        for (int64_t p = p0 ; p < p1 ; p++)
+                        {
+                            if (!GBB (Ab, p)) continue ;
+                            R->cast_A_to_Z (a, Ax + (A_iso ? 0 : p*asize),
+                                asize) ;
+                            if (first)
+                            {
+                                memcpy (z, a, zsize) ;
+                                first = false ;
+                            }
+                            else
+                            {
+                                R->fadd (z, z, a) ;
+                            }
+                            if (terminal != NULL &&
+                                memcmp (z, terminal, zsize) == 0)
+                            {
+                                break ;
+                            }
+                        }
+                    }
+                    // count the entries in the panel
+                    if (Ab == NULL)
+                    {
+                        cnt += (p1 - p0) ;
+                    }
+                    else
+                    {
+                        for (int64_t p = p0 ; p < p1 ; p++)
+                        {
+                            cnt += Ab [p] ;
+                        }
+                    }
+                }
+                Count [k] = cnt ;
+            }
+        }
+
+    }
+    else
+    {
+
+        //----------------------------------------------------------------------
+        // scatter each vector of A into the workspace of its task
+        //----------------------------------------------------------------------
+
+        int tid ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static,1)
+        for (tid = 0 ; tid < ntasks ; tid++)
+        {
+            GB_void a [GB_VLA(zsize_max)] ;
+            int64_t *restrict Count_t = Count + tid * avlen ;
+            int64_t pA_start = GBP (Ap, Slice [tid], avlen) ;
+            int64_t pA_end   = GBP (Ap, Slice [tid+1], avlen) ;
+
+            // the typed workspaces start with zinit
+            for (int r = 0 ; r < nred ; r++)
+            {
+                GB_reduce_multi_struct *R = &(Red [r]) ;
+                if (!R->typed) continue ;
+                const size_t zsize = R->zsize ;
+                GB_void *Z_t = R->Z + tid * avlen * zsize ;
+                for (int64_t i = 0 ; i < avlen ; i++)
+                {
+                    memcpy (Z_t + i * zsize, R->zinit, zsize) ;
+                }
+            }
+
+            for (int64_t p0 = pA_start ; p0 < pA_end ; p0 += GB_MULTI_PANEL)
+            {
+                int64_t p1 = GB_IMIN (p0 + GB_MULTI_PANEL, pA_end) ;
+
+                // scatter the panel with each typed loop
+                for (int r = 0 ; r < nred ; r++)
+                {
+                    GB_reduce_multi_struct *R = &(Red [r]) ;
+                    if (!R->typed) continue ;
+                    GB_reduce_multi_scatter (R->Z + tid * avlen * R->zsize,
+                        Ai, Ax, Ab, A_iso, avlen, p0, p1, R->opcode,
+                        R->ztype->code) ;
+                }
+
+                // count the entries, and scatter the panel for each monoid
+                // without a typed loop
+                for (int64_t p = p0 ; p < p1 ; p++)
+                {
+                    if (!GBB (Ab, p)) continue ;
+                    int64_t i = GBI (Ai, p, avlen) ;
+                    bool first = (Count_t [i] == 0) ;
+                    Count_t [i]++ ;
+                    for (int r = 0 ; r < nred ; r++)
+                    {
+                        GB_reduce_multi_struct *R = &(Red [r]) ;
+                        if (R->fadd == NULL || R->typed) continue ;
+                        const size_t zsize = R->zsize ;
+                        GB_void *z = R->Z + (tid * avlen + i) * zsize ;
+                        R->cast_A_to_Z (a, Ax + (A_iso ? 0 : p*asize), asize) ;
+                        if (first)
+                        {
+                            memcpy (z, a, zsize) ;
+                        }
+                        else if (R->terminal == NULL ||
+                            memcmp (z, R->terminal, zsize) != 0)
+                        {
+                            R->fadd (z, z, a) ;
+                        }
+                    }
+                }
+            }
+        }
+
+        //----------------------------------------------------------------------
+        // sum the workspaces of all tasks into the workspace of task 0
+        //----------------------------------------------------------------------
+
+        if (ntasks > 1)
+        {
+            int64_t i ;
+            #pragma omp parallel for num_threads(nthreads) schedule(static)
+            for (i = 0 ; i < avlen ; i++)
+            {
+                for (int t = 1 ; t < ntasks ; t++)
+                {
+                    int64_t c = Count [t * avlen + i] ;
+                    if (c == 0) continue ;
+                    for (int r = 0 ; r < nred ; r++)
+                    {
+                        GB_reduce_multi_struct *R = &(Red [r]) ;
+                        if (R->fadd == NULL) continue ;
+                        const size_t zsize = R->zsize ;
+                        GB_void *z = R->Z + i * zsize ;
+                        GB_void *z_t = R->Z + (t * avlen + i) * zsize ;
+                        if (Count [i] == 0)
+                        {
+                            memcpy (z, z_t, zsize) ;
+                        }
+                        else
+                        {
+                            R->fadd (z, z, z_t) ;
+                        }
+                    }
+                    Count [i] += c ;
+                }
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // find the indices of the results that exist
+    //--------------------------------------------------------------------------
+
+    // The indices are found before any result is constructed, since w [k] or
+    // s [k] may be aliased with A.  A is not accessed below.
+
+    int64_t tnz = 0 ;
+    for (int64_t j = 0 ; j < nseg ; j++)
+    {
+        tnz += (Count [j] > 0) ;
+    }
+    Wi = GB_MALLOC_WORK (tnz + 1, int64_t, &Wi_size) ;
+    if (Wi == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    int64_t pW = 0 ;
+    for (int64_t j = 0 ; j < nseg ; j++)
+    {
+        if (Count [j] == 0) continue ;
+        Wi [pW++] = (scatter) ? j : GBH (Ah, j) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // construct the results
+    //--------------------------------------------------------------------------
+
+    for (int r = 0 ; r < nred ; r++)
+    {
+        GB_reduce_multi_struct *R = &(Red [r]) ;
+        const int k = R->k ;
+        const size_t zsize = R->zsize ;
+        GB_void *Z = (R->fadd == NULL) ? ((GB_void *) Count) : R->Z ;
+
+        //----------------------------------------------------------------------
+        // s [k] = reduce (Z)
+        //----------------------------------------------------------------------
+
+        if (s != NULL && s [k] != NULL)
+        {
+            if (tnz == 0)
+            {
+                // A has no entries, so s [k] has no entry
+                GB_OK (GB_clear ((GrB_Matrix) s [k], Werk)) ;
+            }
+            else
+            {
+                // T is a 1-by-1 full matrix
+                GB_OK (GB_new_bix (&T, // full, new header
+                    R->ztype, 1, 1, GB_Ap_null, true, GxB_FULL, false,
+                    GB_Global_hyper_switch_get ( ), 1, 1, true, false)) ;
+                GB_void *Tx = (GB_void *) T->x ;
+                if (R->fadd == NULL)
+                {
+                    // count the entries of A
+                    int64_t c = 0 ;
+                    for (int64_t j = 0 ; j < nseg ; j++)
+                    {
+                        c += Count [j] ;
+                    }
+                    memcpy (Tx, &c, sizeof (int64_t)) ;
+                }
+                else
+                {
+                    // reduce the vector result
+                    bool first = true ;
+                    for (int64_t j = 0 ; j < nseg ; j++)
+                    {
+                        if (Count [j] == 0) continue ;
+                        if (first)
+                        {
+                            memcpy (Tx, Z + j * zsize, zsize) ;
+                            first = false ;
+                        }
+                        else
+                        {
+                            R->fadd (Tx, Tx, Z + j * zsize) ;
+                        }
+                        if (R->terminal != NULL &&
+                            memcmp (Tx, R->terminal, zsize) == 0)
+                        {
+                            break ;
+                        }
+                    }
+                }
+                T->magic = GB_MAGIC ;
+                ASSERT_MATRIX_OK (T, "T for s=reduce(A)", GB0) ;
+                GB_OK (GB_transplant_conform ((GrB_Matrix) s [k], s [k]->type,
+                    &T, Werk)) ;
+            }
+        }
+
+        //----------------------------------------------------------------------
+        // w [k] = Z, for those entries that exist
+        //----------------------------------------------------------------------
+
+        if (w != NULL && w [k] != NULL)
+        {
+            // T is an n-by-1 sparse vector with tnz entries
+            GB_OK (GB_new_bix (&T, // sparse, new header
+                R->ztype, n, 1, GB_Ap_malloc, true, GxB_SPARSE, false,
+                GB_Global_hyper_switch_get ( ), 1, tnz, true, false)) ;
+            int64_t *restrict Tp = T->p ;
+            int64_t *restrict Ti = T->i ;
+            GB_void *restrict Tx = (GB_void *) T->x ;
+            int64_t pT = 0 ;
+            for (int64_t j = 0 ; j < nseg ; j++)
+            {
+                if (Count [j] == 0) continue ;
+                Ti [pT] = Wi [pT] ;
+                memcpy (Tx + pT * zsize, Z + j * zsize, zsize) ;
+                pT++ ;
+            }
+            ASSERT (pT == tnz) ;
+            Tp [0] = 0 ;
+            Tp [1] = tnz ;
+            T->nvals = tnz ;
+            T->nvec_nonempty = (tnz > 0) ? 1 : 0 ;
+            T->magic = GB_MAGIC ;
+            ASSERT_MATRIX_OK (T, "T for w=reduce(A)", GB0) ;
+            GB_OK (GB_transplant_conform ((GrB_Matrix) w [k], w [k]->type,
+                &T, Werk)) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_WORKSPACE ;
+    return (GrB_SUCCESS) ;
+}
+
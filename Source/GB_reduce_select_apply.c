@@ -0,0 +1,254 @@
+//------------------------------------------------------------------------------
+// GB_reduce_select_apply: reduce the selected entries of a matrix to a vector
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// JIT: done.
+
+// C<M> = accum (C, reduce (op (select (A)))) where C is n-by-1.  The result
+// is the same as the three steps:
+
+//      S = select (selectop, A, Thunk)
+//      F = apply (op, S)
+//      C<M> = accum (C, reduce (F)) or accum (C, reduce (F'))
+
+// where either op or selectop may be NULL, to skip that step.
+
+// If A is reduced in the same orientation as it is held, and the operators
+// are both built-in, the three steps are fused into a single pass over the
+// entries of A by GB_reduce_each_vector, with a JIT kernel, and no
+// intermediate matrices are constructed.  Otherwise, or if the JIT is
+// disabled, the three steps are computed one at a time.
+
+#define GB_FREE_ALL                     \
+{                                       \
+    GB_Matrix_free (&T) ;               \
+    GB_Matrix_free (&S) ;               \
+    GB_Matrix_free (&F) ;               \
+}
+
+#include "GB_reduce.h"
+#include "GB_select.h"
+#include "GB_apply.h"
+#include "GB_accum_mask.h"
+#include "GB_get_mask.h"
+
+GrB_Info GB_reduce_select_apply     // C<M> = accum (C,reduce(op(select(A))))
+(
+    GrB_Matrix C,                   // input/output for results, size n-by-1
+    const GrB_Matrix M_in,          // optional M for C, unused if NULL
+    const GrB_BinaryOp accum,       // optional accum for z=accum(C,T)
+    const GrB_Monoid monoid,        // reduce monoid for T=reduce(...)
+    const GrB_UnaryOp op,           // unary op to apply, or NULL
+    const GrB_IndexUnaryOp selectop,    // select op, or NULL
+    const GrB_Scalar Thunk,         // thunk for selectop
+    const GrB_Matrix A,             // first input:  matrix A
+    const GrB_Descriptor desc,      // descriptor for C, M, and A
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    struct GB_Matrix_opaque T_header, S_header, F_header ;
+    GrB_Matrix T = NULL, S = NULL, F = NULL ;
+
+    // C may be aliased with M and/or A
+    GB_RETURN_IF_NULL_OR_FAULTY (C) ;
+    GB_RETURN_IF_FAULTY (M_in) ;
+    GB_RETURN_IF_FAULTY_OR_POSITIONAL (accum) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (monoid) ;
+    GB_RETURN_IF_FAULTY (op) ;
+    GB_RETURN_IF_FAULTY (selectop) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_RETURN_IF_FAULTY (desc) ;
+    if (selectop != NULL)
+    {
+        GB_RETURN_IF_NULL_OR_FAULTY (Thunk) ;
+    }
+
+    ASSERT_MATRIX_OK (C, "C input for reduce-select-apply", GB0) ;
+    ASSERT_MATRIX_OK_OR_NULL (M_in, "M_in for reduce-select-apply", GB0) ;
+    ASSERT_BINARYOP_OK_OR_NULL (accum, "accum for reduce-select-apply", GB0) ;
+    ASSERT_MONOID_OK (monoid, "monoid for reduce-select-apply", GB0) ;
+    ASSERT_UNARYOP_OK_OR_NULL (op, "op for reduce-select-apply", GB0) ;
+    ASSERT_MATRIX_OK (A, "A input for reduce-select-apply", GB0) ;
+    ASSERT_DESCRIPTOR_OK_OR_NULL (desc, "desc for reduce-select-apply", GB0) ;
+    ASSERT (GB_VECTOR_OK (C)) ;
+    ASSERT (GB_IMPLIES (M_in != NULL, GB_VECTOR_OK (M_in))) ;
+
+    if (op == NULL && selectop == NULL)
+    {
+        // C<M> = accum (C, reduce (A))
+        return (GB_reduce_to_vector (C, M_in, accum, monoid, A, desc, Werk)) ;
+    }
+
+    // get the descriptor
+    GB_GET_DESCRIPTOR (info, desc, C_replace, Mask_comp, Mask_struct,
+        A_transpose, xx1, xx2, xx3) ;
+
+    // get the mask
+    GrB_Matrix M = GB_get_mask (M_in, &Mask_comp, &Mask_struct) ;
+
+    // check domains and dimensions for C<M> = accum (C,T)
+    GrB_Type ztype = monoid->op->ztype ;
+    GB_OK (GB_compatible (C->type, C, M, Mask_struct, accum, ztype, Werk)) ;
+
+    // S = select (A) must be compatible
+    if (selectop != NULL)
+    {
+        if (!GB_Type_compatible (A->type, selectop->xtype))
+        {
+            GB_ERROR (GrB_DOMAIN_MISMATCH,
+                "Incompatible type for C=%s(A,Thunk):\n"
+                "input A type [%s]\n"
+                "cannot be typecast to operator input of type [%s]",
+                selectop->name, A->type->name, selectop->xtype->name) ;
+        }
+        if (!GB_Type_compatible (GrB_BOOL, selectop->ztype))
+        {
+            GB_ERROR (GrB_DOMAIN_MISMATCH,
+                "Output of user-defined IndexUnaryOp %s is %s\n"
+                "which cannot be typecasted to bool\n",
+                selectop->name, selectop->ztype->name) ;
+        }
+        if (!GB_Type_compatible (Thunk->type, selectop->ytype))
+        {
+            GB_ERROR (GrB_DOMAIN_MISMATCH,
+                "Incompatible type for C=%s(A,Thunk):\n"
+                "input Thunk type [%s] and op thunk type [%s]"
+                " not compatible",
+                selectop->name, Thunk->type->name, selectop->ytype->name) ;
+        }
+        GB_MATRIX_WAIT (Thunk) ;
+        if (GB_nnz ((GrB_Matrix) Thunk) == 0)
+        {
+            GB_ERROR (GrB_EMPTY_OBJECT, "Thunk for C=%s(A,Thunk)"
+                " cannot be an empty scalar\n", selectop->name) ;
+        }
+    }
+
+    // F = op (S) must be compatible
+    GrB_Type ftype = A->type ;
+    if (op != NULL)
+    {
+        if (!GB_Type_compatible (A->type, op->xtype))
+        {
+            GB_ERROR (GrB_DOMAIN_MISMATCH,
+                "Incompatible type for z=%s(x):\n"
+                "input A of type [%s]\n"
+                "cannot be typecast to x input of type [%s]",
+                op->name, A->type->name, op->xtype->name) ;
+        }
+        ftype = op->ztype ;
+    }
+
+    // T = reduce (F) must be compatible
+    if (!GB_Type_compatible (ftype, ztype))
+    {
+        GB_ERROR (GrB_DOMAIN_MISMATCH,
+            "Incompatible type for reduction monoid z=%s(x,y):\n"
+            "input of type [%s]\n"
+            "cannot be typecast to reduction monoid of type [%s]",
+            monoid->op->name, ftype->name, ztype->name) ;
+    }
+
+    // check the dimensions
+    int64_t n = GB_NROWS (C) ;
+    int64_t nt = (A_transpose) ? GB_NCOLS (A) : GB_NROWS (A) ;
+    if (n != nt)
+    {
+        GB_ERROR (GrB_DIMENSION_MISMATCH,
+            "w=reduce(A%s):  length of w is " GBd ";\n"
+            "it must match the number of %s of A, which is " GBd ".",
+            A_transpose ? "'" : "", n, A_transpose ? "columns" : "rows", nt) ;
+    }
+
+    // quick return if an empty mask is complemented
+    GB_RETURN_IF_QUICK_MASK (C, C_replace, M, Mask_comp, Mask_struct) ;
+
+    //--------------------------------------------------------------------------
+    // fused select, apply, and reduce each vector, for built-in operators
+    //--------------------------------------------------------------------------
+
+    bool builtin_op = (op == NULL) ||
+        (op->hash == 0 && !GB_OPCODE_IS_POSITIONAL (op->opcode)) ;
+    bool builtin_selectop = (selectop == NULL) || (selectop->hash == 0) ;
+
+    if (A->is_csc == A_transpose && builtin_op && builtin_selectop)
+    {
+        GB_MATRIX_WAIT (A) ;
+
+        // ythunk = (ytype) Thunk
+        size_t ysize = (selectop == NULL) ? 1 : selectop->ytype->size ;
+        GB_void ythunk [GB_VLA(ysize)] ;
+        memset (ythunk, 0, ysize) ;
+        if (selectop != NULL)
+        {
+            GB_cast_scalar (ythunk, selectop->ytype->code, Thunk->x,
+                Thunk->type->code, ysize) ;
+        }
+
+        GB_CLEAR_STATIC_HEADER (T, &T_header) ;
+        info = GB_reduce_each_vector (T, monoid, op, selectop, ythunk, A,
+            Werk) ;
+        if (info == GrB_SUCCESS)
+        {
+            // C<M> = accum (C,T)
+            info = GB_accum_mask (C, M, NULL, accum, &T, C_replace, Mask_comp,
+                Mask_struct, Werk) ;
+        }
+        if (info != GrB_NO_VALUE)
+        {
+            // the reduction is done, or it failed
+            GB_FREE_ALL ;
+            return (info) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // S = select (selectop, A, Thunk)
+    //--------------------------------------------------------------------------
+
+    GrB_Matrix B = A ;
+    if (selectop != NULL)
+    {
+        GB_CLEAR_STATIC_HEADER (S, &S_header) ;
+        GB_OK (GB_new (&S, // auto sparsity, existing header
+            A->type, A->vlen, A->vdim, GB_Ap_calloc, A->is_csc,
+            GxB_AUTO_SPARSITY, GB_Global_hyper_switch_get ( ), 1)) ;
+        GB_OK (GB_select (S, false, NULL, false, false, NULL, selectop, A,
+            Thunk, false, Werk)) ;
+        B = S ;
+    }
+
+    //--------------------------------------------------------------------------
+    // F = op (S)
+    //--------------------------------------------------------------------------
+
+    if (op != NULL)
+    {
+        GB_CLEAR_STATIC_HEADER (F, &F_header) ;
+        GB_OK (GB_new (&F, // auto sparsity, existing header
+            ftype, B->vlen, B->vdim, GB_Ap_calloc, B->is_csc,
+            GxB_AUTO_SPARSITY, GB_Global_hyper_switch_get ( ), 1)) ;
+        GB_OK (GB_apply (F, false, NULL, false, false, NULL,
+            (GB_Operator) op, NULL, false, B, false, Werk)) ;
+        B = F ;
+    }
+
+    //--------------------------------------------------------------------------
+    // C<M> = accum (C, reduce (F))
+    //--------------------------------------------------------------------------
+
+    info = GB_reduce_to_vector (C, M_in, accum, monoid, B, desc, Werk) ;
+    GB_FREE_ALL ;
+    return (info) ;
+}
+
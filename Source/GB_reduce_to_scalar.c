@@ -80,6 +80,10 @@ GrB_Info GB_reduce_to_scalar    // z = reduce_to_scalar (A)
     //--------------------------------------------------------------------------
 
     GB_MATRIX_WAIT_IF_PENDING (A) ;
+
+    // A is scanned, for adaptive sparsity
+    GB_sparsity_adapt_use (A, false, 0, 0) ;
+
     GB_BURBLE_DENSE (A, "(A %s) ") ;
 
     ASSERT (GB_ZOMBIES_OK (A)) ;
@@ -158,7 +162,7 @@ GrB_Info GB_reduce_to_scalar    // z = reduce_to_scalar (A)
         //----------------------------------------------------------------------
 
         int nthreads_max = GB_Context_nthreads_max ( ) ;
-        double chunk = GB_Context_chunk ( ) ;
+        double chunk = GB_Context_chunk_family (GxB_CHUNK_REDUCE) ;
         int nthreads = GB_nthreads (anz, chunk, nthreads_max) ;
         int ntasks = (nthreads == 1) ? 1 : (64 * nthreads) ;
         ntasks = GB_IMIN (ntasks, anz) ;
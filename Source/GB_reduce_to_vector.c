@@ -10,14 +10,23 @@
 // C<M> = accum (C,reduce(A)) where C is n-by-1.  Reduces a matrix A or A'
 // to a vector.
 
+// If A is reduced in the same orientation as it is held (reducing the rows of
+// a matrix held by row, or the columns of a matrix held by column), each
+// vector of A is reduced directly by GB_reduce_each_vector.  Otherwise, or if
+// that method has no kernel for this monoid, the reduction is computed as
+// C<M> = accum (C, A*x) with the REDUCE_FIRST semiring, where x is an iso
+// full vector.
+
 #define GB_FREE_ALL                     \
 {                                       \
+    GB_Matrix_free (&T) ;               \
     GB_Matrix_free (&B) ;               \
     GrB_Semiring_free (&semiring) ;     \
 }
 
 #include "GB_reduce.h"
 #include "GB_binop.h"
+#include "GB_accum_mask.h"
 #include "GB_mxm.h"
 #include "GB_get_mask.h"
 #include "GB_Semiring_new.h"
@@ -38,8 +47,8 @@ GrB_Info GB_reduce_to_vector        // C<M> = accum (C,reduce(A))
     // check inputs
     //--------------------------------------------------------------------------
 
-    struct GB_Matrix_opaque B_header ;
-    GrB_Matrix B = NULL ;
+    struct GB_Matrix_opaque B_header, T_header ;
+    GrB_Matrix B = NULL, T = NULL ;
     struct GB_Semiring_opaque semiring_header ;
     GrB_Semiring semiring = NULL ;
 
@@ -107,6 +116,30 @@ GrB_Info GB_reduce_to_vector        // C<M> = accum (C,reduce(A))
     // quick return if an empty mask is complemented
     GB_RETURN_IF_QUICK_MASK (C, C_replace, M, Mask_comp, Mask_struct) ;
 
+    //--------------------------------------------------------------------------
+    // reduce each vector of A, if A is reduced in the orientation it is held
+    //--------------------------------------------------------------------------
+
+    if (A->is_csc == A_transpose)
+    {
+        GB_MATRIX_WAIT (A) ;
+        GB_CLEAR_STATIC_HEADER (T, &T_header) ;
+        info = GB_reduce_each_vector (T, monoid, NULL, NULL, NULL, A,
+            Werk) ;
+        if (info == GrB_SUCCESS)
+        { 
+            // C<M> = accum (C,T)
+            info = GB_accum_mask (C, M, NULL, accum, &T, C_replace, Mask_comp,
+                Mask_struct, Werk) ;
+        }
+        if (info != GrB_NO_VALUE)
+        { 
+            // the reduction is done, or it failed
+            GB_FREE_ALL ;
+            return (info) ;
+        }
+    }
+
     //--------------------------------------------------------------------------
     // create B as full iso vector
     //--------------------------------------------------------------------------
@@ -65,6 +65,12 @@ GrB_Info GB_reshape         // reshape a GrB_Matrix into another GrB_Matrix
     GrB_Info info ;
     ASSERT_MATRIX_OK (A, "A for reshape", GB0) ;
 
+    if (Chandle == NULL)
+    { 
+        // A is reshaped in place, so its cached transpose is no longer valid
+        GB_transpose_cache_free (A) ;
+    }
+
     int64_t *I_work = NULL, *J_work = NULL ;
     GB_void *S_work = NULL, *S_input = NULL ;
     size_t I_work_size = 0, J_work_size = 0, S_work_size = 0 ;
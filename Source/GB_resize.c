@@ -41,6 +41,9 @@ GrB_Info GB_resize              // change the size of a matrix
     int8_t  *restrict Ab_new = NULL ; size_t Ab_new_size = 0 ;
     ASSERT_MATRIX_OK (A, "A to resize", GB0) ;
 
+    // A is about to be modified, so its cached transpose is no longer valid
+    GB_transpose_cache_free (A) ;
+
     //--------------------------------------------------------------------------
     // handle the CSR/CSC format
     //--------------------------------------------------------------------------
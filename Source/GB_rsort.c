@@ -0,0 +1,261 @@
+//------------------------------------------------------------------------------
+// GB_rsort: parallel radix sort of (j,i,k) or (i,k) tuples
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// JIT: not needed.  Only one variant possible.
+
+// Sorts the tuples (J [t], I [t], K [t]) for t = 0:n-1 in ascending order,
+// where 0 <= I [t] < vlen and 0 <= J [t] < vdim.  If J is NULL, the tuples
+// (I [t], K [t]) are sorted instead.  K is optional; if NULL, the tuples are
+// just (J [t], I [t]) or I [t].  K is carried along with each tuple as a
+// payload, and is not part of the sort key.
+
+// Each (j,i) pair is packed into a single 64-bit key, (j << ibits) | i, where
+// ibits is the number of bits needed to hold 0:vlen-1.  The caller must ensure
+// that the keys fit in 64 bits (GB_rsort_nbits (vlen) + GB_rsort_nbits (vdim)
+// <= 64).  The keys are sorted with a least-significant-digit radix sort,
+// with up to GB_RSORT_RADIX_BITS bits per pass.  Each pass is parallel: each
+// thread counts the digits in its own slice of the keys, the counts are
+// summed digit-major, and then each thread scatters its slice into its own
+// part of each bucket.  A pass is skipped if all keys have the same digit.
+
+// The sort is stable, so if K [t] = t on input (as in GB_builder), the result
+// is identical to GB_msort_3 (J, I, K, ...) or GB_msort_2 (I, K, ...), even if
+// the (j,i) keys have duplicates.
+
+#include "GB_sort.h"
+
+#define GB_FREE_ALL                                 \
+{                                                   \
+    GB_FREE_WORK (&Key_work, Key_work_size) ;       \
+    GB_FREE_WORK (&K_work, K_work_size) ;           \
+    GB_FREE_WORK (&Hist, Hist_size) ;               \
+}
+
+GrB_Info GB_rsort       // sort (j,i,k) or (i,k) tuples with a radix sort
+(
+    int64_t *restrict I,        // size n, row indices in range 0:vlen-1
+    int64_t *restrict J,        // size n, col indices in range 0:vdim-1,
+                                // or NULL if the tuples are (i,k)
+    int64_t *restrict K,        // size n, payload, or NULL if not present
+    const int64_t n,
+    const int64_t vlen,
+    const int64_t vdim,
+    int nthreads                // # of threads to use
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (I != NULL) ;
+    ASSERT (n >= 0) ;
+    uint64_t *restrict Key_work = NULL ; size_t Key_work_size = 0 ;
+    int64_t  *restrict K_work   = NULL ; size_t K_work_size = 0 ;
+    int64_t  *restrict Hist     = NULL ; size_t Hist_size = 0 ;
+
+    const int ibits = GB_rsort_nbits (vlen) ;
+    const int jbits = (J == NULL) ? 0 : GB_rsort_nbits (vdim) ;
+    const int kbits = ibits + jbits ;
+    ASSERT (kbits <= 64) ;
+    if (n <= 1 || kbits == 0)
+    {
+        // nothing to do
+        return (GrB_SUCCESS) ;
+    }
+
+    nthreads = GB_IMIN (nthreads, GB_IMAX (1, n / GB_BASECASE)) ;
+
+    //--------------------------------------------------------------------------
+    // determine the digits
+    //--------------------------------------------------------------------------
+
+    // use the fewest passes possible, with equal-sized digits
+    const int npasses = (kbits + GB_RSORT_RADIX_BITS-1) / GB_RSORT_RADIX_BITS ;
+    const int dbits = (kbits + npasses - 1) / npasses ;
+    const int64_t nbuckets = ((int64_t) 1) << dbits ;
+    const uint64_t dmask = (uint64_t) (nbuckets - 1) ;
+
+    //--------------------------------------------------------------------------
+    // allocate workspace
+    //--------------------------------------------------------------------------
+
+    // Key_work [0:n-1] and Key_work [n:2n-1] are the two key buffers
+    Key_work = GB_MALLOC_WORK (2*n, uint64_t, &Key_work_size) ;
+    if (K != NULL)
+    {
+        K_work = GB_MALLOC_WORK (n, int64_t, &K_work_size) ;
+    }
+    Hist = GB_MALLOC_WORK (nthreads * nbuckets + 1, int64_t, &Hist_size) ;
+    if (Key_work == NULL || (K != NULL && K_work == NULL) || Hist == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // pack the (j,i) indices into the keys
+    //--------------------------------------------------------------------------
+
+    uint64_t *restrict Key_in  = Key_work ;
+    uint64_t *restrict Key_out = Key_work + n ;
+    int64_t  *restrict K_in    = K ;
+    int64_t  *restrict K_out   = K_work ;
+
+    int64_t t ;
+    if (J == NULL)
+    {
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (t = 0 ; t < n ; t++)
+        {
+            Key_in [t] = (uint64_t) I [t] ;
+        }
+    }
+    else
+    {
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (t = 0 ; t < n ; t++)
+        {
+            Key_in [t] = (((uint64_t) J [t]) << ibits) | ((uint64_t) I [t]) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // sort the keys, one digit at a time
+    //--------------------------------------------------------------------------
+
+    for (int pass = 0 ; pass < npasses ; pass++)
+    {
+
+        const int shift = pass * dbits ;
+        int tid ;
+
+        //----------------------------------------------------------------------
+        // count the digits in each slice
+        //----------------------------------------------------------------------
+
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (tid = 0 ; tid < nthreads ; tid++)
+        {
+            int64_t *restrict H = Hist + tid * nbuckets ;
+            memset (H, 0, nbuckets * sizeof (int64_t)) ;
+            int64_t tstart, tend ;
+            GB_PARTITION (tstart, tend, n, tid, nthreads) ;
+            for (int64_t p = tstart ; p < tend ; p++)
+            {
+                H [(Key_in [p] >> shift) & dmask]++ ;
+            }
+        }
+
+        //----------------------------------------------------------------------
+        // skip this pass if all keys have the same digit
+        //----------------------------------------------------------------------
+
+        bool skip = false ;
+        for (int64_t b = 0 ; b < nbuckets && !skip ; b++)
+        {
+            int64_t total = 0 ;
+            for (tid = 0 ; tid < nthreads ; tid++)
+            {
+                total += Hist [tid * nbuckets + b] ;
+            }
+            skip = (total == n) ;
+        }
+        if (skip) continue ;
+
+        //----------------------------------------------------------------------
+        // cumulative sum of the counts, digit-major
+        //----------------------------------------------------------------------
+
+        int64_t s = 0 ;
+        for (int64_t b = 0 ; b < nbuckets ; b++)
+        {
+            for (tid = 0 ; tid < nthreads ; tid++)
+            {
+                int64_t c = Hist [tid * nbuckets + b] ;
+                Hist [tid * nbuckets + b] = s ;
+                s += c ;
+            }
+        }
+
+        //----------------------------------------------------------------------
+        // scatter each slice into the buckets, in order
+        //----------------------------------------------------------------------
+
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (tid = 0 ; tid < nthreads ; tid++)
+        {
+            int64_t *restrict H = Hist + tid * nbuckets ;
+            int64_t tstart, tend ;
+            GB_PARTITION (tstart, tend, n, tid, nthreads) ;
+            if (K_in == NULL)
+            {
+                for (int64_t p = tstart ; p < tend ; p++)
+                {
+                    uint64_t key = Key_in [p] ;
+                    Key_out [H [(key >> shift) & dmask]++] = key ;
+                }
+            }
+            else
+            {
+                for (int64_t p = tstart ; p < tend ; p++)
+                {
+                    uint64_t key = Key_in [p] ;
+                    int64_t pdest = H [(key >> shift) & dmask]++ ;
+                    Key_out [pdest] = key ;
+                    K_out [pdest] = K_in [p] ;
+                }
+            }
+        }
+
+        //----------------------------------------------------------------------
+        // swap the input and output buffers
+        //----------------------------------------------------------------------
+
+        uint64_t *Key_tmp = Key_in ; Key_in = Key_out ; Key_out = Key_tmp ;
+        int64_t  *K_tmp   = K_in   ; K_in   = K_out   ; K_out   = K_tmp ;
+    }
+
+    //--------------------------------------------------------------------------
+    // unpack the sorted keys into I and J, and copy K back if needed
+    //--------------------------------------------------------------------------
+
+    const uint64_t imask = (ibits == 64) ? UINT64_MAX :
+        ((((uint64_t) 1) << ibits) - 1) ;
+    bool K_copy = (K != NULL && K_in != K) ;
+    if (J == NULL)
+    {
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (t = 0 ; t < n ; t++)
+        {
+            I [t] = (int64_t) Key_in [t] ;
+            if (K_copy) K [t] = K_in [t] ;
+        }
+    }
+    else
+    {
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (t = 0 ; t < n ; t++)
+        {
+            uint64_t key = Key_in [t] ;
+            I [t] = (int64_t) (key & imask) ;
+            J [t] = (int64_t) (key >> ibits) ;
+            if (K_copy) K [t] = K_in [t] ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
+
@@ -53,6 +53,9 @@ GrB_Info GB_select          // C<M> = accum (C, select(A,k)) or select(A',k)
     ASSERT_MATRIX_OK (A, "A input for GB_select", GB0) ;
     ASSERT_SCALAR_OK (Thunk, "Thunk for GB_select", GB0) ;
 
+    // A is scanned, for adaptive sparsity
+    GB_sparsity_adapt_use (A, false, 0, 0) ;
+
     struct GB_Matrix_opaque T_header ;
     GrB_Matrix T = NULL ;
 
@@ -122,6 +125,9 @@ GrB_Info GB_select          // C<M> = accum (C, select(A,k)) or select(A',k)
     // quick return if an empty mask is complemented
     GB_RETURN_IF_QUICK_MASK (C, C_replace, M, Mask_comp, Mask_struct) ;
 
+    // C is about to be modified, so its cached transpose is no longer valid
+    GB_transpose_cache_free (C) ;
+
     //--------------------------------------------------------------------------
     // delete any lingering zombies and assemble any pending tuples
     //--------------------------------------------------------------------------
@@ -363,6 +369,35 @@ GrB_Info GB_select          // C<M> = accum (C, select(A,k)) or select(A',k)
         Thunk2 = Thunk ;
     }
 
+    //--------------------------------------------------------------------------
+    // C = select (C,Thunk) in-place
+    //--------------------------------------------------------------------------
+
+    // If C and A are the same matrix, with no mask, no accum, and no
+    // transpose, then C is pruned in-place by GB_selector, and T is not
+    // constructed.  C must be sparse or hypersparse (a bitmap or full C uses
+    // GB_select_bitmap instead).  The column selectors and the value
+    // selectors with an iso C construct a new matrix, so they are excluded.
+
+    GB_Opcode sel_opcode = op->opcode ;
+    bool in_place = (C == A) && (M == NULL) && (accum == NULL)
+        && !A_transpose && !make_copy && !is_empty
+        && (GB_IS_SPARSE (C) || GB_IS_HYPERSPARSE (C))
+        && !C->i_shallow && !C->x_shallow
+        && !(sel_opcode == GB_COLINDEX_idxunop_code ||
+             sel_opcode == GB_COLLE_idxunop_code ||
+             sel_opcode == GB_COLGT_idxunop_code)
+        && !(C->iso && sel_opcode >= GB_VALUENE_idxunop_code
+                    && sel_opcode <= GB_VALUELE_idxunop_code) ;
+
+    if (in_place)
+    { 
+        GBURBLE ("(in-place select) ") ;
+        GB_OK (GB_selector (NULL, op, flipij, C, Thunk2, Werk)) ;
+        ASSERT_MATRIX_OK (C, "C output for in-place select", GB0) ;
+        return (GB_conform (C, Werk)) ;
+    }
+
     //--------------------------------------------------------------------------
     // create T
     //--------------------------------------------------------------------------
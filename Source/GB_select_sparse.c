@@ -9,6 +9,10 @@
 
 // JIT: done.
 
+// If C is NULL, A is selected in-place.  Its entries are compacted within the
+// existing A->i and A->x arrays, which are then shrunk with a realloc, so no
+// second copy of the pattern and values of A is allocated.
+
 #include "GB_select.h"
 #include "GB_ek_slice.h"
 #ifndef GBCOMPACT
@@ -20,6 +24,7 @@
 #define GB_FREE_WORKSPACE                   \
 {                                           \
     GB_FREE_WORK (&Zp, Zp_size) ;           \
+    GB_FREE_WORK (&Del, Del_size) ;         \
     GB_WERK_POP (Work, int64_t) ;           \
     GB_WERK_POP (A_ek_slicing, int64_t) ;   \
     GB_FREE (&Cp, Cp_size) ;                \
@@ -34,6 +39,49 @@
     GB_FREE_WORKSPACE ;                     \
 }
 
+//------------------------------------------------------------------------------
+// GB_select_shift: shift a slice of A->i or A->x down, for in-place select
+//------------------------------------------------------------------------------
+
+// The n bytes at src are moved down to dest, where dest <= src.  If the slice
+// is shifted by at least GB_SHIFT_CHUNK bytes, it is copied in parallel, one
+// chunk of that size at a time, so that no chunk overlaps its destination.
+
+#define GB_SHIFT_CHUNK (1024*1024)
+
+static void GB_select_shift
+(
+    GB_void *dest,              // destination
+    GB_void *src,               // source
+    size_t n,                   // # of bytes to move
+    int nthreads                // max # of threads to use
+)
+{
+    ASSERT (dest <= src) ;
+    size_t shift = (size_t) (src - dest) ;
+    if (shift == 0 || n == 0)
+    { 
+        // nothing to do
+    }
+    else if (shift < GB_SHIFT_CHUNK)
+    { 
+        // small shift: use a single memmove
+        memmove (dest, src, n) ;
+    }
+    else
+    {
+        // large shift: copy each chunk in parallel
+        for (size_t p = 0 ; p < n ; p += shift)
+        { 
+            GB_memcpy (dest + p, src + p, GB_IMIN (shift, n - p), nthreads) ;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_select_sparse
+//------------------------------------------------------------------------------
+
 GrB_Info GB_select_sparse
 (
     GrB_Matrix C,
@@ -54,6 +102,7 @@ GrB_Info GB_select_sparse
 
     GrB_Info info ;
     int64_t *restrict Zp = NULL ; size_t Zp_size = 0 ;
+    int64_t *restrict Del = NULL ; size_t Del_size = 0 ;
     GB_WERK_DECLARE (Work, int64_t) ;
     int64_t *restrict Wfirst = NULL ;
     int64_t *restrict Wlast = NULL ;
@@ -66,7 +115,7 @@ GrB_Info GB_select_sparse
     GB_void *restrict Cx = NULL ; size_t Cx_size = 0 ;
 
     GB_Opcode opcode = op->opcode ;
-    bool in_place_A = (C == NULL) ; // GrB_wait and GB_resize only
+    bool in_place_A = (C == NULL) ; // GrB_wait, GB_resize, and GB_select
     const bool A_iso = A->iso ;
     const size_t asize = A->type->size ;
     const GB_Type_code acode = A->type->code ;
@@ -87,8 +136,9 @@ GrB_Info GB_select_sparse
 
     int64_t *restrict Ap = A->p ; size_t Ap_size = A->p_size ;
     int64_t *restrict Ah = A->h ;
-    int64_t *restrict Ai = A->i ; size_t Ai_size = A->i_size ;
-    GB_void *restrict Ax = (GB_void *) A->x ; size_t Ax_size = A->x_size ;
+    // Ai and Ax are modified by the phase2 kernels if A is selected in-place
+    int64_t *Ai = A->i ;
+    GB_void *Ax = (GB_void *) A->x ;
     int64_t anvec = A->nvec ;
     bool A_jumbled = A->jumbled ;
     bool A_is_hyper = (Ah != NULL) ;
@@ -241,32 +291,42 @@ GrB_Info GB_select_sparse
     GB_ek_slice_merge2 (&C_nvec_nonempty, Cp_kfirst, Cp, anvec,
         Wfirst, Wlast, A_ek_slicing, A_ntasks, A_nthreads, Werk) ;
 
-    //--------------------------------------------------------------------------
-    // allocate new space for the compacted Ci and Cx
-    //--------------------------------------------------------------------------
-
     cnz = Cp [anvec] ;
-    cnz = GB_IMAX (cnz, 1) ;
-    Ci = GB_MALLOC (cnz, int64_t, &Ci_size) ;
-    // use calloc since C is sparse, not bitmap
-    Cx = (GB_void *) GB_XALLOC (false, C_iso, cnz, asize, &Cx_size) ; // x:OK
-    if (Ci == NULL || Cx == NULL)
-    { 
-        // out of memory
-        GB_FREE_ALL ;
-        return (GrB_OUT_OF_MEMORY) ;
-    }
 
-    //--------------------------------------------------------------------------
-    // set the iso value of C
-    //--------------------------------------------------------------------------
+    if (!in_place_A)
+    {
 
-    if (C_iso)
-    { 
-        // The pattern of C is computed by the worker below.
-        GB_select_iso (Cx, opcode, athunk, Ax, asize) ;
+        //----------------------------------------------------------------------
+        // allocate new space for the compacted Ci and Cx
+        //----------------------------------------------------------------------
+
+        int64_t cnz_alloc = GB_IMAX (cnz, 1) ;
+        Ci = GB_MALLOC (cnz_alloc, int64_t, &Ci_size) ;
+        // use calloc since C is sparse, not bitmap
+        Cx = (GB_void *) GB_XALLOC (false, C_iso, cnz_alloc, asize, // x:OK
+            &Cx_size) ;
+        if (Ci == NULL || Cx == NULL)
+        { 
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+
+        //----------------------------------------------------------------------
+        // set the iso value of C
+        //----------------------------------------------------------------------
+
+        if (C_iso)
+        { 
+            // The pattern of C is computed by the worker below.
+            GB_select_iso (Cx, opcode, athunk, Ax, asize) ;
+        }
     }
 
+    // If A is modified in-place, Ci and Cx are NULL here.  The phase2 kernels
+    // then compact each slice of A->i and A->x in-place, and the iso value of
+    // C is set after the slices are shifted into place, below.
+
     //==========================================================================
     // phase2: select the entries
     //==========================================================================
@@ -359,13 +419,85 @@ GrB_Info GB_select_sparse
     {
 
         //----------------------------------------------------------------------
-        // transplant Cp, Ci, Cx back into A
+        // shift the compacted slice of each task into place
+        //----------------------------------------------------------------------
+
+        // Each task has compacted the entries it keeps to the front of its own
+        // slice of A->i and A->x, starting at pstart_Aslice [tid].  The entries
+        // of task tid belong at Cp_kfirst [tid] in the final result, which is
+        // never past the start of its slice.  The slices are shifted down in
+        // order, so a slice is never moved on top of entries that have not yet
+        // been moved.
+
+        const int64_t *restrict kfirst_Aslice = A_ek_slicing ;
+        const int64_t *restrict klast_Aslice  = A_ek_slicing + A_ntasks ;
+        const int64_t *restrict pstart_Aslice = A_ek_slicing + A_ntasks * 2 ;
+        int nthreads = GB_nthreads (cnz, chunk, nthreads_max) ;
+
+        for (int tid = 0 ; tid < A_ntasks ; tid++)
+        {
+            int64_t kfirst = kfirst_Aslice [tid] ;
+            int64_t klast  = klast_Aslice  [tid] ;
+            if (kfirst > klast) continue ;
+            // # of entries kept by task tid, as counted by phase1
+            int64_t mynz = Wfirst [tid] ;
+            if (kfirst < klast)
+            { 
+                mynz += (Cp [klast] - Cp [kfirst+1]) + Wlast [tid] ;
+            }
+            int64_t pdest = Cp_kfirst [tid] ;
+            int64_t psrc  = pstart_Aslice [tid] ;
+            ASSERT (pdest <= psrc && pdest + mynz <= cnz) ;
+            GB_select_shift (Ai + pdest, Ai + psrc, mynz * sizeof (int64_t),
+                nthreads) ;
+            if (!C_iso)
+            { 
+                GB_select_shift (Ax + pdest * asize, Ax + psrc * asize,
+                    mynz * asize, nthreads) ;
+            }
+        }
+
+        //----------------------------------------------------------------------
+        // set the iso value of C, if A is not already iso
+        //----------------------------------------------------------------------
+
+        if (C_iso && !A_iso)
+        { 
+            GB_select_iso (Ax, opcode, athunk, Ax, asize) ;
+        }
+
+        //----------------------------------------------------------------------
+        // shrink A->i and A->x
+        //----------------------------------------------------------------------
+
+        // If the realloc fails, A->i and A->x are left unchanged.
+        bool ok = true ;
+        int64_t cnz_alloc = GB_IMAX (cnz, 1) ;
+        if (cnz_alloc * sizeof (int64_t) < A->i_size)
+        { 
+            GB_REALLOC (A->i, cnz_alloc, int64_t, &(A->i_size), &ok) ;
+        }
+        size_t cx_size_required = (C_iso ? 1 : cnz_alloc) * asize ;
+        if (cx_size_required < A->x_size)
+        { 
+            GB_REALLOC (A->x, cx_size_required, GB_void, &(A->x_size), &ok) ;
+        }
+
+        //----------------------------------------------------------------------
+        // transplant Cp back into A
         //----------------------------------------------------------------------
 
         // TODO: this is not parallel: use GB_hyper_prune
         if (A->h != NULL && C_nvec_nonempty < anvec)
         {
-            // prune empty vectors from Ah and Ap
+            // prune empty vectors from Ah and Ap, and keep a list of the
+            // pruned vectors in Del, so that A->Y can be updated
+            int64_t ndel = 0 ;
+            if (A->Y != NULL)
+            { 
+                Del = GB_MALLOC_WORK (anvec - C_nvec_nonempty, int64_t,
+                    &Del_size) ;
+            }
             int64_t cnvec = 0 ;
             for (int64_t k = 0 ; k < anvec ; k++)
             {
@@ -375,13 +507,25 @@ GrB_Info GB_select_sparse
                     Ap [cnvec] = Cp [k] ;
                     cnvec++ ;
                 }
+                else if (Del != NULL)
+                { 
+                    Del [ndel++] = Ah [k] ;
+                }
             }
             Ap [cnvec] = Cp [anvec] ;
             A->nvec = cnvec ;
             ASSERT (A->nvec == C_nvec_nonempty) ;
             GB_FREE (&Cp, Cp_size) ;
-            // the A->Y hyper_hash is now invalid
-            GB_hyper_hash_free (A) ;
+            if (Del != NULL)
+            { 
+                // remove the pruned vectors from the A->Y hyper_hash
+                GB_OK (GB_hyper_hash_update (A, Del, ndel, NULL, 0, Werk)) ;
+            }
+            else
+            { 
+                // the A->Y hyper_hash is now invalid
+                GB_hyper_hash_free (A) ;
+            }
         }
         else
         { 
@@ -393,10 +537,6 @@ GrB_Info GB_select_sparse
 
         ASSERT (Cp == NULL) ;
 
-        GB_FREE (&Ai, Ai_size) ;
-        GB_FREE (&Ax, Ax_size) ;
-        A->i = Ci ; Ci = NULL ; A->i_size = Ci_size ;
-        A->x = Cx ; Cx = NULL ; A->x_size = Cx_size ;
         A->nvec_nonempty = C_nvec_nonempty ;
         A->jumbled = A_jumbled ;        // A remains jumbled (in-place select)
         A->iso = C_iso ;                // OK: burble already done above
@@ -0,0 +1,483 @@
+//------------------------------------------------------------------------------
+// GB_select_topk: select the first k entries in each vector of a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// JIT: needed.
+
+// C(i,:) is a copy of the k entries of A(i,:) that come first in the sorted
+// order defined by the comparator op (the k smallest entries for GrB_LT_*, or
+// the k largest for GrB_GT_*), for each row i of A.  If A_transpose is true,
+// C(:,j) holds the k entries selected from each column A(:,j).  Ties are
+// broken by the index, as in GB_sort, so exactly min (k, nnz (A(i,:))) entries
+// are kept in each row.  This is the same as C = A(i,P(i,1:k)) for each row i,
+// where [~,P] = GxB_Matrix_sort (A), but each vector is only partially sorted,
+// with quickselect, so the work is O(nnz(A)) instead of O(nnz(A) log d), for
+// vectors of length d.  The indices of C are left jumbled, and are sorted
+// later, if needed.
+
+#include "GB_sort.h"
+#include "GB_transpose.h"
+#include "GB_slice.h"
+
+//  macros:
+
+//  GB_TOPK (func)      defined as GB_topk_func_TYPE_ascend or _descend,
+//                      or GB_topk_func_UDT
+//  GB_TYPE             bool, int8_, ... or GB_void for UDT
+
+//  GB_ADDR(A,p)        A+p for builtin, A + p * csize otherwise
+//  GB_GET(x,X,i)       x = (op->xtype) X [i]
+//  GB_SWAP(A,i,k)      swap A [i] and A [k]
+//  GB_LT               compare two entries, x < y
+
+//------------------------------------------------------------------------------
+// macros for all built-in types
+//------------------------------------------------------------------------------
+
+#define GB_SORT_UDT         0
+#define GB_ADDR(A,i)        ((A) + (i))
+#define GB_GET(x,A,i)       GB_TYPE x = A [i]
+#define GB_SWAP(A,i,j)      { GB_TYPE t = A [i] ; A [i] = A [j] ; A [j] = t ; }
+
+//------------------------------------------------------------------------------
+// ascending order for built-in types: select the k smallest entries
+//------------------------------------------------------------------------------
+
+#define GB_LT(less,a,i,b,j)  \
+    less = (((a) < (b)) ? true : (((a) == (b)) ? ((i) < (j)) : false))
+
+#define GB_TYPE             bool
+#define GB_TOPK(func)       GB_EVAL3 (GB(topk_), func, _ascend_BOOL)
+#include "GB_topk_template.c"
+
+#define GB_TYPE             int8_t
+#define GB_TOPK(func)       GB_EVAL3 (GB(topk_), func, _ascend_INT8)
+#include "GB_topk_template.c"
+
+#define GB_TYPE             int16_t
+#define GB_TOPK(func)       GB_EVAL3 (GB(topk_), func, _ascend_INT16)
+#include "GB_topk_template.c"
+
+#define GB_TYPE             int32_t
+#define GB_TOPK(func)       GB_EVAL3 (GB(topk_), func, _ascend_INT32)
+#include "GB_topk_template.c"
+
+#define GB_TYPE             int64_t
+#define GB_TOPK(func)       GB_EVAL3 (GB(topk_), func, _ascend_INT64)
+#include "GB_topk_template.c"
+
+#define GB_TYPE             uint8_t
+#define GB_TOPK(func)       GB_EVAL3 (GB(topk_), func, _ascend_UINT8)
+#include "GB_topk_template.c"
+
+#define GB_TYPE             uint16_t
+#define GB_TOPK(func)       GB_EVAL3 (GB(topk_), func, _ascend_UINT16)
+#include "GB_topk_template.c"
+
+#define GB_TYPE             uint32_t
+#define GB_TOPK(func)       GB_EVAL3 (GB(topk_), func, _ascend_UINT32)
+#include "GB_topk_template.c"
+
+#define GB_TYPE             uint64_t
+#define GB_TOPK(func)       GB_EVAL3 (GB(topk_), func, _ascend_UINT64)
+#include "GB_topk_template.c"
+
+#define GB_TYPE             float
+#define GB_TOPK(func)       GB_EVAL3 (GB(topk_), func, _ascend_FP32)
+#include "GB_topk_template.c"
+
+#define GB_TYPE             double
+#define GB_TOPK(func)       GB_EVAL3 (GB(topk_), func, _ascend_FP64)
+#include "GB_topk_template.c"
+
+//------------------------------------------------------------------------------
+// descending order for built-in types: select the k largest entries
+//------------------------------------------------------------------------------
+
+#undef  GB_LT
+#define GB_LT(less,a,i,b,j)  \
+    less = (((a) > (b)) ? true : (((a) == (b)) ? ((i) < (j)) : false))
+
+#define GB_TYPE             bool
+#define GB_TOPK(func)       GB_EVAL3 (GB(topk_), func, _descend_BOOL)
+#include "GB_topk_template.c"
+
+#define GB_TYPE             int8_t
+#define GB_TOPK(func)       GB_EVAL3 (GB(topk_), func, _descend_INT8)
+#include "GB_topk_template.c"
+
+#define GB_TYPE             int16_t
+#define GB_TOPK(func)       GB_EVAL3 (GB(topk_), func, _descend_INT16)
+#include "GB_topk_template.c"
+
+#define GB_TYPE             int32_t
+#define GB_TOPK(func)       GB_EVAL3 (GB(topk_), func, _descend_INT32)
+#include "GB_topk_template.c"
+
+#define GB_TYPE             int64_t
+#define GB_TOPK(func)       GB_EVAL3 (GB(topk_), func, _descend_INT64)
+#include "GB_topk_template.c"
+
+#define GB_TYPE             uint8_t
+#define GB_TOPK(func)       GB_EVAL3 (GB(topk_), func, _descend_UINT8)
+#include "GB_topk_template.c"
+
+#define GB_TYPE             uint16_t
+#define GB_TOPK(func)       GB_EVAL3 (GB(topk_), func, _descend_UINT16)
+#include "GB_topk_template.c"
+
+#define GB_TYPE             uint32_t
+#define GB_TOPK(func)       GB_EVAL3 (GB(topk_), func, _descend_UINT32)
+#include "GB_topk_template.c"
+
+#define GB_TYPE             uint64_t
+#define GB_TOPK(func)       GB_EVAL3 (GB(topk_), func, _descend_UINT64)
+#include "GB_topk_template.c"
+
+#define GB_TYPE             float
+#define GB_TOPK(func)       GB_EVAL3 (GB(topk_), func, _descend_FP32)
+#include "GB_topk_template.c"
+
+#define GB_TYPE             double
+#define GB_TOPK(func)       GB_EVAL3 (GB(topk_), func, _descend_FP64)
+#include "GB_topk_template.c"
+
+//------------------------------------------------------------------------------
+// macros for user-defined types and when typecasting is performed
+//------------------------------------------------------------------------------
+
+#undef  GB_ADDR
+#undef  GB_GET
+#undef  GB_SWAP
+#undef  GB_LT
+
+#define GB_ADDR(A,i)        ((A) + (i) * csize)
+#define GB_GET(x,A,i)       GB_void x [GB_VLA(xsize)] ;                     \
+                            fcast (x, GB_ADDR (A, i), csize)
+#define GB_TYPE             GB_void
+
+#define GB_SWAP(A,i,j)                                                      \
+{                                                                           \
+    GB_void t [GB_VLA(csize)] ;         /* declare the scalar t */          \
+    memcpy (t, GB_ADDR (A, i), csize) ; /* t = A [i] */                     \
+    memcpy (GB_ADDR (A, i), GB_ADDR (A, j), csize) ; /* A [i] = A [j] */    \
+    memcpy (GB_ADDR (A, j), t, csize) ; /* A [j] = t */                     \
+}
+
+#define GB_LT(less,a,i,b,j)                                                 \
+{                                                                           \
+    flt (&less, a, b) ;         /* less = (a < b) */                        \
+    if (!less)                                                              \
+    {                                                                       \
+        /* check for equality and tie-break on index */                     \
+        bool more ;                                                         \
+        flt (&more, b, a) ;     /* more = (b < a) */                        \
+        less = (more) ? false : ((i) < (j)) ;                               \
+    }                                                                       \
+}
+
+#undef  GB_SORT_UDT
+#define GB_SORT_UDT 1
+#define GB_TOPK(func)       GB_EVAL3 (GB(topk_), func, _UDT)
+#include "GB_topk_template.c"
+
+//------------------------------------------------------------------------------
+// GB_select_topk
+//------------------------------------------------------------------------------
+
+#define GB_FREE_WORKSPACE                   \
+{                                           \
+    GB_WERK_POP (C_slice, int64_t) ;        \
+    GB_FREE (&Tp_new, Tp_new_size) ;        \
+    GB_FREE (&Ti_new, Ti_new_size) ;        \
+    GB_FREE (&Tx_new, Tx_new_size) ;        \
+}
+
+#define GB_FREE_ALL                         \
+{                                           \
+    GB_FREE_WORKSPACE ;                     \
+    GB_Matrix_free (&T) ;                   \
+}
+
+GrB_Info GB_select_topk
+(
+    // output:
+    GrB_Matrix C,               // output matrix
+    // input:
+    const GrB_BinaryOp op,      // comparator for the selection
+    const GrB_Matrix A,         // input matrix
+    const uint64_t k,           // # of entries to keep in each vector
+    const bool A_transpose,     // false: select from each row,
+                                // true: select from each column
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT_MATRIX_OK (C, "C input for GB_select_topk", GB0) ;
+    ASSERT_BINARYOP_OK (op, "op for GB_select_topk", GB0) ;
+    ASSERT_MATRIX_OK (A, "A for GB_select_topk", GB0) ;
+
+    int64_t *restrict Tp_new = NULL ; size_t Tp_new_size = 0 ;
+    int64_t *restrict Ti_new = NULL ; size_t Ti_new_size = 0 ;
+    GB_void *restrict Tx_new = NULL ; size_t Tx_new_size = 0 ;
+    GB_WERK_DECLARE (C_slice, int64_t) ;
+    struct GB_Matrix_opaque T_header ;
+    GrB_Matrix T = NULL ;
+
+    GrB_Type atype = A->type ;
+    if (op->ztype != GrB_BOOL || op->xtype != op->ytype || atype != C->type
+        || !GB_Type_compatible (atype, op->xtype))
+    {
+        // op must return bool, and its inputs x and y must have the same type;
+        // the types of A and C must match exactly; A and C must be typecasted
+        // to the input type of the op.
+        return (GrB_DOMAIN_MISMATCH) ;
+    }
+
+    if (GB_NROWS (C) != GB_NROWS (A) || GB_NCOLS (C) != GB_NCOLS (A))
+    {
+        // C must have the same dimensions as A
+        return (GrB_DIMENSION_MISMATCH) ;
+    }
+
+    // C is about to be modified, so its cached transpose is stale
+    GB_transpose_cache_free (C) ;
+
+    // finish any pending work in A
+    GB_MATRIX_WAIT (A) ;
+
+    //--------------------------------------------------------------------------
+    // T = A, held by row (or by column if A_transpose is true)
+    //--------------------------------------------------------------------------
+
+    // T is always a new matrix, so C can be aliased with A
+    GB_CLEAR_STATIC_HEADER (T, &T_header) ;
+    bool T_is_csc = A_transpose ;
+    if (A->is_csc == T_is_csc)
+    {
+        GB_OK (GB_dup_worker (&T, A->iso, A, true, atype)) ;
+    }
+    else
+    {
+        GB_OK (GB_transpose_cast (T, atype, T_is_csc, A, false, Werk)) ;
+    }
+
+    // ensure T is sparse or hypersparse
+    if (GB_IS_BITMAP (T) || GB_IS_FULL (T))
+    {
+        GB_OK (GB_convert_any_to_sparse (T, Werk)) ;
+    }
+
+    // if T is iso, the first k entries of each vector are kept, so its
+    // indices must be in order (the transpose may leave them jumbled)
+    if (T->iso)
+    {
+        GB_OK (GB_unjumble (T, Werk)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // get T and determine the number of threads and tasks to use
+    //--------------------------------------------------------------------------
+
+    int64_t tnvec = T->nvec ;
+    int64_t tnz = GB_nnz (T) ;
+    // k can be larger than INT64_MAX; no vector has more than vlen entries
+    const int64_t tk = (int64_t) GB_IMIN (k, (uint64_t) T->vlen) ;
+    int64_t *restrict Tp = T->p ;
+    size_t tsize = atype->size ;
+    bool T_iso = T->iso ;
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+    int nthreads = GB_nthreads (tnz + tnvec, chunk, nthreads_max) ;
+    int ntasks = (nthreads == 1) ? 1 : (32 * nthreads) ;
+    ntasks = (int) GB_IMIN (ntasks, tnvec) ;
+    ntasks = GB_IMAX (ntasks, 1) ;
+
+    GB_WERK_PUSH (C_slice, ntasks + 1, int64_t) ;
+    if (C_slice == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+    GB_pslice (C_slice, Tp, tnvec, ntasks, false) ;
+
+    //--------------------------------------------------------------------------
+    // count the entries in each vector of the result
+    //--------------------------------------------------------------------------
+
+    Tp_new = GB_MALLOC (T->plen + 1, int64_t, &Tp_new_size) ;
+    if (Tp_new == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    int64_t kk ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (kk = 0 ; kk < tnvec ; kk++)
+    {
+        Tp_new [kk] = GB_IMIN (Tp [kk+1] - Tp [kk], tk) ;
+    }
+    GB_cumsum (Tp_new, tnvec, &(T->nvec_nonempty), nthreads, Werk) ;
+    int64_t tnz_new = Tp_new [tnvec] ;
+
+    //--------------------------------------------------------------------------
+    // partially sort each vector of T that has more than k entries
+    //--------------------------------------------------------------------------
+
+    // If T is iso, all entries have the same value, and the ties are broken
+    // by the index, so the first k entries of each vector are kept.
+
+    if (tnz_new < tnz && !T_iso)
+    {
+
+        GB_BURBLE_MATRIX (T, "(topk select) ") ;
+
+        GB_Opcode opcode = op->opcode ;
+        GB_Type_code acode = atype->code ;
+
+        if ((op->xtype == atype) && (op->ytype == atype) &&
+            (opcode == GB_LT_binop_code || opcode == GB_GT_binop_code) &&
+            (acode < GB_UDT_code))
+        {
+
+            //------------------------------------------------------------------
+            // no typecasting, using built-in < or > operators, builtin types
+            //------------------------------------------------------------------
+
+            #define GB_TOPK_WORKER(order,type)                              \
+                GB(topk_matrix_ ## order ## _ ## type) (T, tk,              \
+                    C_slice, ntasks, nthreads) ;                            \
+                break ;
+
+            if (opcode == GB_LT_binop_code)
+            {
+                // select the k smallest entries
+                switch (acode)
+                {
+                    case GB_BOOL_code   : GB_TOPK_WORKER (ascend, BOOL  )
+                    case GB_INT8_code   : GB_TOPK_WORKER (ascend, INT8  )
+                    case GB_INT16_code  : GB_TOPK_WORKER (ascend, INT16 )
+                    case GB_INT32_code  : GB_TOPK_WORKER (ascend, INT32 )
+                    case GB_INT64_code  : GB_TOPK_WORKER (ascend, INT64 )
+                    case GB_UINT8_code  : GB_TOPK_WORKER (ascend, UINT8 )
+                    case GB_UINT16_code : GB_TOPK_WORKER (ascend, UINT16)
+                    case GB_UINT32_code : GB_TOPK_WORKER (ascend, UINT32)
+                    case GB_UINT64_code : GB_TOPK_WORKER (ascend, UINT64)
+                    case GB_FP32_code   : GB_TOPK_WORKER (ascend, FP32  )
+                    case GB_FP64_code   : GB_TOPK_WORKER (ascend, FP64  )
+                    default:;
+                }
+            }
+            else // opcode == GB_GT_binop_code
+            {
+                // select the k largest entries
+                switch (acode)
+                {
+                    case GB_BOOL_code   : GB_TOPK_WORKER (descend, BOOL  )
+                    case GB_INT8_code   : GB_TOPK_WORKER (descend, INT8  )
+                    case GB_INT16_code  : GB_TOPK_WORKER (descend, INT16 )
+                    case GB_INT32_code  : GB_TOPK_WORKER (descend, INT32 )
+                    case GB_INT64_code  : GB_TOPK_WORKER (descend, INT64 )
+                    case GB_UINT8_code  : GB_TOPK_WORKER (descend, UINT8 )
+                    case GB_UINT16_code : GB_TOPK_WORKER (descend, UINT16)
+                    case GB_UINT32_code : GB_TOPK_WORKER (descend, UINT32)
+                    case GB_UINT64_code : GB_TOPK_WORKER (descend, UINT64)
+                    case GB_FP32_code   : GB_TOPK_WORKER (descend, FP32  )
+                    case GB_FP64_code   : GB_TOPK_WORKER (descend, FP64  )
+                    default:;
+                }
+            }
+        }
+        else
+        {
+
+            //------------------------------------------------------------------
+            // typecasting, user-defined types, or unconventional operators
+            //------------------------------------------------------------------
+
+            GB(topk_matrix_UDT) (T, tk, C_slice, ntasks, nthreads,
+                op) ;
+        }
+
+        // the first k entries of each vector are no longer in order
+        T->jumbled = true ;
+    }
+
+    //--------------------------------------------------------------------------
+    // keep the first k entries of each vector of T
+    //--------------------------------------------------------------------------
+
+    if (tnz_new < tnz)
+    {
+        Ti_new = GB_MALLOC (GB_IMAX (tnz_new, 1), int64_t, &Ti_new_size) ;
+        if (!T_iso)
+        {
+            Tx_new = GB_MALLOC (GB_IMAX (tnz_new, 1) * tsize, GB_void,
+                &Tx_new_size) ;
+        }
+        if (Ti_new == NULL || (!T_iso && Tx_new == NULL))
+        {
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+
+        const int64_t *restrict Ti = T->i ;
+        const GB_void *restrict Tx = (GB_void *) T->x ;
+        int tid ;
+        #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+        for (tid = 0 ; tid < ntasks ; tid++)
+        {
+            for (int64_t j = C_slice [tid] ; j < C_slice [tid+1] ; j++)
+            {
+                int64_t pT = Tp [j] ;
+                int64_t pT_new = Tp_new [j] ;
+                int64_t tknz = Tp_new [j+1] - pT_new ;
+                memcpy (Ti_new + pT_new, Ti + pT, tknz * sizeof (int64_t)) ;
+                if (!T_iso)
+                {
+                    memcpy (Tx_new + pT_new * tsize, Tx + pT * tsize,
+                        tknz * tsize) ;
+                }
+            }
+        }
+
+        // replace the content of T with the selected entries
+        GB_FREE (&(T->i), T->i_size) ;
+        T->i = Ti_new ; T->i_size = Ti_new_size ; Ti_new = NULL ;
+        if (!T_iso)
+        {
+            GB_FREE (&(T->x), T->x_size) ;
+            T->x = Tx_new ; T->x_size = Tx_new_size ; Tx_new = NULL ;
+        }
+    }
+
+    GB_FREE (&(T->p), T->p_size) ;
+    T->p = Tp_new ; T->p_size = Tp_new_size ; Tp_new = NULL ;
+    T->nvals = tnz_new ;
+    ASSERT_MATRIX_OK (T, "T = topk select (A)", GB0) ;
+
+    //--------------------------------------------------------------------------
+    // transplant T into C, free workspace, and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_WORKSPACE ;
+    GB_OK (GB_transplant_conform (C, C->type, &T, Werk)) ;
+    ASSERT_MATRIX_OK (C, "C output of GB_select_topk", GB0) ;
+    return (GrB_SUCCESS) ;
+}
+
@@ -12,10 +12,11 @@
 // matrix for GxB_*resize using GrB_ROWLE, and extracts the diagonal entries
 // for GB_Vector_diag.
 
-// For GB_resize (using GrB_ROWLE) and GB_wait (using GxB_NONZOMBIE), C may be
-// NULL.  In this case, A is always sparse or hypersparse.  If C is NULL on
-// input, A is modified in-place.  Otherwise, C is an uninitialized static
-// header.
+// For GB_resize (using GrB_ROWLE), GB_wait (using GxB_NONZOMBIE), and
+// GB_select (for C=select(C) with no mask or accum), C may be NULL.  In this
+// case, A is always sparse or hypersparse, and the op is not a column
+// selector nor a value selector with an iso A.  If C is NULL on input, A is
+// modified in-place.  Otherwise, C is an uninitialized static header.
 
 // TODO: GB_selector does not exploit the mask.
 
@@ -48,7 +49,9 @@ GrB_Info GB_selector
     ASSERT (GB_IMPLIES (GB_OPCODE_IS_POSITIONAL (opcode), !GB_JUMBLED (A))) ;
     ASSERT (C == NULL || (C != NULL && (C->static_header || GBNSTATIC))) ;
 
-    bool in_place_A = (C == NULL) ; // GrB_wait and GB_resize only
+    bool in_place_A = (C == NULL) ; // GrB_wait, GB_resize, and GB_select
+    ASSERT (GB_IMPLIES (in_place_A, GB_IS_SPARSE (A) || GB_IS_HYPERSPARSE (A)));
+    ASSERT (GB_IMPLIES (in_place_A, !A->i_shallow && !A->x_shallow)) ;
     const bool A_iso = A->iso ;
 
     //--------------------------------------------------------------------------
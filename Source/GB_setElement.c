@@ -94,6 +94,9 @@ GrB_Info GB_setElement              // set a single entry, C(row,col) = scalar
     ASSERT (GB_PENDING_OK (C)) ;
     ASSERT (GB_ZOMBIES_OK (C)) ;
 
+    // C is about to be modified, so its cached transpose is no longer valid
+    GB_transpose_cache_free (C) ;
+
     //--------------------------------------------------------------------------
     // sort C if needed; do not assemble pending tuples or kill zombies yet
     //--------------------------------------------------------------------------
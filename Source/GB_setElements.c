@@ -0,0 +1,515 @@
+//------------------------------------------------------------------------------
+// GB_setElements: C(I(k),J(k)) = X(k) or += X(k), for k = 0:n-1
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Sets a batch of n entries in C, with the same result as calling
+// GB_setElement once for each tuple (I(k),J(k),X(k)), in order for k = 0 to
+// n-1, typecasting from the type of X to the type of C, as needed.  Not
+// user-callable; does the work for GxB_Matrix_setElements_*.
+
+// Entries already present in C (including zombies, and all entries of a
+// bitmap or full matrix) are updated in place, in parallel.  If the same entry
+// appears more than once in (I,J), then the last one is used if accum is NULL.
+// Otherwise, all of them are accumulated into C(i,j) with the accum operator,
+// in order.
+
+// The remaining tuples are sorted and then appended to the pending tuples of C
+// as a single sorted block, so that GB_wait can skip the sort in GB_builder
+// if the prior pending tuples (if any) were also sorted.
+
+#include "GB_Pending.h"
+#include "GB_sort.h"
+
+#define GB_FREE_WORKSPACE                   \
+{                                           \
+    GB_FREE_WORK (&Pos, Pos_size) ;         \
+    GB_FREE_WORK (&K, K_size) ;             \
+    GB_FREE_WORK (&Wi, Wi_size) ;           \
+    GB_FREE_WORK (&Wj, Wj_size) ;           \
+}
+
+#define GB_FREE_ALL GB_FREE_WORKSPACE
+
+GrB_Info GB_setElements             // C(I(k),J(k)) = X(k), for k = 0:n-1
+(
+    GrB_Matrix C,                   // matrix to modify
+    const GrB_BinaryOp accum,       // if NULL: C(i,j) = x
+                                    // else: C(i,j) += x
+    const GrB_Index *I,             // row indices
+    const GrB_Index *J,             // column indices
+    const void *X,                  // values, of type scalar_code
+    const GrB_Index n,              // number of tuples
+    const GB_Type_code scalar_code, // type of X
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    int64_t *restrict Pos = NULL ; size_t Pos_size = 0 ;
+    int64_t *restrict K   = NULL ; size_t K_size   = 0 ;
+    int64_t *restrict Wi  = NULL ; size_t Wi_size  = 0 ;
+    int64_t *restrict Wj  = NULL ; size_t Wj_size  = 0 ;
+
+    ASSERT (C != NULL) ;
+    GB_RETURN_IF_NULL (I) ;
+    GB_RETURN_IF_NULL (J) ;
+    GB_RETURN_IF_NULL (X) ;
+
+    if (n > GB_NMAX)
+    {
+        GB_ERROR (GrB_INVALID_VALUE, "Problem too large: n " GBu
+            " exceeds " GBu, n, GB_NMAX) ;
+    }
+
+    ASSERT (scalar_code <= GB_UDT_code) ;
+
+    GrB_Type ctype = C->type ;
+    GB_Type_code ccode = ctype->code ;
+
+    // scalar_code and C must be compatible
+    if (!GB_code_compatible (scalar_code, ccode))
+    {
+        GB_ERROR (GrB_DOMAIN_MISMATCH,
+            "Input values of type [%s]\n"
+            "cannot be typecast to entries of type [%s]",
+            GB_code_string (scalar_code), ctype->name) ;
+    }
+
+    if (accum != NULL)
+    {
+        // C and X must be compatible with the accum operator
+        GB_RETURN_IF_FAULTY_OR_POSITIONAL (accum) ;
+        GB_OK (GB_BinaryOp_compatible (accum, ctype, ctype, NULL, scalar_code,
+            Werk)) ;
+    }
+
+    // C is about to be modified, so its cached transpose is no longer valid
+    GB_transpose_cache_free (C) ;
+
+    //--------------------------------------------------------------------------
+    // determine the number of threads to use
+    //--------------------------------------------------------------------------
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+    int nthreads = GB_nthreads (n, chunk, nthreads_max) ;
+
+    //--------------------------------------------------------------------------
+    // check the indices
+    //--------------------------------------------------------------------------
+
+    const GrB_Index nrows = GB_NROWS (C) ;
+    const GrB_Index ncols = GB_NCOLS (C) ;
+    int64_t k ;
+    bool indices_ok = true ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static) \
+        reduction(&&:indices_ok)
+    for (k = 0 ; k < n ; k++)
+    {
+        indices_ok = indices_ok && (I [k] < nrows) && (J [k] < ncols) ;
+    }
+
+    if (!indices_ok)
+    {
+        // find the first invalid index, for the error message
+        for (k = 0 ; k < n ; k++)
+        {
+            if (I [k] >= nrows)
+            {
+                GB_ERROR (GrB_INVALID_INDEX,
+                    "Row index " GBu " out of range; must be < " GBd,
+                    I [k], nrows) ;
+            }
+            if (J [k] >= ncols)
+            {
+                GB_ERROR (GrB_INVALID_INDEX,
+                    "Column index " GBu " out of range; must be < " GBd,
+                    J [k], ncols) ;
+            }
+        }
+    }
+
+    if (n == 0)
+    {
+        // quick return
+        return (GrB_SUCCESS) ;
+    }
+
+    // pending tuples and zombies are expected, and C might be jumbled too
+    ASSERT (GB_JUMBLED_OK (C)) ;
+    ASSERT (GB_PENDING_OK (C)) ;
+    ASSERT (GB_ZOMBIES_OK (C)) ;
+
+    //--------------------------------------------------------------------------
+    // sort C if needed; do not assemble pending tuples or kill zombies yet
+    //--------------------------------------------------------------------------
+
+    if (C->jumbled)
+    {
+        GB_OK (GB_wait (C, "C (setElements:jumbled)", Werk)) ;
+    }
+
+    ASSERT (!GB_JUMBLED (C)) ;
+
+    //--------------------------------------------------------------------------
+    // check if C needs to convert to non-iso, or if C is a new iso matrix
+    //--------------------------------------------------------------------------
+
+    // stype is the type of the values X
+    GrB_Type stype = GB_code_type (scalar_code, ctype) ;
+    size_t csize = ctype->size ;
+    size_t xsize = stype->size ;
+    const GB_void *restrict Xv = (GB_void *) X ;
+
+    if (C->iso || (GB_nnz (C) == 0 && !GB_IS_FULL (C) && C->Pending == NULL
+        && accum == NULL))
+    {
+
+        //----------------------------------------------------------------------
+        // check if all of X, typecasted to ctype, is equal to the iso value
+        //----------------------------------------------------------------------
+
+        // the iso value is C->x if C is already iso, or X [0] otherwise
+        GB_void cscalar [GB_VLA(csize)] ;
+        if (C->iso)
+        {
+            memcpy (cscalar, C->x, csize) ;
+        }
+        else
+        {
+            GB_cast_scalar (cscalar, ccode, Xv, scalar_code, csize) ;
+        }
+
+        bool all_same = (accum == NULL) ;
+        if (all_same)
+        {
+            #pragma omp parallel for num_threads(nthreads) schedule(static) \
+                reduction(&&:all_same)
+            for (k = 0 ; k < n ; k++)
+            {
+                if (all_same)
+                {
+                    GB_void s [GB_VLA(csize)] ;
+                    GB_cast_scalar (s, ccode, Xv + k*xsize, scalar_code, csize);
+                    all_same = (memcmp (cscalar, s, csize) == 0) ;
+                }
+            }
+        }
+
+        if (C->iso && !all_same)
+        {
+            // Some new entry differs from the iso value of C.  Assemble all
+            // pending tuples and convert C to non-iso.  Zombies are OK.
+            if (C->Pending != NULL)
+            {
+                GB_OK (GB_wait (C, "C (setElements:to non-iso)", Werk)) ;
+            }
+            GB_OK (GB_convert_any_to_non_iso (C, true)) ;
+        }
+        else if (!C->iso && all_same)
+        {
+            // C is empty and all new entries are the same: convert C to iso
+            GB_OK (GB_convert_any_to_iso (C, cscalar)) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // find each entry in C
+    //--------------------------------------------------------------------------
+
+    // Pos [k] is the position of the kth tuple in C, or -1 if not present.
+
+    Pos = GB_MALLOC_WORK (n, int64_t, &Pos_size) ;
+    K   = GB_MALLOC_WORK (n, int64_t, &K_size) ;
+    if (Pos == NULL || K == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    const bool C_is_csc = C->is_csc ;
+    int64_t nfound = 0 ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static) \
+        reduction(+:nfound)
+    for (k = 0 ; k < n ; k++)
+    {
+        int64_t i = (C_is_csc) ? I [k] : J [k] ;
+        int64_t j = (C_is_csc) ? J [k] : I [k] ;
+        int64_t p = GB_Element_find (C, i, j) ;
+        Pos [k] = p ;
+        K [k] = k ;
+        nfound += (p >= 0) ;
+    }
+
+    int64_t nnew = n - nfound ;
+
+    //--------------------------------------------------------------------------
+    // check for wait
+    //--------------------------------------------------------------------------
+
+    if (nnew > 0 && C->Pending != NULL &&
+        (stype != C->Pending->type || !(accum == C->Pending->op ||
+        (GB_op_is_second (accum, ctype) &&
+         GB_op_is_second (C->Pending->op, ctype)))))
+    {
+        // The new pending tuples are not compatible with the prior pending
+        // tuples (see GB_setElement), so these must be assembled first.  The
+        // positions of the entries in C have changed, so start over.  There
+        // are no longer any pending tuples, so this recursion will only happen
+        // once.
+        GB_FREE_WORKSPACE ;
+        GB_OK (GB_wait (C, "C (setElements:incompatible pending tuples)",
+            Werk)) ;
+        return (GB_setElements (C, accum, I, J, X, n, scalar_code, Werk)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // sort the tuples by their position in C
+    //--------------------------------------------------------------------------
+
+    // The sort is stable since K is unique.  The nnew tuples not in C come
+    // first, in their original order, followed by the nfound entries in C,
+    // sorted by their position in C.
+
+    GB_OK (GB_msort_2 (Pos, K, n, nthreads)) ;
+
+    //--------------------------------------------------------------------------
+    // update the entries already in C, in place
+    //--------------------------------------------------------------------------
+
+    if (nfound > 0)
+    {
+
+        int64_t *restrict Ci = C->i ;
+        int8_t  *restrict Cb = C->b ;
+        GB_void *restrict Cx = (GB_void *) C->x ;
+        const bool C_iso = C->iso ;
+        GB_cast_function cast_X_to_C = GB_cast_factory (ccode, scalar_code) ;
+        GxB_binary_function faccum = NULL ;
+        GB_cast_function cast_C_to_X = NULL, cast_Z_to_Y = NULL,
+            cast_Z_to_C = NULL ;
+        size_t accum_xsize = 0, accum_ysize = 0, accum_zsize = 0 ;
+        if (accum != NULL)
+        {
+            faccum = accum->binop_function ;
+            cast_C_to_X = GB_cast_factory (accum->xtype->code, ccode) ;
+            cast_Z_to_Y = GB_cast_factory (accum->ytype->code, scalar_code) ;
+            cast_Z_to_C = GB_cast_factory (ccode, accum->ztype->code) ;
+            accum_xsize = accum->xtype->size ;
+            accum_ysize = accum->ytype->size ;
+            accum_zsize = accum->ztype->size ;
+        }
+
+        // Each task handles a range of the sorted tuples, adjusted so that all
+        // tuples for the same entry in C are handled by a single task.
+        int nthreads2 = GB_nthreads (nfound, chunk, nthreads_max) ;
+        int64_t nrevived = 0, nbitmap = 0 ;
+        int tid ;
+        #pragma omp parallel for num_threads(nthreads2) schedule(static) \
+            reduction(+:nrevived,nbitmap)
+        for (tid = 0 ; tid < nthreads2 ; tid++)
+        {
+            int64_t rstart, rend ;
+            GB_PARTITION (rstart, rend, nfound, tid, nthreads2) ;
+            rstart += nnew ;
+            rend   += nnew ;
+            // skip any tuples for the entry owned by the prior task
+            while (rstart < rend && rstart > nnew &&
+                Pos [rstart] == Pos [rstart-1])
+            {
+                rstart++ ;
+            }
+            int64_t r = rstart ;
+            while (r < rend)
+            {
+                // find all tuples r1:r2-1 for the entry C(i,j) at position p
+                int64_t p = Pos [r] ;
+                int64_t r1 = r, r2 = r+1 ;
+                while (r2 < n && Pos [r2] == p)
+                {
+                    r2++ ;
+                }
+                r = r2 ;
+
+                // determine if C(i,j) is present, and bring it to life if a
+                // zombie, or set it in the bitmap
+                bool present = true ;
+                if (Ci != NULL)
+                {
+                    int64_t i = Ci [p] ;
+                    if (GB_IS_ZOMBIE (i))
+                    {
+                        // bring the zombie back to life
+                        Ci [p] = GB_FLIP (i) ;
+                        nrevived++ ;
+                        present = false ;
+                    }
+                }
+                else if (Cb != NULL && Cb [p] == 0)
+                {
+                    // set the entry in the C bitmap
+                    Cb [p] = 1 ;
+                    nbitmap++ ;
+                    present = false ;
+                }
+
+                if (C_iso) continue ;
+
+                // set or accumulate the values
+                GB_void *cx = Cx + p*csize ;
+                if (accum == NULL)
+                {
+                    // C(i,j) = (ctype) X [k], for the last tuple k
+                    cast_X_to_C (cx, Xv + K [r2-1]*xsize, csize) ;
+                }
+                else
+                {
+                    if (!present)
+                    {
+                        // C(i,j) = (ctype) X [k], for the first tuple k
+                        cast_X_to_C (cx, Xv + K [r1]*xsize, csize) ;
+                        r1++ ;
+                    }
+                    GB_void xaccum [GB_VLA(accum_xsize)] ;
+                    GB_void yaccum [GB_VLA(accum_ysize)] ;
+                    GB_void zaccum [GB_VLA(accum_zsize)] ;
+                    for (int64_t t = r1 ; t < r2 ; t++)
+                    {
+                        // C(i,j) += X [k]
+                        cast_C_to_X (xaccum, cx, csize) ;
+                        cast_Z_to_Y (yaccum, Xv + K [t]*xsize, accum_ysize) ;
+                        faccum (zaccum, xaccum, yaccum) ;
+                        cast_Z_to_C (cx, zaccum, csize) ;
+                    }
+                }
+            }
+        }
+
+        C->nzombies -= nrevived ;
+        if (Cb != NULL)
+        {
+            C->nvals += nbitmap ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // append the remaining tuples to the pending tuples, as one sorted block
+    //--------------------------------------------------------------------------
+
+    if (nnew > 0)
+    {
+
+        ASSERT (GB_IS_SPARSE (C) || GB_IS_HYPERSPARSE (C)) ;
+
+        //----------------------------------------------------------------------
+        // sort the new tuples by (j,i,k)
+        //----------------------------------------------------------------------
+
+        Wi = GB_MALLOC_WORK (nnew, int64_t, &Wi_size) ;
+        Wj = GB_MALLOC_WORK (nnew, int64_t, &Wj_size) ;
+        if (Wi == NULL || Wj == NULL)
+        {
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+
+        int nthreads3 = GB_nthreads (nnew, chunk, nthreads_max) ;
+        int64_t r ;
+        #pragma omp parallel for num_threads(nthreads3) schedule(static)
+        for (r = 0 ; r < nnew ; r++)
+        {
+            int64_t kr = K [r] ;
+            Wi [r] = (C_is_csc) ? I [kr] : J [kr] ;
+            Wj [r] = (C_is_csc) ? J [kr] : I [kr] ;
+        }
+
+        // K [0:nnew-1] is unique, so duplicate entries (i,j) remain in their
+        // original order, as required by the accum operator, or so that the
+        // last one is kept if accum is NULL.
+        GB_OK (GB_msort_3 (Wj, Wi, K, nnew, nthreads3)) ;
+
+        //----------------------------------------------------------------------
+        // ensure the list of pending tuples is large enough
+        //----------------------------------------------------------------------
+
+        bool is_matrix = (C->vdim > 1) ;
+        if (!GB_Pending_ensure (&(C->Pending), C->iso, stype, accum,
+            is_matrix, nnew, Werk))
+        {
+            // out of memory
+            GB_FREE_ALL ;
+            GB_phybix_free (C) ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+
+        GB_Pending Pending = C->Pending ;
+        int64_t npending = Pending->n ;
+        ASSERT (Pending->type == stype) ;
+        ASSERT (Pending->nmax >= npending + nnew) ;
+        ASSERT ((is_matrix) == (Pending->j != NULL)) ;
+
+        //----------------------------------------------------------------------
+        // keep track of whether or not the pending tuples are still sorted
+        //----------------------------------------------------------------------
+
+        int64_t *restrict Pending_i = Pending->i + npending ;
+        int64_t *restrict Pending_j = (is_matrix) ?
+            (Pending->j + npending) : NULL ;
+        GB_void *restrict Pending_x = (Pending->x == NULL) ? NULL :
+            (Pending->x + npending * xsize) ;
+
+        if (npending > 0 && Pending->sorted)
+        {
+            // the new block is sorted; compare its first tuple with the last
+            // prior pending tuple
+            int64_t ilast = Pending->i [npending-1] ;
+            int64_t jlast = (is_matrix) ? Pending->j [npending-1] : 0 ;
+            Pending->sorted = (jlast < Wj [0]) ||
+                (jlast == Wj [0] && ilast <= Wi [0]) ;
+        }
+
+        //----------------------------------------------------------------------
+        // append the new tuples
+        //----------------------------------------------------------------------
+
+        #pragma omp parallel for num_threads(nthreads3) schedule(static)
+        for (r = 0 ; r < nnew ; r++)
+        {
+            Pending_i [r] = Wi [r] ;
+            if (Pending_j != NULL)
+            {
+                Pending_j [r] = Wj [r] ;
+            }
+            if (Pending_x != NULL)
+            {
+                memcpy (Pending_x + r*xsize, Xv + K [r]*xsize, xsize) ;
+            }
+        }
+        Pending->n += nnew ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_WORKSPACE ;
+    ASSERT_MATRIX_OK (C, "C after setElements", GB0) ;
+    if (nnew > 0)
+    {
+        // block if too many pending tuples
+        return (GB_block (C, Werk)) ;
+    }
+    return (GrB_SUCCESS) ;
+}
+
@@ -227,6 +227,10 @@ GrB_Info GB_sort
     ASSERT_MATRIX_OK (A, "A for GB_sort", GB0) ;
     ASSERT_BINARYOP_OK (op, "op for GB_sort", GB0) ;
 
+    // C and P are about to be modified, so their cached transposes are stale
+    GB_transpose_cache_free (C) ;
+    GB_transpose_cache_free (P) ;
+
     GrB_Matrix T = NULL ;
     struct GB_Matrix_opaque T_header ;
     GB_WERK_DECLARE (C_ek_slicing, int64_t) ;
@@ -346,6 +350,13 @@ GrB_Info GB_sort
         GB_OK (GB_convert_any_to_sparse (C, Werk)) ;
     }
 
+    // an iso C is not sorted, since all its values are tied, so its indices
+    // must be in order (the transpose may leave them jumbled)
+    if (C->iso)
+    { 
+        GB_OK (GB_unjumble (C, Werk)) ;
+    }
+
     //--------------------------------------------------------------------------
     // sort C in place
     //--------------------------------------------------------------------------
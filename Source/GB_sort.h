@@ -19,13 +19,8 @@
 
 #define GB_BASECASE (64 * 1024)
 
-void GB_qsort_1b    // sort array A of size 2-by-n, using 1 key (A [0][])
-(
-    int64_t *restrict A_0,      // size n array
-    GB_void *restrict A_1,      // size n array
-    const size_t xsize,         // size of entries in A_1
-    const int64_t n
-) ;
+// See GB_callbacks.h:
+// GB_CALLBACK_QSORT_1B_PROTO (GB_qsort_1b) ;
 
 void GB_qsort_1b_size1  // GB_qsort_1b with A1 with sizeof = 1
 (
@@ -104,6 +99,39 @@ GrB_Info GB_msort_3    // sort array A of size 3-by-n, using 3 keys (A [0:2][])
     int nthreads                // # of threads to use
 ) ;
 
+//------------------------------------------------------------------------------
+// GB_rsort: radix sort of (j,i,k) or (i,k) tuples
+//------------------------------------------------------------------------------
+
+// GB_builder uses GB_rsort in place of GB_msort_* for at least GB_RSORT_MIN
+// tuples, if the (j,i) indices can be packed into a single 64-bit key.
+
+#define GB_RSORT_MIN (64 * 1024)
+#define GB_RSORT_RADIX_BITS 11
+
+// GB_rsort_nbits: # of bits needed to hold the integers 0 to n-1
+static inline int GB_rsort_nbits (int64_t n)
+{
+    int nbits = 0 ;
+    while (nbits < 63 && (((int64_t) 1) << nbits) < n)
+    { 
+        nbits++ ;
+    }
+    return (nbits) ;
+}
+
+GrB_Info GB_rsort       // sort (j,i,k) or (i,k) tuples with a radix sort
+(
+    int64_t *restrict I,        // size n, row indices in range 0:vlen-1
+    int64_t *restrict J,        // size n, col indices in range 0:vdim-1,
+                                // or NULL if the tuples are (i,k)
+    int64_t *restrict K,        // size n, payload, or NULL if not present
+    const int64_t n,
+    const int64_t vlen,
+    const int64_t vdim,
+    int nthreads                // # of threads to use
+) ;
+
 //------------------------------------------------------------------------------
 // GB_lt_1: sorting comparator function, one key
 //------------------------------------------------------------------------------
@@ -220,7 +248,7 @@ static inline GrB_Index GB_rand (uint64_t *seed)
 }
 
 //------------------------------------------------------------------------------
-// matrix sorting (for GxB_Matrix_sort and GxB_Vector_sort)
+// matrix sorting: GxB_Matrix_sort, GxB_Vector_sort, GxB_Matrix_selectTopK
 //------------------------------------------------------------------------------
 
 GrB_Info GB_sort
@@ -235,5 +263,18 @@ GrB_Info GB_sort
     GB_Werk Werk
 ) ;
 
+GrB_Info GB_select_topk
+(
+    // output:
+    GrB_Matrix C,               // output matrix
+    // input:
+    const GrB_BinaryOp op,      // comparator for the selection
+    const GrB_Matrix A,         // input matrix
+    const uint64_t k,           // # of entries to keep in each vector
+    const bool A_transpose,     // false: select from each row,
+                                // true: select from each column
+    GB_Werk Werk
+) ;
+
 #endif
 
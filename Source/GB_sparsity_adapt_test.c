@@ -0,0 +1,119 @@
+//------------------------------------------------------------------------------
+// GB_sparsity_adapt_test: test sparse to/from bitmap, for adaptive sparsity
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// JIT: not needed.  Only one variant possible.
+
+// Used by GB_conform in place of GB_convert_s2b_test and
+// GB_convert_bitmap_to_sparse_test, if A->sparsity_adaptive is true.  Returns
+// true if A should be converted from sparse/hypersparse to bitmap (if
+// to_bitmap is true), or from bitmap to sparse (if to_bitmap is false).
+
+// The work per use of A in each format is estimated by GB_sparsity_adapt_work,
+// from the recent mix of uses of A in its current band (see
+// GB_sparsity_adapt_use) and its current # of entries.  If the other format
+// would save work, the savings are added to A->adapt_regret; otherwise the
+// regret is cleared.  A is converted only once the savings exceed the cost of
+// the conversion itself, which touches the m*n entries of the bitmap and the
+// nnz(A) entries of the sparse format.  The savings are the larger of the
+// regret (the work already lost by not converting A) and the work saved over
+// the next uses of A, if the recent rate of uses continues.  If conversions
+// and operations on A have both been timed, the conversion cost is scaled by
+// the ratio of their measured time per entry.  As a result, a matrix whose
+// density hovers near A->bitmap_switch (such as the frontier of a BFS) is not
+// converted back and forth at each step, unless the conversion pays for
+// itself.
+
+// If no uses of A in its current band have been recorded yet, the default
+// rules are used.  A bitmap is never used if m*n is too large.  The decision
+// is explained in the burble, when A is converted or when it differs from the
+// default rule.
+
+#include "GB.h"
+
+bool GB_sparsity_adapt_test
+(
+    GrB_Matrix A,           // matrix to test
+    const bool to_bitmap    // if true, test sparse to bitmap;
+                            // otherwise test bitmap to sparse
+)
+{
+
+    //--------------------------------------------------------------------------
+    // get the default rule
+    //--------------------------------------------------------------------------
+
+    int64_t anz = GB_nnz (A) ;
+    float bitmap_switch = A->bitmap_switch ;
+    bool convert_default = to_bitmap ?
+        GB_convert_s2b_test (bitmap_switch, anz, A->vlen, A->vdim) :
+        GB_convert_bitmap_to_sparse_test (bitmap_switch, anz, A->vlen,
+            A->vdim) ;
+
+    double nfull = ((double) A->vlen) * ((double) A->vdim) ;
+    int b = GB_sparsity_adapt_band (A) ;
+    double nuses = A->adapt_nuses [b] ;
+    if (nuses <= 0 || (to_bitmap && nfull >= (double) GB_NMAX))
+    { 
+        // no history, or A is too large to be bitmap: use the default rule
+        return (convert_default) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // estimate the work saved per use by the other format
+    //--------------------------------------------------------------------------
+
+    double pull = A->adapt_npulls [b] / nuses ;
+    double probes = A->adapt_nprobes [b] / nuses ;
+    double sparse_work, bitmap_work ;
+    GB_sparsity_adapt_work (&sparse_work, &bitmap_work, A, 1 - pull, probes) ;
+    double saved = to_bitmap ? (sparse_work - bitmap_work) :
+        (bitmap_work - sparse_work) ;
+    A->adapt_regret = (saved > 0) ? (A->adapt_regret + saved) : 0 ;
+
+    //--------------------------------------------------------------------------
+    // compare the regret with the conversion cost
+    //--------------------------------------------------------------------------
+
+    double cost ;
+    if (A->adapt_op_rate > 0 && A->adapt_cvt_rate > 0)
+    { 
+        // use the measured time per entry for conversions and operations
+        cost = (nfull + anz) * (A->adapt_cvt_rate / A->adapt_op_rate) ;
+    }
+    else
+    { 
+        // estimate the cost of the conversion
+        cost = nfull * bitmap_switch + (double) anz ;
+    }
+    double savings = fmax (A->adapt_regret, saved * nuses) ;
+    bool convert = (savings > cost) ;
+
+    //--------------------------------------------------------------------------
+    // explain the decision
+    //--------------------------------------------------------------------------
+
+    const char *from = to_bitmap ? "sparse" : "bitmap" ;
+    const char *to   = to_bitmap ? "bitmap" : "sparse" ;
+    if (convert)
+    { 
+        GBURBLE ("(adaptive: %s to %s, density %g, pull %g, saves %g >"
+            " conversion %g) ", from, to, anz / nfull, pull, savings, cost) ;
+        // the cost of the conversion is paid
+        A->adapt_regret = 0 ;
+    }
+    else if (convert_default)
+    { 
+        GBURBLE ("(adaptive: stay %s, density %g, pull %g, %s saves %g <="
+            " conversion %g) ", from, anz / nfull, pull, to,
+            fmax (savings, 0), cost) ;
+    }
+
+    return (convert) ;
+}
+
@@ -0,0 +1,113 @@
+//------------------------------------------------------------------------------
+// GB_sparsity_adapt_use: record a use of a matrix, for adaptive sparsity
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// JIT: not needed.  Only one variant possible.
+
+// If A->sparsity_adaptive is true, this method records a use of A as an input
+// to an operation.  Nothing is done otherwise.  Two kinds of uses are
+// distinguished:
+
+//  (1) push: all entries of A are scanned (GrB_mxm via saxpy, GrB_eWise*,
+//      GrB_apply, GrB_select, GrB_reduce, and the matrix A in GrB_assign).
+
+//  (2) pull: the entries of A are accessed at random (GrB_mxm via the dot
+//      product, GrB_extract, and the output C of GrB_assign).  The number of
+//      random accesses is estimated by the caller, typically from the size of
+//      the other operands.
+
+// The counts decay, so that they reflect the recent uses of A.  They are kept
+// separately for each band of A (see GB_sparsity_adapt_band).
+// If the time taken by the operation per entry of its inputs is given
+// (rate > 0), the measured time per entry for operations on A is updated as
+// well.
+
+// A is an input to the operation, and several user threads may use the same
+// input matrix at the same time, so each statistic is updated atomically.
+
+#include "GB.h"
+
+//------------------------------------------------------------------------------
+// GB_adapt_update: x = decay * x + y, atomically
+//------------------------------------------------------------------------------
+
+static inline void GB_adapt_update
+(
+    double *x,
+    const double decay,
+    const double y
+)
+{
+    while (true)
+    {
+        double xold, xnew ;
+        GB_ATOMIC_READ
+        xold = (*x) ;
+        xnew = decay * xold + y ;
+        if (GB_ATOMIC_COMPARE_EXCHANGE_64 (x, xold, xnew)) break ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_sparsity_adapt_use
+//------------------------------------------------------------------------------
+
+void GB_sparsity_adapt_use
+(
+    GrB_Matrix A,               // matrix used as an input to an operation
+    const bool pull,            // if true, A is accessed at random
+    const double probes,        // # of random accesses to A, if pull is true
+    const double rate           // seconds per entry of the operation, if known
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    if (A == NULL || !A->sparsity_adaptive || GB_IS_FULL (A))
+    {
+        // nothing to do
+        return ;
+    }
+
+    //--------------------------------------------------------------------------
+    // count the use of A
+    //--------------------------------------------------------------------------
+
+    int b = GB_sparsity_adapt_band (A) ;
+    GB_adapt_update (&(A->adapt_nuses [b]), GB_ADAPT_DECAY, 1) ;
+    GB_adapt_update (&(A->adapt_npulls [b]), GB_ADAPT_DECAY, pull ? 1 : 0) ;
+    GB_adapt_update (&(A->adapt_nprobes [b]), GB_ADAPT_DECAY,
+        pull ? probes : 0) ;
+
+    //--------------------------------------------------------------------------
+    // update the measured time per entry
+    //--------------------------------------------------------------------------
+
+    if (rate > 0)
+    { 
+        double op_rate ;
+        GB_ATOMIC_READ
+        op_rate = A->adapt_op_rate ;
+        if (op_rate == 0)
+        {
+            // first measurement: take it as-is, unless another thread has
+            // just recorded one
+            double zero = 0 ;
+            if (GB_ATOMIC_COMPARE_EXCHANGE_64 (&(A->adapt_op_rate), zero,
+                rate))
+            {
+                return ;
+            }
+        }
+        GB_adapt_update (&(A->adapt_op_rate), GB_ADAPT_DECAY,
+            (1 - GB_ADAPT_DECAY) * rate) ;
+    }
+}
+
@@ -111,6 +111,73 @@ GrB_Info GB_reduce_to_scalar_jit    // z = reduce_to_scalar (A) via the JIT
     int nthreads                // # of threads to use
 ) ;
 
+GrB_Info GB_reduce_each_vector_jit  // Tx [k] = reduce (A(:,k)) via the JIT
+(
+    // output:
+    GB_void *restrict Tx,       // result, of size A->nvec
+    int8_t *restrict Tb,        // Tb [k] = 1 if A(:,k) has any entry
+    // input:
+    const GrB_Monoid monoid,    // monoid to do the reduction
+    const GrB_Matrix A,         // matrix to reduce
+    const int64_t *restrict A_slice,    // how A is sliced
+    int ntasks,                 // # of tasks to use
+    int nthreads                // # of threads to use
+) ;
+
+//------------------------------------------------------------------------------
+// fused select, apply, and reduce each vector
+//------------------------------------------------------------------------------
+
+uint64_t GB_encodify_reduce_select_apply // encode a fused reduce problem
+(
+    // output:
+    GB_jit_encoding *encoding,  // unique encoding of the entire problem,
+                                // except for the suffix
+    char **suffix,              // suffix for user-defined kernel
+    // input:
+    const GB_jit_kcode kcode,   // kernel to encode
+    GrB_Monoid monoid,          // the monoid to enumify
+    GrB_UnaryOp op,             // built-in unary op to apply, or NULL
+    GrB_IndexUnaryOp selectop,  // built-in select op, or NULL
+    GrB_Matrix A                // input matrix to reduce
+) ;
+
+void GB_enumify_reduce_select_apply // enumerate a fused reduce problem
+(
+    // output:
+    uint64_t *fcode,            // unique encoding of the entire problem
+    // input:
+    GrB_Monoid monoid,          // the monoid to enumify
+    GrB_UnaryOp op,             // built-in unary op to apply, or NULL
+    GrB_IndexUnaryOp selectop,  // built-in select op, or NULL
+    GrB_Matrix A                // input matrix to reduce
+) ;
+
+void GB_macrofy_reduce_select_apply // construct macros for a fused reduce
+(
+    FILE *fp,                   // target file to write, already open
+    // input:
+    uint64_t fcode,             // encoded problem
+    GrB_Monoid monoid,          // monoid to macrofy
+    GrB_Type atype              // type of the A matrix to reduce
+) ;
+
+GrB_Info GB_reduce_select_apply_jit // Tx [k] = reduce (op (select (A(:,k))))
+(
+    // output:
+    GB_void *restrict Tx,       // result, of size A->nvec
+    int8_t *restrict Tb,        // Tb [k] = 1 if any entry of A(:,k) is kept
+    // input:
+    const GrB_Monoid monoid,    // monoid to do the reduction
+    const GrB_UnaryOp op,       // built-in unary op to apply, or NULL
+    const GrB_IndexUnaryOp selectop,    // built-in select op, or NULL
+    const GB_void *restrict ythunk,     // thunk, of type selectop->ytype
+    const GrB_Matrix A,         // matrix to reduce
+    const int64_t *restrict A_slice,    // how A is sliced
+    int ntasks,                 // # of tasks to use
+    int nthreads                // # of threads to use
+) ;
+
 //------------------------------------------------------------------------------
 // GrB_eWiseAdd, GrB_eWiseMult, GxB_eWiseUnion
 //------------------------------------------------------------------------------
@@ -376,6 +443,56 @@ GrB_Info GB_colscale_jit      // C=A*D, colscale, via the JIT
     const int A_nthreads
 ) ;
 
+//------------------------------------------------------------------------------
+// fused alpha*A+beta*B
+//------------------------------------------------------------------------------
+
+uint64_t GB_encodify_ewise_axpby    // encode an alpha*A+beta*B problem
+(
+    // output:
+    GB_jit_encoding *encoding,  // unique encoding of the entire problem,
+                                // except for the suffix
+    char **suffix,              // suffix for user-defined kernel
+    // input:
+    const GB_jit_kcode kcode,   // kernel to encode
+    const GrB_Semiring semiring,    // the semiring to enumify
+    const GrB_Matrix A,
+    const GrB_Matrix B
+) ;
+
+void GB_enumify_ewise_axpby         // enumerate an alpha*A+beta*B problem
+(
+    // output:
+    uint64_t *fcode,            // unique encoding of the entire problem
+    // input:
+    GrB_Semiring semiring,      // the semiring to enumify
+    GrB_Matrix A,
+    GrB_Matrix B
+) ;
+
+void GB_macrofy_ewise_axpby         // construct macros for alpha*A+beta*B
+(
+    FILE *fp,                   // target file to write, already open
+    // input:
+    uint64_t fcode,             // encoded problem
+    GrB_Semiring semiring,      // semiring to macrofy
+    GrB_Type atype,             // type of the A matrix
+    GrB_Type btype              // type of the B matrix
+) ;
+
+GrB_Info GB_ewise_axpby_jit         // T = alpha*A+beta*B via the JIT
+(
+    // input/output:
+    GrB_Matrix T,               // T->x computed; same pattern as A and B
+    // input:
+    const GrB_Semiring semiring,    // add monoid and multiply operator
+    const GB_void *alpha_scalar,    // alpha, of type semiring->multiply->xtype
+    const GrB_Matrix A,
+    const GB_void *beta_scalar,     // beta, of type semiring->multiply->xtype
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+
 //------------------------------------------------------------------------------
 // GrB_mxm
 //------------------------------------------------------------------------------
@@ -1157,6 +1274,46 @@ GrB_Info GB_split_bitmap_jit      // split A into a bitmap tile C
     const int C_nthreads
 ) ;
 
+GrB_Info GB_subref_sparse_jit   // C=A(I,J), extract the values, via the JIT
+(
+    // input/output
+    GrB_Matrix C,
+    // input:
+    const GB_task_struct *restrict TaskList,
+    const int ntasks,
+    const int nthreads,
+    const bool post_sort,
+    const int64_t *Mark,
+    const int64_t *Inext,
+    const int64_t nduplicates,
+    const int64_t *restrict Ap_start,
+    const int64_t *restrict Ap_end,
+    const bool need_qsort,
+    const int Ikind,
+    const int64_t nI,
+    const int64_t Icolon [3],
+    const GrB_Matrix A,
+    const GrB_Index *I
+) ;
+
+GrB_Info GB_bitmap_subref_jit   // C=A(I,J), extract the values, via the JIT
+(
+    // input/output
+    GrB_Matrix C,
+    // input:
+    const GrB_Matrix A,
+    const GrB_Index *I,
+    const int64_t nI,
+    const int Ikind,
+    const int64_t Icolon [3],
+    const GrB_Index *J,
+    const int Jkind,
+    const int64_t Jcolon [3],
+    const GB_task_struct *restrict TaskList,
+    const int ntasks,
+    const int nthreads
+) ;
+
 //------------------------------------------------------------------------------
 // builder kernel
 //------------------------------------------------------------------------------
@@ -80,10 +80,14 @@ GrB_Info GB_subassign_05e
     // scalar.
 
     bool C_is_csc = C->is_csc ;
+    bool C_sparsity_adaptive = C->sparsity_adaptive ;
+    bool C_hyper_pin = C->hyper_pin ;
     GB_phybix_free (C) ;
     // set C->iso = true    OK
     GB_OK (GB_dup_worker (&C, true, M, false, C->type)) ;
     C->is_csc = C_is_csc ;
+    C->sparsity_adaptive = C_sparsity_adaptive ;
+    C->hyper_pin = C_hyper_pin ;
     GB_cast_scalar (C->x, C->type->code, scalar, scalar_type->code, scalar_type->size) ;
 
     C->jumbled = M->jumbled ;       // C is jumbled if M is jumbled
@@ -67,6 +67,8 @@ GrB_Info GB_subassign_24    // C = A, copy A into an existing matrix C
     int C_sparsity_control = C->sparsity_control ;
     float C_hyper_switch = C->hyper_switch ;
     float C_bitmap_switch = C->bitmap_switch ;
+    bool C_sparsity_adaptive = C->sparsity_adaptive ;
+    bool C_hyper_pin = C->hyper_pin ;
 
     ASSERT (!GB_ZOMBIES (A)) ;
     ASSERT (GB_JUMBLED_OK (A)) ;
@@ -137,6 +139,8 @@ GrB_Info GB_subassign_24    // C = A, copy A into an existing matrix C
     C->sparsity_control = C_sparsity_control ;
     C->hyper_switch = C_hyper_switch ;
     C->bitmap_switch = C_bitmap_switch ;
+    C->sparsity_adaptive = C_sparsity_adaptive ;
+    C->hyper_pin = C_hyper_pin ;
 
     //--------------------------------------------------------------------------
     // return the result
@@ -96,10 +96,14 @@ GrB_Info GB_subassign_25
     // initialize them.
 
     bool C_is_csc = C->is_csc ;
+    bool C_sparsity_adaptive = C->sparsity_adaptive ;
+    bool C_hyper_pin = C->hyper_pin ;
     GB_phybix_free (C) ;
     // set C->iso = C_iso   OK
     GB_OK (GB_dup_worker (&C, C_iso, M, false, C->type)) ;
     C->is_csc = C_is_csc ;
+    C->sparsity_adaptive = C_sparsity_adaptive ;
+    C->hyper_pin = C_hyper_pin ;
 
     //--------------------------------------------------------------------------
     // C<M> = A for built-in types
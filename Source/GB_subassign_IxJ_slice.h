@@ -15,7 +15,8 @@
 //------------------------------------------------------------------------------
 
 // Slice IxJ for a scalar assignment method (Methods 01, 03, 13, 15, 17, 19),
-// and for bitmap assignments (in GB_bitmap_assign_IxJ_template).
+// for bitmap assignments (in GB_bitmap_assign_IxJ_template), and for the
+// bitmap/full subref (in GB_bitmap_subref_template).
 
 GrB_Info GB_subassign_IxJ_slice
 (
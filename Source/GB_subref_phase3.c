@@ -7,7 +7,7 @@
 
 //------------------------------------------------------------------------------
 
-// JIT: needed.
+// JIT: done.
 
 // This function either frees Cp and Ch, or transplants then into C, as C->p
 // and C->h.  Either way, the caller must not free them.
@@ -15,6 +15,7 @@
 #include "GB_subref.h"
 #include "GB_sort.h"
 #include "GB_unused.h"
+#include "GB_stringify.h"
 
 GrB_Info GB_subref_phase3   // C=A(I,J)
 (
@@ -164,21 +165,108 @@ GrB_Info GB_subref_phase3   // C=A(I,J)
         // non-iso numeric subref
         //----------------------------------------------------------------------
 
-        // TODO: create versions for asize = 1, 2, 4, 8, 16, and other
+        ASSERT (C->type == A->type) ;
+        const size_t asize = A->type->size ;
+        info = GrB_NO_VALUE ;
+
+        #ifndef GBCOMPACT
+        GB_IF_FACTORY_KERNELS_ENABLED
+        { 
+
+            //------------------------------------------------------------------
+            // via the factory kernel
+            //------------------------------------------------------------------
+
+            // C and A have the same type; no typecasting needed
+            switch (asize)
+            {
+                case GB_1BYTE : // uint8, int8, bool, or 1-byte user
+                    #define GB_C_TYPE uint8_t
+                    #define GB_A_TYPE uint8_t
+                    #define GB_QSORT_1B(Ci,Cx,pC,clen)                      \
+                        GB_qsort_1b_size1 (Ci + pC, Cx + pC, clen)
+                    #include "GB_subref_template.c"
+                    info = GrB_SUCCESS ;
+                    break ;
+
+                case GB_2BYTE : // uint16, int16, or 2-byte user
+                    #define GB_C_TYPE uint16_t
+                    #define GB_A_TYPE uint16_t
+                    #define GB_QSORT_1B(Ci,Cx,pC,clen)                      \
+                        GB_qsort_1b_size2 (Ci + pC, Cx + pC, clen)
+                    #include "GB_subref_template.c"
+                    info = GrB_SUCCESS ;
+                    break ;
+
+                case GB_4BYTE : // uint32, int32, float, or 4-byte user
+                    #define GB_C_TYPE uint32_t
+                    #define GB_A_TYPE uint32_t
+                    #define GB_QSORT_1B(Ci,Cx,pC,clen)                      \
+                        GB_qsort_1b_size4 (Ci + pC, Cx + pC, clen)
+                    #include "GB_subref_template.c"
+                    info = GrB_SUCCESS ;
+                    break ;
+
+                case GB_8BYTE : // uint64, int64, double, float complex,
+                                // or 8-byte user
+                    #define GB_C_TYPE uint64_t
+                    #define GB_A_TYPE uint64_t
+                    #define GB_QSORT_1B(Ci,Cx,pC,clen)                      \
+                        GB_qsort_1b_size8 (Ci + pC, Cx + pC, clen)
+                    #include "GB_subref_template.c"
+                    info = GrB_SUCCESS ;
+                    break ;
+
+                case GB_16BYTE : // double complex or 16-byte user
+                    #define GB_C_TYPE GB_blob16
+                    #define GB_A_TYPE GB_blob16
+                    #define GB_QSORT_1B(Ci,Cx,pC,clen)                      \
+                        GB_qsort_1b_size16 (Ci + pC, Cx + pC, clen)
+                    #include "GB_subref_template.c"
+                    info = GrB_SUCCESS ;
+                    break ;
+
+                default:;
+            }
+        }
+        #endif
 
-        ASSERT (C->type = A->type) ;
-        const int64_t asize = A->type->size ;
-        const GB_void *restrict Ax = (GB_void *) A->x ;
-              GB_void *restrict Cx = (GB_void *) C->x ;
+        //----------------------------------------------------------------------
+        // via the JIT or PreJIT kernel
+        //----------------------------------------------------------------------
 
-        // C and A have the same type
-        #define GB_COPY_RANGE(pC,pA,len)                                \
-            memcpy (Cx + (pC)*asize, Ax + (pA)*asize, (len) * asize) ;
-        #define GB_COPY_ENTRY(pC,pA)                                    \
-            memcpy (Cx + (pC)*asize, Ax + (pA)*asize, asize) ;
-        #define GB_CSIZE1 asize
-        #define GB_CSIZE2 asize
-        #include "GB_subref_template.c"
+        if (info == GrB_NO_VALUE)
+        { 
+            info = GB_subref_sparse_jit (C, TaskList, ntasks, nthreads,
+                post_sort, Mark, Inext, nduplicates, Ap_start, Ap_end,
+                need_qsort, Ikind, nI, Icolon, A, I) ;
+        }
+
+        //----------------------------------------------------------------------
+        // via the generic kernel
+        //----------------------------------------------------------------------
+
+        if (info == GrB_NO_VALUE)
+        { 
+            const GB_void *restrict Ax = (GB_void *) A->x ;
+                  GB_void *restrict Cx = (GB_void *) C->x ;
+            // C and A have the same type
+            #define GB_COPY_RANGE(pC,pA,len)                                \
+                memcpy (Cx + (pC)*asize, Ax + (pA)*asize, (len) * asize) ;
+            #define GB_COPY_ENTRY(pC,pA)                                    \
+                memcpy (Cx + (pC)*asize, Ax + (pA)*asize, asize) ;
+            #define GB_CSIZE1 asize
+            #define GB_CSIZE2 asize
+            #include "GB_subref_template.c"
+            info = GrB_SUCCESS ;
+        }
+
+        if (info != GrB_SUCCESS)
+        { 
+            // out of memory, or other error
+            GB_phybix_free (C) ;
+            return (info) ;
+        }
     }
 
     //--------------------------------------------------------------------------
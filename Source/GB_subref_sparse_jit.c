@@ -0,0 +1,71 @@
+//------------------------------------------------------------------------------
+// GB_subref_sparse_jit: C=A(I,J) where C and A are sparse/hypersparse
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB.h"
+#include "GB_stringify.h"
+#include "GB_unop.h"
+
+typedef GB_JIT_KERNEL_SUBREF_SPARSE_PROTO ((*GB_jit_dl_function)) ;
+
+GrB_Info GB_subref_sparse_jit   // C=A(I,J), extract the values, via the JIT
+(
+    // input/output
+    GrB_Matrix C,
+    // input:
+    const GB_task_struct *restrict TaskList,
+    const int ntasks,
+    const int nthreads,
+    const bool post_sort,
+    const int64_t *Mark,
+    const int64_t *Inext,
+    const int64_t nduplicates,
+    const int64_t *restrict Ap_start,
+    const int64_t *restrict Ap_end,
+    const bool need_qsort,
+    const int Ikind,
+    const int64_t nI,
+    const int64_t Icolon [3],
+    const GrB_Matrix A,
+    const GrB_Index *I
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // encodify the problem
+    //--------------------------------------------------------------------------
+
+    // C and A have the same type, so the identity operator is used
+    struct GB_UnaryOp_opaque op_header ;
+    GB_Operator op = GB_unop_identity (C->type, &op_header) ;
+    GB_jit_encoding encoding ;
+    char *suffix ;
+    uint64_t hash = GB_encodify_apply (&encoding, &suffix,
+        GB_JIT_KERNEL_SUBREF_SPARSE, GB_sparsity (C), true, C->type, op,
+        false, A) ;
+
+    //--------------------------------------------------------------------------
+    // get the kernel function pointer, loading or compiling it if needed
+    //--------------------------------------------------------------------------
+
+    void *dl_function ;
+    GrB_Info info = GB_jitifyer_load (&dl_function,
+        GB_jit_apply_family, "subref_sparse",
+        hash, &encoding, suffix, NULL, NULL,
+        op, C->type, A->type, NULL) ;
+    if (info != GrB_SUCCESS) return (info) ;
+
+    //--------------------------------------------------------------------------
+    // call the jit kernel and return result
+    //--------------------------------------------------------------------------
+
+    GB_jit_dl_function GB_jit_kernel = (GB_jit_dl_function) dl_function ;
+    return (GB_jit_kernel (C, TaskList, ntasks, nthreads, post_sort, Mark,
+        Inext, nduplicates, Ap_start, Ap_end, need_qsort, Ikind, nI, Icolon,
+        A, I, &GB_callback)) ;
+}
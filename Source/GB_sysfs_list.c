@@ -0,0 +1,65 @@
+//------------------------------------------------------------------------------
+// GB_sysfs_list: read a list of CPUs or NUMA nodes from a Linux sysfs file
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// JIT: not needed.  Only one variant possible.
+
+// Linux describes sets of CPUs and NUMA nodes in files such as
+// /sys/devices/system/node/online or /sys/devices/system/node/node0/cpulist,
+// with a comma-separated list of ranges, such as "0-7,16-23".  GB_sysfs_list
+// reads the file and sets member [k] true for each k in the list, for k in
+// the range 0 to n-1.  Entries of the list outside that range are ignored.
+// The # of members found is returned, or -1 if the file cannot be read.
+
+#include "GB.h"
+
+int GB_sysfs_list               // return # of members, or -1 if error
+(
+    bool *member,               // size n; member [k] true if k in the list
+    const int n,                // size of member
+    const char *filename        // file to read
+)
+{
+
+    memset (member, 0, n * sizeof (bool)) ;
+    FILE *f = fopen (filename, "r") ;
+    if (f == NULL)
+    {
+        // file not present
+        return (-1) ;
+    }
+
+    bool ok = true ;
+    int lo, hi ;
+    while (fscanf (f, "%d", &lo) == 1)
+    {
+        hi = lo ;
+        int c = fgetc (f) ;
+        if (c == '-')
+        {
+            ok = (fscanf (f, "%d", &hi) == 1) ;
+            c = fgetc (f) ;
+        }
+        ok = ok && (lo >= 0) ;
+        for (int k = lo ; ok && k <= hi && k < n ; k++)
+        {
+            member [k] = true ;
+        }
+        if (!ok || c != ',') break ;
+    }
+    fclose (f) ;
+
+    if (!ok) return (-1) ;
+    int nmembers = 0 ;
+    for (int k = 0 ; k < n ; k++)
+    {
+        nmembers += member [k] ;
+    }
+    return (nmembers) ;
+}
+
@@ -161,6 +161,7 @@ GrB_Info GB_transplant          // transplant one matrix into another
     { 
         // allocate new C->i component
         C->i = GB_MALLOC (anz, int64_t, &(C->i_size)) ;
+        GB_numa_bind (C->i, C->i_size) ;
         ok = ok && (C->i != NULL) ;
     }
 
@@ -136,7 +136,7 @@ GrB_Info GB_transpose           // C=A', C=(ctype)A' or C=op(A')
     //--------------------------------------------------------------------------
 
     int nthreads_max = GB_Context_nthreads_max ( ) ;
-    double chunk = GB_Context_chunk ( ) ;
+    double chunk = GB_Context_chunk_family (GxB_CHUNK_TRANSPOSE) ;
 
     //--------------------------------------------------------------------------
     // determine the type of C and get the unary, idxunop, binary operator
@@ -254,6 +254,41 @@ GrB_Info GB_transpose           // C=A', C=(ctype)A' or C=op(A')
             ctype, avdim, avlen, GB_Ap_calloc, C_is_csc, GxB_HYPERSPARSE,
             true, A_hyper_switch, 1, 1, true, false)) ;
 
+    }
+    else if (!in_place && A->AT != NULL && (op == NULL || C_iso))
+    {
+
+        //----------------------------------------------------------------------
+        // use the cached transpose of A
+        //----------------------------------------------------------------------
+
+        // A->AT is the transpose of A, with the same type as A.  T is a purely
+        // shallow copy of A->AT, typecasted to ctype by GB_transplant below.
+        // If an operator is applied and C is iso (including the ONE operator
+        // used in place of a positional op), only the iso value is computed.
+
+        GBURBLE ("(cached transpose) ") ;
+        ASSERT_MATRIX_OK (A->AT, "A->AT cached transpose", GB0) ;
+        ASSERT (A->AT->vlen == avdim && A->AT->vdim == avlen) ;
+        ASSERT (A->AT->type == atype) ;
+        ASSERT (!GB_ANY_PENDING_WORK (A->AT)) ;
+        GB_OK (GB_shallow_copy (T, C_is_csc, A->AT, Werk)) ;
+        if (op != NULL)
+        { 
+            // T->x = the iso value of op (A), of type ctype
+            T->x = GB_XALLOC (false, true, anz, csize, &(T->x_size)) ; // x:OK
+            T->x_shallow = false ;
+            if (T->x == NULL)
+            { 
+                // out of memory
+                GB_FREE_ALL ;
+                return (GrB_OUT_OF_MEMORY) ;
+            }
+            GB_unop_iso ((GB_void *) T->x, ctype, C_code_iso, op, A, scalar) ;
+            T->type = ctype ;
+            T->iso = true ;     // OK
+        }
+
     }
     else if (A_is_bitmap || GB_IS_FULL (A))
     {
@@ -371,6 +406,7 @@ GrB_Info GB_transpose           // C=A', C=(ctype)A' or C=op(A')
         int64_t tplen = GB_IMAX (1, anz) ;
         T->p = GB_MALLOC (tplen+1, int64_t, &(T->p_size)) ;
         T->i = GB_MALLOC (anz    , int64_t, &(T->i_size)) ;
+        GB_numa_bind (T->i, T->i_size) ;
         bool allocate_Tx = (op != NULL || C_iso) || (ctype != atype) ;
         if (allocate_Tx)
         { 
@@ -505,6 +541,7 @@ GrB_Info GB_transpose           // C=A', C=(ctype)A' or C=op(A')
         { 
             // A is sparse, so new space is needed for T->i
             T->i = GB_MALLOC (anz, int64_t, &(T->i_size)) ;
+            GB_numa_bind (T->i, T->i_size) ;
         }
         bool allocate_Tx = (op != NULL || C_iso) || (ctype != atype) ;
         if (allocate_Tx)
@@ -11,10 +11,30 @@
 #define GB_TRANSPOSE_H
 #include "GB.h"
 
+// The blocked bucket transpose partitions the rows of A' into blocks of
+// 2^GB_TRANSPOSE_BLOCK_SHIFT rows, so that the row counts of each block fit
+// in the L2 cache.  It needs about 3*nnz(A) int64_t's of workspace, and is
+// not used if that exceeds GB_TRANSPOSE_BLOCKED_WORKSPACE bytes.
+
+// The blocked method is not used by default, since no scaling benchmark has
+// yet shown it to be faster than the atomic and non-atomic methods.  If one
+// does, compile with -DGB_TRANSPOSE_BLOCKED_NTHREADS=t, where t is the
+// measured crossover (the # of threads at which the blocked method starts to
+// win), for matrices with at least 2^GB_TRANSPOSE_BLOCKED_LOG entries.
+#define GB_TRANSPOSE_BLOCK_SHIFT 14
+#define GB_TRANSPOSE_BLOCKED_LOG 20
+#ifndef GB_TRANSPOSE_BLOCKED_NTHREADS
+#define GB_TRANSPOSE_BLOCKED_NTHREADS 0
+#endif
+#ifndef GB_TRANSPOSE_BLOCKED_WORKSPACE
+#define GB_TRANSPOSE_BLOCKED_WORKSPACE ((double) (1 << 30))
+#endif
+
 bool GB_transpose_method        // if true: use GB_builder, false: use bucket
 (
     const GrB_Matrix A,         // matrix to transpose
-    int *nworkspaces_bucket,    // # of slices of A for the bucket method
+    int *nworkspaces_bucket,    // # of slices of A for the bucket method,
+                                // or 0 for the blocked bucket method
     int *nthreads_bucket        // # of threads to use for the bucket method
 ) ;
 
@@ -40,6 +60,13 @@ GrB_Info GB_transpose_in_place   // C=A', no change of type, no operators
     GB_Werk Werk
 ) ;
 
+GrB_Info GB_transpose_in_place_full // A=A', for a full or bitmap matrix
+(
+    GrB_Matrix A,               // matrix to transpose in-place
+    const bool A_is_csc,        // desired CSR/CSC format of A
+    GB_Werk Werk
+) ;
+
 GrB_Info GB_transpose_cast      // C= (ctype) A' or one (A'), not in-place
 (
     GrB_Matrix C,               // output matrix C, not in place
@@ -50,6 +77,12 @@ GrB_Info GB_transpose_cast      // C= (ctype) A' or one (A'), not in-place
     GB_Werk Werk
 ) ;
 
+GrB_Info GB_transpose_cache_build   // build A->AT, if requested
+(
+    GrB_Matrix A,                   // matrix to transpose
+    GB_Werk Werk
+) ;
+
 GrB_Info GB_transpose_bucket    // bucket transpose; typecast and apply op
 (
     GrB_Matrix C,               // output matrix (static header)
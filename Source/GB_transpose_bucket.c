@@ -32,8 +32,14 @@
 // hypersparse matrices, or for very sparse matrices, the qsort method should
 // be used instead (see GB_transpose).
 
-// This method is parallel, but not highly scalable.  At most O(e/m) threads
-// are used.
+// The atomic and non-atomic methods are parallel, but not highly scalable.
+// The non-atomic method uses at most O(e/m) threads, and the atomic method
+// can suffer from contention.  The blocked method (selected when nworkspaces
+// is zero) partitions the rows of C into blocks of 2^GB_TRANSPOSE_BLOCK_SHIFT
+// rows each.  The entries of A are first partitioned by block, in parallel
+// with one slice of A per thread.  Then each block is transposed
+// independently, with its row counts in C->p held in the L2 cache.  It takes
+// O(e) workspace, independent of the # of threads, and uses no atomics.
 
 #include "GB_transpose.h"
 
@@ -41,11 +47,14 @@
 {                                                                       \
     if (Workspaces != NULL && Workspaces_size != NULL)                  \
     {                                                                   \
-        for (int tid = 0 ; tid < nworkspaces ; tid++)                   \
+        for (int tid = 0 ; tid < nwork ; tid++)                         \
         {                                                               \
             GB_FREE_WORK (&(Workspaces [tid]), Workspaces_size [tid]) ; \
         }                                                               \
     }                                                                   \
+    GB_FREE_WORK (&Wj, Wj_size) ;                                       \
+    GB_FREE_WORK (&Wp, Wp_size) ;                                       \
+    GB_FREE_WORK (&Counts, Counts_size) ;                               \
     GB_WERK_POP (A_slice, int64_t) ;                                    \
     GB_WERK_POP (Workspaces_size, size_t) ;                             \
     GB_WERK_POP (Workspaces, int64_t *) ;                               \
@@ -97,6 +106,17 @@ GrB_Info GB_transpose_bucket    // bucket transpose; typecast and apply op
     GB_WERK_DECLARE (Workspaces, int64_t *) ;       // size nworkspaces
     GB_WERK_DECLARE (Workspaces_size, size_t) ;     // size nworkspaces
 
+    // workspace for the blocked method
+    int64_t *restrict Wj = NULL ; size_t Wj_size = 0 ;
+    int64_t *restrict Wp = NULL ; size_t Wp_size = 0 ;
+    int64_t *restrict Counts = NULL ; size_t Counts_size = 0 ;
+
+    // The blocked method uses a single workspace: Workspaces [0] is the
+    // permutation P of size anz, where C(j,i) = A(i,j) is in position
+    // pC = Cp [i] + ... of C, and P [pC] is the position pA of A(i,j) in A.
+    const bool blocked = (nworkspaces == 0) ;
+    const int nwork = (blocked) ? 1 : nworkspaces ;
+
     //--------------------------------------------------------------------------
     // get A
     //--------------------------------------------------------------------------
@@ -110,7 +130,7 @@ GrB_Info GB_transpose_bucket    // bucket transpose; typecast and apply op
 
     // # of threads to use in the O(vlen) loops below
     int nthreads_max = GB_Context_nthreads_max ( ) ;
-    double chunk = GB_Context_chunk ( ) ;
+    double chunk = GB_Context_chunk_family (GxB_CHUNK_TRANSPOSE) ;
     int nth = GB_nthreads (vlen, chunk, nthreads_max) ;
 
     //--------------------------------------------------------------------------
@@ -135,8 +155,8 @@ GrB_Info GB_transpose_bucket    // bucket transpose; typecast and apply op
     // allocate workspace
     //--------------------------------------------------------------------------
 
-    GB_WERK_PUSH (Workspaces, nworkspaces, int64_t *) ;
-    GB_WERK_PUSH (Workspaces_size, nworkspaces, size_t) ;
+    GB_WERK_PUSH (Workspaces, nwork, int64_t *) ;
+    GB_WERK_PUSH (Workspaces_size, nwork, size_t) ;
     if (Workspaces == NULL || Workspaces_size == NULL)
     { 
         // out of memory
@@ -145,10 +165,10 @@ GrB_Info GB_transpose_bucket    // bucket transpose; typecast and apply op
     }
 
     bool ok = true ;
-    for (int tid = 0 ; tid < nworkspaces ; tid++)
+    for (int tid = 0 ; tid < nwork ; tid++)
     { 
-        Workspaces [tid] = GB_MALLOC_WORK (vlen + 1, int64_t,
-            &Workspaces_size [tid]) ;
+        Workspaces [tid] = GB_MALLOC_WORK ((blocked) ? anz : (vlen + 1),
+            int64_t, &Workspaces_size [tid]) ;
         ok = ok && (Workspaces [tid] != NULL) ;
     }
 
@@ -174,7 +194,180 @@ GrB_Info GB_transpose_bucket    // bucket transpose; typecast and apply op
     GB_pslice (A_slice, A->p, A->nvec, nthreads, true) ;
 
     // sum up the row counts and find C->p
-    if (nthreads == 1)
+    if (blocked)
+    {
+
+        //----------------------------------------------------------------------
+        // blocked method: A is sliced, and C is transposed one block at a time
+        //----------------------------------------------------------------------
+
+        // Requires O(anz) int64 workspace, and no atomics.  C->p, C->i, and
+        // the permutation P are computed here; the values of C are gathered
+        // from A in phase2.  The resulting C matrix is not jumbled.
+
+        GBURBLE ("(%d-thread blocked bucket transpose) ", nthreads) ;
+
+        const int64_t *restrict Ap = A->p ;
+        const int64_t *restrict Ah = A->h ;
+        const int64_t *restrict Ai = A->i ;
+        int64_t *restrict Ci = C->i ;
+        int64_t *restrict P = Workspaces [0] ;
+
+        //----------------------------------------------------------------------
+        // determine the block size
+        //----------------------------------------------------------------------
+
+        // Each block holds 2^bshift rows of C.  Use smaller blocks if there
+        // are too few to keep all threads busy, but larger ones if the
+        // nthreads-by-nblocks Counts workspace would be too large.
+        int bshift = GB_TRANSPOSE_BLOCK_SHIFT ;
+        while (bshift > 10 && (vlen >> bshift) < 4 * nthreads)
+        { 
+            bshift-- ;
+        }
+        int64_t nblocks = GB_IMAX (1, (vlen + ((int64_t) 1 << bshift) - 1)
+            >> bshift) ;
+        while (nblocks > 1 && (nblocks * nthreads) > anz / 8)
+        { 
+            bshift++ ;
+            nblocks = (vlen + ((int64_t) 1 << bshift) - 1) >> bshift ;
+        }
+
+        //----------------------------------------------------------------------
+        // allocate workspace
+        //----------------------------------------------------------------------
+
+        // Counts [tid*nblocks + b] = # of entries in A_slice [tid] that fall
+        // in block b of C; Bstart [b] is the position of block b in C.  Wj
+        // and Wp hold the column index and position in A of each entry,
+        // partitioned by block.
+        Counts = GB_MALLOC_WORK ((nthreads + 1) * nblocks + 1, int64_t,
+            &Counts_size) ;
+        Wj = GB_MALLOC_WORK (anz, int64_t, &Wj_size) ;
+        Wp = GB_MALLOC_WORK (anz, int64_t, &Wp_size) ;
+        if (Counts == NULL || Wj == NULL || Wp == NULL)
+        { 
+            // out of memory
+            GB_FREE_ALL ;
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        int64_t *restrict Bstart = Counts + nthreads * nblocks ;
+
+        //----------------------------------------------------------------------
+        // count the entries in each block, for each slice of A
+        //----------------------------------------------------------------------
+
+        int tid ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (tid = 0 ; tid < nthreads ; tid++)
+        {
+            int64_t *restrict count = Counts + tid * nblocks ;
+            memset (count, 0, nblocks * sizeof (int64_t)) ;
+            for (int64_t pA = Ap [A_slice [tid]] ; pA < Ap [A_slice [tid+1]] ;
+                pA++)
+            { 
+                count [Ai [pA] >> bshift]++ ;
+            }
+        }
+
+        //----------------------------------------------------------------------
+        // cumulative sum of the Counts, by block and then by slice
+        //----------------------------------------------------------------------
+
+        // Counts [tid*nblocks + b] becomes the position in Wj and Wp of the
+        // first entry of block b from slice tid.
+        int64_t s = 0 ;
+        for (int64_t b = 0 ; b < nblocks ; b++)
+        {
+            Bstart [b] = s ;
+            for (tid = 0 ; tid < nthreads ; tid++)
+            { 
+                int64_t c = Counts [tid * nblocks + b] ;
+                Counts [tid * nblocks + b] = s ;
+                s += c ;
+            }
+        }
+        Bstart [nblocks] = s ;
+        ASSERT (s == anz) ;
+
+        //----------------------------------------------------------------------
+        // partition the entries of A by block
+        //----------------------------------------------------------------------
+
+        // Within each block, the entries are in ascending order of j.
+
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (tid = 0 ; tid < nthreads ; tid++)
+        {
+            int64_t *restrict count = Counts + tid * nblocks ;
+            for (int64_t k = A_slice [tid] ; k < A_slice [tid+1] ; k++)
+            {
+                // iterate over the entries in A(:,j)
+                int64_t j = GBH (Ah, k) ;
+                int64_t pA_start = Ap [k] ;
+                int64_t pA_end = Ap [k+1] ;
+                for (int64_t pA = pA_start ; pA < pA_end ; pA++)
+                { 
+                    int64_t q = count [Ai [pA] >> bshift]++ ;
+                    Wj [q] = j ;
+                    Wp [q] = pA ;
+                }
+            }
+        }
+
+        //----------------------------------------------------------------------
+        // transpose each block
+        //----------------------------------------------------------------------
+
+        int64_t b, nvec_nonempty = 0 ;
+        #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1) \
+            reduction(+:nvec_nonempty)
+        for (b = 0 ; b < nblocks ; b++)
+        {
+            // C(i0:i1-1,:) is block b, in positions pstart:pend-1 of C
+            int64_t i0 = b << bshift ;
+            int64_t i1 = GB_IMIN (vlen, (b+1) << bshift) ;
+            int64_t pstart = Bstart [b] ;
+            int64_t pend = Bstart [b+1] ;
+
+            // count the entries in each row of the block
+            memset (Cp + i0, 0, (i1 - i0) * sizeof (int64_t)) ;
+            for (int64_t q = pstart ; q < pend ; q++)
+            { 
+                Cp [Ai [Wp [q]]]++ ;
+            }
+
+            // cumulative sum of the row counts of the block
+            int64_t s = pstart ;
+            for (int64_t i = i0 ; i < i1 ; i++)
+            { 
+                int64_t c = Cp [i] ;
+                nvec_nonempty += (c > 0) ;
+                Cp [i] = s ;
+                s += c ;
+            }
+
+            // C(i,j) = A(j,i) for all entries in the block
+            for (int64_t q = pstart ; q < pend ; q++)
+            { 
+                int64_t pC = Cp [Ai [Wp [q]]]++ ;
+                Ci [pC] = Wj [q] ;
+                P [pC] = Wp [q] ;
+            }
+
+            // shift Cp back to the start of each row
+            for (int64_t i = i1 - 1 ; i > i0 ; i--)
+            { 
+                Cp [i] = Cp [i-1] ;
+            }
+            Cp [i0] = pstart ;
+        }
+
+        Cp [vlen] = anz ;
+        C->nvec_nonempty = nvec_nonempty ;
+
+    }
+    else if (nthreads == 1)
     {
 
         //----------------------------------------------------------------------
@@ -321,18 +514,20 @@ GrB_Info GB_transpose_bucket    // bucket transpose; typecast and apply op
     // phase2: transpose A into C
     //==========================================================================
 
-    // transpose both the pattern and the values
+    // transpose both the pattern and the values.  For the blocked method, the
+    // pattern of C is already computed, and A_slice is passed as NULL so
+    // that only the values are gathered, via the permutation P.
+    const int64_t *restrict C_slice = (blocked) ? NULL : A_slice ;
     if (op == NULL)
     { 
         // do not apply an operator; optional typecast to C->type
-        GB_OK (GB_transpose_ix (C, A, Workspaces, A_slice, nworkspaces,
-            nthreads)) ;
+        GB_OK (GB_transpose_ix (C, A, Workspaces, C_slice, nwork, nthreads)) ;
     }
     else
     { 
         // apply an operator, C has type op->ztype
         GB_OK (GB_transpose_op (C, C_code_iso, op, scalar, binop_bind1st, A,
-            Workspaces, A_slice, nworkspaces, nthreads)) ;
+            Workspaces, C_slice, nwork, nthreads)) ;
     }
 
     //--------------------------------------------------------------------------
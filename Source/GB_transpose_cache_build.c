@@ -0,0 +1,76 @@
+//------------------------------------------------------------------------------
+// GB_transpose_cache_build: construct the A->AT cached transpose of a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// JIT: not needed.  Only one variant possible.
+
+// If A->transpose_cache is true and A->AT does not yet exist, it is computed
+// as A->AT = A', with the same type and CSR/CSC format as A.  Otherwise, this
+// function does nothing.  Once A->AT exists, GB_transpose uses it for all
+// subsequent transposes of A, until A is modified.
+
+// The caller must ensure that A is not about to be modified in-place by the
+// operation in progress, since A->AT would then become stale.  A is not
+// modified, except to finish any pending work.
+
+#include "GB_transpose.h"
+
+#define GB_FREE_ALL                 \
+{                                   \
+    GB_Matrix_free (&AT) ;          \
+}
+
+GrB_Info GB_transpose_cache_build   // build A->AT, if requested
+(
+    GrB_Matrix A,                   // matrix to transpose
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    GrB_Matrix AT = NULL ;
+    ASSERT_MATRIX_OK (A, "A for transpose cache", GB0) ;
+
+    if (!A->transpose_cache || A->AT != NULL)
+    { 
+        // A->AT is not requested, or already exists
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // finish any pending work
+    //--------------------------------------------------------------------------
+
+    GB_MATRIX_WAIT (A) ;
+
+    //--------------------------------------------------------------------------
+    // AT = A', with the same type and format as A
+    //--------------------------------------------------------------------------
+
+    GBURBLE ("(build transpose cache) ") ;
+    GB_OK (GB_new (&AT, // any sparsity, new header
+        A->type, A->vdim, A->vlen, GB_Ap_null, A->is_csc,
+        GxB_AUTO_SPARSITY, A->hyper_switch, 0)) ;
+    GB_OK (GB_transpose (AT, NULL, A->is_csc, A, NULL, NULL, false, false,
+        Werk)) ;
+
+    // A->AT is shared by shallow copies in GB_transpose, so it must not be
+    // jumbled
+    GB_MATRIX_WAIT (AT) ;
+    ASSERT_MATRIX_OK (AT, "AT cached transpose", GB0) ;
+    ASSERT (!GB_ANY_PENDING_WORK (AT)) ;
+    ASSERT (!GB_is_shallow (AT)) ;
+
+    A->AT = AT ;
+    return (GrB_SUCCESS) ;
+}
+
@@ -0,0 +1,32 @@
+//------------------------------------------------------------------------------
+// GB_transpose_cache_free: free the A->AT cached transpose of a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Free the A->AT cached transpose of a matrix.  This must be done whenever the
+// content of A is modified.  The matrix remains valid since A->AT is rebuilt
+// when it is next needed, via GB_transpose_cache_build, if A->transpose_cache
+// is true.
+
+#include "GB.h"
+
+void GB_transpose_cache_free    // free the A->AT cached transpose of a matrix
+(
+    GrB_Matrix A                // matrix with content to free
+)
+{
+
+    //--------------------------------------------------------------------------
+    // free A->AT
+    //--------------------------------------------------------------------------
+
+    if (A != NULL && A->AT != NULL)
+    { 
+        GB_Matrix_free (&(A->AT)) ;
+    }
+}
+
@@ -10,6 +10,10 @@
 // All other uses of GB_transpose are not in-place.
 // No operator is applied and no typecasting is done.
 
+// If C is full or bitmap, and its content is not shallow, C->x and C->b are
+// permuted in-place by GB_transpose_in_place_full, and no copy of them is
+// made.
+
 #include "GB_transpose.h"
 
 GrB_Info GB_transpose_in_place   // C=A', no change of type, no operators
@@ -19,6 +23,11 @@ GrB_Info GB_transpose_in_place   // C=A', no change of type, no operators
     GB_Werk Werk
 )
 { 
+    if ((GB_IS_FULL (C) || GB_IS_BITMAP (C)) && !C->x_shallow &&
+        !C->b_shallow)
+    { 
+        return (GB_transpose_in_place_full (C, C_is_csc, Werk)) ;
+    }
     return (GB_transpose (C, NULL, C_is_csc, C,
         NULL, NULL, false, false,       // no operator
         Werk)) ;
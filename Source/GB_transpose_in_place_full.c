@@ -0,0 +1,226 @@
+//------------------------------------------------------------------------------
+// GB_transpose_in_place_full: transpose a full or bitmap matrix in-place
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// JIT: not needed.  Only one variant possible.
+
+// A full or bitmap matrix A is transposed in-place: A->x and A->b are
+// permuted where they are, and no second copy of either array is allocated.
+// No operator is applied and no typecasting is done.  A->x and A->b must not
+// be shallow.
+
+// If A is m-by-n (with vlen m and vdim n), A->x and A->b are held as an n-by-m
+// row-major array X, which must be overwritten with its m-by-n row-major
+// transpose.  If X is square, pairs of tiles of X are swapped.  Otherwise X is
+// transposed with the decomposition of Catanzaro, Keller, and Garland (A
+// decomposition for in-place matrix transposition, PPoPP 2014), with
+// g = gcd (m,n) and b = m/g, in three phases:
+
+//  (1) if g > 1, each column c of X is rotated down by c/b rows,
+//  (2) the entries in each row of X are shuffled, and
+//  (3) the entries in each column of X are shuffled.
+
+// Each phase is a set of independent permutations of the rows or columns of
+// X, done in parallel.  The columns are permuted in blocks of w columns at a
+// time, so that X is accessed a cache line at a time.  Each thread uses a
+// workspace of size max(m, n*w) entries, and the total workspace is at most
+// half the size of X (and at most a quarter, if m and n are both 4 or more).
+// The total work is O(mn).
+
+#include "GB_transpose.h"
+
+#define GB_FREE_ALL                         \
+{                                           \
+    GB_FREE_WORK (&W, W_size) ;             \
+}
+
+// tile size for the square case
+#define GB_TILE 64
+
+//------------------------------------------------------------------------------
+// GB_transpose_permute: transpose the nr-by-nc row-major array X in-place
+//------------------------------------------------------------------------------
+
+static void GB_transpose_permute
+(
+    GB_void *X_in,                  // array to transpose, of size nr*nc
+    const size_t asize,             // size of each entry of X
+    const int64_t nr,               // # of rows of X
+    const int64_t nc,               // # of columns of X
+    const int64_t g,                // gcd (nr,nc)
+    const int64_t b,                // nc/g
+    const int64_t w,                // # of columns in each block
+    const int64_t nblocks,          // # of blocks of columns
+    GB_void *W_in,                  // workspace
+    const int nthreads,             // # of threads for the square case
+    const int nthreads_row,         // # of threads for the row shuffle
+    const int nthreads_col          // # of threads for the column shuffles
+)
+{
+    switch (asize)
+    {
+        case GB_1BYTE : // bool, uint8, int8, A->b, and user types of size 1
+        {
+            #define GB_A_TYPE uint8_t
+            #include "GB_transpose_in_place_full_template.c"
+        }
+        break ;
+
+        case GB_2BYTE : // uint16, int16, and user-defined types of size 2
+        {
+            #define GB_A_TYPE uint16_t
+            #include "GB_transpose_in_place_full_template.c"
+        }
+        break ;
+
+        case GB_4BYTE : // uint32, int32, float, and 4-byte user
+        {
+            #define GB_A_TYPE uint32_t
+            #include "GB_transpose_in_place_full_template.c"
+        }
+        break ;
+
+        case GB_8BYTE : // uint64, int64, double, float complex, and 8-byte user
+        {
+            #define GB_A_TYPE uint64_t
+            #include "GB_transpose_in_place_full_template.c"
+        }
+        break ;
+
+        case GB_16BYTE : // double complex, and user-defined types of size 16
+        {
+            #define GB_A_TYPE GB_blob16
+            #include "GB_transpose_in_place_full_template.c"
+        }
+        break ;
+
+        default : // user-defined types of arbitrary size
+        {
+            #define GB_TRANSPOSE_GENERIC
+            #include "GB_transpose_in_place_full_template.c"
+        }
+        break ;
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_transpose_in_place_full
+//------------------------------------------------------------------------------
+
+GrB_Info GB_transpose_in_place_full // A=A', for a full or bitmap matrix
+(
+    GrB_Matrix A,               // matrix to transpose in-place
+    const bool A_is_csc,        // desired CSR/CSC format of A
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    GB_void *W = NULL ; size_t W_size = 0 ;
+
+    ASSERT_MATRIX_OK (A, "A for in-place full transpose", GB0) ;
+    ASSERT (GB_IS_FULL (A) || GB_IS_BITMAP (A)) ;
+    ASSERT (!A->x_shallow && !A->b_shallow) ;
+
+    const bool A_is_bitmap = GB_IS_BITMAP (A) ;
+    GBURBLE ("(in-place %s transpose) ", A_is_bitmap ? "bitmap" : "full") ;
+
+    //--------------------------------------------------------------------------
+    // permute A->x and A->b
+    //--------------------------------------------------------------------------
+
+    // A->x and A->b are held as an nr-by-nc row-major array
+    const int64_t nr = A->vdim ;
+    const int64_t nc = A->vlen ;
+    const bool permute_x = !A->iso ;
+    const size_t asize = permute_x ? A->type->size : 1 ;
+
+    if (nr > 1 && nc > 1 && (permute_x || A_is_bitmap))
+    {
+
+        //----------------------------------------------------------------------
+        // determine the number of threads to use and the size of each block
+        //----------------------------------------------------------------------
+
+        int nthreads_max = GB_Context_nthreads_max ( ) ;
+        double chunk = GB_Context_chunk_family (GxB_CHUNK_TRANSPOSE) ;
+        int nthreads = GB_nthreads (nr * nc, chunk, nthreads_max) ;
+
+        int64_t g = nr, t = nc ;
+        while (t != 0)
+        {
+            int64_t r = g % t ;
+            g = t ;
+            t = r ;
+        }
+        const int64_t b = nc / g ;
+
+        // each block has up to a cache line of each row of X
+        int64_t w = GB_IMAX (1, 64 / asize) ;
+        w = GB_IMAX (1, GB_IMIN (w, nc / (4 * nthreads))) ;
+        const int64_t nblocks = (nc + w - 1) / w ;
+        int nthreads_row = (int) GB_IMIN (nthreads, GB_IMAX (1, nr / 4)) ;
+        int nthreads_col = (int) GB_IMIN (nthreads, GB_IMAX (1, nc / (4*w))) ;
+
+        //----------------------------------------------------------------------
+        // allocate workspace, if X is not square
+        //----------------------------------------------------------------------
+
+        if (nr != nc)
+        {
+            int64_t wsize = GB_IMAX (nthreads_row * nc, nthreads_col * nr * w) ;
+            W = GB_MALLOC_WORK (wsize * asize, GB_void, &W_size) ;
+            if (W == NULL)
+            { 
+                // out of memory
+                return (GrB_OUT_OF_MEMORY) ;
+            }
+        }
+
+        //----------------------------------------------------------------------
+        // transpose A->x and A->b
+        //----------------------------------------------------------------------
+
+        if (permute_x)
+        {
+            GB_transpose_permute ((GB_void *) A->x, A->type->size, nr, nc, g,
+                b, w, nblocks, W, nthreads, nthreads_row, nthreads_col) ;
+        }
+        if (A_is_bitmap)
+        {
+            GB_transpose_permute ((GB_void *) A->b, sizeof (int8_t), nr, nc, g,
+                b, w, nblocks, W, nthreads, nthreads_row, nthreads_col) ;
+        }
+        GB_FREE_ALL ;
+    }
+
+    //--------------------------------------------------------------------------
+    // swap the dimensions of A
+    //--------------------------------------------------------------------------
+
+    GB_transpose_cache_free (A) ;
+    A->vlen = nr ;
+    A->vdim = nc ;
+    A->nvec = nc ;
+    A->nvec_nonempty = (nr > 0) ? nc : 0 ;
+    A->is_csc = A_is_csc ;
+
+    //--------------------------------------------------------------------------
+    // conform the result to the desired sparsity structure of A
+    //--------------------------------------------------------------------------
+
+    ASSERT_MATRIX_OK (A, "A transposed in-place", GB0) ;
+    GB_OK (GB_conform (A, Werk)) ;
+    ASSERT_MATRIX_OK (A, "A output of in-place full transpose", GB0) ;
+    return (GrB_SUCCESS) ;
+}
+
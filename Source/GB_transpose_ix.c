@@ -12,10 +12,16 @@
 // The values of A are typecasted to C->type, the type of the C matrix.
 
 // If A is sparse or hypersparse
-//      The pattern of C is constructed.  C is sparse.
-//      Workspaces and A_slice are non-NULL.
-//      This method is parallel, but not highly scalable.  It uses only
+//      C is sparse.  For the atomic and non-atomic bucket methods, the
+//      pattern of C is constructed here, Workspaces and A_slice are non-NULL,
+//      and nworkspaces is 1 or nthreads.  These methods are parallel, but not
+//      highly scalable.  The non-atomic method uses only
 //      nthreads = nnz(A)/(A->vlen) threads.
+//      For the blocked bucket method (where GB_transpose_method returns
+//      nworkspaces_bucket as zero), the pattern of C has already been
+//      computed by GB_transpose_bucket.  A_slice is NULL, nworkspaces is 1,
+//      and Workspaces [0] is the permutation P, where C->x [pC] is computed
+//      from A->x [P [pC]].  Only the values of C are computed here.
 
 // If A is full or as-if-full:
 //      The pattern of C is not constructed.  C is full.
@@ -11,12 +11,14 @@
 
 // GB_transpose can use choose between a merge-sort-based method that takes
 // O(anz*log(anz)) time, or a bucket-sort method that takes O(anz+m+n) time.
-// The bucket sort has 3 methods: sequential, atomic, and non-atomic.
+// The bucket sort has 4 methods: sequential, atomic, non-atomic, and blocked.
+// The blocked method is selected by returning nworkspaces_bucket as zero.
 
 bool GB_transpose_method        // if true: use GB_builder, false: use bucket
 (
     const GrB_Matrix A,         // matrix to transpose
-    int *nworkspaces_bucket,    // # of slices of A for the bucket method
+    int *nworkspaces_bucket,    // # of slices of A for the bucket method,
+                                // or 0 for the blocked bucket method
     int *nthreads_bucket        // # of threads to use for the bucket method
 )
 {
@@ -36,14 +38,14 @@ bool GB_transpose_method        // if true: use GB_builder, false: use bucket
 
     // determine # of threads for bucket method
     int nthreads_max = GB_Context_nthreads_max ( ) ;
-    double chunk = GB_Context_chunk ( ) ;
+    double chunk = GB_Context_chunk_family (GxB_CHUNK_TRANSPOSE) ;
     int nthreads = GB_nthreads (anz + avlen, chunk, nthreads_max) ;
 
     //--------------------------------------------------------------------------
     // select between the atomic and non-atomic bucket method
     //--------------------------------------------------------------------------
 
-    bool atomics ;
+    bool atomics, blocked = false ;
     if (nthreads <= 2)
     { 
         // sequential bucket method: no atomics needed
@@ -111,7 +113,29 @@ bool GB_transpose_method        // if true: use GB_builder, false: use bucket
         }
     }
 
-    (*nworkspaces_bucket) = (atomics) ? 1 : nthreads ;
+    // For large matrices, the atomic method suffers from contention and
+    // irregular memory access, and the non-atomic method needs
+    // O(nthreads*avlen) workspace, which limits it to O(anz/avlen) threads.
+    // The blocked method has no atomics, but needs about 3*anz int64_t's of
+    // workspace regardless of the # of threads.  It is used only above a
+    // measured crossover, which is not set by default (see GB_transpose.h),
+    // and only if its workspace is within budget.  It can also be selected
+    // for testing.
+    double blocked_workspace = 3 * ((double) anz) * sizeof (int64_t) ;
+    if (GB_Global_hack_get (2) != 0)
+    { 
+        // the blocked method is forced, for testing only
+        blocked = true ;
+    }
+    else if (GB_TRANSPOSE_BLOCKED_NTHREADS > 2
+        && nthreads >= GB_TRANSPOSE_BLOCKED_NTHREADS
+        && anzlog >= GB_TRANSPOSE_BLOCKED_LOG
+        && blocked_workspace <= GB_TRANSPOSE_BLOCKED_WORKSPACE)
+    { 
+        blocked = true ;
+    }
+
+    (*nworkspaces_bucket) = (blocked) ? 0 : ((atomics) ? 1 : nthreads) ;
     (*nthreads_bucket) = nthreads ;
 
     //--------------------------------------------------------------------------
@@ -9,7 +9,7 @@
 
 // JIT: not needed.  Only one variant possible.
 
-// CALLS:     GB_builder
+// CALLS:     GB_builder, GB_wait_merge
 
 // The matrix A has zombies and/or pending tuples placed there by
 // GrB_setElement, GrB_*assign, or GB_mxm.  Zombies must now be deleted, and
@@ -35,6 +35,10 @@
 // Instead, it is not computed and left pending (as NULL).  It is not modified
 // if A->h doesn't change.
 
+// If only a few pending tuples are added to a large matrix (nnz(T) at most
+// nnz(A)/GB_WAIT_MERGE_RATIO), they are merged into A in place by
+// GB_wait_merge, rather than computing A+T with GB_add.
+
 // If the method is successful, it does an OpenMP flush just before returning.
 
 #define GB_FREE_WORKSPACE               \
@@ -43,6 +47,7 @@
     GB_Matrix_free (&T) ;               \
     GB_Matrix_free (&S) ;               \
     GB_Matrix_free (&A1) ;              \
+    GB_FREE_WORK (&Del, Del_size) ;     \
 }
 
 #define GB_FREE_ALL                     \
@@ -74,6 +79,7 @@ GrB_Info GB_wait                // finish all pending computations
     GrB_Info info = GrB_SUCCESS ;
     struct GB_Matrix_opaque T_header, A1_header, S_header ;
     GrB_Matrix T = NULL, A1 = NULL, S = NULL, Y = NULL ;
+    int64_t *restrict Del = NULL ; size_t Del_size = 0 ;
 
     ASSERT_MATRIX_OK (A, "A to wait", GB_FLIP (GB0)) ;
 
@@ -312,6 +318,26 @@ GrB_Info GB_wait                // finish all pending computations
         return (info) ;
     }
 
+    //--------------------------------------------------------------------------
+    // check for a small update
+    //--------------------------------------------------------------------------
+
+    if (tnz <= anz / GB_WAIT_MERGE_RATIO)
+    { 
+        // Only a few pending tuples have been added to a large matrix A.
+        // Merge them into A in place, which takes time proportional to
+        // nnz(T) plus the part of A that must be shifted, rather than the
+        // O(nnz(A)) time for GB_add, and does not allocate a new matrix.
+        GB_BURBLE_MATRIX (A, "(wait:merge " GBd " into " GBd ") ", tnz, anz);
+        GB_OK (GB_wait_merge (A, T, Werk)) ;
+        GB_Matrix_free (&T) ;
+        ASSERT_MATRIX_OK (A, "A after GB_wait:merge", GB0) ;
+        info = GB_conform (A, Werk) ;
+        ASSERT (GB_IMPLIES (info == GrB_SUCCESS, A->nvec_nonempty >= 0)) ;
+        #pragma omp flush
+        return (info) ;
+    }
+
     //--------------------------------------------------------------------------
     // create the SECOND_ATYPE binary operator
     //--------------------------------------------------------------------------
@@ -387,6 +413,22 @@ GrB_Info GB_wait                // finish all pending computations
         // TODO: if A also had zombies, GB_selector could pad A so that
         // GB_nnz_max (A) is equal to anz + tnz.
 
+        // the vectors A->h [kA:anvec-1] are replaced below; keep a copy of
+        // them so that the A->Y hyper_hash can be updated, not rebuilt
+        int64_t ndel = 0 ;
+        if (A->h != NULL && A->Y != NULL && kA < anvec)
+        {
+            ndel = anvec - kA ;
+            Del = GB_MALLOC_WORK (ndel, int64_t, &Del_size) ;
+            if (Del == NULL)
+            { 
+                // out of memory
+                GB_FREE_ALL ;
+                return (GrB_OUT_OF_MEMORY) ;
+            }
+            memcpy (Del, A->h + kA, ndel * sizeof (int64_t)) ;
+        }
+
         // make sure A has enough space for the new tuples
         if (anz_new > GB_nnz_max (A))
         { 
@@ -522,8 +564,17 @@ GrB_Info GB_wait                // finish all pending computations
         // need to recompute the # of non-empty vectors in GB_conform
         A->nvec_nonempty = -1 ;     // recomputed just below
 
-        // A->h has been modified so A->Y is now invalid
-        GB_hyper_hash_free (A) ;
+        // A->h [kA:end] has been modified, so update A->Y
+        if (A->h != NULL && A->Y != NULL)
+        { 
+            GB_OK (GB_hyper_hash_update (A, Del, ndel, A->h + kA,
+                A->nvec - kA, Werk)) ;
+        }
+        else
+        { 
+            GB_hyper_hash_free (A) ;
+        }
+        GB_FREE_WORK (&Del, Del_size) ;
 
         ASSERT_MATRIX_OK (A, "A after GB_wait:append", GB0) ;
 
@@ -23,6 +23,17 @@ GrB_Info GB_wait                // finish all pending computations
     GB_Werk Werk
 ) ;
 
+// GB_wait merges the pending tuples into A in place if nnz(T) is at most
+// nnz(A)/GB_WAIT_MERGE_RATIO, where T is the matrix of assembled pending tuples
+#define GB_WAIT_MERGE_RATIO 16
+
+GrB_Info GB_wait_merge              // A = A+T, in place
+(
+    GrB_Matrix A,                   // matrix to modify
+    GrB_Matrix T,                   // pending tuples, assembled
+    GB_Werk Werk
+) ;
+
 GrB_Info GB_unjumble        // unjumble a matrix
 (
     GrB_Matrix A,           // matrix to unjumble
@@ -0,0 +1,345 @@
+//------------------------------------------------------------------------------
+// GB_wait_merge: merge a few assembled pending tuples into A, in place
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// JIT: not needed.  Only one variant possible.
+
+// A = A+T, where T is the hypersparse matrix of assembled pending tuples,
+// using the SECOND operator (entries in T replace those in A).  Used by
+// GB_wait when nnz(T) is small compared with nnz(A).  A is sparse or
+// hypersparse, with no zombies, and is not jumbled.  The sparsity format of A
+// is not changed; the caller must conform A afterwards.
+
+// Entries of T already present in A are written into A in place, in parallel.
+// The remaining new entries are merged into A in a single backward pass over
+// the vectors of A, starting at the last vector of A that receives a new
+// entry.  Entries of A before the first such vector are not touched.  The
+// space for A->i and A->x (and A->h and A->p if A is hypersparse) is doubled
+// when it is too small, so that repeated small updates take amortized time
+// proportional to the number of new entries plus the part of A that must be
+// shifted, with no allocation of a new matrix.
+
+// A->Y is kept if A is hypersparse and no new vectors are added to A, and is
+// updated in place with GB_hyper_hash_update if new vectors are added.
+
+// T is modified: the entries of T already applied to A become zombies.
+
+#include "GB.h"
+
+#define GB_FREE_WORKSPACE                   \
+{                                           \
+    GB_FREE_WORK (&Tnew, Tnew_size) ;       \
+    GB_FREE_WORK (&Tk, Tk_size) ;           \
+}
+
+#define GB_FREE_ALL GB_FREE_WORKSPACE
+
+GrB_Info GB_wait_merge              // A = A+T, in place
+(
+    GrB_Matrix A,                   // matrix to modify
+    GrB_Matrix T,                   // pending tuples, assembled
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    int64_t *restrict Tnew = NULL ; size_t Tnew_size = 0 ;
+    int64_t *restrict Tk   = NULL ; size_t Tk_size   = 0 ;
+
+    ASSERT_MATRIX_OK (A, "A for wait_merge", GB0) ;
+    ASSERT_MATRIX_OK (T, "T for wait_merge", GB0) ;
+    ASSERT (GB_IS_SPARSE (A) || GB_IS_HYPERSPARSE (A)) ;
+    ASSERT (GB_IS_HYPERSPARSE (T)) ;
+    ASSERT (!GB_ANY_PENDING_WORK (A)) ;
+    ASSERT (!GB_ANY_PENDING_WORK (T)) ;
+    ASSERT (A->iso == T->iso) ;
+    ASSERT (A->type == T->type) ;
+    ASSERT (A->vlen == T->vlen && A->vdim == T->vdim) ;
+
+    const int64_t *restrict Tp = T->p ;
+    const int64_t *restrict Th = T->h ;
+    int64_t *restrict Ti = T->i ;
+    const GB_void *restrict Tx = (GB_void *) T->x ;
+    const int64_t tnvec = T->nvec ;
+
+    int64_t *restrict Ap = A->p ;
+    int64_t *restrict Ah = A->h ;
+    int64_t *restrict Ai = A->i ;
+    GB_void *restrict Ax = (GB_void *) A->x ;
+    const int64_t anvec = A->nvec ;
+    const int64_t anz = GB_nnz (A) ;
+    const size_t asize = A->type->size ;
+    const bool A_iso = A->iso ;
+
+    //--------------------------------------------------------------------------
+    // allocate workspace
+    //--------------------------------------------------------------------------
+
+    // Tnew [k] = # of entries in T(:,j) not in A(:,j), where j = Th [k]
+    // Tk [k] = position of A(:,j) in A, or GB_FLIP (insertion point) if
+    // A is hypersparse and A(:,j) is not present.
+
+    Tnew = GB_MALLOC_WORK (tnvec, int64_t, &Tnew_size) ;
+    Tk   = GB_MALLOC_WORK (tnvec, int64_t, &Tk_size) ;
+    if (Tnew == NULL || Tk == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // update entries already in A, and count the new entries and vectors
+    //--------------------------------------------------------------------------
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+    int nthreads = GB_nthreads (GB_nnz (T), chunk, nthreads_max) ;
+    int64_t nnew = 0, nvnew = 0 ;
+    int64_t k ;
+
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1) \
+        reduction(+:nnew,nvnew)
+    for (k = 0 ; k < tnvec ; k++)
+    {
+        // find A(:,j)
+        int64_t j = Th [k] ;
+        int64_t kA = j ;
+        bool found = true ;
+        if (Ah != NULL)
+        {
+            int64_t pright = anvec - 1 ;
+            kA = 0 ;
+            GB_SPLIT_BINARY_SEARCH (j, Ah, kA, pright, found) ;
+        }
+        int64_t pT_start = Tp [k] ;
+        int64_t pT_end = Tp [k+1] ;
+        if (!found)
+        {
+            // A(:,j) is not present; all of T(:,j) is new
+            Tk [k] = GB_FLIP (kA) ;
+            Tnew [k] = pT_end - pT_start ;
+            nnew += Tnew [k] ;
+            nvnew++ ;
+            continue ;
+        }
+        Tk [k] = kA ;
+
+        // look for each entry T(i,j) in A(:,j)
+        int64_t pA_start = Ap [kA] ;
+        int64_t pA_end = Ap [kA+1] ;
+        int64_t my_nnew = 0 ;
+        for (int64_t pT = pT_start ; pT < pT_end ; pT++)
+        {
+            int64_t i = Ti [pT] ;
+            int64_t pleft = pA_start ;
+            int64_t pright = pA_end - 1 ;
+            bool is_present ;
+            GB_BINARY_SEARCH (i, Ai, pleft, pright, is_present) ;
+            if (is_present)
+            {
+                // A(i,j) = T(i,j), and remove T(i,j) from T
+                if (!A_iso)
+                {
+                    memcpy (Ax + pleft * asize, Tx + pT * asize, asize) ;
+                }
+                Ti [pT] = GB_FLIP (i) ;
+                // the next entry in T(:,j) can only appear after this one
+                pA_start = pleft + 1 ;
+            }
+            else
+            {
+                // T(i,j) is a new entry
+                my_nnew++ ;
+                pA_start = pleft ;
+            }
+        }
+        Tnew [k] = my_nnew ;
+        nnew += my_nnew ;
+    }
+
+    if (nnew == 0)
+    {
+        // all entries of T were already present in A; A->Y is still valid
+        GB_FREE_WORKSPACE ;
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // ensure A has enough space for the new entries and vectors
+    //--------------------------------------------------------------------------
+
+    if (anz + nnew > GB_nnz_max (A))
+    {
+        // double the space, for future incremental growth
+        GB_OK (GB_ix_realloc (A, 2 * (anz + nnew))) ;
+        Ai = A->i ;
+        Ax = (GB_void *) A->x ;
+    }
+
+    if (anvec + nvnew > A->plen)
+    {
+        // A is hypersparse: double the size of the hyperlist
+        ASSERT (Ah != NULL) ;
+        GB_OK (GB_hyper_realloc (A, GB_IMIN (A->vdim, 2 * (anvec + nvnew)),
+            Werk)) ;
+        Ap = A->p ;
+        Ah = A->h ;
+    }
+
+    //--------------------------------------------------------------------------
+    // merge the new entries into A, in a single backward pass
+    //--------------------------------------------------------------------------
+
+    // shift: # of new entries in T(:,0:j) not yet placed in A
+    // vshift: # of new vectors in T(:,0:j) not yet placed in A
+    // pend: A->i [0:pend-1] and A->x [0:pend-1] have not yet been moved
+    // kend: A->p [0:kend-1] and A->h [0:kend-1] have not yet been moved
+    // pkend: the original value of A->p [kend]
+
+    int64_t shift = nnew ;
+    int64_t vshift = nvnew ;
+    int64_t pend = anz ;
+    int64_t kend = anvec ;
+    int64_t pkend = anz ;
+    int64_t nvec_nonempty_new = 0 ;
+    Ap [anvec + nvnew] = anz + nnew ;
+
+    for (int64_t kT = tnvec - 1 ; kT >= 0 ; kT--)
+    {
+
+        int64_t newk = Tnew [kT] ;
+        if (newk == 0) continue ;
+
+        //----------------------------------------------------------------------
+        // get A(:,j), which might be empty or not present
+        //----------------------------------------------------------------------
+
+        int64_t j = Th [kT] ;
+        int64_t kA = Tk [kT] ;
+        bool found = (kA >= 0) ;
+        if (!found) kA = GB_FLIP (kA) ;
+        ASSERT (kA <= kend) ;
+        int64_t pA_start = (kA < kend) ? Ap [kA] : pkend ;
+        int64_t pA_end = pA_start ;
+        if (found)
+        {
+            pA_end = (kA+1 < kend) ? Ap [kA+1] : pkend ;
+        }
+        int64_t kfirst = (found) ? (kA+1) : kA ;
+
+        //----------------------------------------------------------------------
+        // move the entries and vectors after A(:,j)
+        //----------------------------------------------------------------------
+
+        if (pend > pA_end)
+        {
+            memmove (Ai + pA_end + shift, Ai + pA_end,
+                (pend - pA_end) * sizeof (int64_t)) ;
+            if (!A_iso)
+            {
+                memmove (Ax + (pA_end + shift) * asize, Ax + pA_end * asize,
+                    (pend - pA_end) * asize) ;
+            }
+        }
+
+        for (int64_t ka = kend - 1 ; ka >= kfirst ; ka--)
+        {
+            Ap [ka + vshift] = Ap [ka] + shift ;
+            if (Ah != NULL) Ah [ka + vshift] = Ah [ka] ;
+        }
+
+        //----------------------------------------------------------------------
+        // merge T(:,j) into A(:,j), from the bottom up
+        //----------------------------------------------------------------------
+
+        int64_t pA = pA_end - 1 ;
+        int64_t pC = pA_end + shift - 1 ;
+        for (int64_t pT = Tp [kT+1] - 1 ; pT >= Tp [kT] ; pT--)
+        {
+            int64_t i = Ti [pT] ;
+            if (GB_IS_ZOMBIE (i)) continue ;
+            // move entries of A(:,j) that come after T(i,j)
+            while (pA >= pA_start && Ai [pA] > i)
+            {
+                Ai [pC] = Ai [pA] ;
+                if (!A_iso)
+                {
+                    memcpy (Ax + pC * asize, Ax + pA * asize, asize) ;
+                }
+                pA-- ;
+                pC-- ;
+            }
+            // place T(i,j) in A(:,j)
+            Ai [pC] = i ;
+            if (!A_iso)
+            {
+                memcpy (Ax + pC * asize, Tx + pT * asize, asize) ;
+            }
+            pC-- ;
+        }
+
+        // A(:,j) now starts at pA_start + shift.  Entries of A(:,j) not yet
+        // moved, in A->i [pA_start:pA], are moved with the prior vectors.
+        shift -= newk ;
+        ASSERT (pC == pA + shift) ;
+        if (!found)
+        {
+            // A(:,j) is a new vector in the hyperlist
+            vshift-- ;
+        }
+        if (pA_start == pA_end)
+        {
+            // A(:,j) was empty but is no longer
+            nvec_nonempty_new++ ;
+        }
+        Ap [kA + vshift] = pA_start + shift ;
+        if (Ah != NULL) Ah [kA + vshift] = j ;
+        pend = pA + 1 ;
+        kend = kA ;
+        pkend = pA_start ;
+    }
+
+    ASSERT (shift == 0) ;
+    ASSERT (vshift == 0) ;
+
+    //--------------------------------------------------------------------------
+    // finalize A
+    //--------------------------------------------------------------------------
+
+    A->nvec = anvec + nvnew ;
+    A->nvals = anz + nnew ;
+    if (A->nvec_nonempty >= 0)
+    {
+        A->nvec_nonempty += nvec_nonempty_new ;
+    }
+    if (nvnew > 0 && A->Y != NULL)
+    {
+        // A->h has been modified, so update A->Y with the new vectors, which
+        // are gathered into Tk [0:nvnew-1] (Tk is no longer needed)
+        int64_t nins = 0 ;
+        for (int64_t kT = 0 ; kT < tnvec ; kT++)
+        {
+            if (Tk [kT] < 0)
+            { 
+                Tk [nins++] = Th [kT] ;
+            }
+        }
+        ASSERT (nins == nvnew) ;
+        GB_OK (GB_hyper_hash_update (A, NULL, 0, Tk, nins, Werk)) ;
+    }
+
+    GB_FREE_WORKSPACE ;
+    ASSERT_MATRIX_OK (A, "A after wait_merge", GB0) ;
+    return (GrB_SUCCESS) ;
+}
+
@@ -26,13 +26,17 @@ void *GB_xalloc_memory      // return the newly-allocated space
         // always calloc the iso entry
         p = GB_CALLOC (type_size, GB_void, size) ;
     }
-    else if (use_calloc)
-    { 
-        p = GB_CALLOC (n * type_size, GB_void, size) ;
-    }
     else
     { 
+        // apply the NUMA policy to the values of a matrix, if the block is
+        // large, before its pages are first touched by the memset, if any
         p = GB_MALLOC (n * type_size, GB_void, size) ;
+        GB_numa_bind (p, *size) ;
+        if (p != NULL && use_calloc)
+        { 
+            int nthreads_max = GB_Context_nthreads_max ( ) ;
+            GB_memset (p, 0, (*size), nthreads_max) ;
+        }
     }
     return (p) ;
 }
@@ -30,6 +30,7 @@ GB_monoid_is_terminal
 GB_terminal_condition
 GB_if_terminal_break
 GB_declare_const_terminal
+GB_pragma_simd_reduction_monoid
 
 // panel size
 GB_panel
@@ -71,3 +72,25 @@ GrB_Info GB (_red)
     #endif
 }
 
+//------------------------------------------------------------------------------
+// reduce each vector of a non-iso matrix to a scalar, for monoids only
+//------------------------------------------------------------------------------
+
+GrB_Info GB (_red_each)
+(
+    GB_Z_TYPE *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+)
+{ 
+    #if GB_DISABLE
+    return (GrB_NO_VALUE) ;
+    #else
+    #include "GB_reduce_each_vector_template.c"
+    return (GrB_SUCCESS) ;
+    #endif
+}
+
@@ -10,3 +10,13 @@ GrB_Info GB (_red)
     int nthreads
 ) ;
 
+GrB_Info GB (_red_each)
+(
+    GB_atype_parameter *restrict Tx,
+    int8_t *restrict Tb,
+    const GrB_Matrix A,
+    const int64_t *restrict A_slice,
+    int ntasks,
+    int nthreads
+) ;
+
@@ -122,6 +122,11 @@ static GrB_Info GB_global_enum_get (int32_t *value, int field)
             (*value) = (int) GB_jitifyer_get_control ( ) ;
             break ;
 
+        case GxB_NUMA_POLICY : 
+
+            (*value) = (int) GB_Global_numa_policy_get ( ) ;
+            break ;
+
         case GxB_JIT_USE_CMAKE : 
 
             (*value) = (int) GB_jitifyer_get_use_cmake ( ) ;
@@ -432,6 +437,11 @@ GrB_Info GrB_Global_get_SIZE
                 (*value) = sizeof (double) * GxB_NBITMAP_SWITCH ;
                 break ;
 
+            case GxB_CHUNK_FAMILY : 
+
+                (*value) = sizeof (double) * GxB_NCHUNK_FAMILY ;
+                break ;
+
             case GxB_COMPILER_VERSION : 
 
                 (*value) = sizeof (int32_t) * 3 ;
@@ -493,6 +503,17 @@ GrB_Info GrB_Global_get_VOID
             }
             break ;
 
+        case GxB_CHUNK_FAMILY : 
+
+            {
+                double *dvalue = (double *) value ;
+                for (int k = 0 ; k < GxB_NCHUNK_FAMILY ; k++)
+                {
+                    dvalue [k] = GB_Global_chunk_family_get (k) ;
+                }
+            }
+            break ;
+
         case GxB_COMPILER_VERSION : 
 
             {
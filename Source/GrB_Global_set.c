@@ -71,6 +71,10 @@ static GrB_Info GB_global_enum_set (int32_t value, int field)
             GB_jitifyer_set_control (value) ;
             break ;
 
+        case GxB_NUMA_POLICY : 
+
+            return (GB_numa_policy_set (value)) ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -295,6 +299,27 @@ GrB_Info GrB_Global_set_VOID
             }
             break ;
 
+        case GxB_CHUNK_FAMILY : 
+
+            if (value == NULL)
+            { 
+                // no kernel family is tuned
+                GB_Global_chunk_family_default ( ) ;
+            }
+            else
+            {
+                if (size < sizeof (double) * GxB_NCHUNK_FAMILY)
+                { 
+                    return (GrB_INVALID_VALUE) ;
+                }
+                double *dvalue = (double *) value ;
+                for (int k = 0 ; k < GxB_NCHUNK_FAMILY ; k++)
+                { 
+                    GB_Global_chunk_family_set (k, dvalue [k]) ;
+                }
+            }
+            break ;
+
         case GxB_PRINTF : 
 
             if (size != sizeof (GB_printf_function_t))
@@ -149,6 +149,9 @@ GrB_Info GB_Matrix_removeElement
 )
 {
 
+    // C is about to be modified, so its cached transpose is no longer valid
+    GB_transpose_cache_free (C) ;
+
     //--------------------------------------------------------------------------
     // if C is jumbled, wait on the matrix first.  If full, convert to nonfull
     //--------------------------------------------------------------------------
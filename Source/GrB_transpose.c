@@ -84,12 +84,29 @@ GrB_Info GrB_transpose              // C<M> = accum(C,A') or accum(C,A)
         A_transpose = !A_transpose ;
     }
 
+    if (A == C && M == NULL && accum == NULL && !A_transpose)
+    {
+
+        // C = C', with no mask or accum: transpose C in-place.  No copy of
+        // C->x or C->b is made if C is full or bitmap.
+        GB_OK (GB_transpose_in_place (C, C_is_csc, Werk)) ;
+        ASSERT_MATRIX_OK (C, "final C for GrB_transpose", GB0) ;
+        GB_BURBLE_END ;
+        return (GrB_SUCCESS) ;
+    }
+
     if (!A_transpose)
     {
 
         // T = A', the default behavior.  This step may seem counter-intuitive,
         // but method computes C<M>=A' by default when A_transpose is false.
 
+        if (A != C)
+        { 
+            // use the cached A', or construct it if requested
+            GB_OK (GB_transpose_cache_build (A, Werk)) ;
+        }
+
         // Precasting:
         if (accum == NULL)
         { 
@@ -10,9 +10,12 @@
 // Predefined Contexts (GxB_CONTEXT_WORLD in particular) are not freed.
 // Attempts to do so are silently ignored.
 
-// If the Context to be freed is also currently the Context any user thread,
-// then results are undefined.  Before freeing a Context, first disengage it
-// from any user thread that might have it engaged as their Context object,
+// If the Context to be freed is currently engaged by the user thread that
+// calls GxB_Context_free, it is first disengaged, which also restores the CPUs
+// of this user thread if the Context was bound to a list of CPUs (see
+// GB_Context_bind).  If the Context is engaged by any other user thread, then
+// results are undefined.  Before freeing a Context, first disengage it from
+// any other user thread that might have it engaged as their Context object,
 // via any of the following:
 //
 // GxB_Context_disengage (Context) ;   // disengages a particular Context
@@ -33,9 +36,17 @@ GrB_Info GxB_Context_free           // free a Context
         GxB_Context Context = *Context_handle ;
         if (Context != NULL)
         {
+            if (Context == GB_Context_current ( ))
+            { 
+                // disengage the Context from this user thread, and restore
+                // its CPUs if the Context is bound
+                GB_Context_disengage (Context) ;
+            }
             size_t header_size = Context->header_size ;
             // free the Context user_name
             GB_FREE (&(Context->user_name), Context->user_name_size) ;
+            // free the list of CPUs
+            GB_FREE (&(Context->cpus), Context->cpus_size) ;
             if (header_size > 0)
             { 
                 Context->magic = GB_FREED ;  // to help detect dangling pointers
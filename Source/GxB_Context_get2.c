@@ -163,6 +163,11 @@ GrB_Info GxB_Context_get_INT
             (*value) = GB_Context_gpu_id_get (Context) ;
             break ;
 
+        case GxB_CONTEXT_NUMA_NODE :
+
+            (*value) = Context->numa_node ;
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -197,6 +202,12 @@ GrB_Info GxB_Context_get_SIZE
     // get the field
     //--------------------------------------------------------------------------
 
+    if ((int) field == GxB_CONTEXT_CPUS)
+    { 
+        (*value) = Context->ncpus * sizeof (int32_t) ;
+        return (GrB_SUCCESS) ;
+    }
+
     if (field != GrB_NAME)
     { 
         return (GrB_INVALID_VALUE) ;
@@ -224,6 +235,30 @@ GrB_Info GxB_Context_get_VOID
     GrB_Field field
 )
 { 
-    return (GrB_INVALID_VALUE) ;
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Context_get_VOID (Context, value, field)") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (Context) ;
+    GB_RETURN_IF_NULL (value) ;
+    ASSERT_CONTEXT_OK (Context, "context for get", GB0) ;
+
+    if ((int) field != GxB_CONTEXT_CPUS)
+    { 
+        return (GrB_INVALID_VALUE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // get the list of CPUs, of size given by GrB_get (Context, &size, field)
+    //--------------------------------------------------------------------------
+
+    if (Context->ncpus > 0)
+    { 
+        memcpy (value, Context->cpus, Context->ncpus * sizeof (int32_t)) ;
+    }
+    #pragma omp flush
+    return (GrB_SUCCESS) ;
 }
 
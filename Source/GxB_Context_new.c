@@ -49,6 +49,12 @@ GrB_Info GxB_Context_new            // create a new Context
     Context->chunk = GB_Context_chunk_get (NULL) ;
     Context->gpu_id = GB_Context_gpu_id_get (NULL) ;
 
+    // the Context is not bound to any CPUs
+    Context->cpus = NULL ;
+    Context->cpus_size = 0 ;
+    Context->ncpus = 0 ;
+    Context->numa_node = -1 ;
+
     // return the result
     (*Context_handle) = Context ;
     return (GrB_SUCCESS) ;
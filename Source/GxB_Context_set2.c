@@ -155,6 +155,15 @@ GrB_Info GxB_Context_set_INT
             GB_Context_gpu_id_set (Context, value) ;
             break ;
 
+        case GxB_CONTEXT_NUMA_NODE : 
+
+            if (Context == GxB_CONTEXT_WORLD)
+            { 
+                // built-in GxB_CONTEXT_WORLD may not be bound to any CPUs
+                return (GrB_INVALID_VALUE) ;
+            }
+            return (GB_Context_numa_set (Context, value)) ;
+
         default : 
             return (GrB_INVALID_VALUE) ;
     }
@@ -174,6 +183,27 @@ GrB_Info GxB_Context_set_VOID
     size_t size
 )
 { 
-    return (GrB_INVALID_VALUE) ;
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Context_set_VOID (Context, value, field, size)") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (Context) ;
+    ASSERT_CONTEXT_OK (Context, "Context to set", GB0) ;
+
+    if (Context == GxB_CONTEXT_WORLD || (int) field != GxB_CONTEXT_CPUS ||
+        size % sizeof (int32_t) != 0)
+    { 
+        // built-in GxB_CONTEXT_WORLD may not be bound to any CPUs
+        return (GrB_INVALID_VALUE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // set the list of CPUs; if value is NULL, the Context is not bound
+    //--------------------------------------------------------------------------
+
+    int ncpus = (value == NULL) ? 0 : (int) (size / sizeof (int32_t)) ;
+    return (GB_Context_cpus_set (Context, (int32_t *) value, ncpus, -1)) ;
 }
 
@@ -111,6 +111,11 @@ GrB_Info GxB_Global_Option_get_INT32    // gets the current global option
             (*value) = (int32_t) GB_jitifyer_get_control ( ) ;
             break ;
 
+        case GxB_NUMA_POLICY : 
+
+            (*value) = (int32_t) GB_Global_numa_policy_get ( ) ;
+            break ;
+
         case GxB_JIT_USE_CMAKE : 
 
             (*value) = (int32_t) GB_jitifyer_get_use_cmake ( ) ;
@@ -163,6 +168,14 @@ GrB_Info GxB_Global_Option_get_FP64     // gets the current global option
             }
             break ;
 
+        case GxB_CHUNK_FAMILY : 
+
+            for (int k = 0 ; k < GxB_NCHUNK_FAMILY ; k++)
+            {
+                value [k] = GB_Global_chunk_family_get (k) ;
+            }
+            break ;
+
         case GxB_GLOBAL_CHUNK :         // same as GxB_CHUNK
 
             (*value) = GB_Context_chunk_get (NULL) ;
@@ -479,6 +492,20 @@ GrB_Info GxB_Global_Option_get      // gets the current global option
             }
             break ;
 
+        case GxB_CHUNK_FAMILY : 
+
+            {
+                va_start (ap, field) ;
+                double *chunk_family = va_arg (ap, double *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (chunk_family) ;
+                for (int k = 0 ; k < GxB_NCHUNK_FAMILY ; k++)
+                {
+                    chunk_family [k] = GB_Global_chunk_family_get (k) ;
+                }
+            }
+            break ;
+
         case GxB_FORMAT : 
 
             {
@@ -937,6 +964,17 @@ GrB_Info GxB_Global_Option_get      // gets the current global option
             }
             break ;
 
+        case GxB_NUMA_POLICY : 
+
+            {
+                va_start (ap, field) ;
+                int *numa_policy = va_arg (ap, int *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (numa_policy) ;
+                (*numa_policy) = GB_Global_numa_policy_get ( ) ;
+            }
+            break ;
+
         case GxB_JIT_USE_CMAKE : 
 
             {
@@ -84,6 +84,10 @@ GrB_Info GxB_Global_Option_set_INT32      // set a global default option
             GB_jitifyer_set_control ((int) value) ;
             break ;
 
+        case GxB_NUMA_POLICY : 
+
+            return (GB_numa_policy_set (value)) ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -174,6 +178,22 @@ GrB_Info GxB_Global_Option_set_FP64_ARRAY      // set a global default option
             }
             break ;
 
+        case GxB_CHUNK_FAMILY : 
+
+            if (value == NULL)
+            { 
+                // no kernel family is tuned
+                GB_Global_chunk_family_default ( ) ;
+            }
+            else
+            {
+                for (int k = 0 ; k < GxB_NCHUNK_FAMILY ; k++)
+                { 
+                    GB_Global_chunk_family_set (k, value [k]) ;
+                }
+            }
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -389,6 +409,36 @@ GrB_Info GxB_Global_Option_set      // set a global default option
             }
             break ;
 
+        case GxB_CHUNK_FAMILY : 
+
+            {
+                va_start (ap, field) ;
+                double *chunk_family = va_arg (ap, double *) ;
+                va_end (ap) ;
+                if (chunk_family == NULL)
+                { 
+                    // no kernel family is tuned
+                    GB_Global_chunk_family_default ( ) ;
+                }
+                else
+                {
+                    for (int k = 0 ; k < GxB_NCHUNK_FAMILY ; k++)
+                    { 
+                        GB_Global_chunk_family_set (k, chunk_family [k]) ;
+                    }
+                }
+            }
+            break ;
+
+        case GxB_NUMA_POLICY : 
+
+            {
+                va_start (ap, field) ;
+                int numa_policy = va_arg (ap, int) ;
+                va_end (ap) ;
+                return (GB_numa_policy_set (numa_policy)) ;
+            }
+
         case GxB_FORMAT : 
 
             {
@@ -0,0 +1,76 @@
+//------------------------------------------------------------------------------
+// GxB_Iterator_getBlock: get the rest of the current vector of an iterator
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// On input, the iterator must be a row or column iterator, and the prior call
+// to GxB_rowIterator_* or GxB_colIterator_* (seek or next) must have returned
+// GrB_SUCCESS, so that the iterator is at an entry in the current row (or
+// column) of the matrix.  Results are undefined if these conditions are not
+// met.
+
+// GxB_Iterator_getBlock returns pointers to the entries of the current row
+// (or column), from the current entry to the end of the row, as n positions
+// held contiguously in the matrix.  The iterator is not moved.  For a row
+// iterator, position t of the block (for t = 0 to n-1) is:
+
+//  index:  Ilist [t] if Ilist is not NULL, or
+//          GxB_rowIterator_getColIndex (iterator) + t otherwise (if the
+//          matrix is bitmap or full)
+//  value:  ((type *) Xlist) [t], or ((type *) Xlist) [0] if iso is true
+//  entry:  position t is an entry if Blist is NULL, or if Blist [t] is
+//          nonzero (Blist is not NULL only if the matrix is bitmap)
+
+// and likewise for a column iterator.  The arrays Ilist, Xlist, and Blist are
+// owned by the matrix, and must not be modified.  Any output parameter may be
+// NULL, if that result is not needed.  Once the block has been used, the
+// iterator can be moved to the next row with GxB_rowIterator_nextRow (or
+// GxB_colIterator_nextCol).
+
+// This method allows the entries of a row or column to be accessed in bulk,
+// rather than with one call to GxB_*Iterator_next* and GxB_Iterator_get_*
+// for each entry.
+
+#include "GB.h"
+
+GrB_Info GxB_Iterator_getBlock
+(
+    GxB_Iterator iterator,          // row or column iterator at an entry
+    const GrB_Index **Ilist,        // indices of the block, or NULL
+    const void **Xlist,             // values of the block
+    const int8_t **Blist,           // bitmap of the block, or NULL
+    GrB_Index *n,                   // # of positions in the block
+    bool *iso                       // if true, all entries have Xlist [0]
+)
+{
+
+    int64_t p = iterator->p ;
+    if (Ilist != NULL)
+    {
+        (*Ilist) = (iterator->Ai == NULL) ? NULL :
+            ((const GrB_Index *) (iterator->Ai + p)) ;
+    }
+    if (Xlist != NULL)
+    {
+        (*Xlist) = ((const GB_void *) iterator->Ax) +
+            (iterator->iso ? 0 : (p * iterator->type_size)) ;
+    }
+    if (Blist != NULL)
+    {
+        (*Blist) = (iterator->Ab == NULL) ? NULL : (iterator->Ab + p) ;
+    }
+    if (n != NULL)
+    {
+        (*n) = (GrB_Index) (iterator->pend - p) ;
+    }
+    if (iso != NULL)
+    {
+        (*iso) = iterator->iso ;
+    }
+    return (GrB_SUCCESS) ;
+}
+
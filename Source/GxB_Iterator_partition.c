@@ -0,0 +1,71 @@
+//------------------------------------------------------------------------------
+// GxB_Iterator_partition: split the vectors of a matrix for parallel iterators
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// On input, the iterator must be a row or column iterator, attached to a
+// matrix A.  It need not be at any specific row or column.
+
+// GxB_Iterator_partition splits the rows (for a row iterator) or columns (for
+// a column iterator) of A into ntasks contiguous ranges, so that each range
+// holds about the same number of entries of A.  Task tid is given the range k
+// = Slice [tid] to Slice [tid+1]-1, where k is used in
+// GxB_rowIterator_kseek or GxB_colIterator_kseek, and Slice [0] = 0 and
+// Slice [ntasks] = GxB_rowIterator_kount (iterator).  Some ranges may be
+// empty.  If A is bitmap or full, the ranges have the same number of rows or
+// columns.
+
+// On input, ntasks is the number of ranges requested, and Slice must have
+// size at least ntasks+1.  On output, ntasks is the number of ranges, which
+// can be less than the number requested if A has few rows or columns.
+
+// Each user thread must then use its own iterator, attached to the same
+// matrix A.  The matrix has no pending work once it has been attached to this
+// iterator, so the other iterators can be attached to A in parallel.
+
+// The following error conditions are returned:
+// GrB_NULL_POINTER:    if the iterator, Slice, or ntasks are NULL.
+// GrB_INVALID_VALUE:   if ntasks is less than 1 on input.
+
+#include "GB.h"
+#include "GB_slice.h"
+
+GrB_Info GxB_Iterator_partition
+(
+    GrB_Index *Slice,               // size ntasks+1
+    int *ntasks,                    // # of tasks requested and returned
+    GxB_Iterator iterator           // row or column iterator attached to A
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_RETURN_IF_NULL (Slice) ;
+    GB_RETURN_IF_NULL (ntasks) ;
+    GB_RETURN_IF_NULL (iterator) ;
+    if ((*ntasks) < 1)
+    {
+        return (GrB_INVALID_VALUE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // slice the vectors of A
+    //--------------------------------------------------------------------------
+
+    // Ap is NULL if A is bitmap or full, and then each task is given the
+    // same number of vectors.  Otherwise, the ranges are perfectly balanced
+    // by a binary search of Ap, since a user application will often create
+    // one task per thread.
+    int64_t anvec = iterator->anvec ;
+    int nt = (int) GB_IMIN ((*ntasks), GB_IMAX (anvec, 1)) ;
+    GB_pslice ((int64_t *) Slice, iterator->Ap, anvec, nt, true) ;
+    (*ntasks) = nt ;
+    return (GrB_SUCCESS) ;
+}
+
@@ -49,6 +49,21 @@ GrB_Info GxB_Matrix_Option_get_INT32    // gets the current option of a matrix
             (*value) = A->sparsity_control ;
             break ;
 
+        case GxB_SPARSITY_ADAPTIVE : 
+
+            (*value) = (int32_t) A->sparsity_adaptive ;
+            break ;
+
+        case GxB_HYPER_PIN : 
+
+            (*value) = (int32_t) A->hyper_pin ;
+            break ;
+
+        case GxB_TRANSPOSE_CACHE : 
+
+            (*value) = (int32_t) A->transpose_cache ;
+            break ;
+
         case GxB_SPARSITY_STATUS : 
 
             (*value) = GB_sparsity (A) ;
@@ -177,6 +192,39 @@ GrB_Info GxB_Matrix_Option_get      // gets the current option of a matrix
             }
             break ;
 
+        case GxB_SPARSITY_ADAPTIVE : 
+
+            {
+                va_start (ap, field) ;
+                int *sparsity_adaptive = va_arg (ap, int *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (sparsity_adaptive) ;
+                (*sparsity_adaptive) = (int) A->sparsity_adaptive ;
+            }
+            break ;
+
+        case GxB_HYPER_PIN : 
+
+            {
+                va_start (ap, field) ;
+                int *hyper_pin = va_arg (ap, int *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (hyper_pin) ;
+                (*hyper_pin) = (int) A->hyper_pin ;
+            }
+            break ;
+
+        case GxB_TRANSPOSE_CACHE : 
+
+            {
+                va_start (ap, field) ;
+                int *transpose_cache = va_arg (ap, int *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (transpose_cache) ;
+                (*transpose_cache) = (int) A->transpose_cache ;
+            }
+            break ;
+
         case GxB_SPARSITY_STATUS : 
 
             {
@@ -54,6 +54,25 @@ GrB_Info GxB_Matrix_Option_set_INT32    // set an option in a matrix
             A->sparsity_control = GB_sparsity_control (value, (int64_t) (-1)) ;
             break ;
 
+        case GxB_SPARSITY_ADAPTIVE : 
+
+            A->sparsity_adaptive = (value != 0) ;
+            break ;
+
+        case GxB_HYPER_PIN : 
+
+            A->hyper_pin = (value != 0) ;
+            break ;
+
+        case GxB_TRANSPOSE_CACHE : 
+
+            A->transpose_cache = (value != 0) ;
+            if (!A->transpose_cache)
+            { 
+                GB_transpose_cache_free (A) ;
+            }
+            break ;
+
         case GxB_FORMAT : 
 
             if (! (value == GxB_BY_ROW || value == GxB_BY_COL))
@@ -207,6 +226,40 @@ GrB_Info GxB_Matrix_Option_set      // set an option in a matrix
             }
             break ;
 
+        case GxB_SPARSITY_ADAPTIVE : 
+
+            {
+                va_start (ap, field) ;
+                int sparsity_adaptive = va_arg (ap, int) ;
+                va_end (ap) ;
+                A->sparsity_adaptive = (sparsity_adaptive != 0) ;
+            }
+            break ;
+
+        case GxB_HYPER_PIN : 
+
+            {
+                va_start (ap, field) ;
+                int hyper_pin = va_arg (ap, int) ;
+                va_end (ap) ;
+                A->hyper_pin = (hyper_pin != 0) ;
+            }
+            break ;
+
+        case GxB_TRANSPOSE_CACHE : 
+
+            {
+                va_start (ap, field) ;
+                int transpose_cache = va_arg (ap, int) ;
+                va_end (ap) ;
+                A->transpose_cache = (transpose_cache != 0) ;
+                if (!A->transpose_cache)
+                { 
+                    GB_transpose_cache_free (A) ;
+                }
+            }
+            break ;
+
         case GxB_FORMAT : 
 
             {
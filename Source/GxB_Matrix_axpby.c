@@ -0,0 +1,79 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_axpby: fused C<M> = accum (C, alpha*A+beta*B)
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// C<M> = accum (C, alpha*A+beta*B), where '+' and '*' are the additive monoid
+// and multiplicative operator of the semiring:
+
+// if A(i,j) and B(i,j) both appear:
+//      T(i,j) = add (mult (alpha, A(i,j)), mult (beta, B(i,j)))
+// else if A(i,j) appears but B(i,j) does not:
+//      T(i,j) = mult (alpha, A(i,j))
+// else if A(i,j) does not appear but B(i,j) does:
+//      T(i,j) = mult (beta, B(i,j))
+
+// This is the same as GrB_apply (AS, mult, alpha, A), GrB_apply (BS, mult,
+// beta, B), followed by GrB_eWiseAdd (C, M, accum, add, AS, BS), but without
+// the intermediate matrices AS and BS.
+
+#include "GB_ewise.h"
+#include "GB_get_mask.h"
+
+GrB_Info GxB_Matrix_axpby           // C<M> = accum (C, alpha*A+beta*B)
+(
+    GrB_Matrix C,                   // input/output matrix for results
+    const GrB_Matrix M_in,          // optional mask for C, unused if NULL
+    const GrB_BinaryOp accum,       // optional accum for Z=accum(C,T)
+    const GrB_Semiring semiring,    // defines '+' and '*' for alpha*A+beta*B
+    const GrB_Scalar alpha,         // scalar to multiply with A
+    const GrB_Matrix A,             // first input:  matrix A
+    const GrB_Scalar beta,          // scalar to multiply with B
+    const GrB_Matrix B,             // second input: matrix B
+    const GrB_Descriptor desc       // descriptor for C, M, A, and B
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE (C, "GxB_Matrix_axpby (C, M, accum, semiring, alpha, A,"
+        " beta, B, desc)") ;
+    GB_BURBLE_START ("GxB_axpby") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (C) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (semiring) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (alpha) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (beta) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (B) ;
+    GB_RETURN_IF_FAULTY (M_in) ;
+
+    // get the descriptor
+    GB_GET_DESCRIPTOR (info, desc, C_replace, Mask_comp, Mask_struct,
+        A_tran, B_tran, xx, xx7) ;
+
+    // get the mask
+    GrB_Matrix M = GB_get_mask (M_in, &Mask_comp, &Mask_struct) ;
+
+    //--------------------------------------------------------------------------
+    // C<M> = accum (C,T) where T = alpha*A+beta*B, or with A' and/or B'
+    //--------------------------------------------------------------------------
+
+    info = GB_ewise_axpby (
+        C,              C_replace,  // C and its descriptor
+        M, Mask_comp, Mask_struct,  // mask and its descriptor
+        accum,                      // accumulate operator
+        semiring,                   // semiring that defines '+' and '*'
+        alpha, A,       A_tran,     // alpha, A, and its descriptor
+        beta,  B,       B_tran,     // beta, B, and its descriptor
+        Werk) ;
+
+    GB_BURBLE_END ;
+    return (info) ;
+}
+
@@ -0,0 +1,35 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_build_File: build a matrix from a file of tuples
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// If dup is NULL: any duplicates result in an error.
+// If dup is GxB_IGNORE_DUP: duplicates are ignored, which is not an error.
+// If dup is a valid binary operator, it is used to reduce any duplicates to
+// a single value.
+
+#include "GB_build.h"
+
+GrB_Info GxB_Matrix_build_File      // build a matrix from a file of tuples
+(
+    GrB_Matrix C,                   // matrix to build
+    FILE *f,                        // file of binary (row,col,value) tuples
+    const GrB_Type xtype,           // type of the values in the file
+    const GrB_BinaryOp dup,         // binary function to assemble duplicates
+    size_t memory,                  // workspace limit in bytes (0: default)
+    const GrB_Descriptor desc       // currently unused
+)
+{ 
+    GB_WHERE (C, "GxB_Matrix_build_File (C, f, xtype, dup, memory, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_build_File") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (C) ;
+    GB_RETURN_IF_FAULTY (desc) ;
+    GrB_Info info = GB_build_file (C, f, xtype, dup, memory, Werk) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
+
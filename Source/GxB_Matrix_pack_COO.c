@@ -0,0 +1,266 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_pack_COO: pack a matrix from sorted COO tuples
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// JIT: not needed.  Only one variant possible.
+
+// Packs a list of nvals tuples (Ai [k], Aj [k], Ax [k]) into A, taking
+// ownership of the Ai and Ax arrays, which become A->i and A->x of a
+// hypersparse matrix.  The tuples must already be sorted in the same order
+// that A is held: by column (then by row) if A is held by column, or by row
+// (then by column) if A is held by row, with no duplicates.  Unlike
+// GrB_Matrix_build, no copy of the tuples is made, and no sort or assembly of
+// duplicates is needed.  A single parallel pass over the tuples checks the
+// indices and their order, and constructs the A->p and A->h arrays, taking
+// O(nvals/nthreads + nvec) time and O(nvec) memory.  The Aj array is freed
+// on success (or Ai, if A is held by row).
+
+// If any index is out of bounds, or if the tuples are out of order or have
+// duplicates, an error is returned and A and the input arrays are unchanged.
+
+// The arrays must be allocated by the same malloc function passed to
+// GxB_init, or by the ANSI C malloc if GrB_init was used, just as for the
+// other GxB_Matrix_pack methods.
+
+#include "GB_export.h"
+#include "GB_cumsum.h"
+
+#define GB_FREE_WORKSPACE                           \
+{                                                   \
+    GB_FREE_WORK (&Slice_nvec, Slice_nvec_size) ;   \
+    GB_FREE_WORK (&Slice_bad, Slice_bad_size) ;     \
+}
+
+#define GB_FREE_ALL                                 \
+{                                                   \
+    GB_FREE_WORKSPACE ;                             \
+    GB_FREE (&Ap_new, Ap_new_size) ;                \
+    GB_FREE (&Ah_new, Ah_new_size) ;                \
+}
+
+GrB_Info GxB_Matrix_pack_COO      // pack a matrix from sorted COO tuples
+(
+    GrB_Matrix A,       // matrix to create (type, nrows, ncols unchanged)
+    GrB_Index **Ai,     // row indices, Ai_size >= nvals*sizeof(int64_t)
+    GrB_Index **Aj,     // column indices, Aj_size >= nvals*sizeof(int64_t)
+    void **Ax,          // values, Ax_size >= nvals * (type size)
+                        // or Ax_size >= (type size), if iso is true
+    GrB_Index Ai_size,  // size of Ai in bytes
+    GrB_Index Aj_size,  // size of Aj in bytes
+    GrB_Index Ax_size,  // size of Ax in bytes
+    bool iso,           // if true, A is iso
+    GrB_Index nvals,    // number of tuples
+    const GrB_Descriptor desc
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs and get the descriptor
+    //--------------------------------------------------------------------------
+
+    int64_t *restrict Slice_nvec = NULL ; size_t Slice_nvec_size = 0 ;
+    int64_t *restrict Slice_bad  = NULL ; size_t Slice_bad_size  = 0 ;
+    int64_t *restrict Ap_new = NULL ; size_t Ap_new_size = 0 ;
+    int64_t *restrict Ah_new = NULL ; size_t Ah_new_size = 0 ;
+
+    GB_WHERE (A, "GxB_Matrix_pack_COO (A, &Ai, &Aj, &Ax, "
+        "Ai_size, Aj_size, Ax_size, iso, nvals, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_pack_COO") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6, xx7) ;
+
+    if (nvals > GB_NMAX)
+    {
+        return (GrB_INVALID_VALUE) ;
+    }
+    GB_RETURN_IF_NULL (Ai) ;
+    GB_RETURN_IF_NULL (Aj) ;
+    GB_RETURN_IF_NULL (Ax) ;
+    if (nvals > 0)
+    {
+        GB_RETURN_IF_NULL (*Ai) ;
+        GB_RETURN_IF_NULL (*Aj) ;
+        GB_RETURN_IF_NULL (*Ax) ;
+    }
+    // Ax must hold nvals entries, or a single entry if A is iso
+    GrB_Index Ax_size_required = (nvals == 0) ? 0 :
+        ((iso ? 1 : nvals) * A->type->size) ;
+    if (Ai_size < nvals * sizeof (int64_t) ||
+        Aj_size < nvals * sizeof (int64_t) ||
+        Ax_size < Ax_size_required)
+    {
+        return (GrB_INVALID_VALUE) ;
+    }
+
+    // The tuples are sorted by (j,i) where j is the vector index and i is the
+    // index within the vector.  Vi becomes A->i, and Vj is used to construct
+    // A->h and A->p.
+    const bool is_csc = A->is_csc ;
+    GrB_Index **Vi = is_csc ? Ai : Aj ;
+    GrB_Index **Vj = is_csc ? Aj : Ai ;
+    GrB_Index Vi_size = is_csc ? Ai_size : Aj_size ;
+    GrB_Index Vj_size = is_csc ? Aj_size : Ai_size ;
+    const int64_t vlen = A->vlen ;
+    const int64_t vdim = A->vdim ;
+    const int64_t n = (int64_t) nvals ;
+
+    //--------------------------------------------------------------------------
+    // allocate workspace
+    //--------------------------------------------------------------------------
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+    int nthreads = GB_nthreads (n, chunk, nthreads_max) ;
+
+    Slice_nvec = GB_MALLOC_WORK (nthreads+1, int64_t, &Slice_nvec_size) ;
+    Slice_bad  = GB_MALLOC_WORK (nthreads, int64_t, &Slice_bad_size) ;
+    if (Slice_nvec == NULL || Slice_bad == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // check the tuples and count the vectors in each slice
+    //--------------------------------------------------------------------------
+
+    const int64_t *restrict I = (int64_t *) ((n > 0) ? (*Vi) : NULL) ;
+    const int64_t *restrict J = (int64_t *) ((n > 0) ? (*Vj) : NULL) ;
+
+    int tid ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (tid = 0 ; tid < nthreads ; tid++)
+    {
+        int64_t pstart, pend, my_nvec = 0 ;
+        GB_PARTITION (pstart, pend, n, tid, nthreads) ;
+        int64_t ilast = (pstart == 0) ? -1 : I [pstart-1] ;
+        int64_t jlast = (pstart == 0) ? -1 : J [pstart-1] ;
+        Slice_bad [tid] = -1 ;
+        for (int64_t p = pstart ; p < pend ; p++)
+        {
+            int64_t i = I [p] ;
+            int64_t j = J [p] ;
+            if (i < 0 || i >= vlen || j < 0 || j >= vdim ||
+                j < jlast || (j == jlast && i <= ilast))
+            {
+                // index out of bounds, out of order, or a duplicate
+                Slice_bad [tid] = p ;
+                break ;
+            }
+            if (j != jlast) my_nvec++ ;
+            ilast = i ;
+            jlast = j ;
+        }
+        Slice_nvec [tid] = my_nvec ;
+    }
+
+    // collect the report from each thread
+    for (tid = 0 ; tid < nthreads ; tid++)
+    {
+        int64_t p = Slice_bad [tid] ;
+        if (p >= 0)
+        {
+            int64_t i = I [p] ;
+            int64_t j = J [p] ;
+            int64_t row = is_csc ? i : j ;
+            int64_t col = is_csc ? j : i ;
+            GB_FREE_ALL ;
+            if (i < 0 || i >= vlen || j < 0 || j >= vdim)
+            {
+                GB_ERROR (GrB_INDEX_OUT_OF_BOUNDS,
+                    "index (" GBd "," GBd ") out of bounds,"
+                    " must be < (" GBd ", " GBd ")",
+                    row, col, GB_NROWS (A), GB_NCOLS (A)) ;
+            }
+            else
+            {
+                GB_ERROR (GrB_INVALID_VALUE,
+                    "tuple " GBd " at index (" GBd "," GBd ") is a duplicate"
+                    " or out of order; tuples must be sorted by %s, with no"
+                    " duplicates", p, row, col, is_csc ? "column" : "row") ;
+            }
+        }
+    }
+
+    GB_cumsum (Slice_nvec, nthreads, NULL, 1, NULL) ;
+    const int64_t nvec = Slice_nvec [nthreads] ;
+
+    //--------------------------------------------------------------------------
+    // construct the hyperlist and vector pointers
+    //--------------------------------------------------------------------------
+
+    Ap_new = GB_MALLOC (GB_IMAX (nvec, 1) + 1, int64_t, &Ap_new_size) ;
+    Ah_new = GB_MALLOC (GB_IMAX (nvec, 1), int64_t, &Ah_new_size) ;
+    if (Ap_new == NULL || Ah_new == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (tid = 0 ; tid < nthreads ; tid++)
+    {
+        int64_t pstart, pend ;
+        GB_PARTITION (pstart, pend, n, tid, nthreads) ;
+        int64_t k = Slice_nvec [tid] ;
+        int64_t jlast = (pstart == 0) ? -1 : J [pstart-1] ;
+        for (int64_t p = pstart ; p < pend ; p++)
+        {
+            int64_t j = J [p] ;
+            if (j != jlast)
+            {
+                // vector j starts at position p
+                Ah_new [k] = j ;
+                Ap_new [k] = p ;
+                k++ ;
+                jlast = j ;
+            }
+        }
+    }
+    Ap_new [nvec] = n ;
+
+    //--------------------------------------------------------------------------
+    // pack the matrix
+    //--------------------------------------------------------------------------
+
+    // The tuples have been checked above, so the import can trust them.
+    // Ap_new and Ah_new are already in the debug memtable, so only A->i and
+    // A->x are added to it below.
+    GB_FREE_WORKSPACE ;
+    GB_OK (GB_import (true, &A, A->type, vlen, vdim, false,
+        (GrB_Index **) &Ap_new, Ap_new_size,    // Ap
+        (GrB_Index **) &Ah_new, Ah_new_size,    // Ah
+        NULL, 0,                                // Ab
+        Vi, Vi_size,                            // Ai
+        Ax, Ax_size,                            // Ax
+        0, false, nvec,                         // nvec, not jumbled
+        GxB_HYPERSPARSE, is_csc,                // hypersparse, same format
+        iso, true, false, Werk)) ;
+    GB_Global_memtable_add (A->i, A->i_size) ;
+    GB_Global_memtable_add (A->x, A->x_size) ;
+    A->nvec_nonempty = nvec ;
+
+    // free the vector indices of the tuples
+    if (*Vj != NULL)
+    {
+        GB_Global_memtable_add (*Vj, Vj_size) ;
+        GB_FREE (Vj, Vj_size) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // conform the matrix to its desired sparsity format
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_conform (A, Werk)) ;
+    ASSERT_MATRIX_OK (A, "A packed from COO", GB0) ;
+    GB_BURBLE_END ;
+    return (GrB_SUCCESS) ;
+}
+
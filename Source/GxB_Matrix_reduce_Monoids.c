@@ -0,0 +1,120 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_reduce_Monoids: reduce a matrix with several monoids at once
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// For each k in the range 0 to n-1, w [k] = reduce (A) and s [k] = reduce (A)
+// using monoid [k], all in a single pass over the entries of A.  The vector
+// w [k] reduces each row of A, or each column of A if the descriptor has
+// GrB_INP0 set to GrB_TRAN, and the scalar s [k] reduces all entries of A.
+// Either array w or s may be NULL, and any w [k] or s [k] may be NULL, if
+// that result is not needed.  If monoid [k] is NULL, the entries of A are
+// counted instead: w [k] (i) is the # of entries in the ith row (or column)
+// of A, and s [k] is nvals (A).
+
+// No mask or accum is used: w [k] and s [k] are replaced with their results.
+// The results are identical to GrB_reduce (w [k], NULL, NULL, monoid [k], A,
+// desc) and GrB_reduce (s [k], NULL, monoid [k], A, NULL), except for roundoff
+// when the monoid is not exactly associative (such as PLUS for floating-point
+// types), and except that A is read just once.  This is useful for steps that
+// need several statistics of the rows of a matrix at the same time, such as
+// the degree, sum, and maximum weight of each node of a graph.
+
+#include "GB_reduce.h"
+
+GrB_Info GxB_Matrix_reduce_Monoids  // w [k] = reduce (A), s [k] = reduce (A)
+(
+    GrB_Vector *w,                  // array of n vectors, or NULL
+    GrB_Scalar *s,                  // array of n scalars, or NULL
+    const GrB_Monoid *monoid,       // array of n monoids
+    int n,                          // # of reductions
+    const GrB_Matrix A,             // matrix to reduce
+    const GrB_Descriptor desc       // descriptor for A
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_Matrix_reduce_Monoids (w, s, monoid, n, A, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_reduce_Monoids") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_RETURN_IF_FAULTY (desc) ;
+    if (n < 0)
+    {
+        GB_ERROR (GrB_INVALID_VALUE, "Number of reductions %d"
+            " must be non-negative", n) ;
+    }
+    if (n > 0)
+    {
+        GB_RETURN_IF_NULL (monoid) ;
+    }
+
+    // get the descriptor
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, A_transpose, xx4, xx5, xx6);
+
+    // the length of each vector w [k]
+    int64_t nw = A_transpose ? GB_NCOLS (A) : GB_NROWS (A) ;
+
+    for (int k = 0 ; k < n ; k++)
+    {
+        GB_RETURN_IF_FAULTY (monoid [k]) ;
+        GrB_Vector wk = (w == NULL) ? NULL : w [k] ;
+        GrB_Scalar sk = (s == NULL) ? NULL : s [k] ;
+        GB_RETURN_IF_FAULTY (wk) ;
+        GB_RETURN_IF_FAULTY (sk) ;
+
+        // the type of each result: the monoid type, or int64 if counting
+        GrB_Type ztype = (monoid [k] == NULL) ? GrB_INT64 :
+            monoid [k]->op->ztype ;
+
+        // z = reduce (A) must be compatible
+        if (monoid [k] != NULL && !GB_Type_compatible (A->type, ztype))
+        {
+            GB_ERROR (GrB_DOMAIN_MISMATCH,
+                "Incompatible type for reduction monoid z=%s(x,y):\n"
+                "input matrix A of type [%s]\n"
+                "cannot be typecast to reduction monoid of type [%s]",
+                monoid [k]->op->name, A->type->name, ztype->name) ;
+        }
+
+        // w [k] = z and s [k] = z must be compatible
+        if (wk != NULL && !GB_Type_compatible (wk->type, ztype))
+        {
+            GB_ERROR (GrB_DOMAIN_MISMATCH,
+                "Result w [%d] of type [%s]\n"
+                "cannot be typecast from the reduction of type [%s]",
+                k, wk->type->name, ztype->name) ;
+        }
+        if (sk != NULL && !GB_Type_compatible (sk->type, ztype))
+        {
+            GB_ERROR (GrB_DOMAIN_MISMATCH,
+                "Result s [%d] of type [%s]\n"
+                "cannot be typecast from the reduction of type [%s]",
+                k, sk->type->name, ztype->name) ;
+        }
+
+        // check the dimensions
+        if (wk != NULL && GB_NROWS (wk) != nw)
+        {
+            GB_ERROR (GrB_DIMENSION_MISMATCH,
+                "w [%d] = reduce (A):  length of w [%d] is " GBd ";\n"
+                "it must match the number of %s of A, which is " GBd ".",
+                k, k, GB_NROWS (wk), A_transpose ? "columns" : "rows", nw) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // w [k] = reduce (A) and s [k] = reduce (A) for all k
+    //--------------------------------------------------------------------------
+
+    info = GB_reduce_multi (w, s, monoid, n, A, A_transpose, Werk) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
+
@@ -0,0 +1,49 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_reduce_SelectApply: select, apply, and reduce, in one pass
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// w<M> = accum (w, reduce (op (select (A)))).  The result is the same as:
+
+//      GrB_select (S, NULL, NULL, selectop, A, Thunk, NULL) ;
+//      GrB_apply (F, NULL, NULL, op, S, NULL) ;
+//      GrB_reduce (w, M, accum, monoid, F, desc) ;
+
+// where S and F are matrices of the same size as A, except that S and F are
+// not constructed when the three steps can be fused into a single pass over
+// the entries of A.  The rows of A are reduced, or the columns of A if the
+// descriptor has GrB_INP0 set to GrB_TRAN.  Either op or selectop may be NULL
+// to skip that step.  The Thunk is not accessed if selectop is NULL.
+
+// The fused method is used when the rows of a matrix held by row (or the
+// columns of a matrix held by column) are reduced, and op and selectop are
+// built-in operators (op cannot be positional).  It requires the JIT.
+
+#include "GB_reduce.h"
+
+GrB_Info GxB_Matrix_reduce_SelectApply  // w<M> = accum (w,reduce(op(sel(A))))
+(
+    GrB_Vector w,                   // input/output vector for results
+    const GrB_Vector M,             // optional mask for w, unused if NULL
+    const GrB_BinaryOp accum,       // optional accum for z=accum(w,t)
+    const GrB_Monoid monoid,        // reduce monoid for t=reduce(...)
+    const GrB_UnaryOp op,           // unary op to apply, or NULL
+    const GrB_IndexUnaryOp selectop,    // op to select entries, or NULL
+    const GrB_Scalar Thunk,         // thunk for selectop
+    const GrB_Matrix A,             // first input:  matrix A
+    const GrB_Descriptor desc       // descriptor for w, M, and A
+)
+{
+    GB_WHERE (w, "GxB_Matrix_reduce_SelectApply (w, M, accum, monoid, op, "
+        "selectop, Thunk, A, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_reduce_SelectApply") ;
+    GrB_Info info = GB_reduce_select_apply ((GrB_Matrix) w, (GrB_Matrix) M,
+        accum, monoid, op, selectop, Thunk, A, desc, Werk) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
+
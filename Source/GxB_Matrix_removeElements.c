@@ -0,0 +1,241 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_removeElements: remove a set of entries from a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Removes the entries C (I(k),J(k)) for k = 0:n-1 from the matrix C, with the
+// same result as calling GrB_Matrix_removeElement once for each (I(k),J(k)).
+// Entries are located in parallel, and zombies are created (or the bitmap is
+// cleared) in a single pass.  Pending tuples are assembled only if some entry
+// is not found in C and C has pending tuples.
+
+#include "GB.h"
+#include "GB_sort.h"
+
+#define GB_FREE_ALL                         \
+{                                           \
+    GB_FREE_WORK (&Pos, Pos_size) ;         \
+}
+
+//------------------------------------------------------------------------------
+// GB_Matrix_removeElements: remove a set of entries from a matrix
+//------------------------------------------------------------------------------
+
+GrB_Info GB_Matrix_removeElements
+(
+    GrB_Matrix C,               // matrix to remove entries from
+    const GrB_Index *I,         // row indices
+    const GrB_Index *J,         // column indices
+    const GrB_Index n,          // number of entries to remove
+    GB_Werk Werk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    int64_t *restrict Pos = NULL ; size_t Pos_size = 0 ;
+
+    GB_RETURN_IF_NULL (I) ;
+    GB_RETURN_IF_NULL (J) ;
+
+    int nthreads_max = GB_Context_nthreads_max ( ) ;
+    double chunk = GB_Context_chunk ( ) ;
+    int nthreads = GB_nthreads (n, chunk, nthreads_max) ;
+
+    const GrB_Index nrows = GB_NROWS (C) ;
+    const GrB_Index ncols = GB_NCOLS (C) ;
+    int64_t k ;
+    bool indices_ok = true ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static) \
+        reduction(&&:indices_ok)
+    for (k = 0 ; k < n ; k++)
+    {
+        indices_ok = indices_ok && (I [k] < nrows) && (J [k] < ncols) ;
+    }
+
+    if (!indices_ok)
+    {
+        // find the first invalid index, for the error message
+        for (k = 0 ; k < n ; k++)
+        {
+            if (I [k] >= nrows)
+            {
+                GB_ERROR (GrB_INVALID_INDEX,
+                    "Row index " GBu " out of range; must be < " GBd,
+                    I [k], nrows) ;
+            }
+            if (J [k] >= ncols)
+            {
+                GB_ERROR (GrB_INVALID_INDEX,
+                    "Column index " GBu " out of range; must be < " GBd,
+                    J [k], ncols) ;
+            }
+        }
+    }
+
+    if (n == 0)
+    {
+        // quick return
+        return (GrB_SUCCESS) ;
+    }
+
+    // C is about to be modified, so its cached transpose is no longer valid
+    GB_transpose_cache_free (C) ;
+
+    //--------------------------------------------------------------------------
+    // if C is jumbled, wait on the matrix first.  If full, convert to nonfull
+    //--------------------------------------------------------------------------
+
+    if (GB_IS_FULL (C))
+    {
+        // convert C from full to sparse
+        GB_OK (GB_convert_to_nonfull (C, Werk)) ;
+    }
+    else if (C->jumbled)
+    {
+        // C is sparse or hypersparse, and jumbled
+        GB_OK (GB_wait (C, "C (removeElements:jumbled)", Werk)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // C is not jumbled and not full; it may have zombies and pending tuples
+    //--------------------------------------------------------------------------
+
+    ASSERT (!GB_IS_FULL (C)) ;
+    ASSERT (GB_ZOMBIES_OK (C)) ;
+    ASSERT (!GB_JUMBLED (C)) ;
+    ASSERT (GB_PENDING_OK (C)) ;
+
+    bool C_is_pending = GB_PENDING (C) ;
+    if (GB_nnz (C) == 0 && !C_is_pending)
+    {
+        // quick return
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // find each entry
+    //--------------------------------------------------------------------------
+
+    // Pos [k] is the position of the kth entry if it is live, or -1 if it is
+    // not present (not found, a zombie, or not in the bitmap).
+
+    Pos = GB_MALLOC_WORK (n, int64_t, &Pos_size) ;
+    if (Pos == NULL)
+    {
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    const bool C_is_csc = C->is_csc ;
+    const int64_t *restrict Ci = C->i ;
+    const int8_t  *restrict Cb = C->b ;
+    int64_t nmissing = 0 ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static) \
+        reduction(+:nmissing)
+    for (k = 0 ; k < n ; k++)
+    {
+        int64_t i = (C_is_csc) ? I [k] : J [k] ;
+        int64_t j = (C_is_csc) ? J [k] : I [k] ;
+        int64_t p = GB_Element_find (C, i, j) ;
+        nmissing += (p < 0) ;
+        if (p >= 0 && ((Ci != NULL && GB_IS_ZOMBIE (Ci [p])) ||
+                       (Cb != NULL && Cb [p] == 0)))
+        {
+            // C(i,j) is a zombie or is not in the bitmap
+            p = -1 ;
+        }
+        Pos [k] = p ;
+    }
+
+    //--------------------------------------------------------------------------
+    // assemble any pending tuples if some entries were not found
+    //--------------------------------------------------------------------------
+
+    if (nmissing > 0 && C_is_pending)
+    {
+        // An entry not in C may be a pending tuple.  Assemble them and look
+        // again.  There are no pending tuples after the wait, so this
+        // recursion will only happen once.
+        GB_FREE_ALL ;
+        GB_OK (GB_wait (C, "C (removeElements:pending tuples)", Werk)) ;
+        ASSERT (!GB_PENDING (C)) ;
+        return (GB_Matrix_removeElements (C, I, J, n, Werk)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // sort the positions so that duplicates are adjacent
+    //--------------------------------------------------------------------------
+
+    GB_OK (GB_msort_1 (Pos, n, nthreads)) ;
+
+    //--------------------------------------------------------------------------
+    // remove each entry, skipping duplicates and entries not present
+    //--------------------------------------------------------------------------
+
+    int64_t *restrict Ci_mod = C->i ;
+    int8_t  *restrict Cb_mod = C->b ;
+    int64_t nremoved = 0 ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static) \
+        reduction(+:nremoved)
+    for (k = 0 ; k < n ; k++)
+    {
+        int64_t p = Pos [k] ;
+        if (p < 0 || (k > 0 && Pos [k-1] == p)) continue ;
+        if (Cb_mod != NULL)
+        {
+            // remove C(i,j) from the bitmap
+            Cb_mod [p] = 0 ;
+        }
+        else
+        {
+            // C(i,j) becomes a zombie
+            Ci_mod [p] = GB_FLIP (Ci_mod [p]) ;
+        }
+        nremoved++ ;
+    }
+
+    if (Cb_mod != NULL)
+    {
+        C->nvals -= nremoved ;
+    }
+    else
+    {
+        C->nzombies += nremoved ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_ALL ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GxB_Matrix_removeElements: remove a set of entries from a matrix
+//------------------------------------------------------------------------------
+
+GrB_Info GxB_Matrix_removeElements
+(
+    GrB_Matrix C,               // matrix to remove entries from
+    const GrB_Index *I,         // row indices
+    const GrB_Index *J,         // column indices
+    GrB_Index n                 // number of entries to remove
+)
+{
+    GB_WHERE (C, "GxB_Matrix_removeElements (C, I, J, n)") ;
+    GB_BURBLE_START ("GxB_Matrix_removeElements") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (C) ;
+    GrB_Info info = GB_Matrix_removeElements (C, I, J, n, Werk) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
+
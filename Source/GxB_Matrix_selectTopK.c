@@ -0,0 +1,46 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_selectTopK: select the first k entries in each row or column
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+#include "GB.h"
+#include "GB_sort.h"
+
+GrB_Info GxB_Matrix_selectTopK
+(
+    // output:
+    GrB_Matrix C,           // matrix with the selected entries
+    // input
+    GrB_BinaryOp op,        // comparator op
+    GrB_Matrix A,           // matrix to select from
+    uint64_t k,             // # of entries to select in each row or column
+    const GrB_Descriptor desc
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE (C, "GxB_Matrix_selectTopK (C, op, A, k, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_selectTopK") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (C) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (op) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+
+    // get the descriptor
+    GB_GET_DESCRIPTOR (info, desc, xx0, xx1, xx2, A_transpose, xx3, xx4, xx5) ;
+
+    //--------------------------------------------------------------------------
+    // select the entries
+    //--------------------------------------------------------------------------
+
+    info = GB_select_topk (C, op, A, k, A_transpose, Werk) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
+
@@ -0,0 +1,58 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_setElements: set a list of entries in a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Set a list of entries in a matrix, C(I(k),J(k)) = X(k) for k = 0:n-1,
+// typecasting from the type of X to the type of C, as needed.  The result is
+// the same as calling GrB_Matrix_setElement once for each tuple, in order.
+
+// If dup is NULL: existing entries are overwritten, and if (I(k),J(k))
+// appears more than once, the last tuple is used.
+// If dup is a valid binary operator, it is used as an accumulator:
+// C(I(k),J(k)) = dup (C(I(k),J(k)), X(k)) if the entry is already present,
+// applied in order for k = 0:n-1.
+
+#define GB_FREE_ALL ;
+#include "GB.h"
+
+#define GB_SETS(prefix,type,T)                                              \
+GrB_Info GB_EVAL3 (prefix, _Matrix_setElements_, T) /* C(I,J) = X */        \
+(                                                                           \
+    GrB_Matrix C,                   /* matrix to modify                   */\
+    const GrB_Index *I,             /* array of row indices of tuples     */\
+    const GrB_Index *J,             /* array of column indices of tuples  */\
+    const type *X,                  /* array of values of tuples          */\
+    GrB_Index n,                    /* number of tuples                   */\
+    const GrB_BinaryOp dup          /* accum op for existing entries      */\
+)                                                                           \
+{                                                                           \
+    GB_WHERE (C, "GxB_Matrix_setElements_" GB_STR(T)                        \
+        " (C, I, J, X, n, dup)") ;                                          \
+    GB_BURBLE_START ("GxB_Matrix_setElements_" GB_STR(T)) ;                 \
+    GB_RETURN_IF_NULL_OR_FAULTY (C) ;                                       \
+    GrB_Info info = GB_setElements (C, dup, I, J, X, n,                     \
+        GB_ ## T ## _code, Werk) ;                                          \
+    GB_BURBLE_END ;                                                         \
+    return (info) ;                                                         \
+}
+
+GB_SETS (GxB, bool      , BOOL   )
+GB_SETS (GxB, int8_t    , INT8   )
+GB_SETS (GxB, int16_t   , INT16  )
+GB_SETS (GxB, int32_t   , INT32  )
+GB_SETS (GxB, int64_t   , INT64  )
+GB_SETS (GxB, uint8_t   , UINT8  )
+GB_SETS (GxB, uint16_t  , UINT16 )
+GB_SETS (GxB, uint32_t  , UINT32 )
+GB_SETS (GxB, uint64_t  , UINT64 )
+GB_SETS (GxB, float     , FP32   )
+GB_SETS (GxB, double    , FP64   )
+GB_SETS (GxB, GxB_FC32_t, FC32   )
+GB_SETS (GxB, GxB_FC64_t, FC64   )
+GB_SETS (GxB, void      , UDT    )
+
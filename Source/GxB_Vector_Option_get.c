@@ -51,6 +51,11 @@ GrB_Info GxB_Vector_Option_get_INT32    // gets the current option of a vector
             (*value) = v->sparsity_control ;
             break ;
 
+        case GxB_SPARSITY_ADAPTIVE : 
+
+            (*value) = (int32_t) v->sparsity_adaptive ;
+            break ;
+
         case GxB_SPARSITY_STATUS : 
 
             (*value) = GB_sparsity ((GrB_Matrix) v) ;
@@ -166,6 +171,17 @@ GrB_Info GxB_Vector_Option_get      // gets the current option of a vector
             }
             break ;
 
+        case GxB_SPARSITY_ADAPTIVE : 
+
+            {
+                va_start (ap, field) ;
+                int *sparsity_adaptive = va_arg (ap, int *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (sparsity_adaptive) ;
+                (*sparsity_adaptive) = (int) v->sparsity_adaptive ;
+            }
+            break ;
+
         case GxB_SPARSITY_STATUS : 
 
             {
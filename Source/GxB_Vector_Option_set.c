@@ -54,6 +54,11 @@ GrB_Info GxB_Vector_Option_set_INT32    // set an option in a vector
             v->sparsity_control = GB_sparsity_control (value, (int64_t) (-1)) ;
             break ;
 
+        case GxB_SPARSITY_ADAPTIVE : 
+
+            v->sparsity_adaptive = (value != 0) ;
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -170,6 +175,16 @@ GrB_Info GxB_Vector_Option_set      // set an option in a vector
             }
             break ;
 
+        case GxB_SPARSITY_ADAPTIVE : 
+
+            {
+                va_start (ap, field) ;
+                int sparsity_adaptive = va_arg (ap, int) ;
+                va_end (ap) ;
+                v->sparsity_adaptive = (sparsity_adaptive != 0) ;
+            }
+            break ;
+
         default : 
 
             return (GrB_INVALID_VALUE) ;
@@ -0,0 +1,72 @@
+//------------------------------------------------------------------------------
+// GxB_Vector_axpby: fused w<M> = accum (w, alpha*u+beta*v)
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// w<M> = accum (w, alpha*u+beta*v), where '+' and '*' are the additive monoid
+// and multiplicative operator of the semiring.  See GxB_Matrix_axpby.
+
+#include "GB_ewise.h"
+#include "GB_get_mask.h"
+
+GrB_Info GxB_Vector_axpby           // w<M> = accum (w, alpha*u+beta*v)
+(
+    GrB_Vector w,                   // input/output vector for results
+    const GrB_Vector M_in,          // optional mask for w, unused if NULL
+    const GrB_BinaryOp accum,       // optional accum for z=accum(w,t)
+    const GrB_Semiring semiring,    // defines '+' and '*' for alpha*u+beta*v
+    const GrB_Scalar alpha,         // scalar to multiply with u
+    const GrB_Vector u,             // first input:  vector u
+    const GrB_Scalar beta,          // scalar to multiply with v
+    const GrB_Vector v,             // second input: vector v
+    const GrB_Descriptor desc       // descriptor for w and M
+)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE (w, "GxB_Vector_axpby (w, M, accum, semiring, alpha, u,"
+        " beta, v, desc)") ;
+    GB_BURBLE_START ("GxB_axpby") ;
+    GB_RETURN_IF_NULL_OR_FAULTY (w) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (semiring) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (alpha) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (u) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (beta) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (v) ;
+    GB_RETURN_IF_FAULTY (M_in) ;
+    ASSERT (GB_VECTOR_OK (w)) ;
+    ASSERT (GB_VECTOR_OK (u)) ;
+    ASSERT (GB_VECTOR_OK (v)) ;
+    ASSERT (M_in == NULL || GB_VECTOR_OK (M_in)) ;
+
+    // get the descriptor
+    GB_GET_DESCRIPTOR (info, desc, C_replace, Mask_comp, Mask_struct,
+        xx1, xx2, xx3, xx7) ;
+
+    // get the mask
+    GrB_Matrix M = GB_get_mask ((GrB_Matrix) M_in, &Mask_comp, &Mask_struct) ;
+
+    //--------------------------------------------------------------------------
+    // w<M> = accum (w,t) where t = alpha*u+beta*v
+    //--------------------------------------------------------------------------
+
+    info = GB_ewise_axpby (
+        (GrB_Matrix) w, C_replace,  // w and its descriptor
+        M, Mask_comp, Mask_struct,  // mask and its descriptor
+        accum,                      // accumulate operator
+        semiring,                   // semiring that defines '+' and '*'
+        alpha, (GrB_Matrix) u, false,   // alpha and u, never transposed
+        beta,  (GrB_Matrix) v, false,   // beta and v, never transposed
+        Werk) ;
+
+    GB_BURBLE_END ;
+    return (info) ;
+}
+
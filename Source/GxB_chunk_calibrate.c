@@ -0,0 +1,33 @@
+//------------------------------------------------------------------------------
+// GxB_chunk_calibrate: tune the chunk for each kernel family
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GxB_chunk_calibrate measures the fork/join overhead of a parallel region,
+// and the time per unit of work of each kernel family, on this machine.  It
+// then sets the global GxB_CHUNK_FAMILY table (see GB_chunk_calibrate).  The
+// table can be read with GrB_get (GrB_GLOBAL, c, GxB_CHUNK_FAMILY), and reset
+// to its default with GrB_set (GrB_GLOBAL, NULL, GxB_CHUNK_FAMILY, 0).
+
+#include "GB.h"
+
+GrB_Info GxB_chunk_calibrate (void)
+{ 
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE1 ("GxB_chunk_calibrate ( )") ;
+
+    //--------------------------------------------------------------------------
+    // calibrate the chunk for each kernel family
+    //--------------------------------------------------------------------------
+
+    return (GB_chunk_calibrate ( )) ;
+}
+
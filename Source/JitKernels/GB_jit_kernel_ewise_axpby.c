@@ -0,0 +1,19 @@
+//------------------------------------------------------------------------------
+// GB_jit_kernel_ewise_axpby.c: T = alpha*A+beta*B
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The macros are constructed by GB_macrofy_ewise_axpby.  There are no
+// pre-compiled factory kernels for this method.
+
+GB_JIT_GLOBAL GB_JIT_KERNEL_EWISE_AXPBY_PROTO (GB_jit_kernel) ;
+GB_JIT_GLOBAL GB_JIT_KERNEL_EWISE_AXPBY_PROTO (GB_jit_kernel)
+{
+    #include "GB_ewise_axpby_template.c"
+    return (GrB_SUCCESS) ;
+}
+
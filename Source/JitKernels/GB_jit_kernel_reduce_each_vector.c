@@ -0,0 +1,24 @@
+//------------------------------------------------------------------------------
+// GB_jit_kernel_reduce_each_vector.c: JIT kernel to reduce each vector
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Tx [k] = reduce (A(:,k)) for each vector k of a non-iso matrix A, with no
+// zombies.  The macros are the same as the GB_jit_kernel_reduce kernel, and
+// are constructed by GB_macrofy_reduce.  The template file
+// GB_reduce_each_vector_template.c appears in GraphBLAS/Source/Template, and
+// is used by both the pre-compiled kernels in GraphBLAS/Source/FactoryKernels,
+// and by the JIT kernel here.
+
+GB_JIT_GLOBAL GB_JIT_KERNEL_REDUCE_EACH_VECTOR_PROTO (GB_jit_kernel) ;
+GB_JIT_GLOBAL GB_JIT_KERNEL_REDUCE_EACH_VECTOR_PROTO (GB_jit_kernel)
+{
+    GB_Z_TYPE *restrict Tx = (GB_Z_TYPE *) Tx_space ;
+    #include "GB_reduce_each_vector_template.c"
+    return (GrB_SUCCESS) ;
+}
+
@@ -0,0 +1,23 @@
+//------------------------------------------------------------------------------
+// GB_jit_kernel_reduce_select_apply.c: fused select, apply, and reduce
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Tx [k] = reduce (op (select (A(:,k)))) for each vector k of a non-iso matrix
+// A, with no zombies.  The macros are constructed by
+// GB_macrofy_reduce_select_apply.  There are no pre-compiled factory kernels
+// for this method, so the template GB_reduce_select_apply_template.c is used
+// only by this JIT kernel.
+
+GB_JIT_GLOBAL GB_JIT_KERNEL_REDUCE_SELECT_APPLY_PROTO (GB_jit_kernel) ;
+GB_JIT_GLOBAL GB_JIT_KERNEL_REDUCE_SELECT_APPLY_PROTO (GB_jit_kernel)
+{
+    GB_Z_TYPE *restrict Tx = (GB_Z_TYPE *) Tx_space ;
+    #include "GB_reduce_select_apply_template.c"
+    return (GrB_SUCCESS) ;
+}
+
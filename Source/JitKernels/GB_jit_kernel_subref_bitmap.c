@@ -0,0 +1,46 @@
+//------------------------------------------------------------------------------
+// GB_jit_kernel_subref_bitmap: C=A(I,J) where C and A are bitmap or full
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// non-iso numeric subref, where C and A have the same type and sparsity
+
+#if GB_A_IS_BITMAP
+    #define GB_IXJ_WORK(pC,pA)                  \
+    {                                           \
+        int8_t ab = Ab [pA] ;                   \
+        Cb [pC] = ab ;                          \
+        if (ab)                                 \
+        {                                       \
+            Cx [pC] = Ax [pA] ;                 \
+            task_cnvals++ ;                     \
+        }                                       \
+    }
+#else
+    #define GB_IXJ_WORK(pC,pA)                  \
+    {                                           \
+        Cx [pC] = Ax [pA] ;                     \
+    }
+#endif
+
+GB_JIT_GLOBAL GB_JIT_KERNEL_SUBREF_BITMAP_PROTO (GB_jit_kernel) ;
+GB_JIT_GLOBAL GB_JIT_KERNEL_SUBREF_BITMAP_PROTO (GB_jit_kernel)
+{
+    #if GB_A_IS_BITMAP
+    const int8_t *restrict Ab = A->b ;
+          int8_t *restrict Cb = C->b ;
+    #endif
+    const GB_A_TYPE *restrict Ax = (GB_A_TYPE *) A->x ;
+          GB_C_TYPE *restrict Cx = (GB_C_TYPE *) C->x ;
+    const int64_t avlen = A->vlen ;
+    int64_t cnvals = 0 ;
+    #include "GB_bitmap_subref_template.c"
+    #if GB_A_IS_BITMAP
+    C->nvals = cnvals ;
+    #endif
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,27 @@
+//------------------------------------------------------------------------------
+// GB_jit_kernel_subref_sparse: C=A(I,J) where C and A are sparse/hypersparse
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// non-iso numeric subref, where C and A have the same type
+
+#include "GB_subref_method.h"
+
+GB_JIT_GLOBAL GB_JIT_KERNEL_SUBREF_SPARSE_PROTO (GB_jit_kernel) ;
+GB_JIT_GLOBAL GB_JIT_KERNEL_SUBREF_SPARSE_PROTO (GB_jit_kernel)
+{
+    #ifdef GB_JIT_RUNTIME
+    // get callback functions
+    GB_qsort_1b_f GB_qsort_1b = my_callback->GB_qsort_1b_func ;
+    #endif
+
+    const int64_t *restrict Cp = C->p ;
+    int64_t *restrict Ci = C->i ;
+    #define GB_PHASE_2_OF_2
+    #include "GB_subref_template.c"
+    return (GrB_SUCCESS) ;
+}
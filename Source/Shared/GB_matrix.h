@@ -512,6 +512,63 @@ bool jumbled ;          // true if the matrix may be jumbled.  bitmap and full
 
 bool iso ;              // true if all entries have the same value
 
+//------------------------------------------------------------------------------
+// cached transpose
+//------------------------------------------------------------------------------
+
+// If A->transpose_cache is true (see GxB_TRANSPOSE_CACHE), the transpose of A
+// is kept in A->AT once it has been computed, so that subsequent uses of A'
+// (in GrB_mxm, GrB_vxm, GrB_transpose, and so on) do not need to transpose A
+// again.  A->AT has the same CSR/CSC format as A, so its vectors are the
+// vectors of A'.  It is never shallow and never has pending work.  A->AT is
+// freed whenever the content of A is modified, and rebuilt when it is next
+// needed.  Shallow copies of A do not have their own A->AT.
+
+GrB_Matrix AT ;         // cached transpose of A, or NULL
+bool transpose_cache ;  // if true, keep A->AT once it is computed
+
+//------------------------------------------------------------------------------
+// pinned hypersparsity
+//------------------------------------------------------------------------------
+
+// If A->hyper_pin is true (see GxB_HYPER_PIN), A is never converted from
+// hypersparse to sparse: the sparse format is replaced with hypersparse in the
+// sparsity control of A (see GB_sparsity_control_pinned), regardless of
+// A->hyper_switch and the number of non-empty vectors of A.  This avoids the
+// O(A->vdim) size of A->p for a matrix whose dimension is huge, even when it
+// temporarily has many non-empty vectors.  A->hyper_pin has no effect if
+// A->vdim <= 1.
+
+bool hyper_pin ;        // if true, never convert A to sparse
+
+//------------------------------------------------------------------------------
+// adaptive sparsity
+//------------------------------------------------------------------------------
+
+// If A->sparsity_adaptive is true (see GxB_SPARSITY_ADAPTIVE), GB_conform
+// chooses between sparse/hypersparse and bitmap with a cost model, instead of
+// the fixed A->bitmap_switch threshold.  Each time A is used as an input (by
+// GrB_mxm, GrB_assign, GrB_extract, and so on), GB_sparsity_adapt_use records
+// whether A was scanned (push) or accessed at random (pull), and how many
+// random accesses were made.  The counts decay so that they reflect the recent
+// mix of uses, and they are kept separately for uses of A when it has few
+// entries (band 0) and many entries (band 1), relative to A->bitmap_switch,
+// since many algorithms choose their access pattern by the size of their
+// inputs (a BFS, for example, pushes from a small frontier and pulls into a
+// large one).  When A is conformed, GB_sparsity_adapt_test estimates the work
+// saved per use if A were held in the other format, and adds it to
+// A->adapt_regret.  A is converted only when the regret exceeds the estimated
+// cost of the conversion, which is scaled by the measured times of operations
+// on A and of its conversions (in seconds per entry).
+
+bool sparsity_adaptive ;    // if true, use the cost model in GB_conform
+double adapt_nuses [2] ;    // decayed # of uses of A
+double adapt_npulls [2] ;   // decayed # of uses that access A at random
+double adapt_nprobes [2] ;  // decayed # of random accesses to A
+double adapt_regret ;       // work that the other format would have saved
+double adapt_op_rate ;      // measured seconds per entry, operations
+double adapt_cvt_rate ;     // measured seconds per entry, conversions
+
 //------------------------------------------------------------------------------
 // iterating through a matrix
 //------------------------------------------------------------------------------
@@ -475,6 +475,11 @@ struct GB_Context_opaque    // content of GxB_Context
     // OpenMP thread(s):
     double chunk ;          // chunk size for # of threads for small problems
     int nthreads_max ;      // max # threads to use in this call to GraphBLAS
+    // CPU binding:
+    int32_t *cpus ;         // CPUs for the threads of this Context, or NULL
+    size_t cpus_size ;      // allocated size of cpus
+    int ncpus ;             // # of CPUs in the cpus list
+    int numa_node ;         // NUMA node of the cpus, or -1 if not a node
     // GPU:
     int gpu_id ;            // if negative: use the CPU only; do not use a GPU
                             // if >= 0: then use GPU gpu_id
@@ -9,162 +9,208 @@
 
 // C and M are both sparse or both hyper, and C->h is a copy of M->h.
 // M is present, and not complemented.  It may be valued or structural.
+// The work is scheduled with the work-stealing scheduler in GB_task_steal.h.
 
 {
 
-    int tid ;
-    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1) \
-        reduction(+:nzombies)
-    for (tid = 0 ; tid < ntasks ; tid++)
+    //--------------------------------------------------------------------------
+    // split the entries of C into grains
+    //--------------------------------------------------------------------------
+
+    // The TaskList from GB_AxB_dot3_slice balances the estimated work of each
+    // task, but the estimate can be poor, particularly for matrices with a
+    // power-law degree distribution.  Instead of scheduling the tasks
+    // themselves, the entries of C are split into grains of grainsize entries
+    // each, and each thread starts with the grains of a contiguous set of
+    // tasks.  A thread that runs out of work steals the back half of the
+    // grains of another thread, so that a task that takes longer than its
+    // estimate is split on demand (see GB_task_steal.h).
+
+    const int64_t cnvec = C->nvec ;
+    const int64_t cnz = Cp [cnvec] ;
+    const int nworkers = GB_STEAL_NTHREADS (nthreads) ;
+    const int64_t grainsize = (nworkers == 1) ? GB_IMAX (cnz, 1) :
+        GB_task_steal_grainsize (cnz, nworkers, 256) ;
+    const int64_t ngrains = (cnz + grainsize - 1) / grainsize ;
+
+    // one range per thread, 64 bytes apart (see GB_task_steal.h)
+    uint64_t Range [GB_VLA (nworkers * GB_STEAL_PAD)] ;
+    for (int t = 0 ; t < nworkers ; t++)
     {
+        // thread t starts with the grains of TaskList [t0:t1-1]
+        int t0 = (int) ((((int64_t) t  ) * ntasks) / nworkers) ;
+        int t1 = (int) ((((int64_t) t+1) * ntasks) / nworkers) ;
+        int64_t lo = (t0 >= ntasks) ? ngrains : (TaskList [t0].pC / grainsize);
+        int64_t hi = (t1 >= ntasks) ? ngrains : (TaskList [t1].pC / grainsize);
+        Range [t * GB_STEAL_PAD] = GB_STEAL_RANGE (lo, hi) ;
+    }
 
-        //----------------------------------------------------------------------
-        // get the task descriptor
-        //----------------------------------------------------------------------
-
-        int64_t kfirst = TaskList [tid].kfirst ;
-        int64_t klast  = TaskList [tid].klast ;
-        int64_t pC_first = TaskList [tid].pC ;
-        int64_t pC_last  = TaskList [tid].pC_end ;
-        int64_t task_nzombies = 0 ;     // # of zombies found by this task
-
-        //----------------------------------------------------------------------
-        // compute all vectors in this task
-        //----------------------------------------------------------------------
+    //--------------------------------------------------------------------------
+    // compute all grains of C
+    //--------------------------------------------------------------------------
 
-        for (int64_t k = kfirst ; k <= klast ; k++)
+    int tid ;
+    #pragma omp parallel for num_threads(nworkers) schedule(static,1) \
+        reduction(+:nzombies)
+    for (tid = 0 ; tid < nworkers ; tid++)
+    {
+        int64_t grain = 0, grain_prior = -1, kfirst = 0 ;
+        while (GB_task_steal_next (&grain, Range, tid, nworkers))
         {
 
             //------------------------------------------------------------------
-            // get C(:,k) and M(:k)
+            // get the entries and vectors of this grain
             //------------------------------------------------------------------
 
-            #if defined ( GB_MASK_SPARSE_STRUCTURAL_AND_NOT_COMPLEMENTED )
-            // M and C are both sparse
-            const int64_t j = k ;
-            #else
-            // M and C are either both sparse or both hypersparse
-            const int64_t j = GBH_C (Ch, k) ;
-            #endif
-
-            int64_t pC_start = Cp [k] ;
-            int64_t pC_end   = Cp [k+1] ;
-            if (k == kfirst)
-            { 
-                // First vector for task; may only be partially owned.
-                pC_start = pC_first ;
-                pC_end   = GB_IMIN (pC_end, pC_last) ;
-            }
-            else if (k == klast)
-            { 
-                // Last vector for task; may only be partially owned.
-                pC_end   = pC_last ;
-            }
-            else
-            { 
-                // task completely owns this vector C(:,k).
-            }
+            // grains are usually taken in order, so the search for kfirst
+            // starts at the kfirst of the prior grain, if it came earlier
+            int64_t pC_first = grain * grainsize ;
+            int64_t pC_last  = GB_IMIN (pC_first + grainsize, cnz) ;
+            kfirst = GB_task_steal_vector (pC_first, Cp,
+                (grain > grain_prior) ? kfirst : 0, cnvec) ;
+            int64_t klast = GB_task_steal_vector (pC_last-1, Cp, kfirst,
+                cnvec) ;
+            grain_prior = grain ;
+            int64_t task_nzombies = 0 ;     // # of zombies found by this grain
 
             //------------------------------------------------------------------
-            // get B(:,j)
+            // compute all vectors in this grain
             //------------------------------------------------------------------
 
-            #if GB_B_IS_HYPER
-                // B is hyper: find B(:,j) using the B->Y hyper hash
-                int64_t pB_start, pB_end ;
-                GB_hyper_hash_lookup (Bh, bnvec, Bp, B_Yp, B_Yi, B_Yx,
-                    B_hash_bits, j, &pB_start, &pB_end) ;
-            #elif GB_B_IS_SPARSE
-                // B is sparse
-                const int64_t pB_start = Bp [j] ;
-                const int64_t pB_end = Bp [j+1] ;
-            #else
-                // B is bitmap or full
-                const int64_t pB_start = j * vlen ;
-            #endif
-
-            #if (GB_B_IS_SPARSE || GB_B_IS_HYPER)
-                const int64_t bjnz = pB_end - pB_start ;
-                if (bjnz == 0)
-                {
-                    // no work to do if B(:,j) is empty, except for zombies
-                    task_nzombies += (pC_end - pC_start) ;
-                    for (int64_t pC = pC_start ; pC < pC_end ; pC++)
-                    { 
-                        // C(i,j) is a zombie
-                        int64_t i = Mi [pC] ;
-                        Ci [pC] = GB_FLIP (i) ;
-                    }
-                    continue ;
-                }
-                #if (GB_A_IS_SPARSE || GB_A_IS_HYPER)
-                    // Both A and B are sparse; get first and last in B(:,j)
-                    const int64_t ib_first = Bi [pB_start] ;
-                    const int64_t ib_last  = Bi [pB_end-1] ;
-                #endif
-            #endif
+            for (int64_t k = kfirst ; k <= klast ; k++)
+            {
 
-            //------------------------------------------------------------------
-            // C(:,j)<M(:,j)> = A(:,i)'*B(:,j)
-            //------------------------------------------------------------------
+                //--------------------------------------------------------------
+                // get C(:,k) and M(:k)
+                //--------------------------------------------------------------
 
-            for (int64_t pC = pC_start ; pC < pC_end ; pC++)
-            {
+                #if defined ( GB_MASK_SPARSE_STRUCTURAL_AND_NOT_COMPLEMENTED )
+                // M and C are both sparse
+                const int64_t j = k ;
+                #else
+                // M and C are either both sparse or both hypersparse
+                const int64_t j = GBH_C (Ch, k) ;
+                #endif
+
+                int64_t pC_start = Cp [k] ;
+                int64_t pC_end   = Cp [k+1] ;
+                if (k == kfirst)
+                { 
+                    // First vector for grain; may only be partially owned.
+                    pC_start = pC_first ;
+                    pC_end   = GB_IMIN (pC_end, pC_last) ;
+                }
+                else if (k == klast)
+                { 
+                    // Last vector for grain; may only be partially owned.
+                    pC_end   = pC_last ;
+                }
+                else
+                { 
+                    // grain completely owns this vector C(:,k).
+                }
 
                 //--------------------------------------------------------------
-                // get C(i,j) and M(i,j)
+                // get B(:,j)
                 //--------------------------------------------------------------
 
-                bool cij_exists = false ;
-                GB_CIJ_DECLARE (cij) ;
-                #if GB_IS_PLUS_PAIR_REAL_SEMIRING
-                cij = 0 ;
+                #if GB_B_IS_HYPER
+                    // B is hyper: find B(:,j) using the B->Y hyper hash
+                    int64_t pB_start, pB_end ;
+                    GB_hyper_hash_lookup (Bh, bnvec, Bp, B_Yp, B_Yi, B_Yx,
+                        B_hash_bits, j, &pB_start, &pB_end) ;
+                #elif GB_B_IS_SPARSE
+                    // B is sparse
+                    const int64_t pB_start = Bp [j] ;
+                    const int64_t pB_end = Bp [j+1] ;
+                #else
+                    // B is bitmap or full
+                    const int64_t pB_start = j * vlen ;
                 #endif
 
-                // get the value of M(i,j)
-                int64_t i = Mi [pC] ;
-                #if !defined ( GB_MASK_SPARSE_STRUCTURAL_AND_NOT_COMPLEMENTED )
-                // if M is structural, no need to check its values
-                if (GB_MCAST (Mx, pC, msize))
+                #if (GB_B_IS_SPARSE || GB_B_IS_HYPER)
+                    const int64_t bjnz = pB_end - pB_start ;
+                    if (bjnz == 0)
+                    {
+                        // no work to do if B(:,j) is empty, except for zombies
+                        task_nzombies += (pC_end - pC_start) ;
+                        for (int64_t pC = pC_start ; pC < pC_end ; pC++)
+                        { 
+                            // C(i,j) is a zombie
+                            int64_t i = Mi [pC] ;
+                            Ci [pC] = GB_FLIP (i) ;
+                        }
+                        continue ;
+                    }
+                    #if (GB_A_IS_SPARSE || GB_A_IS_HYPER)
+                        // Both A and B are sparse; get first and last in B(:,j)
+                        const int64_t ib_first = Bi [pB_start] ;
+                        const int64_t ib_last  = Bi [pB_end-1] ;
+                    #endif
                 #endif
-                { 
+
+                //--------------------------------------------------------------
+                // C(:,j)<M(:,j)> = A(:,i)'*B(:,j)
+                //--------------------------------------------------------------
+
+                for (int64_t pC = pC_start ; pC < pC_end ; pC++)
+                {
 
                     //----------------------------------------------------------
-                    // the mask allows C(i,j) to be computed
+                    // get C(i,j) and M(i,j)
                     //----------------------------------------------------------
 
-                    #if GB_A_IS_HYPER
-                    // A is hyper: find A(:,i) using the A->Y hyper hash
-                    int64_t pA, pA_end ;
-                    GB_hyper_hash_lookup (Ah, anvec, Ap, A_Yp, A_Yi, A_Yx,
-                        A_hash_bits, i, &pA, &pA_end) ;
-                    const int64_t ainz = pA_end - pA ;
-                    if (ainz > 0)
-                    #elif GB_A_IS_SPARSE
-                    // A is sparse
-                    int64_t pA = Ap [i] ;
-                    const int64_t pA_end = Ap [i+1] ;
-                    const int64_t ainz = pA_end - pA ;
-                    if (ainz > 0)
-                    #else
-                    // A is bitmap or full
-                    const int64_t pA = i * vlen ;
+                    bool cij_exists = false ;
+                    GB_CIJ_DECLARE (cij) ;
+                    #if GB_IS_PLUS_PAIR_REAL_SEMIRING
+                    cij = 0 ;
+                    #endif
+
+                    // get the value of M(i,j)
+                    int64_t i = Mi [pC] ;
+                    #if !defined(GB_MASK_SPARSE_STRUCTURAL_AND_NOT_COMPLEMENTED)
+                    // if M is structural, no need to check its values
+                    if (GB_MCAST (Mx, pC, msize))
                     #endif
                     { 
-                        // C(i,j) = A(:,i)'*B(:,j)
-                        #include "GB_AxB_dot_cij.c"
+
+                        //------------------------------------------------------
+                        // the mask allows C(i,j) to be computed
+                        //------------------------------------------------------
+
+                        #if GB_A_IS_HYPER
+                        // A is hyper: find A(:,i) using the A->Y hyper hash
+                        int64_t pA, pA_end ;
+                        GB_hyper_hash_lookup (Ah, anvec, Ap, A_Yp, A_Yi, A_Yx,
+                            A_hash_bits, i, &pA, &pA_end) ;
+                        const int64_t ainz = pA_end - pA ;
+                        if (ainz > 0)
+                        #elif GB_A_IS_SPARSE
+                        // A is sparse
+                        int64_t pA = Ap [i] ;
+                        const int64_t pA_end = Ap [i+1] ;
+                        const int64_t ainz = pA_end - pA ;
+                        if (ainz > 0)
+                        #else
+                        // A is bitmap or full
+                        const int64_t pA = i * vlen ;
+                        #endif
+                        { 
+                            // C(i,j) = A(:,i)'*B(:,j)
+                            #include "GB_AxB_dot_cij.c"
+                        }
                     }
-                }
 
-                if (!GB_CIJ_EXISTS)
-                { 
-                    // C(i,j) is a zombie
-                    task_nzombies++ ;
-                    Ci [pC] = GB_FLIP (i) ;
+                    if (!GB_CIJ_EXISTS)
+                    { 
+                        // C(i,j) is a zombie
+                        task_nzombies++ ;
+                        Ci [pC] = GB_FLIP (i) ;
+                    }
                 }
             }
+            nzombies += task_nzombies ;
         }
-        nzombies += task_nzombies ;
     }
 }
 
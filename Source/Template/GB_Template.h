@@ -60,6 +60,7 @@
 #include "GB_atomics.h"
 #include "GB_printf_kernels.h"
 #include "GB_assert_kernels.h"
+#include "GB_ijlist.h"
 #include "GB_opaque.h"
 #include "GB_math_macros.h"
 #include "GB_binary_search.h"
@@ -70,6 +71,7 @@
 #include "GB_nthreads.h"
 #include "GB_log2.h"
 #include "GB_task_struct.h"
+#include "GB_task_steal.h"
 #include "GB_hash.h"
 #include "GB_wait_macros.h"
 #include "GB_AxB_macros.h"
@@ -0,0 +1,76 @@
+//------------------------------------------------------------------------------
+// GB_bitmap_subref_template: C = A(I,J) where A and C are bitmap or full
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Iterate over all positions in the IxJ Cartesian product, for C=A(I,J) where
+// A is bitmap or full.  C is |I|-by-|J|, and has the same sparsity structure
+// as A.  The tasks in TaskList have already been constructed by
+// GB_subassign_IxJ_slice, in the caller.  GB_IXJ_WORK (pC,pA), defined by
+// the caller, operates on the entry C(iC,jC) at position pC and the entry
+// A(iA,jA) at position pA, where iA = I [iC] and jA = J [jC].
+
+{
+
+    //--------------------------------------------------------------------------
+    // iterate over all IxJ
+    //--------------------------------------------------------------------------
+
+    int taskid ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1) \
+        reduction(+:cnvals)
+    for (taskid = 0 ; taskid < ntasks ; taskid++)
+    {
+
+        //----------------------------------------------------------------------
+        // get the task descriptor
+        //----------------------------------------------------------------------
+
+        int64_t kfirst = TaskList [taskid].kfirst ;
+        int64_t klast  = TaskList [taskid].klast ;
+        int64_t task_cnvals = 0 ;
+        bool fine_task = (klast == -1) ;
+        int64_t iC_start = 0, iC_end = nI ;
+        if (fine_task)
+        {
+            // a fine task operates on a slice of a single vector
+            klast = kfirst ;
+            iC_start = TaskList [taskid].pA ;
+            iC_end   = TaskList [taskid].pA_end ;
+        }
+
+        //----------------------------------------------------------------------
+        // compute all vectors in this task
+        //----------------------------------------------------------------------
+
+        for (int64_t jC = kfirst ; jC <= klast ; jC++)
+        {
+
+            //------------------------------------------------------------------
+            // get jA, the corresponding vector of A
+            //------------------------------------------------------------------
+
+            int64_t jA = GB_ijlist (J, jC, Jkind, Jcolon) ;
+            int64_t pA0 = jA * avlen ;      // first entry in A(:,jA)
+            int64_t pC0 = jC * nI ;         // first entry in C(:,jC)
+
+            //------------------------------------------------------------------
+            // operate on C (iC_start:iC_end-1,jC)
+            //------------------------------------------------------------------
+
+            for (int64_t iC = iC_start ; iC < iC_end ; iC++)
+            {
+                int64_t iA = GB_ijlist (I, iC, Ikind, Icolon) ;
+                int64_t pA = iA + pA0 ;
+                int64_t pC = iC + pC0 ;
+                // C(iC,jC) = A(iA,jA)
+                GB_IXJ_WORK (pC, pA) ;
+            }
+        }
+        cnvals += task_cnvals ;
+    }
+}
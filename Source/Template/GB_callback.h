@@ -27,6 +27,7 @@ typedef GB_CALLBACK_FREE_MEMORY_PROTO ((*GB_free_memory_f)) ;
 typedef GB_CALLBACK_MALLOC_MEMORY_PROTO ((*GB_malloc_memory_f)) ;
 typedef GB_CALLBACK_MEMSET_PROTO ((*GB_memset_f)) ;
 typedef GB_CALLBACK_QSORT_1_PROTO ((*GB_qsort_1_f)) ;
+typedef GB_CALLBACK_QSORT_1B_PROTO ((*GB_qsort_1b_f)) ;
 typedef GB_CALLBACK_WERK_POP_PROTO ((*GB_werk_pop_f)) ;
 typedef GB_CALLBACK_WERK_PUSH_PROTO ((*GB_werk_push_f)) ;
 
@@ -46,6 +47,7 @@ typedef struct
     GB_malloc_memory_f          GB_malloc_memory_func ;
     GB_memset_f                 GB_memset_func ;
     GB_qsort_1_f                GB_qsort_1_func ;
+    GB_qsort_1b_f               GB_qsort_1b_func ;
     GB_werk_pop_f               GB_werk_pop_func ;
     GB_werk_push_f              GB_werk_push_func ;
 }
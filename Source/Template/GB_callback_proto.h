@@ -132,6 +132,15 @@ void GX_qsort_1    /* sort array A of size 1-by-n */                        \
     const int64_t n                                                         \
 )
 
+#define GB_CALLBACK_QSORT_1B_PROTO(GX_qsort_1b)                             \
+void GX_qsort_1b    /* sort array A of size 2-by-n, using 1 key (A [0][]) */  \
+(                                                                           \
+    int64_t *restrict A_0,      /* size n array */                          \
+    GB_void *restrict A_1,      /* size n array */                          \
+    const size_t xsize,         /* size of entries in A_1 */                \
+    const int64_t n                                                         \
+)
+
 #define GB_CALLBACK_WERK_POP_PROTO(GX_werk_pop)                             \
 void *GX_werk_pop     /* free the top block of werkspace memory */          \
 (                                                                           \
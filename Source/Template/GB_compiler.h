@@ -123,6 +123,27 @@
 #define GB_COMPILER_MSC_2019_OR_NEWER ( GB_COMPILER_MSC \
     && (GB_COMPILER_MAJOR == 19) && (GB_COMPILER_MINOR >= 20))
 
+//------------------------------------------------------------------------------
+// Workaround for compiler bug in gcc 12
+//------------------------------------------------------------------------------
+
+// gcc 12.2 at -O1 miscompiles a "#pragma omp simd reduction(^:z)" loop when z
+// is a bool, and the loop segfaults.  A reproducer:
+//
+//      bool f (const bool *Ax, int64_t pstart, int64_t pend)
+//      {
+//          bool z = Ax [pstart] ;
+//          #pragma omp simd reduction(^:z)
+//          for (int64_t p = pstart+1 ; p < pend ; p++) z ^= Ax [p] ;
+//          return (z) ;
+//      }
+//
+// The GB_COMPILER_GCC_12 flag disables the simd reduction for the LXOR monoid
+// (see GB_PRAGMA_SIMD_REDUCTION_LXOR below).  The bug does not appear at -O0,
+// -O2, or -O3, nor with other versions of gcc.
+
+#define GB_COMPILER_GCC_12 ( GB_COMPILER_GCC && (GB_COMPILER_MAJOR == 12))
+
 //------------------------------------------------------------------------------
 // malloc.h: required include file for Microsoft Visual Studio
 //------------------------------------------------------------------------------
@@ -159,6 +180,14 @@
 
 #endif
 
+// GB_PRAGMA_SIMD_REDUCTION_LXOR (z) becomes "#pragma omp simd reduction(^:z)"
+// for a bool z, except for gcc 12 (see GB_COMPILER_GCC_12 above).
+#if GB_COMPILER_GCC_12
+    #define GB_PRAGMA_SIMD_REDUCTION_LXOR(s)
+#else
+    #define GB_PRAGMA_SIMD_REDUCTION_LXOR(s) GB_PRAGMA_SIMD_REDUCTION (^,s)
+#endif
+
 // by default, enable the #pragma omp simd statements.  This can be #undef'd
 // later, for methods that must disable it (see GB_generic.h).
 #define GB_PRAGMA_SIMD_VECTORIZE GB_PRAGMA_SIMD
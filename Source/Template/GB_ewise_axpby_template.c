@@ -0,0 +1,56 @@
+//------------------------------------------------------------------------------
+// GB_ewise_axpby_template: T = alpha*A+beta*B where A and B have one pattern
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A and B have the same pattern, and T has the same pattern as A, so entry p
+// of T is computed from entry p of A and B, with no pattern merge:
+
+//      T(i,j) = add (mult (alpha, A(i,j)), mult (beta, B(i,j)))
+
+// where A(i,j) and B(i,j) are typecasted to the y input of the multiplicative
+// operator.  A, B, and T can be sparse, hypersparse, bitmap, or full.  T is
+// not iso, but A and/or B can be iso.  This template is not used for any
+// generic kernels.
+
+#include "GB_unused.h"
+
+{
+
+    //--------------------------------------------------------------------------
+    // get T, A, B, alpha, and beta
+    //--------------------------------------------------------------------------
+
+    const int8_t *restrict Ab = A->b ;
+    const GB_A_TYPE *restrict Ax = (GB_A_TYPE *) A->x ;
+    const GB_B_TYPE *restrict Bx = (GB_B_TYPE *) B->x ;
+    GB_Z_TYPE *restrict Tx = (GB_Z_TYPE *) T->x ;
+    GB_A_NHELD (anz) ;          // int64_t anz = GB_nnz_held (A) ;
+    ASSERT (!T->iso) ;
+    const GB_X_TYPE alpha = (*((GB_X_TYPE *) alpha_scalar_in)) ;
+    const GB_X_TYPE beta  = (*((GB_X_TYPE *) beta_scalar_in )) ;
+    int64_t p ;
+
+    //--------------------------------------------------------------------------
+    // T = alpha*A+beta*B
+    //--------------------------------------------------------------------------
+
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (p = 0 ; p < anz ; p++)
+    {
+        if (!GBB_A (Ab, p)) continue ;
+        GB_DECLAREA (aij) ;
+        GB_GETA (aij, Ax, p, A_iso) ;           // aij = Ax [p]
+        GB_DECLAREB (bij) ;
+        GB_GETB (bij, Bx, p, B_iso) ;           // bij = Bx [p]
+        GB_Z_TYPE t, s ;
+        GB_MULT (t, alpha, aij, , , ) ;         // t = alpha*aij
+        GB_MULT (s, beta,  bij, , , ) ;         // s = beta*bij
+        GB_ADD (Tx [p], t, s) ;                 // Tx [p] = t + s
+    }
+}
+
@@ -391,6 +391,40 @@ GrB_Info GB_jit_kernel_reduce                                           \
     const int nthreads                                                  \
 )
 
+#define GB_JIT_KERNEL_REDUCE_EACH_VECTOR_PROTO(GB_jit_kernel_reduce_each)     \
+GrB_Info GB_jit_kernel_reduce_each                                      \
+(                                                                       \
+    GB_void *restrict Tx_space,                                         \
+    int8_t *restrict Tb,                                                \
+    const GrB_Matrix A,                                                 \
+    const int64_t *restrict A_slice,                                    \
+    const int ntasks,                                                   \
+    const int nthreads                                                  \
+)
+
+#define GB_JIT_KERNEL_REDUCE_SELECT_APPLY_PROTO(GB_jit_kernel_reduce_fused) \
+GrB_Info GB_jit_kernel_reduce_fused                                     \
+(                                                                       \
+    GB_void *restrict Tx_space,                                         \
+    int8_t *restrict Tb,                                                \
+    const GrB_Matrix A,                                                 \
+    const GB_void *restrict ythunk,                                     \
+    const int64_t *restrict A_slice,                                    \
+    const int ntasks,                                                   \
+    const int nthreads                                                  \
+)
+
+#define GB_JIT_KERNEL_EWISE_AXPBY_PROTO(GB_jit_kernel_ewise_axpby)     \
+GrB_Info GB_jit_kernel_ewise_axpby                                      \
+(                                                                       \
+    GrB_Matrix T,                                                       \
+    const GB_void *alpha_scalar_in,                                     \
+    const GrB_Matrix A,                                                 \
+    const GB_void *beta_scalar_in,                                      \
+    const GrB_Matrix B,                                                 \
+    const int nthreads                                                  \
+)
+
 #define GB_JIT_KERNEL_ROWSCALE_PROTO(GB_jit_kernel_rowscale)            \
 GrB_Info GB_jit_kernel_rowscale                                         \
 (                                                                       \
@@ -493,6 +527,45 @@ GrB_Info GB_jit_kernel_subassign_any                                    \
     const GB_callback_struct *restrict my_callback                      \
 )
 
+#define GB_JIT_KERNEL_SUBREF_BITMAP_PROTO(GB_jit_kernel_subref_bitmap)  \
+GrB_Info GB_jit_kernel_subref_bitmap                                    \
+(                                                                       \
+    GrB_Matrix C,                                                       \
+    const GrB_Matrix A,                                                 \
+    const GrB_Index *I,                                                 \
+    const int64_t nI,                                                   \
+    const int Ikind,                                                    \
+    const int64_t Icolon [3],                                           \
+    const GrB_Index *J,                                                 \
+    const int Jkind,                                                    \
+    const int64_t Jcolon [3],                                           \
+    const GB_task_struct *restrict TaskList,                            \
+    const int ntasks,                                                   \
+    const int nthreads                                                  \
+)
+
+#define GB_JIT_KERNEL_SUBREF_SPARSE_PROTO(GB_jit_kernel_subref_sparse)  \
+GrB_Info GB_jit_kernel_subref_sparse                                    \
+(                                                                       \
+    GrB_Matrix C,                                                       \
+    const GB_task_struct *restrict TaskList,                            \
+    const int ntasks,                                                   \
+    const int nthreads,                                                 \
+    const bool post_sort,                                               \
+    const int64_t *Mark,                                                \
+    const int64_t *Inext,                                               \
+    const int64_t nduplicates,                                          \
+    const int64_t *restrict Ap_start,                                   \
+    const int64_t *restrict Ap_end,                                     \
+    const bool need_qsort,                                              \
+    const int Ikind,                                                    \
+    const int64_t nI,                                                   \
+    const int64_t Icolon [3],                                           \
+    const GrB_Matrix A,                                                 \
+    const GrB_Index *I,                                                 \
+    const GB_callback_struct *restrict my_callback                      \
+)
+
 #define GB_JIT_KERNEL_TRANS_BIND1ST_PROTO(GB_jit_kernel_trans_bind1st)  \
 GrB_Info GB_jit_kernel_trans_bind1st                                    \
 (                                                                       \
@@ -612,9 +685,12 @@ GrB_Info GB_jit_kernel_AxB_dot3                                         \
 #define JIT_EM4(g)  GB_JIT_KERNEL_EMULT_04_PROTO(g) ;
 #define JIT_EM8(g)  GB_JIT_KERNEL_EMULT_08_PROTO(g) ;
 #define JIT_EMB(g)  GB_JIT_KERNEL_EMULT_BITMAP_PROTO(g) ;
+#define JIT_AXPB(g) GB_JIT_KERNEL_EWISE_AXPBY_PROTO(g) ;
 #define JIT_EWFA(g) GB_JIT_KERNEL_EWISE_FULLA_PROTO(g) ;
 #define JIT_EWFN(g) GB_JIT_KERNEL_EWISE_FULLN_PROTO(g) ;
 #define JIT_RED(g)  GB_JIT_KERNEL_REDUCE_PROTO(g) ;
+#define JIT_REDV(g) GB_JIT_KERNEL_REDUCE_EACH_VECTOR_PROTO(g) ;
+#define JIT_REDF(g) GB_JIT_KERNEL_REDUCE_SELECT_APPLY_PROTO(g) ;
 #define JIT_ROWS(g) GB_JIT_KERNEL_ROWSCALE_PROTO(g) ;
 #define JIT_SELB(g) GB_JIT_KERNEL_SELECT_BITMAP_PROTO(g) ;
 #define JIT_SEL1(g) GB_JIT_KERNEL_SELECT_PHASE1_PROTO(g) ;
@@ -623,6 +699,8 @@ GrB_Info GB_jit_kernel_AxB_dot3                                         \
 #define JIT_SPF(g)  GB_JIT_KERNEL_SPLIT_FULL_PROTO(g) ;
 #define JIT_SPS(g)  GB_JIT_KERNEL_SPLIT_SPARSE_PROTO(g) ;
 #define JIT_SUB(g)  GB_JIT_KERNEL_SUBASSIGN_PROTO(g) ;
+#define JIT_SRB(g)  GB_JIT_KERNEL_SUBREF_BITMAP_PROTO(g) ;
+#define JIT_SRS(g)  GB_JIT_KERNEL_SUBREF_SPARSE_PROTO(g) ;
 #define JIT_TR1(g)  GB_JIT_KERNEL_TRANS_BIND1ST_PROTO(g) ;
 #define JIT_TR2(g)  GB_JIT_KERNEL_TRANS_BIND2ND_PROTO(g) ;
 #define JIT_TR0(g)  GB_JIT_KERNEL_TRANS_UNOP_PROTO(g) ;
@@ -0,0 +1,163 @@
+//------------------------------------------------------------------------------
+// GB_reduce_each_vector_template: T(k)=reduce(A(:,k)) for each vector of A
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Reduce each vector A(:,k) of a matrix to the scalar Tx [k], for built-in
+// operators or jitified kernels.  This is a segmented reduction over the
+// vectors of A, used when a matrix is reduced to a vector in the same
+// orientation as it is held (the rows of a matrix held by row, or the columns
+// of a matrix held by column).  A can be sparse, hypersparse, bitmap, or
+// full.  It cannot have any zombies, and it cannot be iso.
+
+// Tb [k] is set to 1 if A(:,k) has at least one entry, or to 0 if it has none,
+// in which case Tx [k] is not modified.  Task tid reduces the vectors
+// A_slice [tid] to A_slice [tid+1]-1.
+
+// If the monoid is not terminal, each vector is reduced in a single loop that
+// the compiler can vectorize, with "#pragma omp simd reduction" for the PLUS
+// and TIMES monoids (and BXOR, for the JIT).  Otherwise, each vector is
+// reduced in panels of GB_PANEL entries, and its reduction stops as soon as
+// the terminal value is reached (for the LOR monoid, or MAX for integers, for
+// example).  The ANY monoid takes the last entry of each vector (or the first
+// entry, if A is bitmap).
+
+// The Tx array always has the same type as z, GB_Z_TYPE.
+
+#include "GB_unused.h"
+
+// default panel size
+#ifndef GB_PANEL
+#define GB_PANEL 16
+#endif
+
+{
+
+    //--------------------------------------------------------------------------
+    // get A
+    //--------------------------------------------------------------------------
+
+    const int64_t *restrict Ap = A->p ;
+    const int8_t  *restrict Ab = A->b ;
+    const GB_A_TYPE *restrict Ax = (GB_A_TYPE *) A->x ;
+    const int64_t avlen = A->vlen ;
+    ASSERT (!A->iso) ;
+    ASSERT (A->nzombies == 0) ;
+    GB_DECLARE_TERMINAL_CONST (zterminal) ;
+
+    //--------------------------------------------------------------------------
+    // reduce each vector of A
+    //--------------------------------------------------------------------------
+
+    int tid ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+    for (tid = 0 ; tid < ntasks ; tid++)
+    {
+        for (int64_t k = A_slice [tid] ; k < A_slice [tid+1] ; k++)
+        {
+
+            //------------------------------------------------------------------
+            // get A(:,k)
+            //------------------------------------------------------------------
+
+            int64_t pA_start = GBP_A (Ap, k, avlen) ;
+            int64_t pA_end   = GBP_A (Ap, k+1, avlen) ;
+            GB_Z_TYPE z ;
+
+            if (Ab != NULL)
+            {
+
+                //--------------------------------------------------------------
+                // A is bitmap: skip entries not in the bitmap
+                //--------------------------------------------------------------
+
+                int64_t p = pA_start ;
+                while (p < pA_end && !Ab [p])
+                {
+                    p++ ;
+                }
+                if (p == pA_end)
+                {
+                    // A(:,k) has no entries
+                    Tb [k] = 0 ;
+                    continue ;
+                }
+                // z = (ztype) Ax [p], the first entry in A(:,k)
+                GB_GETA (z, Ax, p, false) ;
+                #if !GB_IS_ANY_MONOID
+                for (p++ ; p < pA_end ; p++)
+                {
+                    if (!Ab [p]) continue ;
+                    // z += (ztype) Ax [p]
+                    GB_GETA_AND_UPDATE (z, Ax, p) ;
+                    #if GB_MONOID_IS_TERMINAL
+                    // check for early exit
+                    GB_IF_TERMINAL_BREAK (z, zterminal) ;
+                    #endif
+                }
+                #endif
+
+            }
+            else
+            {
+
+                //--------------------------------------------------------------
+                // A is sparse, hypersparse, or full
+                //--------------------------------------------------------------
+
+                if (pA_start == pA_end)
+                {
+                    // A(:,k) has no entries
+                    Tb [k] = 0 ;
+                    continue ;
+                }
+
+                #if GB_IS_ANY_MONOID
+                {
+                    // z = (ztype) Ax [pA_end-1], the last entry in A(:,k)
+                    GB_GETA (z, Ax, pA_end-1, false) ;
+                }
+                #elif GB_MONOID_IS_TERMINAL
+                {
+                    // z = (ztype) Ax [pA_start]
+                    GB_GETA (z, Ax, pA_start, false) ;
+                    for (int64_t p = pA_start+1 ; p < pA_end ; p += GB_PANEL)
+                    {
+                        int64_t p_end = GB_IMIN (p + GB_PANEL, pA_end) ;
+                        for (int64_t pA = p ; pA < p_end ; pA++)
+                        {
+                            // z += (ztype) Ax [pA]
+                            GB_GETA_AND_UPDATE (z, Ax, pA) ;
+                        }
+                        // check for early exit, once per panel
+                        GB_IF_TERMINAL_BREAK (z, zterminal) ;
+                    }
+                }
+                #else
+                {
+                    // z = (ztype) Ax [pA_start]
+                    GB_GETA (z, Ax, pA_start, false) ;
+                    GB_PRAGMA_SIMD_REDUCTION_MONOID (z)
+                    for (int64_t p = pA_start+1 ; p < pA_end ; p++)
+                    {
+                        // z += (ztype) Ax [p]
+                        GB_GETA_AND_UPDATE (z, Ax, p) ;
+                    }
+                }
+                #endif
+            }
+
+            //------------------------------------------------------------------
+            // save the result
+            //------------------------------------------------------------------
+
+            Tx [k] = z ;
+            Tb [k] = 1 ;
+        }
+    }
+}
+
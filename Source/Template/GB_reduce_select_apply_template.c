@@ -0,0 +1,109 @@
+//------------------------------------------------------------------------------
+// GB_reduce_select_apply_template: T(k)=reduce(op(select(A(:,k)))) for all k
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Reduce each vector A(:,k) of a matrix to the scalar Tx [k], where only the
+// entries that pass the select test are reduced, and the unary operator is
+// applied to each of them first.  This is the same segmented reduction as
+// GB_reduce_each_vector_template, fused with GrB_select and GrB_apply, so that
+// the entries of A are read just once and no intermediate matrices are
+// constructed.  A can be sparse, hypersparse, bitmap, or full.  It cannot have
+// any zombies, and it cannot be iso.
+
+// The index i of the entry A(i,k) and the vector index j = k (or the kth
+// entry of the hyperlist) are passed to the select operator as i and j.  The
+// GB_IDXUNOP macro flips them if A is held by row.
+
+// Tb [k] is set to 1 if any entry of A(:,k) is kept, or to 0 otherwise, in
+// which case Tx [k] is not modified.  Task tid reduces the vectors
+// A_slice [tid] to A_slice [tid+1]-1.  The Tx array always has the same type
+// as z, GB_Z_TYPE, and the thunk has type GB_Y_TYPE.
+
+#include "GB_unused.h"
+
+{
+
+    //--------------------------------------------------------------------------
+    // get A and the thunk
+    //--------------------------------------------------------------------------
+
+    const int64_t *restrict Ap = A->p ;
+    const int64_t *restrict Ah = A->h ;
+    const int8_t  *restrict Ab = A->b ;
+    const int64_t *restrict Ai = A->i ;
+    const GB_A_TYPE *restrict Ax = (GB_A_TYPE *) A->x ;
+    const int64_t avlen = A->vlen ;
+    ASSERT (!A->iso) ;
+    ASSERT (A->nzombies == 0) ;
+    GB_DECLARE_TERMINAL_CONST (zterminal) ;
+    const GB_Y_TYPE y = *((GB_Y_TYPE *) ythunk) ;
+
+    //--------------------------------------------------------------------------
+    // reduce the selected entries of each vector of A
+    //--------------------------------------------------------------------------
+
+    int tid ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+    for (tid = 0 ; tid < ntasks ; tid++)
+    {
+        for (int64_t k = A_slice [tid] ; k < A_slice [tid+1] ; k++)
+        {
+
+            //------------------------------------------------------------------
+            // get A(:,j)
+            //------------------------------------------------------------------
+
+            const int64_t j = GBH_A (Ah, k) ;
+            int64_t pA_start = GBP_A (Ap, k, avlen) ;
+            int64_t pA_end   = GBP_A (Ap, k+1, avlen) ;
+            GB_Z_TYPE z ;
+            bool found = false ;
+
+            //------------------------------------------------------------------
+            // reduce the entries of A(:,j) that are kept
+            //------------------------------------------------------------------
+
+            for (int64_t p = pA_start ; p < pA_end ; p++)
+            {
+                if (!GBB_A (Ab, p)) continue ;
+                const int64_t i = GBI_A (Ai, p, avlen) ;
+                GB_TEST_VALUE_OF_ENTRY (keep, p) ;
+                if (!keep) continue ;
+                if (found)
+                {
+                    // z += (ztype) op ((xtype) Ax [p])
+                    GB_APPLY_AND_UPDATE (z, Ax, p) ;
+                }
+                else
+                {
+                    // z = (ztype) op ((xtype) Ax [p]), the first entry kept
+                    GB_APPLY_ENTRY (z, Ax, p) ;
+                    found = true ;
+                    #if GB_IS_ANY_MONOID
+                    break ;
+                    #endif
+                }
+                #if GB_MONOID_IS_TERMINAL
+                // check for early exit
+                GB_IF_TERMINAL_BREAK (z, zterminal) ;
+                #endif
+            }
+
+            //------------------------------------------------------------------
+            // save the result
+            //------------------------------------------------------------------
+
+            if (found)
+            {
+                Tx [k] = z ;
+            }
+            Tb [k] = found ;
+        }
+    }
+}
+
@@ -0,0 +1,199 @@
+//------------------------------------------------------------------------------
+// GB_select_phase2_template: C=select(A,thunk), or A=select(A,thunk) in-place
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// If GB_SELECT_IN_PLACE is 0, the entries of A are copied into the new arrays
+// Ci and Cx, where task tid places its entries of C(:,k) at Cp [k], or at
+// Cp_kfirst [tid] for its first vector.
+
+// If GB_SELECT_IN_PLACE is 1, then Ci and Cx are the same arrays as Ai and Ax.
+// Each task compacts the entries it keeps to the front of its own slice of A,
+// starting at pstart_Aslice [tid].  The output position pC never exceeds the
+// input position pA, and no task writes outside of its own slice, so the
+// tasks do not conflict.  The caller then shifts the slice of each task down
+// to its final position in C.
+
+{
+
+    #if GB_SELECT_IN_PLACE
+        // the source and destination can overlap
+        #define GB_SELECT_COPY(dest,src,n) \
+            if ((dest) != (src)) memmove (dest, src, n)
+    #else
+        #define GB_SELECT_COPY(dest,src,n) memcpy (dest, src, n)
+    #endif
+
+    int tid ;
+    #pragma omp parallel for num_threads(A_nthreads) schedule(dynamic,1)
+    for (tid = 0 ; tid < A_ntasks ; tid++)
+    {
+
+        // if kfirst > klast then task tid does no work at all
+        int64_t kfirst = kfirst_Aslice [tid] ;
+        int64_t klast  = klast_Aslice  [tid] ;
+        #if GB_SELECT_IN_PLACE
+        int64_t pW = pstart_Aslice [tid] ;
+        #endif
+
+        //----------------------------------------------------------------------
+        // selection from vectors kfirst to klast
+        //----------------------------------------------------------------------
+
+        for (int64_t k = kfirst ; k <= klast ; k++)
+        {
+
+            //------------------------------------------------------------------
+            // find the part of A(:,k) to be operated on by this task
+            //------------------------------------------------------------------
+
+            GB_GET_PA_AND_PC (pA_start, pA_end, pC, tid, k, kfirst, klast,
+                pstart_Aslice, Cp_kfirst,
+                GBP_A (Ap, k, avlen), GBP_A (Ap, k+1, avlen), Cp [k]) ;
+            #if GB_SELECT_IN_PLACE
+            // compact A(:,k) to the front of the slice of this task
+            pC = pW ;
+            ASSERT (pC <= pA_start) ;
+            #endif
+
+            //------------------------------------------------------------------
+            // compact Ai and Ax [pA_start ... pA_end-1] into Ci and Cx
+            //------------------------------------------------------------------
+
+            #if defined ( GB_ENTRY_SELECTOR )
+
+                int64_t j = GBH_A (Ah, k) ;
+                for (int64_t pA = pA_start ; pA < pA_end ; pA++)
+                {
+                    // A is sparse or hypersparse
+                    ASSERT (Ai != NULL) ;
+                    int64_t i = Ai [pA] ;
+                    GB_TEST_VALUE_OF_ENTRY (keep, pA) ;
+                    if (keep)
+                    {
+                        ASSERT (GB_SELECT_IN_PLACE ||
+                            (pC >= Cp [k] && pC < Cp [k+1])) ;
+                        Ci [pC] = i ;
+                        #if GB_SELECT_IN_PLACE
+                        if (pC != pA)
+                        #endif
+                        {
+                            // Cx [pC] = Ax [pA] ;
+                            GB_SELECT_ENTRY (Cx, pC, Ax, pA) ;
+                        }
+                        pC++ ;
+                    }
+                }
+
+            #elif defined ( GB_TRIL_SELECTOR  ) || \
+                  defined ( GB_ROWGT_SELECTOR )
+
+                // keep Zp [k] to pA_end-1
+                int64_t p = GB_IMAX (Zp [k], pA_start) ;
+                int64_t mynz = pA_end - p ;
+                if (mynz > 0)
+                {
+                    // A and C are both sparse or hypersparse
+                    ASSERT (pA_start <= p && p + mynz <= pA_end) ;
+                    ASSERT (GB_SELECT_IN_PLACE ||
+                        (pC >= Cp [k] && pC + mynz <= Cp [k+1])) ;
+                    ASSERT (Ai != NULL) ;
+                    GB_SELECT_COPY (Ci +pC, Ai +p, mynz*sizeof (int64_t)) ;
+                    #if !GB_ISO_SELECT
+                    GB_SELECT_COPY (Cx +pC*asize, Ax +p*asize, mynz*asize) ;
+                    #endif
+                    pC += mynz ;
+                }
+
+            #elif defined ( GB_TRIU_SELECTOR  ) || \
+                  defined ( GB_ROWLE_SELECTOR )
+
+                // keep pA_start to Zp[k]-1
+                int64_t p = GB_IMIN (Zp [k], pA_end) ;
+                int64_t mynz = p - pA_start ;
+                if (mynz > 0)
+                {
+                    // A and C are both sparse or hypersparse
+                    ASSERT (GB_SELECT_IN_PLACE ||
+                        (pC >= Cp [k] && pC + mynz <= Cp [k+1])) ;
+                    ASSERT (Ai != NULL) ;
+                    GB_SELECT_COPY (Ci +pC, Ai +pA_start,
+                        mynz*sizeof (int64_t)) ;
+                    #if !GB_ISO_SELECT
+                    GB_SELECT_COPY (Cx +pC*asize, Ax +pA_start*asize,
+                        mynz*asize) ;
+                    #endif
+                    pC += mynz ;
+                }
+
+            #elif defined ( GB_DIAG_SELECTOR )
+
+                // task that owns the diagonal entry does this work
+                // A can be sparse, hypersparse, or full, but not bitmap
+                int64_t p = Zp [k] ;
+                if (pA_start <= p && p < pA_end)
+                {
+                    ASSERT (GB_SELECT_IN_PLACE ||
+                        (pC >= Cp [k] && pC + 1 <= Cp [k+1])) ;
+                    Ci [pC] = GBI_A (Ai, p, avlen) ;
+                    #if !GB_ISO_SELECT
+                    GB_SELECT_COPY (Cx +pC*asize, Ax +p*asize, asize) ;
+                    #endif
+                    pC++ ;
+                }
+
+            #elif defined ( GB_OFFDIAG_SELECTOR  ) || \
+                  defined ( GB_ROWINDEX_SELECTOR )
+
+                // keep pA_start to Zp[k]-1
+                int64_t p = GB_IMIN (Zp [k], pA_end) ;
+                int64_t mynz = p - pA_start ;
+                if (mynz > 0)
+                {
+                    // A and C are both sparse or hypersparse
+                    ASSERT (GB_SELECT_IN_PLACE ||
+                        (pC >= Cp [k] && pC + mynz <= Cp [k+1])) ;
+                    ASSERT (Ai != NULL) ;
+                    GB_SELECT_COPY (Ci +pC, Ai +pA_start,
+                        mynz*sizeof (int64_t)) ;
+                    #if !GB_ISO_SELECT
+                    GB_SELECT_COPY (Cx +pC*asize, Ax +pA_start*asize,
+                        mynz*asize) ;
+                    #endif
+                    pC += mynz ;
+                }
+
+                // keep Zp[k]+1 to pA_end-1
+                p = GB_IMAX (Zp [k]+1, pA_start) ;
+                mynz = pA_end - p ;
+                if (mynz > 0)
+                {
+                    // A and C are both sparse or hypersparse
+                    ASSERT (pA_start <= p && p < pA_end) ;
+                    ASSERT (GB_SELECT_IN_PLACE ||
+                        (pC >= Cp [k] && pC + mynz <= Cp [k+1])) ;
+                    ASSERT (Ai != NULL) ;
+                    GB_SELECT_COPY (Ci +pC, Ai +p, mynz*sizeof (int64_t)) ;
+                    #if !GB_ISO_SELECT
+                    GB_SELECT_COPY (Cx +pC*asize, Ax +p*asize, mynz*asize) ;
+                    #endif
+                    pC += mynz ;
+                }
+
+            #endif
+
+            #if GB_SELECT_IN_PLACE
+            pW = pC ;
+            #endif
+        }
+    }
+
+    #undef GB_SELECT_COPY
+}
+
+#undef GB_SELECT_IN_PLACE
+
@@ -7,13 +7,17 @@
 
 //------------------------------------------------------------------------------
 
-// GB_subref_templat extracts a submatrix, C = A(I,J).  The method is done in
+// GB_subref_template extracts a submatrix, C = A(I,J).  The method is done in
 // two phases.  Phase 1 just counts the entries in C, and phase 2 constructs
 // the pattern and values of C.  There are 3 kinds of subref:
 //
 //      symbolic:  C(i,j) is the position of A(I(i),J(j)) in the matrix A
 //      iso:     C = A(I,J), extracting the pattern only, not the values
 //      numeric: C = A(I,J), extracting the pattern and values
+//
+// For the numeric case, the caller either defines GB_COPY_RANGE,
+// GB_COPY_ENTRY, GB_CSIZE1, and GB_CSIZE2 for a generic kernel, or
+// GB_C_TYPE and GB_A_TYPE for a factory kernel or JIT kernel.
 
 #if defined ( GB_SYMBOLIC )
 
@@ -27,6 +31,24 @@
 
 #endif
 
+#if defined ( GB_C_TYPE )
+
+    // non-iso numeric subref, via a factory kernel or JIT kernel, where C and
+    // A have the same type
+    #define GB_COPY_RANGE(pC,pA,len)                                        \
+        memcpy (Cx + (pC), Ax + (pA), (len) * sizeof (GB_C_TYPE)) ;
+    #define GB_COPY_ENTRY(pC,pA) Cx [pC] = Ax [pA] ;
+    #define GB_CSIZE1 1
+    #define GB_CSIZE2 (sizeof (GB_C_TYPE))
+
+#endif
+
+// to sort the pattern and values of C(:,kC), for a non-iso numeric subref:
+#ifndef GB_QSORT_1B
+#define GB_QSORT_1B(Ci,Cx,pC,clen)                                          \
+    GB_qsort_1b (Ci + pC, (GB_void *) (Cx + pC*GB_CSIZE1), GB_CSIZE2, clen)
+#endif
+
 // to iterate across all entries in a bucket:
 #define GB_for_each_index_in_bucket(inew,i)     \
     for (int64_t inew = Mark [i] - 1 ; inew >= 0 ; inew = Inext [inew])
@@ -42,6 +64,11 @@
     const int64_t *restrict Ai = A->i ;
     const int64_t avlen = A->vlen ;
 
+    #if defined ( GB_C_TYPE )
+    const GB_A_TYPE *restrict Ax = (GB_A_TYPE *) A->x ;
+          GB_C_TYPE *restrict Cx = (GB_C_TYPE *) C->x ;
+    #endif
+
     // these values are ignored if Ikind == GB_LIST
     int64_t ibegin = Icolon [GxB_BEGIN] ;
     int64_t iinc   = Icolon [GxB_INC  ] ;
@@ -512,8 +539,7 @@
                         GB_qsort_1 (Ci + pC, clen) ;
                         #else
                         // sort the pattern of C(:,kC), and the values
-                        GB_qsort_1b (Ci + pC, (GB_void *) (Cx + pC*GB_CSIZE1),
-                            GB_CSIZE2, clen) ;
+                        GB_QSORT_1B (Ci, Cx, pC, clen) ;
                         #endif
                     }
                     #endif
@@ -641,8 +667,7 @@
                     #else
                     { 
                         // sort the pattern of C(:,kC), and the values
-                        GB_qsort_1b (Ci + pC, (GB_void *) (Cx + pC*GB_CSIZE1),
-                            GB_CSIZE2, clen) ;
+                        GB_QSORT_1B (Ci, Cx, pC, clen) ;
                     }
                     #endif
                 }
@@ -661,4 +686,7 @@
 #undef GB_CSIZE2
 #undef GB_SYMBOLIC
 #undef GB_ISO_SUBREF
+#undef GB_QSORT_1B
+#undef GB_C_TYPE
+#undef GB_A_TYPE
 
@@ -0,0 +1,204 @@
+//------------------------------------------------------------------------------
+// GB_task_steal.h: work-stealing scheduler for irregular kernels
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Most kernels slice their work into a fixed TaskList, based on an estimate
+// of the work of each task, and then schedule the tasks with
+// "#pragma omp for schedule(dynamic,1)".  If the estimate is poor, a single
+// task can take much longer than the others, and all other threads wait for
+// it to finish.
+
+// With the work-stealing scheduler, the work is instead split into many small
+// grains, numbered 0 to ngrains-1.  Each thread owns a contiguous range of
+// grains, [lo,hi), and takes its grains one at a time, in order, from the
+// front of its range.  When a thread runs dry, it steals the back half of the
+// largest range of any other thread.  A poorly estimated range is thus split
+// on demand between the threads that have run out of work, and the threads
+// access the data in long contiguous runs, except after a steal.
+
+// The range of each thread is held as a single uint64_t, with lo in the upper
+// 32 bits and hi in the lower 32 bits, and is updated with an atomic
+// compare/exchange.  No locks are used.  The ranges are GB_STEAL_PAD words
+// (64 bytes) apart, so no two ranges share a cache line.  The array of ranges
+// is a variable-length array on the stack and is not aligned, so the first
+// and last ranges may share a cache line with other variables.  The # of
+// grains must be less than 2^31 (see GB_task_steal_grainsize).
+
+// A grain is never returned twice: grains move from the front of a range to
+// one thread, or from the back of a range to the range of another thread,
+// and a range is only refilled (by a steal) once it is empty.
+
+#ifndef GB_TASK_STEAL_H
+#define GB_TASK_STEAL_H
+
+// # of uint64_t's per range: 64 bytes, the size of a typical cache line
+#define GB_STEAL_PAD 8
+
+// # of threads that can use the scheduler: the ranges are held in a
+// variable-length array of nthreads*GB_STEAL_PAD entries on the stack
+#if GB_HAS_VLA
+#define GB_STEAL_NTHREADS(nthreads) (nthreads)
+#else
+#define GB_STEAL_NTHREADS(nthreads) \
+    GB_IMIN (nthreads, GB_VLA_MAXSIZE / GB_STEAL_PAD)
+#endif
+
+// pack and unpack a range [lo,hi) of grains
+#define GB_STEAL_RANGE(lo,hi) ((((uint64_t) (lo)) << 32) | ((uint64_t) (hi)))
+#define GB_STEAL_LO(range) ((int64_t) ((range) >> 32))
+#define GB_STEAL_HI(range) ((int64_t) ((range) & 0xFFFFFFFF))
+
+//------------------------------------------------------------------------------
+// GB_task_steal_grainsize: determine the size of each grain
+//------------------------------------------------------------------------------
+
+// The n items of work (such as the entries of C) are split into grains of
+// grainsize items each, with about ngrains_per_thread grains for each thread,
+// and fewer than 2^31 grains in total.
+
+static inline int64_t GB_task_steal_grainsize
+(
+    int64_t n,                  // # of items of work
+    int nthreads,               // # of threads
+    int ngrains_per_thread      // target # of grains per thread
+)
+{
+    int64_t ngrains = ((int64_t) nthreads) * ngrains_per_thread ;
+    int64_t grainsize = (n + ngrains - 1) / GB_IMAX (ngrains, 1) ;
+    grainsize = GB_IMAX (grainsize, (n >> 30) + 1) ;
+    return (GB_IMAX (grainsize, 1)) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_task_steal_next: get the next grain for this thread
+//------------------------------------------------------------------------------
+
+// Returns true if a grain is found, or false if all grains have been taken.
+// Range [tid*GB_STEAL_PAD] holds the range of thread tid, and all ranges must
+// be initialized before any thread calls GB_task_steal_next.
+
+static inline bool GB_task_steal_next
+(
+    // output:
+    int64_t *grain,             // the grain to do next
+    // input/output:
+    uint64_t *Range,            // ranges of all threads
+    // input:
+    const int tid,              // this thread
+    const int nthreads          // # of threads
+)
+{
+
+    //--------------------------------------------------------------------------
+    // take the next grain from the front of the range of this thread
+    //--------------------------------------------------------------------------
+
+    uint64_t *my_range = Range + tid * GB_STEAL_PAD ;
+    while (true)
+    {
+        uint64_t range ;
+        GB_ATOMIC_READ
+        range = (*my_range) ;
+        int64_t lo = GB_STEAL_LO (range) ;
+        int64_t hi = GB_STEAL_HI (range) ;
+        if (lo >= hi) break ;
+        uint64_t range_new = GB_STEAL_RANGE (lo+1, hi) ;
+        if (GB_ATOMIC_COMPARE_EXCHANGE_64 (my_range, range, range_new))
+        {
+            (*grain) = lo ;
+            return (true) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // this thread has run dry: steal the back half of the largest range
+    //--------------------------------------------------------------------------
+
+    while (true)
+    {
+        // find the victim: the thread with the most grains left
+        int victim = -1 ;
+        int64_t most = 0 ;
+        for (int t = 0 ; t < nthreads ; t++)
+        {
+            uint64_t range ;
+            GB_ATOMIC_READ
+            range = Range [t * GB_STEAL_PAD] ;
+            int64_t left = GB_STEAL_HI (range) - GB_STEAL_LO (range) ;
+            if (left > most)
+            {
+                most = left ;
+                victim = t ;
+            }
+        }
+        if (victim < 0)
+        {
+            // all grains have been taken
+            return (false) ;
+        }
+
+        // the victim keeps [lo,mid) and this thread takes [mid,hi)
+        uint64_t *victim_range = Range + victim * GB_STEAL_PAD ;
+        uint64_t range ;
+        GB_ATOMIC_READ
+        range = (*victim_range) ;
+        int64_t lo = GB_STEAL_LO (range) ;
+        int64_t hi = GB_STEAL_HI (range) ;
+        if (lo >= hi) continue ;
+        int64_t mid = lo + (hi - lo) / 2 ;
+        uint64_t range_new = GB_STEAL_RANGE (lo, mid) ;
+        if (GB_ATOMIC_COMPARE_EXCHANGE_64 (victim_range, range, range_new))
+        {
+            // this thread does grain mid now, and keeps [mid+1,hi)
+            GB_ATOMIC_WRITE
+            (*my_range) = GB_STEAL_RANGE (mid+1, hi) ;
+            (*grain) = mid ;
+            return (true) ;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// GB_task_steal_vector: find the vector k that contains the entry p
+//------------------------------------------------------------------------------
+
+// Given p in the range 0 to Cp [cnvec]-1, find k so that Cp [k] <= p and
+// p < Cp [k+1], searching only k in the range kleft to cnvec-1.  This is the
+// same as GB_search_for_vector, for a sparse or hypersparse matrix C.
+
+static inline int64_t GB_task_steal_vector
+(
+    const int64_t p,                // search for vector k that contains p
+    const int64_t *restrict Cp,     // vector pointers to search
+    int64_t kleft,                  // left-most k to search
+    const int64_t cnvec             // Cp is of size cnvec+1
+)
+{
+    int64_t k = kleft ;
+    int64_t kright = cnvec ;
+    bool found ;
+    GB_SPLIT_BINARY_SEARCH (p, Cp, k, kright, found) ;
+    if (found)
+    {
+        // skip any empty vectors that start at p
+        while (k < cnvec-1 && Cp [k+1] == p)
+        {
+            k++ ;
+        }
+    }
+    else
+    {
+        k-- ;
+    }
+    ASSERT (k >= 0 && k < cnvec) ;
+    ASSERT (Cp [k] <= p && p < Cp [k+1]) ;
+    return (k) ;
+}
+
+#endif
+
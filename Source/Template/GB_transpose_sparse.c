@@ -22,7 +22,32 @@
     const int64_t anvec = A->nvec ;
     int64_t *restrict Ci = C->i ;
 
-    if (nthreads == 1)
+    if (A_slice == NULL)
+    {
+
+        //------------------------------------------------------------------
+        // blocked method: gather the values of C
+        //------------------------------------------------------------------
+
+        // C->p and C->i have already been computed by GB_transpose_bucket,
+        // and Workspaces [0] is the permutation P, where C(j,i) is in
+        // position pC of C and A(i,j) is in position P [pC] of A.
+
+        #ifndef GB_ISO_TRANSPOSE
+        const int64_t *restrict P = Workspaces [0] ;
+        const int64_t cnz = C->nvals ;
+        int64_t pC ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (pC = 0 ; pC < cnz ; pC++)
+        { 
+            // Cx [pC] = op (Ax [P [pC]])
+            int64_t pA = P [pC] ;
+            GB_APPLY_OP (pC, pA) ;
+        }
+        #endif
+
+    }
+    else if (nthreads == 1)
     {
 
         //------------------------------------------------------------------
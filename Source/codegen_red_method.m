@@ -34,10 +34,12 @@ is_monoid = ~isempty (identity) ;
 if (is_monoid)
     % monoid function name and identity value
     fprintf (f, 'm4_define(`_red'',    `_red__%s'')\n', name) ;
+    fprintf (f, 'm4_define(`_red_each'', `_red_each__%s'')\n', name) ;
     fprintf (f, 'm4_define(`GB_identity'', `%s'')\n', identity) ;
 else
     % first and second operators are not monoids
     fprintf (f, 'm4_define(`_red'',    `_red__(none)'')\n') ;
+    fprintf (f, 'm4_define(`_red_each'', `_red_each__(none)'')\n') ;
     fprintf (f, 'm4_define(`GB_identity'', `(none)'')\n') ;
 end
 
@@ -98,6 +100,25 @@ else
     fprintf (f, 'm4_define(`GB_declare_const_terminal'', `'')\n') ;
 end
 
+% simd reduction, for non-terminal monoids on real non-boolean types
+simd_op = '' ;
+if (~is_terminal && ~contains (atype, 'FC'))
+    switch (opname)
+        case { 'plus' }
+            simd_op = '+' ;
+        case { 'times' }
+            simd_op = '*' ;
+        otherwise
+            simd_op = '' ;
+    end
+end
+if (isempty (simd_op))
+    fprintf (f, 'm4_define(`GB_pragma_simd_reduction_monoid'', `'')\n') ;
+else
+    pragma = sprintf ('GB_PRAGMA_SIMD_REDUCTION (%s,z)', simd_op) ;
+    fprintf (f, 'm4_define(`GB_pragma_simd_reduction_monoid'', `#define GB_PRAGMA_SIMD_REDUCTION_MONOID(z) %s'')\n', pragma) ;
+end
+
 if (is_any)
     % no panel for the ANY monoid
     fprintf (f, 'm4_define(`GB_panel'', `'')\n') ;
@@ -263,6 +263,13 @@ bool GB_mx_isequal  // true if A and B are exactly the same
                     // difference is less than or equal to eps.
 ) ;
 
+bool GB_mx_isequal_entries  // true if A and B have the same entries
+(
+    GrB_Matrix A,
+    GrB_Matrix B,
+    double eps      // as in GB_mx_isequal
+) ;
+
 GrB_Matrix GB_mx_alias      // output matrix (NULL if no match found)
 (
     char *arg_name,         // name of the output matrix
@@ -0,0 +1,239 @@
+//------------------------------------------------------------------------------
+// GB_mex_test36: test GxB_Matrix_setElements and GxB_Matrix_removeElements
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The batched methods are compared with loops of GrB_Matrix_setElement,
+// GrB_Matrix_assign (for an accumulator), and GrB_Matrix_removeElement, with
+// many duplicate indices, on matrices that start with pending tuples and
+// zombies, in all four sparsity formats.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test36"
+
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+#define N  100      // dimension of C
+#define NT 1000     // number of tuples
+
+typedef struct { double stuff ; } mytype ;
+
+//------------------------------------------------------------------------------
+// make: create a test matrix with pending tuples and zombies
+//------------------------------------------------------------------------------
+
+static GrB_Info make (GrB_Matrix *C_handle, int sparsity, bool iso,
+    uint64_t seed)
+{
+    GrB_Info info ;
+    GrB_Matrix C = NULL ;
+    info = GrB_Matrix_new (&C, GrB_FP64, N, N) ;
+    if (info != GrB_SUCCESS) return (info) ;
+    GxB_Matrix_Option_set_(C, GxB_SPARSITY_CONTROL, sparsity) ;
+    simple_rand_seed (seed) ;
+    if (sparsity == GxB_FULL)
+    {
+        GrB_Matrix_assign_FP64 (C, NULL, NULL, 1, GrB_ALL, N, GrB_ALL, N,
+            NULL) ;
+    }
+    for (int k = 0 ; k < 400 ; k++)
+    {
+        double x = iso ? 1 : (double) (k % 7 + 1) ;
+        GrB_Matrix_setElement_FP64 (C, x, simple_rand_i ( ) % N,
+            simple_rand_i ( ) % N) ;
+    }
+    GrB_Matrix_wait (C, GrB_MATERIALIZE) ;
+    // add some pending tuples and zombies
+    for (int k = 0 ; k < 20 ; k++)
+    {
+        double x = iso ? 1 : (double) (k % 5 + 1) ;
+        GrB_Matrix_setElement_FP64 (C, x, simple_rand_i ( ) % N,
+            simple_rand_i ( ) % N) ;
+    }
+    for (int k = 0 ; k < 20 ; k++)
+    {
+        GrB_Matrix_removeElement (C, simple_rand_i ( ) % N,
+            simple_rand_i ( ) % N) ;
+    }
+    (*C_handle) = C ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test36 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix C1 = NULL, C2 = NULL ;
+    GrB_Type mytype = NULL ;
+    GrB_Index I [NT], J [NT] ;
+    int32_t X [NT] ;
+    GrB_BinaryOp dups [3] = { NULL, GrB_PLUS_FP64, GrB_MINUS_FP64 } ;
+    int sparsities [4] = { GxB_SPARSE, GxB_HYPERSPARSE, GxB_BITMAP, GxB_FULL } ;
+    int ntrials = 0 ;
+
+    //--------------------------------------------------------------------------
+    // compare the batched methods with loops of the single-entry methods
+    //--------------------------------------------------------------------------
+
+    for (int s = 0 ; s < 4 ; s++)
+    {
+        int sparsity = sparsities [s] ;
+        for (int iso = 0 ; iso <= 1 ; iso++)
+        {
+            for (int nt = 0 ; nt <= NT ; nt += NT/4)
+            {
+                uint64_t seed = 1 + s + 10*iso + 100*nt ;
+
+                // create the tuples; about half of them fall in a small
+                // block of C, so many duplicates appear in (I,J)
+                simple_rand_seed (seed + 7) ;
+                for (int k = 0 ; k < nt ; k++)
+                {
+                    GrB_Index range = (k % 2 == 0) ? 8 : N ;
+                    I [k] = simple_rand_i ( ) % range ;
+                    J [k] = simple_rand_i ( ) % range ;
+                    X [k] = iso ? 1 : (int32_t) (simple_rand_i ( ) % 9) - 4 ;
+                }
+
+                //--------------------------------------------------------------
+                // setElements, with and without a dup operator
+                //--------------------------------------------------------------
+
+                for (int d = 0 ; d < 3 ; d++)
+                {
+                    GrB_BinaryOp dup = dups [d] ;
+                    OK (make (&C1, sparsity, iso, seed)) ;
+                    OK (make (&C2, sparsity, iso, seed)) ;
+
+                    // C1(I,J) = X with the batched method, typecasting X
+                    OK (GxB_Matrix_setElements_INT32 (C1, I, J, X, nt, dup)) ;
+
+                    // C2(I,J) = X, one tuple at a time
+                    for (int k = 0 ; k < nt ; k++)
+                    {
+                        if (dup == NULL)
+                        {
+                            OK (GrB_Matrix_setElement_INT32 (C2, X [k],
+                                I [k], J [k])) ;
+                        }
+                        else
+                        {
+                            OK (GrB_Matrix_assign_INT32 (C2, NULL, dup, X [k],
+                                &I [k], 1, &J [k], 1, NULL)) ;
+                        }
+                    }
+                    CHECK (GB_mx_isequal_entries (C1, C2, 0)) ;
+                    GrB_free (&C1) ;
+                    GrB_free (&C2) ;
+                    ntrials++ ;
+                }
+
+                //--------------------------------------------------------------
+                // removeElements
+                //--------------------------------------------------------------
+
+                OK (make (&C1, sparsity, iso, seed)) ;
+                OK (make (&C2, sparsity, iso, seed)) ;
+                OK (GxB_Matrix_removeElements (C1, I, J, nt)) ;
+                for (int k = 0 ; k < nt ; k++)
+                {
+                    OK (GrB_Matrix_removeElement (C2, I [k], J [k])) ;
+                }
+                CHECK (GB_mx_isequal_entries (C1, C2, 0)) ;
+                GrB_free (&C1) ;
+                GrB_free (&C2) ;
+                ntrials++ ;
+
+                //--------------------------------------------------------------
+                // setElements then removeElements on the same entries
+                //--------------------------------------------------------------
+
+                OK (make (&C1, sparsity, iso, seed)) ;
+                OK (make (&C2, sparsity, iso, seed)) ;
+                OK (GxB_Matrix_setElements_INT32 (C1, I, J, X, nt, NULL)) ;
+                OK (GxB_Matrix_removeElements (C1, I, J, nt/2)) ;
+                for (int k = 0 ; k < nt ; k++)
+                {
+                    OK (GrB_Matrix_setElement_INT32 (C2, X [k], I [k], J [k])) ;
+                }
+                for (int k = 0 ; k < nt/2 ; k++)
+                {
+                    OK (GrB_Matrix_removeElement (C2, I [k], J [k])) ;
+                }
+                CHECK (GB_mx_isequal_entries (C1, C2, 0)) ;
+                GrB_free (&C1) ;
+                GrB_free (&C2) ;
+                ntrials++ ;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // error handling
+    //--------------------------------------------------------------------------
+
+    OK (make (&C1, GxB_SPARSE, false, 1)) ;
+    OK (make (&C2, GxB_SPARSE, false, 1)) ;
+    I [0] = 0 ; J [0] = 0 ; X [0] = 1 ;
+    I [1] = N ; J [1] = 0 ; X [1] = 2 ;
+
+    expected = GrB_INVALID_INDEX ;
+    ERR1 (C1, GxB_Matrix_setElements_INT32 (C1, I, J, X, 2, NULL)) ;
+    ERR1 (C1, GxB_Matrix_removeElements (C1, I, J, 2)) ;
+    I [1] = 0 ; J [1] = N ;
+    ERR1 (C1, GxB_Matrix_setElements_INT32 (C1, I, J, X, 2, NULL)) ;
+    ERR1 (C1, GxB_Matrix_removeElements (C1, I, J, 2)) ;
+
+    expected = GrB_NULL_POINTER ;
+    ERR (GxB_Matrix_setElements_INT32 (C1, NULL, J, X, 2, NULL)) ;
+    ERR (GxB_Matrix_setElements_INT32 (C1, I, NULL, X, 2, NULL)) ;
+    ERR (GxB_Matrix_setElements_INT32 (C1, I, J, NULL, 2, NULL)) ;
+    ERR (GxB_Matrix_removeElements (C1, NULL, J, 2)) ;
+    ERR (GxB_Matrix_removeElements (C1, I, NULL, 2)) ;
+
+    // C1 is unchanged by the failed calls, and by an empty list
+    OK (GxB_Matrix_setElements_INT32 (C1, I, J, X, 0, NULL)) ;
+    OK (GxB_Matrix_removeElements (C1, I, J, 0)) ;
+    CHECK (GB_mx_isequal_entries (C1, C2, 0)) ;
+    GrB_free (&C1) ;
+    GrB_free (&C2) ;
+
+    // user-defined type of C does not match the type of X
+    OK (GrB_Type_new (&mytype, sizeof (mytype))) ;
+    OK (GrB_Matrix_new (&C1, mytype, N, N)) ;
+    expected = GrB_DOMAIN_MISMATCH ;
+    ERR1 (C1, GxB_Matrix_setElements_INT32 (C1, I, J, X, 1, NULL)) ;
+    GrB_free (&C1) ;
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_free (&mytype) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test36:  all tests passed (%d trials).\n\n", ntrials) ;
+}
+
@@ -0,0 +1,155 @@
+//------------------------------------------------------------------------------
+// GB_mex_test37: test the blocked bucket transpose
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// The blocked bucket transpose is not used by default, so it is forced here
+// with GB_Global_hack_set (2,1), and compared with the default methods.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test37"
+
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+//------------------------------------------------------------------------------
+// GB_mex_test37 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, C1 = NULL, C2 = NULL ;
+    int save_nthreads ;
+    double save_chunk ;
+    OK (GxB_Global_Option_get_INT32 (GxB_NTHREADS, &save_nthreads)) ;
+    OK (GxB_Global_Option_get_FP64 (GxB_CHUNK, &save_chunk)) ;
+    // use a small chunk so that many threads are used, even for small problems
+    OK (GxB_Global_Option_set_FP64 (GxB_CHUNK, 100)) ;
+    int64_t save_hack = GB_Global_hack_get (2) ;
+    int ntrials = 0 ;
+
+    // matrices of various shapes, with more rows than fit in a single block
+    GrB_Index dims [4][3] = {
+        // nrows, ncols, nvals
+        { 1,      100,   50 },
+        { 100,    1,     50 },
+        { 40000,  300,   20000 },
+        { 70000,  5000,  100000 } } ;
+
+    for (int d = 0 ; d < 4 ; d++)
+    {
+        GrB_Index nrows = dims [d][0] ;
+        GrB_Index ncols = dims [d][1] ;
+        GrB_Index nvals = dims [d][2] ;
+        for (int hyper = 0 ; hyper <= 1 ; hyper++)
+        {
+            for (int iso = 0 ; iso <= 1 ; iso++)
+            {
+
+                //--------------------------------------------------------------
+                // create a random sparse or hypersparse matrix A
+                //--------------------------------------------------------------
+
+                OK (GrB_Matrix_new (&A, GrB_INT32, nrows, ncols)) ;
+                OK (GxB_Matrix_Option_set_(A, GxB_SPARSITY_CONTROL,
+                    hyper ? GxB_HYPERSPARSE : GxB_SPARSE)) ;
+                simple_rand_seed (d + 10*hyper + 100*iso) ;
+                for (int64_t k = 0 ; k < nvals ; k++)
+                {
+                    int32_t x = iso ? 3 : (int32_t) (simple_rand_i ( ) % 1000);
+                    OK (GrB_Matrix_setElement_INT32 (A, x,
+                        simple_rand_i ( ) % nrows,
+                        simple_rand_i ( ) % ncols)) ;
+                }
+                OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+
+                for (int nthreads = 1 ; nthreads <= 4 ; nthreads += 3)
+                {
+                    OK (GxB_Global_Option_set_INT32 (GxB_NTHREADS, nthreads)) ;
+
+                    //----------------------------------------------------------
+                    // C = A', typecasted to double
+                    //----------------------------------------------------------
+
+                    OK (GrB_Matrix_new (&C1, GrB_FP64, ncols, nrows)) ;
+                    OK (GrB_Matrix_new (&C2, GrB_FP64, ncols, nrows)) ;
+                    GB_Global_hack_set (2, 1) ;
+                    OK (GrB_transpose (C1, NULL, NULL, A, NULL)) ;
+                    GB_Global_hack_set (2, 0) ;
+                    OK (GrB_transpose (C2, NULL, NULL, A, NULL)) ;
+                    CHECK (GB_mx_isequal_entries (C1, C2, 0)) ;
+                    GrB_free (&C1) ;
+                    GrB_free (&C2) ;
+                    ntrials++ ;
+
+                    //----------------------------------------------------------
+                    // C = ainv (A')
+                    //----------------------------------------------------------
+
+                    OK (GrB_Matrix_new (&C1, GrB_INT32, ncols, nrows)) ;
+                    OK (GrB_Matrix_new (&C2, GrB_INT32, ncols, nrows)) ;
+                    GB_Global_hack_set (2, 1) ;
+                    OK (GrB_Matrix_apply (C1, NULL, NULL, GrB_AINV_INT32, A,
+                        GrB_DESC_T0)) ;
+                    GB_Global_hack_set (2, 0) ;
+                    OK (GrB_Matrix_apply (C2, NULL, NULL, GrB_AINV_INT32, A,
+                        GrB_DESC_T0)) ;
+                    CHECK (GB_mx_isequal_entries (C1, C2, 0)) ;
+                    GrB_free (&C1) ;
+                    GrB_free (&C2) ;
+                    ntrials++ ;
+
+                    //----------------------------------------------------------
+                    // C = 2 + A'
+                    //----------------------------------------------------------
+
+                    OK (GrB_Matrix_new (&C1, GrB_INT32, ncols, nrows)) ;
+                    OK (GrB_Matrix_new (&C2, GrB_INT32, ncols, nrows)) ;
+                    GB_Global_hack_set (2, 1) ;
+                    OK (GrB_Matrix_apply_BinaryOp1st_INT32 (C1, NULL, NULL,
+                        GrB_PLUS_INT32, 2, A, GrB_DESC_T1)) ;
+                    GB_Global_hack_set (2, 0) ;
+                    OK (GrB_Matrix_apply_BinaryOp1st_INT32 (C2, NULL, NULL,
+                        GrB_PLUS_INT32, 2, A, GrB_DESC_T1)) ;
+                    CHECK (GB_mx_isequal_entries (C1, C2, 0)) ;
+                    GrB_free (&C1) ;
+                    GrB_free (&C2) ;
+                    ntrials++ ;
+                }
+
+                GrB_free (&A) ;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GB_Global_hack_set (2, save_hack) ;
+    OK (GxB_Global_Option_set_INT32 (GxB_NTHREADS, save_nthreads)) ;
+    OK (GxB_Global_Option_set_FP64 (GxB_CHUNK, save_chunk)) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test37:  all tests passed (%d trials).\n\n", ntrials) ;
+}
+
@@ -0,0 +1,137 @@
+//------------------------------------------------------------------------------
+// GB_mex_test38: test GrB_get/set for GxB_TRANSPOSE_CACHE
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Tests the get/set round trips and the invalid values of GxB_TRANSPOSE_CACHE,
+// and the use and invalidation of the cached transpose.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test38"
+
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+#define N 100
+
+//------------------------------------------------------------------------------
+// GB_mex_test38 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, B = NULL, C1 = NULL, C2 = NULL ;
+    GrB_Vector v = NULL ;
+    GrB_Descriptor desc = NULL ;
+    int32_t i32 ;
+
+    OK (GrB_Matrix_new (&A, GrB_FP64, N, N)) ;
+    OK (GrB_Matrix_new (&B, GrB_FP64, N, N)) ;
+    OK (GrB_Vector_new (&v, GrB_FP64, N)) ;
+    simple_rand_seed (38) ;
+    for (int k = 0 ; k < 4*N ; k++)
+    {
+        OK (GrB_Matrix_setElement_FP64 (A, (double) (k % 7),
+            simple_rand_i ( ) % N, simple_rand_i ( ) % N)) ;
+        OK (GrB_Matrix_setElement_FP64 (B, (double) (k % 5),
+            simple_rand_i ( ) % N, simple_rand_i ( ) % N)) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (B, GrB_MATERIALIZE)) ;
+
+    //--------------------------------------------------------------------------
+    // GxB_TRANSPOSE_CACHE
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_get_INT32 (A, &i32, GxB_TRANSPOSE_CACHE)) ;
+    CHECK (i32 == 0) ;
+    OK (GrB_Matrix_set_INT32 (A, true, GxB_TRANSPOSE_CACHE)) ;
+    OK (GrB_Matrix_get_INT32 (A, &i32, GxB_TRANSPOSE_CACHE)) ;
+    CHECK (i32 == 1) ;
+    OK (GxB_Matrix_Option_get_INT32 (A, GxB_TRANSPOSE_CACHE, &i32)) ;
+    CHECK (i32 == 1) ;
+    CHECK (A->AT == NULL) ;
+
+    // C1 = A'*B with the saxpy method constructs and keeps A->AT
+    OK (GrB_Descriptor_new (&desc)) ;
+    OK (GrB_Descriptor_set_INT32 (desc, GrB_TRAN, GrB_INP0)) ;
+    OK (GrB_Descriptor_set_INT32 (desc, GxB_AxB_SAXPY,
+        (GrB_Field) GxB_AxB_METHOD)) ;
+    OK (GrB_Matrix_new (&C1, GrB_FP64, N, N)) ;
+    OK (GrB_mxm (C1, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, B, desc)) ;
+    CHECK (A->AT != NULL) ;
+
+    // the cached A' gives the same result as a new one
+    OK (GrB_Matrix_new (&C2, GrB_FP64, N, N)) ;
+    OK (GrB_mxm (C2, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, B, desc)) ;
+    CHECK (GB_mx_isequal_entries (C1, C2, 0)) ;
+    GrB_free (&C2) ;
+
+    // modifying A frees A->AT, but A still keeps the setting
+    OK (GrB_Matrix_setElement_FP64 (A, 99, 0, 0)) ;
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    CHECK (A->AT == NULL) ;
+    OK (GrB_mxm (C1, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, B, desc)) ;
+    CHECK (A->AT != NULL) ;
+
+    // A->AT is kept if an operation on A fails its checks
+    OK (GrB_Matrix_new (&C2, GrB_FP64, N, 1)) ;
+    expected = GrB_DIMENSION_MISMATCH ;
+    ERR (GrB_mxm (A, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, C2, C2, NULL)) ;
+    ERR (GrB_Matrix_eWiseAdd_BinaryOp (A, NULL, NULL, GrB_PLUS_FP64, C2, C2,
+        NULL)) ;
+    ERR (GrB_Matrix_apply (A, NULL, NULL, GrB_AINV_FP64, C2, NULL)) ;
+    ERR (GrB_Matrix_select_INT64 (A, NULL, NULL, GrB_TRIL, C2, 0, NULL)) ;
+    CHECK (A->AT != NULL) ;
+    GrB_free (&C2) ;
+
+    // clearing the setting frees A->AT
+    OK (GxB_Matrix_Option_set_INT32 (A, GxB_TRANSPOSE_CACHE, false)) ;
+    OK (GrB_Matrix_get_INT32 (A, &i32, GxB_TRANSPOSE_CACHE)) ;
+    CHECK (i32 == 0) ;
+    CHECK (A->AT == NULL) ;
+    OK (GrB_Matrix_new (&C2, GrB_FP64, N, N)) ;
+    OK (GrB_mxm (C2, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, B, desc)) ;
+    CHECK (A->AT == NULL) ;
+    CHECK (GB_mx_isequal_entries (C1, C2, 0)) ;
+    GrB_free (&C1) ;
+    GrB_free (&C2) ;
+
+    // a GrB_Vector has no cached transpose
+    expected = GrB_INVALID_VALUE ;
+    ERR (GrB_Vector_set_INT32 (v, true, GxB_TRANSPOSE_CACHE)) ;
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_free (&A) ;
+    GrB_free (&B) ;
+    GrB_free (&C1) ;
+    GrB_free (&C2) ;
+    GrB_free (&v) ;
+    GrB_free (&desc) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test38:  all tests passed.\n\n") ;
+}
+
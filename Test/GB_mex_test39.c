@@ -0,0 +1,276 @@
+//------------------------------------------------------------------------------
+// GB_mex_test39: test GxB_Matrix_pack_COO
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GxB_Matrix_pack_COO is compared with GrB_Matrix_build, for matrices held by
+// row and by column, with iso and non-iso values, and with 1 and 4 threads.
+// Its error checks are tested with bad tuples placed at the start, middle, and
+// end of the list, so that they are found by different threads.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test39"
+
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+#define NROWS 300
+#define NCOLS 200
+#define NMAX  2000      // max # of tuples
+
+//------------------------------------------------------------------------------
+// tuples: create a sorted list of unique tuples
+//------------------------------------------------------------------------------
+
+// The tuples are sorted by column if by_col is true, or by row otherwise.
+// The arrays are allocated with the same malloc function given to GxB_init,
+// so that GxB_Matrix_pack_COO can take ownership of them.
+
+static int64_t tuples
+(
+    GrB_Index **I_handle, GrB_Index **J_handle, double **X_handle,
+    int64_t nz, bool by_col, bool iso, uint64_t seed
+)
+{
+    GrB_Index *I = mxMalloc (GB_IMAX (nz, 1) * sizeof (GrB_Index)) ;
+    GrB_Index *J = mxMalloc (GB_IMAX (nz, 1) * sizeof (GrB_Index)) ;
+    double *X = mxMalloc (GB_IMAX (nz, 1) * sizeof (double)) ;
+    simple_rand_seed (seed) ;
+    int64_t nvals = 0 ;
+    int64_t nouter = by_col ? NCOLS : NROWS ;
+    int64_t ninner = by_col ? NROWS : NCOLS ;
+    for (int64_t outer = 0 ; outer < nouter && nvals < nz ; outer++)
+    {
+        // leave some vectors empty
+        if (simple_rand_i ( ) % 4 == 0) continue ;
+        for (int64_t inner = 0 ; inner < ninner && nvals < nz ; inner++)
+        {
+            if (simple_rand_i ( ) % 8 != 0) continue ;
+            I [nvals] = by_col ? inner : outer ;
+            J [nvals] = by_col ? outer : inner ;
+            X [nvals] = iso ? 3 : (double) (simple_rand_i ( ) % 100) ;
+            nvals++ ;
+        }
+    }
+    (*I_handle) = I ;
+    (*J_handle) = J ;
+    (*X_handle) = X ;
+    return (nvals) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test39 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, B = NULL ;
+    GrB_Index *I = NULL, *J = NULL ;
+    double *X = NULL ;
+    GrB_Index nvals ;
+    int save_nthreads ;
+    double save_chunk ;
+    OK (GxB_Global_Option_get_INT32 (GxB_NTHREADS, &save_nthreads)) ;
+    OK (GxB_Global_Option_get_FP64 (GxB_CHUNK, &save_chunk)) ;
+    // use a small chunk so that many threads check the tuples
+    OK (GxB_Global_Option_set_FP64 (GxB_CHUNK, 10)) ;
+    int ntrials = 0 ;
+
+    //--------------------------------------------------------------------------
+    // compare GxB_Matrix_pack_COO with GrB_Matrix_build
+    //--------------------------------------------------------------------------
+
+    int64_t nzlist [4] = { 0, 1, 100, NMAX } ;
+    for (int by_col = 0 ; by_col <= 1 ; by_col++)
+    {
+        for (int iso = 0 ; iso <= 1 ; iso++)
+        {
+            for (int nthreads = 1 ; nthreads <= 4 ; nthreads += 3)
+            {
+                OK (GxB_Global_Option_set_INT32 (GxB_NTHREADS, nthreads)) ;
+                for (int k = 0 ; k < 4 ; k++)
+                {
+                    int64_t nz = tuples (&I, &J, &X, nzlist [k], by_col, iso,
+                        k + 10*iso + 100*by_col) ;
+
+                    // B = sparse (I, J, X), with GrB_Matrix_build
+                    OK (GrB_Matrix_new (&B, GrB_FP64, NROWS, NCOLS)) ;
+                    OK (GxB_Matrix_Option_set_INT32 (B, GxB_FORMAT,
+                        by_col ? GxB_BY_COL : GxB_BY_ROW)) ;
+                    OK (GrB_Matrix_build_FP64 (B, I, J, X, nz, NULL)) ;
+
+                    // A = sparse (I, J, X), with GxB_Matrix_pack_COO.  A has
+                    // prior content, which is discarded.
+                    OK (GrB_Matrix_new (&A, GrB_FP64, NROWS, NCOLS)) ;
+                    OK (GxB_Matrix_Option_set_INT32 (A, GxB_FORMAT,
+                        by_col ? GxB_BY_COL : GxB_BY_ROW)) ;
+                    OK (GrB_Matrix_setElement_FP64 (A, 1, 0, 0)) ;
+                    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+                    GrB_Index nbytes = GB_IMAX (nz, 1) * sizeof (GrB_Index) ;
+                    GrB_Index xbytes = (iso ? 1 : GB_IMAX (nz, 1))
+                        * sizeof (double) ;
+                    OK (GxB_Matrix_pack_COO (A, &I, &J, (void **) &X,
+                        nbytes, nbytes, xbytes, iso, nz, NULL)) ;
+                    CHECK (I == NULL && J == NULL && X == NULL) ;
+                    OK (GrB_Matrix_nvals (&nvals, A)) ;
+                    CHECK (nvals == nz) ;
+                    CHECK (A->iso == iso) ;
+                    CHECK (GB_mx_isequal_entries (A, B, 0)) ;
+                    GrB_free (&A) ;
+                    GrB_free (&B) ;
+                    ntrials++ ;
+                }
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // an empty list of tuples may be NULL
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&A, GrB_FP64, NROWS, NCOLS)) ;
+    OK (GrB_Matrix_setElement_FP64 (A, 1, 0, 0)) ;
+    OK (GxB_Matrix_pack_COO (A, &I, &J, (void **) &X, 0, 0, 0, false, 0,
+        NULL)) ;
+    OK (GrB_Matrix_nvals (&nvals, A)) ;
+    CHECK (nvals == 0) ;
+    GrB_free (&A) ;
+
+    //--------------------------------------------------------------------------
+    // error handling
+    //--------------------------------------------------------------------------
+
+    // the bad tuple is placed at the start, middle, or end of the list
+    OK (GxB_Global_Option_set_INT32 (GxB_NTHREADS, 4)) ;
+    for (int by_col = 0 ; by_col <= 1 ; by_col++)
+    {
+        int64_t nz = tuples (&I, &J, &X, NMAX, by_col, false, 39) ;
+        GrB_Index nbytes = nz * sizeof (GrB_Index) ;
+        GrB_Index xbytes = nz * sizeof (double) ;
+        GrB_Index *V = by_col ? J : I ;     // vector index of each tuple
+        GrB_Index *W = by_col ? I : J ;     // index within each vector
+        int64_t vdim = by_col ? NCOLS : NROWS ;
+        int64_t vlen = by_col ? NROWS : NCOLS ;
+        int64_t plist [3] = { 0, nz/2, nz-1 } ;
+
+        OK (GrB_Matrix_new (&A, GrB_FP64, NROWS, NCOLS)) ;
+        OK (GxB_Matrix_Option_set_INT32 (A, GxB_FORMAT,
+            by_col ? GxB_BY_COL : GxB_BY_ROW)) ;
+        OK (GrB_Matrix_setElement_FP64 (A, 1, 0, 0)) ;
+        OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+        OK (GrB_Matrix_dup (&B, A)) ;
+
+        for (int k = 0 ; k < 3 ; k++)
+        {
+            int64_t p = plist [k] ;
+            GrB_Index v = V [p], w = W [p] ;
+
+            // index out of bounds
+            expected = GrB_INDEX_OUT_OF_BOUNDS ;
+            V [p] = vdim ;
+            ERR1 (A, GxB_Matrix_pack_COO (A, &I, &J, (void **) &X,
+                nbytes, nbytes, xbytes, false, nz, NULL)) ;
+            V [p] = v ;
+            W [p] = vlen ;
+            ERR1 (A, GxB_Matrix_pack_COO (A, &I, &J, (void **) &X,
+                nbytes, nbytes, xbytes, false, nz, NULL)) ;
+            W [p] = w ;
+
+            // a duplicate tuple
+            expected = GrB_INVALID_VALUE ;
+            if (p > 0)
+            {
+                V [p] = V [p-1] ;
+                W [p] = W [p-1] ;
+                ERR1 (A, GxB_Matrix_pack_COO (A, &I, &J, (void **) &X,
+                    nbytes, nbytes, xbytes, false, nz, NULL)) ;
+                V [p] = v ;
+                W [p] = w ;
+            }
+
+            // tuples out of order: swap tuples p and p+1
+            if (p < nz-1)
+            {
+                V [p] = V [p+1] ; V [p+1] = v ;
+                W [p] = W [p+1] ; W [p+1] = w ;
+                ERR1 (A, GxB_Matrix_pack_COO (A, &I, &J, (void **) &X,
+                    nbytes, nbytes, xbytes, false, nz, NULL)) ;
+                V [p+1] = V [p] ; V [p] = v ;
+                W [p+1] = W [p] ; W [p] = w ;
+            }
+
+            // A and the arrays are unchanged by the errors
+            CHECK (I != NULL && J != NULL && X != NULL) ;
+            CHECK (GB_mx_isequal_entries (A, B, 0)) ;
+        }
+
+        // arrays too small
+        expected = GrB_INVALID_VALUE ;
+        ERR (GxB_Matrix_pack_COO (A, &I, &J, (void **) &X,
+            nbytes - 1, nbytes, xbytes, false, nz, NULL)) ;
+        ERR (GxB_Matrix_pack_COO (A, &I, &J, (void **) &X,
+            nbytes, nbytes - 1, xbytes, false, nz, NULL)) ;
+        ERR (GxB_Matrix_pack_COO (A, &I, &J, (void **) &X,
+            nbytes, nbytes, xbytes - 1, false, nz, NULL)) ;
+        ERR (GxB_Matrix_pack_COO (A, &I, &J, (void **) &X,
+            nbytes, nbytes, sizeof (double) - 1, true, nz, NULL)) ;
+        ERR (GxB_Matrix_pack_COO (A, &I, &J, (void **) &X,
+            nbytes, nbytes, xbytes, false, GB_NMAX + 1, NULL)) ;
+
+        // NULL arrays
+        expected = GrB_NULL_POINTER ;
+        ERR (GxB_Matrix_pack_COO (A, NULL, &J, (void **) &X,
+            nbytes, nbytes, xbytes, false, nz, NULL)) ;
+        ERR (GxB_Matrix_pack_COO (A, &I, NULL, (void **) &X,
+            nbytes, nbytes, xbytes, false, nz, NULL)) ;
+        GrB_Index *Inull = NULL ;
+        ERR (GxB_Matrix_pack_COO (A, &Inull, &J, (void **) &X,
+            nbytes, nbytes, xbytes, false, nz, NULL)) ;
+        ERR (GxB_Matrix_pack_COO (A, &I, &J, NULL,
+            nbytes, nbytes, xbytes, false, nz, NULL)) ;
+        double *Xnull = NULL ;
+        ERR (GxB_Matrix_pack_COO (A, &I, &J, (void **) &Xnull,
+            nbytes, nbytes, xbytes, false, nz, NULL)) ;
+        ERR (GxB_Matrix_pack_COO (NULL, &I, &J, (void **) &X,
+            nbytes, nbytes, xbytes, false, nz, NULL)) ;
+        CHECK (GB_mx_isequal_entries (A, B, 0)) ;
+
+        // the tuples are valid after all the changes above
+        OK (GxB_Matrix_pack_COO (A, &I, &J, (void **) &X,
+            nbytes, nbytes, xbytes, false, nz, NULL)) ;
+        OK (GrB_Matrix_nvals (&nvals, A)) ;
+        CHECK (nvals == nz) ;
+        GrB_free (&A) ;
+        GrB_free (&B) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    OK (GxB_Global_Option_set_INT32 (GxB_NTHREADS, save_nthreads)) ;
+    OK (GxB_Global_Option_set_FP64 (GxB_CHUNK, save_chunk)) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test39:  all tests passed (%d trials).\n\n", ntrials) ;
+}
+
@@ -0,0 +1,269 @@
+//------------------------------------------------------------------------------
+// GB_mex_test40: test GxB_Matrix_build_File
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GxB_Matrix_build_File is compared with GrB_Matrix_build on the same tuples.
+// The workspace is set to its minimum, so that files with more than
+// GB_BUILD_FILE_BLOCK tuples are split into several sorted runs, and
+// duplicates appear both within a run and across runs.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+#include "GB_build.h"
+
+#define USAGE "GB_mex_test40"
+
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+#define NT (3 * GB_BUILD_FILE_BLOCK + 1000)    // number of tuples
+
+//------------------------------------------------------------------------------
+// write_tuples: write n tuples to a new temporary file
+//------------------------------------------------------------------------------
+
+// Each tuple is written as (int64_t row, int64_t col, value), with no padding,
+// where each value has size xsize.  If extra > 0, that many bytes of a partial
+// tuple are appended to the end of the file.
+
+static FILE *write_tuples (const GrB_Index *I, const GrB_Index *J,
+    const void *X, size_t xsize, int64_t n, size_t extra)
+{
+    FILE *f = tmpfile ( ) ;
+    if (f == NULL) return (NULL) ;
+    for (int64_t k = 0 ; k < n ; k++)
+    {
+        int64_t rc [2] = { (int64_t) I [k], (int64_t) J [k] } ;
+        fwrite (rc, sizeof (int64_t), 2, f) ;
+        fwrite (((const char *) X) + k * xsize, xsize, 1, f) ;
+    }
+    for (size_t k = 0 ; k < extra ; k++)
+    {
+        fputc (0, f) ;
+    }
+    rewind (f) ;
+    return (f) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test40 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix C1 = NULL, C2 = NULL ;
+    FILE *f = NULL ;
+    int ntrials = 0 ;
+
+    GrB_Index *I = mxMalloc (NT * sizeof (GrB_Index)) ;
+    GrB_Index *J = mxMalloc (NT * sizeof (GrB_Index)) ;
+    double    *X = mxMalloc (NT * sizeof (double)) ;
+    int32_t   *Y = mxMalloc (NT * sizeof (int32_t)) ;
+    CHECK (I != NULL && J != NULL && X != NULL && Y != NULL) ;
+
+    //--------------------------------------------------------------------------
+    // many duplicates, within and across runs
+    //--------------------------------------------------------------------------
+
+    GrB_BinaryOp dups [4] = { GrB_PLUS_FP64, GrB_FIRST_FP64, GrB_SECOND_FP64,
+        GxB_IGNORE_DUP } ;
+
+    // matrices, a CSR matrix, and a single column
+    GrB_Index dims [3][2] = { { 500, 500 }, { 300, 700 }, { 20000, 1 } } ;
+
+    for (int d = 0 ; d < 3 ; d++)
+    {
+        GrB_Index nrows = dims [d][0] ;
+        GrB_Index ncols = dims [d][1] ;
+        int fmt = (d == 1) ? GxB_BY_ROW : GxB_BY_COL ;
+
+        simple_rand_seed (d + 1) ;
+        for (int64_t k = 0 ; k < NT ; k++)
+        {
+            I [k] = simple_rand_i ( ) % nrows ;
+            J [k] = simple_rand_i ( ) % ncols ;
+            Y [k] = (int32_t) (simple_rand_i ( ) % 100) ;
+            X [k] = (double) Y [k] ;
+        }
+
+        for (int k = 0 ; k < 4 ; k++)
+        {
+            GrB_BinaryOp dup = dups [k] ;
+            for (int memory = 0 ; memory <= 1 ; memory++)
+            {
+                for (int typecast = 0 ; typecast <= 1 ; typecast++)
+                {
+                    OK (GrB_Matrix_new (&C1, GrB_FP64, nrows, ncols)) ;
+                    OK (GrB_Matrix_new (&C2, GrB_FP64, nrows, ncols)) ;
+                    OK (GxB_Matrix_Option_set_(C1, GxB_FORMAT, fmt)) ;
+                    OK (GxB_Matrix_Option_set_(C2, GxB_FORMAT, fmt)) ;
+
+                    // C1 = build from the file, with memory = 1 to force
+                    // multiple runs, or 0 to use a single chunk
+                    f = typecast ?
+                        write_tuples (I, J, Y, sizeof (int32_t), NT, 0) :
+                        write_tuples (I, J, X, sizeof (double), NT, 0) ;
+                    CHECK (f != NULL) ;
+                    OK (GxB_Matrix_build_File (C1, f,
+                        typecast ? GrB_INT32 : GrB_FP64, dup, memory, NULL)) ;
+                    fclose (f) ;
+
+                    // C2 = build from the same tuples held in memory
+                    OK (GrB_Matrix_build_FP64 (C2, I, J, X, NT, dup)) ;
+                    CHECK (GB_mx_isequal_entries (C1, C2, 0)) ;
+                    GrB_free (&C1) ;
+                    GrB_free (&C2) ;
+                    ntrials++ ;
+                }
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // a single duplicate, in the first and last runs
+    //--------------------------------------------------------------------------
+
+    // all tuples are unique, except that the last one repeats the first
+    for (int64_t k = 0 ; k < NT ; k++)
+    {
+        I [k] = k % 1000 ;
+        J [k] = k / 1000 ;
+        X [k] = (double) k ;
+    }
+    I [NT-1] = I [0] ;
+    J [NT-1] = J [0] ;
+
+    for (int memory = 0 ; memory <= 1 ; memory++)
+    {
+        // with dup = NULL, the duplicate is an error, and C1 is not modified
+        OK (GrB_Matrix_new (&C1, GrB_FP64, 1000, 1000)) ;
+        f = write_tuples (I, J, X, sizeof (double), NT, 0) ;
+        CHECK (f != NULL) ;
+        expected = GrB_INVALID_VALUE ;
+        ERR1 (C1, GxB_Matrix_build_File (C1, f, GrB_FP64, NULL, memory,
+            NULL)) ;
+        fclose (f) ;
+        GrB_Index nvals ;
+        OK (GrB_Matrix_nvals (&nvals, C1)) ;
+        CHECK (nvals == 0) ;
+
+        // C1 can still be built after the failed call
+        OK (GrB_Matrix_new (&C2, GrB_FP64, 1000, 1000)) ;
+        f = write_tuples (I, J, X, sizeof (double), NT, 0) ;
+        CHECK (f != NULL) ;
+        OK (GxB_Matrix_build_File (C1, f, GrB_FP64, GrB_SECOND_FP64, memory,
+            NULL)) ;
+        fclose (f) ;
+        OK (GrB_Matrix_build_FP64 (C2, I, J, X, NT, GrB_SECOND_FP64)) ;
+        CHECK (GB_mx_isequal_entries (C1, C2, 0)) ;
+        GrB_free (&C1) ;
+        GrB_free (&C2) ;
+        ntrials++ ;
+    }
+
+    //--------------------------------------------------------------------------
+    // empty file
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&C1, GrB_FP64, 10, 10)) ;
+    OK (GrB_Matrix_new (&C2, GrB_FP64, 10, 10)) ;
+    f = write_tuples (I, J, X, sizeof (double), 0, 0) ;
+    CHECK (f != NULL) ;
+    OK (GxB_Matrix_build_File (C1, f, GrB_FP64, NULL, 1, NULL)) ;
+    fclose (f) ;
+    CHECK (GB_mx_isequal_entries (C1, C2, 0)) ;
+    GrB_free (&C1) ;
+    GrB_free (&C2) ;
+    ntrials++ ;
+
+    //--------------------------------------------------------------------------
+    // malformed files
+    //--------------------------------------------------------------------------
+
+    expected = GrB_INVALID_VALUE ;
+    size_t rsize = 2 * sizeof (int64_t) + sizeof (double) ;
+    int64_t ns [3] = { 0, 100, NT } ;
+    for (int k = 0 ; k < 3 ; k++)
+    {
+        for (size_t extra = 1 ; extra < rsize ; extra += 7)
+        {
+            // n complete tuples followed by a partial tuple
+            OK (GrB_Matrix_new (&C1, GrB_FP64, 1000, 1000)) ;
+            f = write_tuples (I, J, X, sizeof (double), ns [k], extra) ;
+            CHECK (f != NULL) ;
+            ERR1 (C1, GxB_Matrix_build_File (C1, f, GrB_FP64,
+                GrB_PLUS_FP64, 1, NULL)) ;
+            fclose (f) ;
+            GrB_Index nvals ;
+            OK (GrB_Matrix_nvals (&nvals, C1)) ;
+            CHECK (nvals == 0) ;
+            GrB_free (&C1) ;
+            ntrials++ ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // other errors
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&C1, GrB_FP64, 10, 10)) ;
+
+    // index out of bounds
+    I [0] = 10 ; J [0] = 0 ; X [0] = 1 ;
+    f = write_tuples (I, J, X, sizeof (double), 1, 0) ;
+    CHECK (f != NULL) ;
+    expected = GrB_INDEX_OUT_OF_BOUNDS ;
+    ERR1 (C1, GxB_Matrix_build_File (C1, f, GrB_FP64, NULL, 0, NULL)) ;
+    fclose (f) ;
+
+    // NULL file
+    expected = GrB_NULL_POINTER ;
+    ERR1 (C1, GxB_Matrix_build_File (C1, NULL, GrB_FP64, NULL, 0, NULL)) ;
+
+    // positional dup operator
+    I [0] = 0 ;
+    f = write_tuples (I, J, X, sizeof (double), 1, 0) ;
+    CHECK (f != NULL) ;
+    expected = GrB_DOMAIN_MISMATCH ;
+    ERR1 (C1, GxB_Matrix_build_File (C1, f, GrB_FP64, GxB_FIRSTI_INT64, 0,
+        NULL)) ;
+
+    // output not empty
+    OK (GxB_Matrix_build_File (C1, f, GrB_FP64, NULL, 0, NULL)) ;
+    rewind (f) ;
+    expected = GrB_OUTPUT_NOT_EMPTY ;
+    ERR1 (C1, GxB_Matrix_build_File (C1, f, GrB_FP64, NULL, 0, NULL)) ;
+    fclose (f) ;
+    GrB_free (&C1) ;
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    mxFree (I) ;
+    mxFree (J) ;
+    mxFree (X) ;
+    mxFree (Y) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test40:  all tests passed (%d trials).\n\n", ntrials) ;
+}
+
@@ -0,0 +1,239 @@
+//------------------------------------------------------------------------------
+// GB_mex_test41: test GxB_Matrix_reduce_Monoids
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GxB_Matrix_reduce_Monoids is compared with GrB_Matrix_reduce_Monoid and
+// GrB_Matrix_reduce_Monoid_Scalar, one monoid at a time, with the typed
+// loops (built-in monoids with no typecasting) and the generic ones, for
+// matrices in all four formats, reduced along their vectors or scattered.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test41"
+
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+#define NMON 6
+
+//------------------------------------------------------------------------------
+// GB_mex_test41 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, Ones = NULL ;
+    GrB_Vector w [NMON], w2 = NULL ;
+    GrB_Scalar s [NMON], s2 = NULL ;
+    GrB_Type mytype = NULL ;
+    for (int k = 0 ; k < NMON ; k++)
+    {
+        w [k] = NULL ;
+        s [k] = NULL ;
+    }
+    bool save_factory = GB_factory_kernels_enabled ;
+    int save_nthreads ;
+    double save_chunk ;
+    OK (GxB_Global_Option_get_INT32 (GxB_NTHREADS, &save_nthreads)) ;
+    OK (GxB_Global_Option_get_FP64 (GxB_CHUNK, &save_chunk)) ;
+    OK (GxB_Global_Option_set_FP64 (GxB_CHUNK, 100)) ;
+    int ntrials = 0 ;
+
+    // the type of A, and the monoids for each type; a NULL monoid counts
+    // the entries.  The last monoid for each type typecasts A, so it uses the
+    // generic loops.
+    GrB_Type atypes [3] = { GrB_FP64, GrB_INT32, GrB_BOOL } ;
+    GrB_Monoid monoids [3][NMON] = {
+        { GrB_PLUS_MONOID_FP64, GrB_MIN_MONOID_FP64, GrB_MAX_MONOID_FP64,
+          GrB_TIMES_MONOID_FP64, NULL, GrB_PLUS_MONOID_INT64 },
+        { GrB_PLUS_MONOID_INT32, GrB_MIN_MONOID_INT32, GrB_MAX_MONOID_INT32,
+          GrB_TIMES_MONOID_INT32, NULL, GrB_PLUS_MONOID_FP64 },
+        { GrB_LOR_MONOID_BOOL, GrB_LAND_MONOID_BOOL, GrB_LXOR_MONOID_BOOL,
+          GrB_LXNOR_MONOID_BOOL, NULL, GrB_PLUS_MONOID_INT32 } } ;
+
+    // a wide matrix (reduced along its vectors or scattered), and a tall one
+    // (transposed before it is scattered)
+    GrB_Index dims [2][2] = { { 50, 2000 }, { 5000, 20 } } ;
+    int sparsities [4] = { GxB_SPARSE, GxB_HYPERSPARSE, GxB_BITMAP, GxB_FULL } ;
+
+    for (int t = 0 ; t < 3 ; t++)
+    {
+        GrB_Type atype = atypes [t] ;
+        for (int d = 0 ; d < 2 ; d++)
+        {
+            GrB_Index nrows = dims [d][0] ;
+            GrB_Index ncols = dims [d][1] ;
+            for (int iso = 0 ; iso <= 1 ; iso++)
+            {
+
+                //--------------------------------------------------------------
+                // create A, with some empty rows and columns
+                //--------------------------------------------------------------
+
+                OK (GrB_Matrix_new (&A, atype, nrows, ncols)) ;
+                simple_rand_seed (t + 10*d + 100*iso) ;
+                int64_t nz = (nrows * ncols) / 4 ;
+                for (int64_t p = 0 ; p < nz ; p++)
+                {
+                    GrB_Index i = simple_rand_i ( ) % (nrows - 1) ;
+                    GrB_Index j = simple_rand_i ( ) % (ncols - 1) ;
+                    double x = iso ? 1 :
+                        ((double) (simple_rand_i ( ) % 5) - 2) ;
+                    if (!iso && atype == GrB_FP64 && p % 97 == 0)
+                    {
+                        // some NaNs, ignored by MIN and MAX
+                        x = NAN ;
+                    }
+                    OK (GrB_Matrix_setElement_FP64 (A, x, i, j)) ;
+                }
+                OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+
+                for (int s_fmt = 0 ; s_fmt < 8 ; s_fmt++)
+                {
+                    int sparsity = sparsities [s_fmt / 2] ;
+                    int fmt = (s_fmt % 2 == 0) ? GxB_BY_ROW : GxB_BY_COL ;
+                    if (sparsity == GxB_FULL)
+                    {
+                        // fill A so it can be held as full (this is done
+                        // last, since A is modified)
+                        OK (GrB_Matrix_assign_FP64 (A, A, NULL, 1, GrB_ALL,
+                            nrows, GrB_ALL, ncols, GrB_DESC_SC)) ;
+                    }
+                    OK (GxB_Matrix_Option_set_(A, GxB_FORMAT, fmt)) ;
+                    OK (GxB_Matrix_Option_set_(A, GxB_SPARSITY_CONTROL,
+                        sparsity)) ;
+                    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+
+                    // Ones = pattern of A, for counting the entries
+                    OK (GrB_Matrix_new (&Ones, GrB_INT64, nrows, ncols)) ;
+                    OK (GrB_Matrix_apply (Ones, NULL, NULL, GxB_ONE_INT64, A,
+                        NULL)) ;
+
+                    for (int tr = 0 ; tr <= 1 ; tr++)
+                    {
+                        GrB_Descriptor desc = tr ? GrB_DESC_T0 : NULL ;
+                        GrB_Index n = tr ? ncols : nrows ;
+                        for (int factory = 0 ; factory <= 1 ; factory++)
+                        {
+                            for (int nth = 1 ; nth <= 4 ; nth += 3)
+                            {
+                                OK (GxB_Global_Option_set_INT32 (GxB_NTHREADS,
+                                    nth)) ;
+                                GB_factory_kernels_enabled = factory ;
+
+                                //----------------------------------------------
+                                // w [k] and s [k] = reduce (A) for all k
+                                //----------------------------------------------
+
+                                for (int k = 0 ; k < NMON ; k++)
+                                {
+                                    GrB_Monoid mon = monoids [t][k] ;
+                                    GrB_Type ztype = (mon == NULL) ?
+                                        GrB_INT64 : mon->op->ztype ;
+                                    OK (GrB_Vector_new (&w [k], ztype, n)) ;
+                                    OK (GrB_Scalar_new (&s [k], ztype)) ;
+                                }
+                                OK (GxB_Matrix_reduce_Monoids (w, s,
+                                    monoids [t], NMON, A, desc)) ;
+                                GB_factory_kernels_enabled = save_factory ;
+
+                                //----------------------------------------------
+                                // compare with one monoid at a time
+                                //----------------------------------------------
+
+                                for (int k = 0 ; k < NMON ; k++)
+                                {
+                                    GrB_Monoid mon = monoids [t][k] ;
+                                    GrB_Type ztype = (mon == NULL) ?
+                                        GrB_INT64 : mon->op->ztype ;
+                                    OK (GrB_Vector_new (&w2, ztype, n)) ;
+                                    OK (GrB_Scalar_new (&s2, ztype)) ;
+                                    GrB_Matrix B = (mon == NULL) ? Ones : A ;
+                                    if (mon == NULL)
+                                    {
+                                        mon = GrB_PLUS_MONOID_INT64 ;
+                                    }
+                                    OK (GrB_Matrix_reduce_Monoid (w2, NULL,
+                                        NULL, mon, B, desc)) ;
+                                    OK (GrB_Matrix_reduce_Monoid_Scalar (s2,
+                                        NULL, mon, B, NULL)) ;
+                                    CHECK (GB_mx_isequal_entries (
+                                        (GrB_Matrix) w [k], (GrB_Matrix) w2,
+                                        0)) ;
+                                    CHECK (GB_mx_isequal_entries (
+                                        (GrB_Matrix) s [k], (GrB_Matrix) s2,
+                                        0)) ;
+                                    GrB_free (&w2) ;
+                                    GrB_free (&s2) ;
+                                    GrB_free (&w [k]) ;
+                                    GrB_free (&s [k]) ;
+                                }
+                                ntrials++ ;
+                            }
+                        }
+                    }
+                    GrB_free (&Ones) ;
+                }
+                GrB_free (&A) ;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // only some results requested
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&A, GrB_INT32, 10, 10)) ;
+    OK (GrB_Matrix_setElement_INT32 (A, 3, 1, 2)) ;
+    OK (GrB_Matrix_setElement_INT32 (A, 4, 1, 5)) ;
+    OK (GrB_Vector_new (&w [0], GrB_INT32, 10)) ;
+    OK (GrB_Scalar_new (&s [1], GrB_INT32)) ;
+    OK (GxB_Matrix_reduce_Monoids (w, s, monoids [1], 2, A, NULL)) ;
+    int32_t x = 0 ;
+    OK (GrB_Vector_extractElement_INT32 (&x, w [0], 1)) ;
+    CHECK (x == 7) ;
+    OK (GrB_Scalar_extractElement_INT32 (&x, s [1])) ;
+    CHECK (x == 3) ;
+    OK (GxB_Matrix_reduce_Monoids (NULL, NULL, monoids [1], 2, A, NULL)) ;
+    GrB_free (&w [0]) ;
+    GrB_free (&s [1]) ;
+
+    // s [0] has a user-defined type, which the monoid cannot be typecast to
+    OK (GrB_Type_new (&mytype, sizeof (double))) ;
+    OK (GrB_Scalar_new (&s [0], mytype)) ;
+    expected = GrB_DOMAIN_MISMATCH ;
+    ERR (GxB_Matrix_reduce_Monoids (NULL, s, monoids [1], 1, A, NULL)) ;
+    GrB_free (&s [0]) ;
+    GrB_free (&A) ;
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_free (&mytype) ;
+    GB_factory_kernels_enabled = save_factory ;
+    OK (GxB_Global_Option_set_INT32 (GxB_NTHREADS, save_nthreads)) ;
+    OK (GxB_Global_Option_set_FP64 (GxB_CHUNK, save_chunk)) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test41:  all tests passed (%d trials).\n\n", ntrials) ;
+}
@@ -0,0 +1,332 @@
+//------------------------------------------------------------------------------
+// GB_mex_test42: test GxB_Iterator_partition and GxB_Iterator_getBlock
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// A matrix is split with GxB_Iterator_partition, and each range of rows (or
+// columns) is then traversed with its own iterator, using kseek and
+// GxB_Iterator_getBlock.  The entries found are used to build a copy of the
+// matrix, which must match the original.  All four formats are tested, by row
+// and by column, with one task, a few tasks, and more tasks than vectors.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test42"
+
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+//------------------------------------------------------------------------------
+// GB_mex_test42 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, A0 = NULL, C = NULL ;
+    GxB_Iterator it = NULL, iterator = NULL ;
+    int ntrials = 0 ;
+
+    // the matrices below have at most NMAX vectors and NZMAX entries
+    #define NMAX 2000
+    #define NZMAX (40 * NMAX)
+    GrB_Index *Slice = mxMalloc ((NMAX + 2) * sizeof (GrB_Index)) ;
+    GrB_Index *I = mxMalloc (NZMAX * sizeof (GrB_Index)) ;
+    GrB_Index *J = mxMalloc (NZMAX * sizeof (GrB_Index)) ;
+    double    *X = mxMalloc (NZMAX * sizeof (double)) ;
+    CHECK (Slice != NULL && I != NULL && J != NULL && X != NULL) ;
+
+    //--------------------------------------------------------------------------
+    // test all formats
+    //--------------------------------------------------------------------------
+
+    // a short wide matrix, a tall thin one, and one with only 3 rows and 3
+    // columns, so most ntasks exceed the number of vectors
+    GrB_Index dims [3][2] = { { 40, NMAX }, { NMAX, 40 }, { 3, 3 } } ;
+    int sparsities [4] = { GxB_SPARSE, GxB_HYPERSPARSE, GxB_BITMAP, GxB_FULL } ;
+    int ntasks_list [5] = { 1, 2, 3, 7, NMAX+1 } ;
+
+    for (int d = 0 ; d < 3 ; d++)
+    {
+        GrB_Index nrows = dims [d][0] ;
+        GrB_Index ncols = dims [d][1] ;
+        for (int iso = 0 ; iso <= 1 ; iso++)
+        {
+
+            //------------------------------------------------------------------
+            // create A0, with some empty rows and columns and some dense ones
+            //------------------------------------------------------------------
+
+            OK (GrB_Matrix_new (&A0, GrB_FP64, nrows, ncols)) ;
+            simple_rand_seed (d + 10*iso) ;
+            int64_t nz = GB_IMAX ((nrows * ncols) / 10, 4) ;
+            for (int64_t p = 0 ; p < nz ; p++)
+            {
+                GrB_Index i = simple_rand_i ( ) % (nrows - 1) ;
+                GrB_Index j = simple_rand_i ( ) % (ncols - 1) ;
+                // the first rows and columns have more entries
+                if (p % 2 == 0) i = i % 2 ;
+                if (p % 3 == 0) j = j % 2 ;
+                double x = iso ? 3 : ((double) (simple_rand_i ( ) % 100)) ;
+                OK (GrB_Matrix_setElement_FP64 (A0, x, i, j)) ;
+            }
+            OK (GrB_Matrix_wait (A0, GrB_MATERIALIZE)) ;
+
+            for (int s = 0 ; s < 4 ; s++)
+            {
+                int sparsity = sparsities [s] ;
+                OK (GrB_Matrix_dup (&A, A0)) ;
+                if (sparsity == GxB_FULL)
+                {
+                    // add explicit zeros so A can be held as full
+                    OK (GrB_Matrix_assign_FP64 (A, A, NULL, iso ? 3 : 0,
+                        GrB_ALL, nrows, GrB_ALL, ncols, GrB_DESC_SC)) ;
+                }
+
+                for (int by_col = 0 ; by_col <= 1 ; by_col++)
+                {
+                    OK (GxB_Matrix_Option_set_(A, GxB_FORMAT,
+                        by_col ? GxB_BY_COL : GxB_BY_ROW)) ;
+                    OK (GxB_Matrix_Option_set_(A, GxB_SPARSITY_CONTROL,
+                        sparsity)) ;
+                    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+                    bool A_iso ;
+                    OK (GxB_Matrix_iso (&A_iso, A)) ;
+                    CHECK (A_iso == (bool) iso) ;
+
+                    for (int kt = 0 ; kt < 5 ; kt++)
+                    {
+
+                        //------------------------------------------------------
+                        // partition A
+                        //------------------------------------------------------
+
+                        OK (GxB_Iterator_new (&it)) ;
+                        GrB_Index kount ;
+                        if (by_col)
+                        {
+                            OK (GxB_colIterator_attach (it, A, NULL)) ;
+                            kount = GxB_colIterator_kount (it) ;
+                        }
+                        else
+                        {
+                            OK (GxB_rowIterator_attach (it, A, NULL)) ;
+                            kount = GxB_rowIterator_kount (it) ;
+                        }
+                        int ntasks = ntasks_list [kt] ;
+                        OK (GxB_Iterator_partition (Slice, &ntasks, it)) ;
+                        GrB_free (&it) ;
+
+                        // ntasks is reduced to the number of vectors
+                        int64_t nt = GB_IMIN (ntasks_list [kt],
+                            GB_IMAX (kount, 1)) ;
+                        CHECK (ntasks == nt) ;
+                        CHECK (Slice [0] == 0) ;
+                        CHECK (Slice [ntasks] == kount) ;
+                        for (int tid = 0 ; tid < ntasks ; tid++)
+                        {
+                            CHECK (Slice [tid] <= Slice [tid+1]) ;
+                        }
+
+                        //------------------------------------------------------
+                        // traverse each range with its own iterator
+                        //------------------------------------------------------
+
+                        int64_t n = 0 ;
+                        int64_t nvecs = 0 ;
+                        for (int tid = 0 ; tid < ntasks ; tid++)
+                        {
+                            OK (GxB_Iterator_new (&iterator)) ;
+                            if (by_col)
+                            {
+                                OK (GxB_colIterator_attach (iterator, A,
+                                    NULL)) ;
+                            }
+                            else
+                            {
+                                OK (GxB_rowIterator_attach (iterator, A,
+                                    NULL)) ;
+                            }
+                            for (GrB_Index k = Slice [tid] ;
+                                 k < Slice [tid+1] ; k++)
+                            {
+                                info = by_col ?
+                                    GxB_colIterator_kseek (iterator, k) :
+                                    GxB_rowIterator_kseek (iterator, k) ;
+                                nvecs++ ;
+                                if (info == GrB_NO_VALUE) continue ;
+                                CHECK (info == GrB_SUCCESS) ;
+                                GrB_Index i, j, nblock ;
+                                if (by_col)
+                                {
+                                    i = GxB_colIterator_getRowIndex (iterator) ;
+                                    j = GxB_colIterator_getColIndex (iterator) ;
+                                }
+                                else
+                                {
+                                    i = GxB_rowIterator_getRowIndex (iterator) ;
+                                    j = GxB_rowIterator_getColIndex (iterator) ;
+                                }
+                                const GrB_Index *Ilist ;
+                                const void *Xlist ;
+                                const int8_t *Blist ;
+                                bool block_iso ;
+                                OK (GxB_Iterator_getBlock (iterator, &Ilist,
+                                    &Xlist, &Blist, &nblock, &block_iso)) ;
+                                CHECK (nblock > 0) ;
+                                CHECK (block_iso == (bool) iso) ;
+                                CHECK ((Ilist == NULL) ==
+                                    (sparsity == GxB_BITMAP ||
+                                     sparsity == GxB_FULL)) ;
+                                CHECK ((Blist != NULL) ==
+                                    (sparsity == GxB_BITMAP)) ;
+                                // the block starts at the current entry
+                                const double *Ax = (const double *) Xlist ;
+                                CHECK (Ax [0] == GxB_Iterator_get_FP64
+                                    (iterator)) ;
+                                if (Ilist != NULL)
+                                {
+                                    CHECK (Ilist [0] == (by_col ? i : j)) ;
+                                }
+                                if (Blist != NULL)
+                                {
+                                    CHECK (Blist [0]) ;
+                                }
+                                for (GrB_Index t = 0 ; t < nblock ; t++)
+                                {
+                                    if (Blist != NULL && !Blist [t]) continue ;
+                                    GrB_Index index = (Ilist != NULL) ?
+                                        Ilist [t] : ((by_col ? i : j) + t) ;
+                                    I [n] = by_col ? index : i ;
+                                    J [n] = by_col ? j : index ;
+                                    X [n] = Ax [block_iso ? 0 : t] ;
+                                    n++ ;
+                                }
+                            }
+                            GrB_free (&iterator) ;
+                        }
+                        CHECK (nvecs == kount) ;
+
+                        //------------------------------------------------------
+                        // check the result
+                        //------------------------------------------------------
+
+                        GrB_Index nvals ;
+                        OK (GrB_Matrix_nvals (&nvals, A)) ;
+                        CHECK (n == nvals) ;
+                        OK (GrB_Matrix_new (&C, GrB_FP64, nrows, ncols)) ;
+                        OK (GxB_Matrix_Option_set_(C, GxB_FORMAT,
+                            by_col ? GxB_BY_COL : GxB_BY_ROW)) ;
+                        OK (GrB_Matrix_build_FP64 (C, I, J, X, n, NULL)) ;
+                        CHECK (GB_mx_isequal_entries (C, A, 0)) ;
+                        GrB_free (&C) ;
+                        OK (GxB_Matrix_Option_set_(A, GxB_SPARSITY_CONTROL,
+                            sparsity)) ;
+                        OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+                        ntrials++ ;
+                    }
+                }
+                GrB_free (&A) ;
+            }
+            GrB_free (&A0) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // balance: each range of a sparse matrix has about the same # of entries
+    //--------------------------------------------------------------------------
+
+    // row i of A has i entries, so the work is far from uniform per row
+    #define NB 400
+    OK (GrB_Matrix_new (&A, GrB_FP64, NB, NB)) ;
+    OK (GxB_Matrix_Option_set_(A, GxB_FORMAT, GxB_BY_ROW)) ;
+    int64_t n = 0 ;
+    for (int64_t i = 0 ; i < NB ; i++)
+    {
+        for (int64_t j = 0 ; j < i ; j++)
+        {
+            I [n] = i ;
+            J [n] = j ;
+            X [n] = 1 ;
+            n++ ;
+        }
+    }
+    OK (GrB_Matrix_build_FP64 (A, I, J, X, n, NULL)) ;
+    OK (GxB_Matrix_Option_set_(A, GxB_SPARSITY_CONTROL, GxB_SPARSE)) ;
+    OK (GxB_Iterator_new (&it)) ;
+    OK (GxB_rowIterator_attach (it, A, NULL)) ;
+    for (int ntasks = 1 ; ntasks <= 64 ; ntasks *= 4)
+    {
+        int nt = ntasks ;
+        OK (GxB_Iterator_partition (Slice, &nt, it)) ;
+        CHECK (nt == ntasks) ;
+        for (int tid = 0 ; tid < nt ; tid++)
+        {
+            // # of entries in rows Slice [tid] to Slice [tid+1]-1
+            int64_t k1 = Slice [tid], k2 = Slice [tid+1] ;
+            int64_t ntask = (k2*(k2-1))/2 - (k1*(k1-1))/2 ;
+            CHECK (ntask <= n / nt + NB) ;
+        }
+        ntrials++ ;
+    }
+    GrB_free (&it) ;
+    GrB_free (&A) ;
+
+    //--------------------------------------------------------------------------
+    // empty hypersparse matrix
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&A, GrB_FP64, 10, 10)) ;
+    OK (GxB_Matrix_Option_set_(A, GxB_SPARSITY_CONTROL, GxB_HYPERSPARSE)) ;
+    OK (GxB_Iterator_new (&it)) ;
+    OK (GxB_colIterator_attach (it, A, NULL)) ;
+    int ntasks = 4 ;
+    OK (GxB_Iterator_partition (Slice, &ntasks, it)) ;
+    CHECK (ntasks == 1) ;
+    CHECK (Slice [0] == 0 && Slice [1] == 0) ;
+    ntrials++ ;
+
+    //--------------------------------------------------------------------------
+    // error handling
+    //--------------------------------------------------------------------------
+
+    expected = GrB_NULL_POINTER ;
+    ERR (GxB_Iterator_partition (NULL, &ntasks, it)) ;
+    ERR (GxB_Iterator_partition (Slice, NULL, it)) ;
+    ERR (GxB_Iterator_partition (Slice, &ntasks, NULL)) ;
+    expected = GrB_INVALID_VALUE ;
+    ntasks = 0 ;
+    ERR (GxB_Iterator_partition (Slice, &ntasks, it)) ;
+    CHECK (ntasks == 0) ;
+    GrB_free (&it) ;
+    GrB_free (&A) ;
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    mxFree (Slice) ;
+    mxFree (I) ;
+    mxFree (J) ;
+    mxFree (X) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test42:  all tests passed (%d trials).\n\n", ntrials) ;
+}
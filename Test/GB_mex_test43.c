@@ -0,0 +1,298 @@
+//------------------------------------------------------------------------------
+// GB_mex_test43: test GxB_Matrix_selectTopK
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GxB_Matrix_selectTopK is compared with the first k entries of each row (or
+// column) of [C,P] = GxB_Matrix_sort (A), which are used as a mask M to
+// compute R<M>=A.  The values of A have many ties, which both methods break
+// by index.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test43"
+
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+//------------------------------------------------------------------------------
+// a user-defined type and comparators
+//------------------------------------------------------------------------------
+
+typedef struct { double x ; int32_t y ; } mytype ;
+
+void mylt (bool *z, const mytype *a, const mytype *b) ;
+void mylt (bool *z, const mytype *a, const mytype *b)
+{
+    (*z) = (a->x < b->x) ;
+}
+
+// compare by absolute value
+void abslt (bool *z, const double *a, const double *b) ;
+void abslt (bool *z, const double *a, const double *b)
+{
+    (*z) = (fabs (*a) < fabs (*b)) ;
+}
+
+//------------------------------------------------------------------------------
+// topk_ref: R = first k entries of each vector of A, using GxB_Matrix_sort
+//------------------------------------------------------------------------------
+
+static GrB_Info topk_ref (GrB_Matrix *R_handle, GrB_BinaryOp op, GrB_Matrix A,
+    uint64_t k, bool by_col)
+{
+    GrB_Info info ;
+    GrB_Matrix S = NULL, P = NULL, P2 = NULL, M = NULL, R = NULL ;
+    GrB_Index *I = NULL, *J = NULL, *X = NULL ;
+    bool *B = NULL ;
+    GrB_Index nrows, ncols, nvals ;
+    GrB_Type atype ;
+    GrB_Matrix_nrows (&nrows, A) ;
+    GrB_Matrix_ncols (&ncols, A) ;
+    GxB_Matrix_type (&atype, A) ;
+
+    // [S,P] = sort (A)
+    GrB_Matrix_new (&S, atype, nrows, ncols) ;
+    GrB_Matrix_new (&P, GrB_INT64, nrows, ncols) ;
+    info = GxB_Matrix_sort (S, P, op, A, by_col ? GrB_DESC_T0 : NULL) ;
+    if (info != GrB_SUCCESS) return (info) ;
+
+    // P2 = the first k entries of each vector of P
+    GrB_Matrix_new (&P2, GrB_INT64, nrows, ncols) ;
+    int64_t kmax = (int64_t) GB_IMIN (k, (uint64_t) INT64_MAX) ;
+    GrB_Matrix_select_INT64 (P2, NULL, NULL, by_col ? GrB_ROWLE : GrB_COLLE,
+        P, kmax - 1, NULL) ;
+
+    // M(i,j) = true for each selected entry A(i,j)
+    GrB_Matrix_nvals (&nvals, P2) ;
+    I = mxMalloc ((nvals + 1) * sizeof (GrB_Index)) ;
+    J = mxMalloc ((nvals + 1) * sizeof (GrB_Index)) ;
+    X = mxMalloc ((nvals + 1) * sizeof (GrB_Index)) ;
+    B = mxMalloc ((nvals + 1) * sizeof (bool)) ;
+    GrB_Matrix_extractTuples_INT64 (I, J, (int64_t *) X, &nvals, P2) ;
+    for (int64_t p = 0 ; p < nvals ; p++)
+    {
+        // replace the position in the sorted vector with the index in A
+        if (by_col)
+        {
+            I [p] = X [p] ;
+        }
+        else
+        {
+            J [p] = X [p] ;
+        }
+        B [p] = true ;
+    }
+    GrB_Matrix_new (&M, GrB_BOOL, nrows, ncols) ;
+    info = GrB_Matrix_build_BOOL (M, I, J, B, nvals, NULL) ;
+
+    // R<M,struct> = A
+    GrB_Matrix_new (&R, atype, nrows, ncols) ;
+    GrB_Matrix_assign (R, M, NULL, A, GrB_ALL, nrows, GrB_ALL, ncols,
+        GrB_DESC_S) ;
+
+    GrB_free (&S) ;
+    GrB_free (&P) ;
+    GrB_free (&P2) ;
+    GrB_free (&M) ;
+    mxFree (I) ;
+    mxFree (J) ;
+    mxFree (X) ;
+    mxFree (B) ;
+    (*R_handle) = R ;
+    return (info) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test43 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A0 = NULL, A = NULL, C = NULL, R = NULL ;
+    GrB_Type mytype_t = NULL ;
+    GrB_BinaryOp mylt_op = NULL, abslt_op = NULL ;
+    int save_nthreads ;
+    double save_chunk ;
+    OK (GxB_Global_Option_get_INT32 (GxB_NTHREADS, &save_nthreads)) ;
+    OK (GxB_Global_Option_get_FP64 (GxB_CHUNK, &save_chunk)) ;
+    OK (GxB_Global_Option_set_FP64 (GxB_CHUNK, 100)) ;
+    int ntrials = 0 ;
+
+    OK (GrB_Type_new (&mytype_t, sizeof (mytype))) ;
+    OK (GrB_BinaryOp_new (&mylt_op, (GxB_binary_function) mylt, GrB_BOOL,
+        mytype_t, mytype_t)) ;
+    OK (GrB_BinaryOp_new (&abslt_op, (GxB_binary_function) abslt, GrB_BOOL,
+        GrB_FP64, GrB_FP64)) ;
+
+    // each case is a type of A and a comparator.  INT32 with LT_FP64 and
+    // FP64 with GT_INT32 are typecast, and the latter creates more ties.
+    #define NCASES 8
+    GrB_Type atypes [NCASES] = { GrB_FP64, GrB_FP64, GrB_INT32, GrB_BOOL,
+        GrB_INT32, GrB_FP64, GrB_FP64, NULL } ;
+    GrB_BinaryOp ops [NCASES] = { GrB_LT_FP64, GrB_GT_FP64, GrB_LT_INT32,
+        GrB_GT_BOOL, GrB_LT_FP64, GrB_GT_INT32, abslt_op, mylt_op } ;
+    atypes [NCASES-1] = mytype_t ;
+
+    // a wide matrix, and a tall one
+    GrB_Index dims [2][2] = { { 20, 300 }, { 300, 20 } } ;
+    int sparsities [4] = { GxB_SPARSE, GxB_HYPERSPARSE, GxB_BITMAP, GxB_FULL } ;
+    uint64_t klist [6] = { 0, 1, 3, 20, 300, UINT64_MAX } ;
+
+    for (int c = 0 ; c < NCASES ; c++)
+    {
+        GrB_Type atype = atypes [c] ;
+        GrB_BinaryOp op = ops [c] ;
+        for (int d = 0 ; d < 2 ; d++)
+        {
+            GrB_Index nrows = dims [d][0] ;
+            GrB_Index ncols = dims [d][1] ;
+            for (int iso = 0 ; iso <= 1 ; iso++)
+            {
+
+                //--------------------------------------------------------------
+                // create A0, with many ties
+                //--------------------------------------------------------------
+
+                OK (GrB_Matrix_new (&A0, atype, nrows, ncols)) ;
+                simple_rand_seed (c + 10*d + 100*iso) ;
+                int64_t nz = (nrows * ncols) / 5 ;
+                for (int64_t p = 0 ; p < nz ; p++)
+                {
+                    GrB_Index i = simple_rand_i ( ) % (nrows - 1) ;
+                    GrB_Index j = simple_rand_i ( ) % (ncols - 1) ;
+                    double x = iso ? 1 :
+                        ((double) (simple_rand_i ( ) % 9) - 4) / 2 ;
+                    if (atype == mytype_t)
+                    {
+                        mytype y = { x, (int32_t) p } ;
+                        if (iso) y.y = 0 ;
+                        OK (GrB_Matrix_setElement_UDT (A0, &y, i, j)) ;
+                    }
+                    else
+                    {
+                        OK (GrB_Matrix_setElement_FP64 (A0, x, i, j)) ;
+                    }
+                }
+                OK (GrB_Matrix_wait (A0, GrB_MATERIALIZE)) ;
+
+                for (int s = 0 ; s < 4 ; s++)
+                {
+                    int sparsity = sparsities [s] ;
+                    OK (GrB_Matrix_dup (&A, A0)) ;
+                    if (sparsity == GxB_FULL && atype != mytype_t)
+                    {
+                        // fill A so it can be held as full
+                        OK (GrB_Matrix_assign_FP64 (A, A, NULL, iso ? 1 : 0,
+                            GrB_ALL, nrows, GrB_ALL, ncols, GrB_DESC_SC)) ;
+                    }
+                    for (int fmt = 0 ; fmt <= 1 ; fmt++)
+                    {
+                        OK (GxB_Matrix_Option_set_(A, GxB_FORMAT,
+                            fmt ? GxB_BY_COL : GxB_BY_ROW)) ;
+                        OK (GxB_Matrix_Option_set_(A, GxB_SPARSITY_CONTROL,
+                            sparsity)) ;
+                        OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+                        for (int by_col = 0 ; by_col <= 1 ; by_col++)
+                        {
+                            GrB_Descriptor desc = by_col ? GrB_DESC_T0 : NULL ;
+                            for (int kk = 0 ; kk < 6 ; kk++)
+                            {
+                                uint64_t k = klist [kk] ;
+                                OK (topk_ref (&R, op, A, k, by_col)) ;
+                                for (int nth = 1 ; nth <= 4 ; nth += 3)
+                                {
+                                    OK (GxB_Global_Option_set_INT32
+                                        (GxB_NTHREADS, nth)) ;
+                                    OK (GrB_Matrix_new (&C, atype, nrows,
+                                        ncols)) ;
+                                    OK (GxB_Matrix_selectTopK (C, op, A, k,
+                                        desc)) ;
+                                    CHECK (GB_mx_isequal_entries (C, R, 0)) ;
+                                    GrB_free (&C) ;
+                                    ntrials++ ;
+                                }
+                                GrB_free (&R) ;
+                            }
+                        }
+                        OK (GxB_Matrix_Option_set_(A, GxB_SPARSITY_CONTROL,
+                            sparsity)) ;
+                    }
+
+                    //----------------------------------------------------------
+                    // C aliased with A
+                    //----------------------------------------------------------
+
+                    OK (topk_ref (&R, op, A, 3, false)) ;
+                    OK (GxB_Matrix_selectTopK (A, op, A, 3, NULL)) ;
+                    CHECK (GB_mx_isequal_entries (A, R, 0)) ;
+                    GrB_free (&R) ;
+                    GrB_free (&A) ;
+                    ntrials++ ;
+                }
+                GrB_free (&A0) ;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // error handling
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&A, GrB_FP64, 10, 10)) ;
+    OK (GrB_Matrix_new (&C, GrB_FP64, 10, 10)) ;
+    OK (GrB_Matrix_new (&R, GrB_FP64, 10, 5)) ;
+
+    expected = GrB_NULL_POINTER ;
+    ERR (GxB_Matrix_selectTopK (NULL, GrB_LT_FP64, A, 1, NULL)) ;
+    ERR1 (C, GxB_Matrix_selectTopK (C, NULL, A, 1, NULL)) ;
+    ERR1 (C, GxB_Matrix_selectTopK (C, GrB_LT_FP64, NULL, 1, NULL)) ;
+
+    expected = GrB_DIMENSION_MISMATCH ;
+    ERR1 (R, GxB_Matrix_selectTopK (R, GrB_LT_FP64, A, 1, NULL)) ;
+
+    // the op must return bool
+    expected = GrB_DOMAIN_MISMATCH ;
+    ERR1 (C, GxB_Matrix_selectTopK (C, GrB_PLUS_FP64, A, 1, NULL)) ;
+    // A cannot be typecast to the user-defined type
+    ERR1 (C, GxB_Matrix_selectTopK (C, mylt_op, A, 1, NULL)) ;
+    GrB_free (&R) ;
+    // C and A must have the same type
+    OK (GrB_Matrix_new (&R, GrB_INT32, 10, 10)) ;
+    ERR1 (R, GxB_Matrix_selectTopK (R, GrB_LT_FP64, A, 1, NULL)) ;
+
+    GrB_free (&A) ;
+    GrB_free (&C) ;
+    GrB_free (&R) ;
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_free (&mylt_op) ;
+    GrB_free (&abslt_op) ;
+    GrB_free (&mytype_t) ;
+    OK (GxB_Global_Option_set_INT32 (GxB_NTHREADS, save_nthreads)) ;
+    OK (GxB_Global_Option_set_FP64 (GxB_CHUNK, save_chunk)) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test43:  all tests passed (%d trials).\n\n", ntrials) ;
+}
@@ -0,0 +1,304 @@
+//------------------------------------------------------------------------------
+// GB_mex_test44: test GxB_Matrix_reduce_SelectApply
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GxB_Matrix_reduce_SelectApply is compared with GrB_select, GrB_apply, and
+// GrB_reduce, computed one at a time.  The rows of a matrix held by row (or
+// the columns of a matrix held by column) are reduced by the fused JIT
+// kernel, including positional select operators, whose row and column
+// indices are flipped for a matrix held by row.  The other cases, and all
+// cases with the JIT disabled, use the three steps.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test44"
+
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+//------------------------------------------------------------------------------
+// GB_mex_test44 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A0 = NULL, A = NULL, S = NULL, F = NULL ;
+    GrB_Vector w0 = NULL, w1 = NULL, w2 = NULL, mask = NULL ;
+    GrB_Scalar Thunk = NULL ;
+    GrB_Type mytype = NULL ;
+    int save_control ;
+    OK (GxB_Global_Option_get_INT32 (GxB_JIT_C_CONTROL, &save_control)) ;
+    int ntrials = 0 ;
+
+    // each case is a type of A, a select op and its thunk, a unary op, and
+    // a monoid.  Most cases typecast: A to the input of the select op or the
+    // unary op, the int64 Thunk to the select op, or the result of the unary
+    // op to the monoid.  ROWINDEX and TRIL are positional.
+    #define NCASES 10
+    GrB_Type atypes [NCASES] = { GrB_FP64, GrB_FP64, GrB_FP64, GrB_INT32,
+        GrB_INT32, GrB_INT32, GrB_FP64, GrB_FP64, GrB_INT32, GrB_BOOL } ;
+    GrB_IndexUnaryOp selops [NCASES] = { GrB_TRIL, GrB_ROWINDEX_INT64,
+        GrB_VALUEGT_FP64, GrB_VALUEGT_FP64, GrB_COLLE, GrB_TRIU, NULL,
+        GrB_VALUENE_FP64, GrB_COLINDEX_INT64, GrB_VALUEEQ_BOOL } ;
+    int64_t thunks [NCASES] = { 0, -3, 0, -1, 5, 2, 0, 0, -7, 1 } ;
+    GrB_UnaryOp ops [NCASES] = { NULL, GrB_AINV_FP64, GrB_ABS_FP64,
+        GrB_AINV_FP64, GrB_IDENTITY_BOOL, NULL, GrB_ABS_INT32, GrB_LNOT,
+        GxB_ONE_INT32, GrB_IDENTITY_BOOL } ;
+    GrB_Monoid monoids [NCASES] = { GrB_PLUS_MONOID_FP64,
+        GrB_PLUS_MONOID_INT64, GrB_MAX_MONOID_FP64, GrB_MIN_MONOID_INT32,
+        GrB_LOR_MONOID_BOOL, GrB_PLUS_MONOID_INT32, GrB_TIMES_MONOID_INT64,
+        GrB_PLUS_MONOID_FP64, GrB_PLUS_MONOID_INT64, GrB_LXOR_MONOID_BOOL } ;
+
+    // a wide matrix, and a tall one
+    GrB_Index dims [2][2] = { { 30, 200 }, { 200, 30 } } ;
+    int sparsities [4] = { GxB_SPARSE, GxB_HYPERSPARSE, GxB_BITMAP, GxB_FULL } ;
+
+    for (int c = 0 ; c < NCASES ; c++)
+    {
+        GrB_Type atype = atypes [c] ;
+        GrB_IndexUnaryOp selop = selops [c] ;
+        GrB_UnaryOp op = ops [c] ;
+        GrB_Monoid monoid = monoids [c] ;
+        GrB_Type ztype = monoid->op->ztype ;
+        OK (GrB_Scalar_new (&Thunk, GrB_INT64)) ;
+        OK (GrB_Scalar_setElement_INT64 (Thunk, thunks [c])) ;
+
+        for (int d = 0 ; d < 2 ; d++)
+        {
+            GrB_Index nrows = dims [d][0] ;
+            GrB_Index ncols = dims [d][1] ;
+            for (int iso = 0 ; iso <= 1 ; iso++)
+            {
+
+                //--------------------------------------------------------------
+                // create A0, with some empty rows and columns
+                //--------------------------------------------------------------
+
+                OK (GrB_Matrix_new (&A0, atype, nrows, ncols)) ;
+                simple_rand_seed (c + 10*d + 100*iso) ;
+                int64_t nz = (nrows * ncols) / 5 ;
+                for (int64_t p = 0 ; p < nz ; p++)
+                {
+                    GrB_Index i = simple_rand_i ( ) % (nrows - 1) ;
+                    GrB_Index j = simple_rand_i ( ) % (ncols - 1) ;
+                    // small integers, so the sums are exact in any order
+                    double x = iso ? 2 :
+                        ((double) (simple_rand_i ( ) % 7) - 3) ;
+                    OK (GrB_Matrix_setElement_FP64 (A0, x, i, j)) ;
+                }
+                OK (GrB_Matrix_wait (A0, GrB_MATERIALIZE)) ;
+
+                for (int s = 0 ; s < 4 ; s++)
+                {
+                    int sparsity = sparsities [s] ;
+                    OK (GrB_Matrix_dup (&A, A0)) ;
+                    if (sparsity == GxB_FULL)
+                    {
+                        // fill A so it can be held as full
+                        OK (GrB_Matrix_assign_FP64 (A, A, NULL, iso ? 2 : 1,
+                            GrB_ALL, nrows, GrB_ALL, ncols, GrB_DESC_SC)) ;
+                    }
+                    for (int fmt = 0 ; fmt <= 1 ; fmt++)
+                    {
+                        OK (GxB_Matrix_Option_set_(A, GxB_FORMAT,
+                            fmt ? GxB_BY_COL : GxB_BY_ROW)) ;
+                        OK (GxB_Matrix_Option_set_(A, GxB_SPARSITY_CONTROL,
+                            sparsity)) ;
+                        OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+
+                        // the rows of A are reduced (fused if A is held by
+                        // row), or the columns with GrB_INP0 = GrB_TRAN (fused
+                        // if A is held by column)
+                        for (int tr = 0 ; tr <= 1 ; tr++)
+                        {
+                            GrB_Index n = tr ? ncols : nrows ;
+                            GrB_Descriptor desc = tr ? GrB_DESC_T0 : NULL ;
+
+                            // w0: initial content of w, for the accum
+                            OK (GrB_Vector_new (&w0, ztype, n)) ;
+                            for (GrB_Index i = 0 ; i < n ; i += 3)
+                            {
+                                OK (GrB_Vector_setElement_INT32 (w0, 1, i)) ;
+                            }
+
+                            //--------------------------------------------------
+                            // w2 = reduce (op (select (A))), in three steps
+                            //--------------------------------------------------
+
+                            GrB_Matrix B = A ;
+                            if (selop != NULL)
+                            {
+                                OK (GrB_Matrix_new (&S, atype, nrows, ncols)) ;
+                                OK (GrB_Matrix_select_Scalar (S, NULL, NULL,
+                                    selop, A, Thunk, NULL)) ;
+                                B = S ;
+                            }
+                            if (op != NULL)
+                            {
+                                GrB_Type ftype ;
+                                OK (GxB_UnaryOp_ztype (&ftype, op)) ;
+                                OK (GrB_Matrix_new (&F, ftype, nrows, ncols)) ;
+                                OK (GrB_Matrix_apply (F, NULL, NULL, op, B,
+                                    NULL)) ;
+                                B = F ;
+                            }
+                            OK (GrB_Vector_dup (&w2, w0)) ;
+                            OK (GrB_Matrix_reduce_Monoid (w2, NULL,
+                                monoid->op, monoid, B, desc)) ;
+                            GrB_free (&S) ;
+                            GrB_free (&F) ;
+
+                            //--------------------------------------------------
+                            // w1 = the same, with the JIT on and off
+                            //--------------------------------------------------
+
+                            for (int jit = 0 ; jit <= 1 ; jit++)
+                            {
+                                OK (GxB_Global_Option_set_INT32
+                                    (GxB_JIT_C_CONTROL,
+                                    jit ? save_control : GxB_JIT_OFF)) ;
+                                OK (GrB_Vector_dup (&w1, w0)) ;
+                                OK (GxB_Matrix_reduce_SelectApply (w1, NULL,
+                                    monoid->op, monoid, op, selop, Thunk, A,
+                                    desc)) ;
+                                OK (GxB_Global_Option_set_INT32
+                                    (GxB_JIT_C_CONTROL, save_control)) ;
+                                CHECK (GB_mx_isequal_entries ((GrB_Matrix) w1,
+                                    (GrB_Matrix) w2, 0)) ;
+                                GrB_free (&w1) ;
+                                ntrials++ ;
+                            }
+                            GrB_free (&w0) ;
+                            GrB_free (&w2) ;
+                        }
+                        OK (GxB_Matrix_Option_set_(A, GxB_SPARSITY_CONTROL,
+                            sparsity)) ;
+                    }
+                    GrB_free (&A) ;
+                }
+                GrB_free (&A0) ;
+            }
+        }
+        GrB_free (&Thunk) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // with a mask and GrB_REPLACE
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&A, GrB_FP64, 50, 40)) ;
+    OK (GxB_Matrix_Option_set_(A, GxB_FORMAT, GxB_BY_ROW)) ;
+    for (int64_t k = 0 ; k < 500 ; k++)
+    {
+        OK (GrB_Matrix_setElement_FP64 (A, (double) (k % 5),
+            (k * 7) % 50, (k * 13) % 40)) ;
+    }
+    OK (GrB_Scalar_new (&Thunk, GrB_INT64)) ;
+    OK (GrB_Scalar_setElement_INT64 (Thunk, 1)) ;
+    OK (GrB_Vector_new (&mask, GrB_BOOL, 50)) ;
+    OK (GrB_Vector_new (&w0, GrB_FP64, 50)) ;
+    for (int64_t i = 0 ; i < 50 ; i += 2)
+    {
+        OK (GrB_Vector_setElement_BOOL (mask, true, i)) ;
+        OK (GrB_Vector_setElement_FP64 (w0, 100, i / 2)) ;
+    }
+    OK (GrB_Matrix_new (&S, GrB_FP64, 50, 40)) ;
+    OK (GrB_Matrix_select_Scalar (S, NULL, NULL, GrB_VALUEGT_FP64, A, Thunk,
+        NULL)) ;
+    OK (GrB_Matrix_apply (S, NULL, NULL, GrB_AINV_FP64, S, NULL)) ;
+    for (int jit = 0 ; jit <= 1 ; jit++)
+    {
+        OK (GrB_Vector_dup (&w2, w0)) ;
+        OK (GrB_Matrix_reduce_Monoid (w2, mask, GrB_PLUS_FP64,
+            GrB_PLUS_MONOID_FP64, S, GrB_DESC_RC)) ;
+        OK (GxB_Global_Option_set_INT32 (GxB_JIT_C_CONTROL,
+            jit ? save_control : GxB_JIT_OFF)) ;
+        OK (GrB_Vector_dup (&w1, w0)) ;
+        OK (GxB_Matrix_reduce_SelectApply (w1, mask, GrB_PLUS_FP64,
+            GrB_PLUS_MONOID_FP64, GrB_AINV_FP64, GrB_VALUEGT_FP64, Thunk, A,
+            GrB_DESC_RC)) ;
+        OK (GxB_Global_Option_set_INT32 (GxB_JIT_C_CONTROL, save_control)) ;
+        CHECK (GB_mx_isequal_entries ((GrB_Matrix) w1, (GrB_Matrix) w2, 0)) ;
+        GrB_free (&w1) ;
+        GrB_free (&w2) ;
+        ntrials++ ;
+    }
+    GrB_free (&S) ;
+    GrB_free (&w0) ;
+
+    //--------------------------------------------------------------------------
+    // error handling
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Vector_new (&w1, GrB_FP64, 50)) ;
+
+    // the Thunk is NULL, or has no entry
+    expected = GrB_NULL_POINTER ;
+    ERR1 (w1, GxB_Matrix_reduce_SelectApply (w1, NULL, NULL,
+        GrB_PLUS_MONOID_FP64, NULL, GrB_TRIL, NULL, A, NULL)) ;
+    expected = GrB_EMPTY_OBJECT ;
+    OK (GrB_Scalar_clear (Thunk)) ;
+    ERR1 (w1, GxB_Matrix_reduce_SelectApply (w1, NULL, NULL,
+        GrB_PLUS_MONOID_FP64, NULL, GrB_TRIL, Thunk, A, NULL)) ;
+    OK (GrB_Scalar_setElement_INT64 (Thunk, 0)) ;
+
+    // A cannot be typecast to a user-defined type, nor to the monoid
+    expected = GrB_DOMAIN_MISMATCH ;
+    OK (GrB_Type_new (&mytype, sizeof (double))) ;
+    OK (GrB_Matrix_new (&A0, mytype, 50, 40)) ;
+    ERR1 (w1, GxB_Matrix_reduce_SelectApply (w1, NULL, NULL,
+        GrB_PLUS_MONOID_FP64, NULL, GrB_VALUEGT_FP64, Thunk, A0, NULL)) ;
+    ERR1 (w1, GxB_Matrix_reduce_SelectApply (w1, NULL, NULL,
+        GrB_PLUS_MONOID_FP64, NULL, GrB_TRIL, Thunk, A0, NULL)) ;
+    ERR1 (w1, GxB_Matrix_reduce_SelectApply (w1, NULL, NULL,
+        GrB_PLUS_MONOID_FP64, GrB_AINV_FP64, NULL, NULL, A0, NULL)) ;
+    GrB_free (&A0) ;
+
+    // the Thunk cannot be typecast to the select op
+    GrB_Scalar Thunk2 = NULL ;
+    OK (GrB_Scalar_new (&Thunk2, mytype)) ;
+    double one = 1 ;
+    OK (GrB_Scalar_setElement_UDT (Thunk2, &one)) ;
+    ERR1 (w1, GxB_Matrix_reduce_SelectApply (w1, NULL, NULL,
+        GrB_PLUS_MONOID_FP64, NULL, GrB_TRIL, Thunk2, A, NULL)) ;
+    GrB_free (&Thunk2) ;
+
+    // w has the wrong size
+    expected = GrB_DIMENSION_MISMATCH ;
+    ERR1 (w1, GxB_Matrix_reduce_SelectApply (w1, NULL, NULL,
+        GrB_PLUS_MONOID_FP64, NULL, GrB_TRIL, Thunk, A, GrB_DESC_T0)) ;
+
+    GrB_free (&w1) ;
+    GrB_free (&mask) ;
+    GrB_free (&Thunk) ;
+    GrB_free (&A) ;
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_free (&mytype) ;
+    OK (GxB_Global_Option_set_INT32 (GxB_JIT_C_CONTROL, save_control)) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test44:  all tests passed (%d trials).\n\n", ntrials) ;
+}
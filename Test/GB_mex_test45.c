@@ -0,0 +1,445 @@
+//------------------------------------------------------------------------------
+// GB_mex_test45: test GxB_Matrix_axpby and GxB_Vector_axpby
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GxB_axpby is compared with GrB_apply (bind1st) of the multiplicative
+// operator to A and B, followed by GrB_eWiseAdd with the additive monoid.
+// If A and B have the same pattern and the same effective orientation, the
+// fused JIT kernel is used: with B aliased to A, with B a different matrix
+// with the same pattern, with A and/or B transposed and held in the opposite
+// format, and with A and B full or with all their entries present, in any
+// format.  The other cases, and all cases with the JIT disabled, use the
+// apply and eWiseAdd steps.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test45"
+
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+// add a pair of inputs, and the descriptor for GxB_axpby, to the list
+#define PAIR(x,y,d)                 \
+{                                   \
+    X [npairs] = x ;                \
+    Y [npairs] = y ;                \
+    descs [npairs++] = d ;          \
+}
+
+//------------------------------------------------------------------------------
+// conform: set the format and sparsity of A, and finish any pending work
+//------------------------------------------------------------------------------
+
+static GrB_Info conform (GrB_Matrix A, int fmt, int sparsity)
+{
+    GrB_Info info ;
+    OK (GxB_Matrix_Option_set_(A, GxB_FORMAT, fmt)) ;
+    OK (GxB_Matrix_Option_set_(A, GxB_SPARSITY_CONTROL, sparsity)) ;
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// transposed: T = A', held in the opposite format as A
+//------------------------------------------------------------------------------
+
+static GrB_Info transposed (GrB_Matrix *T, GrB_Matrix A, int fmt,
+    int sparsity)
+{
+    GrB_Info info ;
+    GrB_Type type ;
+    GrB_Index nrows, ncols ;
+    OK (GxB_Matrix_type (&type, A)) ;
+    OK (GrB_Matrix_nrows (&nrows, A)) ;
+    OK (GrB_Matrix_ncols (&ncols, A)) ;
+    OK (GrB_Matrix_new (T, type, ncols, nrows)) ;
+    OK (GrB_transpose (*T, NULL, NULL, A, NULL)) ;
+    OK (conform (*T, (fmt == GxB_BY_ROW) ? GxB_BY_COL : GxB_BY_ROW,
+        sparsity)) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test45 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A0 = NULL, D0 = NULL, A = NULL, B = NULL, D = NULL, At = NULL,
+        Bt = NULL, B2 = NULL, C0 = NULL, C1 = NULL, C2 = NULL, AS = NULL,
+        BS = NULL ;
+    GrB_Vector u = NULL, v = NULL, w0 = NULL, w1 = NULL, w2 = NULL,
+        us = NULL, vs = NULL, mask = NULL ;
+    GrB_Scalar alpha = NULL, beta = NULL ;
+    GrB_Type mytype = NULL ;
+    int save_control ;
+    OK (GxB_Global_Option_get_INT32 (GxB_JIT_C_CONTROL, &save_control)) ;
+    int ntrials = 0 ;
+
+    // each case is a semiring, the types of A and B, and alpha and beta with
+    // their types.  Most cases typecast A, B, alpha, or beta to the inputs of
+    // the multiplicative operator.  MINUS is not commutative, so alpha-A(i,j)
+    // is checked as well.
+    #define NCASES 5
+    GrB_Semiring semirings [NCASES] = { GrB_PLUS_TIMES_SEMIRING_FP64,
+        GrB_MIN_PLUS_SEMIRING_INT32, GrB_LOR_LAND_SEMIRING_BOOL,
+        GrB_PLUS_TIMES_SEMIRING_INT64, GxB_MAX_MINUS_FP32 } ;
+    GrB_Type atypes [NCASES] = { GrB_FP64, GrB_INT32, GrB_BOOL, GrB_INT32,
+        GrB_FP32 } ;
+    GrB_Type btypes [NCASES] = { GrB_FP64, GrB_FP64, GrB_INT32, GrB_INT32,
+        GrB_FP64 } ;
+    GrB_Type alpha_types [NCASES] = { GrB_FP64, GrB_INT64, GrB_BOOL, GrB_FP64,
+        GrB_FP32 } ;
+    GrB_Type beta_types [NCASES] = { GrB_FP64, GrB_INT32, GrB_BOOL, GrB_INT8,
+        GrB_FP64 } ;
+    double alphas [NCASES] = { 2, 5, 1, 2, 1.5 } ;
+    double betas  [NCASES] = { -3, 1, 1, -1, -2 } ;
+
+    GrB_Index nrows = 40, ncols = 30 ;
+    int sparsities [4] = { GxB_SPARSE, GxB_HYPERSPARSE, GxB_BITMAP, GxB_FULL } ;
+
+    for (int c = 0 ; c < NCASES ; c++)
+    {
+        GrB_Semiring semiring = semirings [c] ;
+        GrB_BinaryOp mult = semiring->multiply ;
+        GrB_Monoid monoid = semiring->add ;
+        GrB_Type ztype = monoid->op->ztype ;
+        GrB_Type atype = atypes [c] ;
+        GrB_Type btype = btypes [c] ;
+        // with an accum for odd cases
+        GrB_BinaryOp accum = (c % 2 == 1) ? monoid->op : NULL ;
+        OK (GrB_Scalar_new (&alpha, alpha_types [c])) ;
+        OK (GrB_Scalar_setElement_FP64 (alpha, alphas [c])) ;
+        OK (GrB_Scalar_new (&beta, beta_types [c])) ;
+        OK (GrB_Scalar_setElement_FP64 (beta, betas [c])) ;
+
+        // C0: initial content of C
+        OK (GrB_Matrix_new (&C0, ztype, nrows, ncols)) ;
+        for (GrB_Index k = 0 ; k < nrows ; k++)
+        {
+            OK (GrB_Matrix_setElement_FP64 (C0, 1, k, (k * 7) % ncols)) ;
+        }
+        OK (GrB_Matrix_wait (C0, GrB_MATERIALIZE)) ;
+
+        for (int iso = 0 ; iso <= 1 ; iso++)
+        {
+
+            //------------------------------------------------------------------
+            // create A0, and D0 with another pattern
+            //------------------------------------------------------------------
+
+            OK (GrB_Matrix_new (&A0, atype, nrows, ncols)) ;
+            OK (GrB_Matrix_new (&D0, btype, nrows, ncols)) ;
+            simple_rand_seed (c + 10*iso) ;
+            int64_t nz = (nrows * ncols) / 4 ;
+            for (int64_t p = 0 ; p < nz ; p++)
+            {
+                GrB_Index i = simple_rand_i ( ) % nrows ;
+                GrB_Index j = simple_rand_i ( ) % ncols ;
+                // small integers, so the results are exact
+                double x = iso ? 3 : ((double) (simple_rand_i ( ) % 7) - 3) ;
+                OK (GrB_Matrix_setElement_FP64 (A0, x, i, j)) ;
+                OK (GrB_Matrix_setElement_FP64 (D0, x + 1, j, i % ncols)) ;
+            }
+            OK (GrB_Matrix_wait (A0, GrB_MATERIALIZE)) ;
+            OK (GrB_Matrix_wait (D0, GrB_MATERIALIZE)) ;
+
+            for (int s = 0 ; s < 4 ; s++)
+            {
+                int sparsity = sparsities [s] ;
+                OK (GrB_Matrix_dup (&A, A0)) ;
+                OK (GrB_Matrix_dup (&D, D0)) ;
+                if (sparsity == GxB_FULL)
+                {
+                    // fill A and D so they can be held as full
+                    OK (GrB_Matrix_assign_FP64 (A, A, NULL, iso ? 3 : 1,
+                        GrB_ALL, nrows, GrB_ALL, ncols, GrB_DESC_SC)) ;
+                    OK (GrB_Matrix_assign_FP64 (D, D, NULL, 2,
+                        GrB_ALL, nrows, GrB_ALL, ncols, GrB_DESC_SC)) ;
+                }
+
+                for (int f = 0 ; f <= 1 ; f++)
+                {
+                    int fmt = f ? GxB_BY_COL : GxB_BY_ROW ;
+                    int fmt2 = f ? GxB_BY_ROW : GxB_BY_COL ;
+                    OK (conform (A, fmt, sparsity)) ;
+                    OK (conform (D, fmt, sparsity)) ;
+
+                    // B: the same pattern as A, with other values
+                    OK (GrB_Matrix_new (&B, btype, nrows, ncols)) ;
+                    OK (GrB_Matrix_apply_BinaryOp2nd_FP64 (B, NULL, NULL,
+                        GrB_MINUS_FP64, A, 1, NULL)) ;
+                    OK (conform (B, fmt, sparsity)) ;
+
+                    // At and Bt: A' and B' held in the opposite format
+                    OK (transposed (&At, A, fmt, sparsity)) ;
+                    OK (transposed (&Bt, B, fmt, sparsity)) ;
+
+                    // B2: B held in the opposite format
+                    OK (GrB_Matrix_dup (&B2, B)) ;
+                    OK (conform (B2, fmt2, sparsity)) ;
+
+                    //----------------------------------------------------------
+                    // list the pairs of inputs to try
+                    //----------------------------------------------------------
+
+                    #define NPAIRS 10
+                    GrB_Matrix X [NPAIRS], Y [NPAIRS] ;
+                    GrB_Descriptor descs [NPAIRS] ;
+                    int npairs = 0 ;
+
+                    // fused: B aliased to A, or with the same pattern
+                    PAIR (A, A, NULL) ;
+                    PAIR (A, B, NULL) ;
+                    // fused: A' and/or B' have the same layout as B and A
+                    PAIR (A, Bt, GrB_DESC_T1) ;
+                    PAIR (At, B, GrB_DESC_T0) ;
+                    PAIR (At, Bt, GrB_DESC_T0T1) ;
+                    // not fused: another pattern (unless both full), or B
+                    // held in the other format
+                    PAIR (A, D, NULL) ;
+                    PAIR (D, A, NULL) ;
+                    PAIR (A, B2, NULL) ;
+
+                    // fused: A is full, and B has all its entries present,
+                    // but is held as sparse, hypersparse, or bitmap
+                    GrB_Matrix Bs [3] = { NULL, NULL, NULL } ;
+                    if (sparsity == GxB_FULL)
+                    {
+                        for (int k = 0 ; k < 3 ; k++)
+                        {
+                            OK (GrB_Matrix_dup (&Bs [k], B)) ;
+                            OK (conform (Bs [k], fmt, sparsities [k])) ;
+                        }
+                        PAIR (A, Bs [0], NULL) ;
+                        PAIR (Bs [2], A, NULL) ;
+                    }
+
+                    for (int k = 0 ; k < npairs ; k++)
+                    {
+                        GrB_Descriptor desc = descs [k] ;
+
+                        //------------------------------------------------------
+                        // C2 = accum (C0, alpha*X + beta*Y), in three steps
+                        //------------------------------------------------------
+
+                        GrB_Index xnrows, xncols, ynrows, yncols ;
+                        OK (GrB_Matrix_nrows (&xnrows, X [k])) ;
+                        OK (GrB_Matrix_ncols (&xncols, X [k])) ;
+                        OK (GrB_Matrix_nrows (&ynrows, Y [k])) ;
+                        OK (GrB_Matrix_ncols (&yncols, Y [k])) ;
+                        OK (GrB_Matrix_new (&AS, mult->ztype, xnrows, xncols)) ;
+                        OK (GrB_Matrix_new (&BS, mult->ztype, ynrows, yncols)) ;
+                        OK (GrB_Matrix_apply_BinaryOp1st_Scalar (AS, NULL,
+                            NULL, mult, alpha, X [k], NULL)) ;
+                        OK (GrB_Matrix_apply_BinaryOp1st_Scalar (BS, NULL,
+                            NULL, mult, beta, Y [k], NULL)) ;
+                        OK (GrB_Matrix_dup (&C2, C0)) ;
+                        OK (GrB_Matrix_eWiseAdd_Monoid (C2, NULL, accum,
+                            monoid, AS, BS, desc)) ;
+                        GrB_free (&AS) ;
+                        GrB_free (&BS) ;
+
+                        //------------------------------------------------------
+                        // C1 = the same, with the JIT on and off
+                        //------------------------------------------------------
+
+                        for (int jit = 0 ; jit <= 1 ; jit++)
+                        {
+                            OK (GxB_Global_Option_set_INT32 (GxB_JIT_C_CONTROL,
+                                jit ? save_control : GxB_JIT_OFF)) ;
+                            OK (GrB_Matrix_dup (&C1, C0)) ;
+                            OK (GxB_Matrix_axpby (C1, NULL, accum, semiring,
+                                alpha, X [k], beta, Y [k], desc)) ;
+                            OK (GxB_Global_Option_set_INT32 (GxB_JIT_C_CONTROL,
+                                save_control)) ;
+                            CHECK (GB_mx_isequal_entries (C1, C2, 0)) ;
+                            GrB_free (&C1) ;
+                            ntrials++ ;
+                        }
+                        GrB_free (&C2) ;
+                    }
+
+                    for (int k = 0 ; k < 3 ; k++)
+                    {
+                        GrB_free (&Bs [k]) ;
+                    }
+                    GrB_free (&B) ;
+                    GrB_free (&At) ;
+                    GrB_free (&Bt) ;
+                    GrB_free (&B2) ;
+                }
+                GrB_free (&A) ;
+                GrB_free (&D) ;
+            }
+            GrB_free (&A0) ;
+            GrB_free (&D0) ;
+        }
+        GrB_free (&C0) ;
+        GrB_free (&alpha) ;
+        GrB_free (&beta) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // GxB_Vector_axpby, with a mask and GrB_REPLACE
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Scalar_new (&alpha, GrB_FP64)) ;
+    OK (GrB_Scalar_setElement_FP64 (alpha, 2)) ;
+    OK (GrB_Scalar_new (&beta, GrB_FP64)) ;
+    OK (GrB_Scalar_setElement_FP64 (beta, -1)) ;
+    OK (GrB_Vector_new (&u, GrB_FP64, 100)) ;
+    OK (GrB_Vector_new (&mask, GrB_BOOL, 100)) ;
+    OK (GrB_Vector_new (&w0, GrB_FP64, 100)) ;
+    for (int64_t i = 0 ; i < 100 ; i += 2)
+    {
+        OK (GrB_Vector_setElement_FP64 (u, (double) (i % 5), i)) ;
+        OK (GrB_Vector_setElement_BOOL (mask, true, (i * 3) % 100)) ;
+        OK (GrB_Vector_setElement_FP64 (w0, 100, (i * 7) % 100)) ;
+    }
+    for (int pattern = 0 ; pattern <= 1 ; pattern++)
+    {
+        // v: the same pattern as u, or another one
+        OK (GrB_Vector_new (&v, GrB_FP64, 100)) ;
+        if (pattern == 0)
+        {
+            OK (GrB_Vector_apply_BinaryOp2nd_FP64 (v, NULL, NULL,
+                GrB_TIMES_FP64, u, 3, NULL)) ;
+        }
+        else
+        {
+            for (int64_t i = 0 ; i < 100 ; i += 3)
+            {
+                OK (GrB_Vector_setElement_FP64 (v, (double) (i % 4), i)) ;
+            }
+        }
+        OK (GrB_Vector_wait (v, GrB_MATERIALIZE)) ;
+
+        OK (GrB_Vector_new (&us, GrB_FP64, 100)) ;
+        OK (GrB_Vector_new (&vs, GrB_FP64, 100)) ;
+        OK (GrB_Vector_apply_BinaryOp1st_Scalar (us, NULL, NULL,
+            GrB_TIMES_FP64, alpha, u, NULL)) ;
+        OK (GrB_Vector_apply_BinaryOp1st_Scalar (vs, NULL, NULL,
+            GrB_TIMES_FP64, beta, v, NULL)) ;
+        OK (GrB_Vector_dup (&w2, w0)) ;
+        OK (GrB_Vector_eWiseAdd_Monoid (w2, mask, GrB_PLUS_FP64,
+            GrB_PLUS_MONOID_FP64, us, vs, GrB_DESC_RC)) ;
+
+        for (int jit = 0 ; jit <= 1 ; jit++)
+        {
+            OK (GxB_Global_Option_set_INT32 (GxB_JIT_C_CONTROL,
+                jit ? save_control : GxB_JIT_OFF)) ;
+            OK (GrB_Vector_dup (&w1, w0)) ;
+            OK (GxB_Vector_axpby (w1, mask, GrB_PLUS_FP64,
+                GrB_PLUS_TIMES_SEMIRING_FP64, alpha, u, beta, v,
+                GrB_DESC_RC)) ;
+            OK (GxB_Global_Option_set_INT32 (GxB_JIT_C_CONTROL,
+                save_control)) ;
+            CHECK (GB_mx_isequal_entries ((GrB_Matrix) w1, (GrB_Matrix) w2,
+                0)) ;
+            GrB_free (&w1) ;
+            ntrials++ ;
+        }
+        GrB_free (&us) ;
+        GrB_free (&vs) ;
+        GrB_free (&w2) ;
+        GrB_free (&v) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // error handling
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&A, GrB_FP64, 40, 30)) ;
+    OK (GrB_Matrix_new (&C1, GrB_FP64, 40, 30)) ;
+    OK (GrB_Vector_new (&w1, GrB_FP64, 100)) ;
+
+    // NULL inputs
+    expected = GrB_NULL_POINTER ;
+    ERR1 (C1, GxB_Matrix_axpby (C1, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64,
+        NULL, A, beta, A, NULL)) ;
+    ERR1 (C1, GxB_Matrix_axpby (C1, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64,
+        alpha, A, beta, NULL, NULL)) ;
+    ERR1 (w1, GxB_Vector_axpby (w1, NULL, NULL, NULL, alpha, u, beta, u,
+        NULL)) ;
+
+    // alpha or beta has no entry
+    expected = GrB_EMPTY_OBJECT ;
+    OK (GrB_Scalar_clear (alpha)) ;
+    ERR1 (C1, GxB_Matrix_axpby (C1, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64,
+        alpha, A, beta, A, NULL)) ;
+    OK (GrB_Scalar_setElement_FP64 (alpha, 2)) ;
+    OK (GrB_Scalar_clear (beta)) ;
+    ERR1 (w1, GxB_Vector_axpby (w1, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64,
+        alpha, u, beta, u, NULL)) ;
+    OK (GrB_Scalar_setElement_FP64 (beta, -1)) ;
+
+    // alpha or A cannot be typecast to the multiplicative operator, and
+    // positional operators are not supported
+    expected = GrB_DOMAIN_MISMATCH ;
+    GrB_Scalar alpha2 = NULL ;
+    double one = 1 ;
+    OK (GrB_Type_new (&mytype, sizeof (double))) ;
+    OK (GrB_Scalar_new (&alpha2, mytype)) ;
+    OK (GrB_Scalar_setElement_UDT (alpha2, &one)) ;
+    ERR1 (C1, GxB_Matrix_axpby (C1, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64,
+        alpha2, A, beta, A, NULL)) ;
+    ERR1 (C1, GxB_Matrix_axpby (C1, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64,
+        alpha, A, alpha2, A, NULL)) ;
+    GrB_free (&alpha2) ;
+    OK (GrB_Matrix_new (&A0, mytype, 40, 30)) ;
+    ERR1 (C1, GxB_Matrix_axpby (C1, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64,
+        alpha, A, beta, A0, NULL)) ;
+    GrB_free (&A0) ;
+    ERR1 (C1, GxB_Matrix_axpby (C1, NULL, NULL, GxB_MIN_FIRSTI_INT64,
+        alpha, A, beta, A, NULL)) ;
+
+    // A and B have different dimensions
+    expected = GrB_DIMENSION_MISMATCH ;
+    OK (GrB_Matrix_new (&B, GrB_FP64, 30, 40)) ;
+    ERR1 (C1, GxB_Matrix_axpby (C1, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64,
+        alpha, A, beta, B, NULL)) ;
+    ERR1 (C1, GxB_Matrix_axpby (C1, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64,
+        alpha, A, beta, A, GrB_DESC_T1)) ;
+    OK (GxB_Matrix_axpby (C1, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64,
+        alpha, A, beta, B, GrB_DESC_T1)) ;
+    GrB_free (&B) ;
+
+    GrB_free (&A) ;
+    GrB_free (&C1) ;
+    GrB_free (&w1) ;
+    GrB_free (&u) ;
+    GrB_free (&w0) ;
+    GrB_free (&mask) ;
+    GrB_free (&alpha) ;
+    GrB_free (&beta) ;
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_free (&mytype) ;
+    OK (GxB_Global_Option_set_INT32 (GxB_JIT_C_CONTROL, save_control)) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test45:  all tests passed (%d trials).\n\n", ntrials) ;
+}
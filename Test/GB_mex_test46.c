@@ -0,0 +1,191 @@
+//------------------------------------------------------------------------------
+// GB_mex_test46: test GxB_HYPER_PIN and sparse-to-hypersparse conversion
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Tests the get/set of GxB_HYPER_PIN, and the conversion of a sparse matrix to
+// hypersparse, both with far fewer entries than vectors (where the non-empty
+// vectors are found by binary search) and with more entries than vectors
+// (where the vectors are scanned), with one thread and with several tasks.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test46"
+
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+#define N 100
+
+//------------------------------------------------------------------------------
+// GB_mex_test46 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, C = NULL, H = NULL, S = NULL ;
+    GrB_Vector v = NULL ;
+    int32_t i32 ;
+    int save_nthreads ;
+    double save_chunk ;
+    OK (GxB_Global_Option_get_INT32 (GxB_NTHREADS, &save_nthreads)) ;
+    OK (GxB_Global_Option_get_FP64 (GxB_CHUNK, &save_chunk)) ;
+    int ntrials = 0 ;
+
+    //--------------------------------------------------------------------------
+    // GxB_HYPER_PIN
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&A, GrB_FP64, N, N)) ;
+    OK (GrB_Vector_new (&v, GrB_FP64, N)) ;
+    simple_rand_seed (46) ;
+    for (int k = 0 ; k < 4*N ; k++)
+    {
+        OK (GrB_Matrix_setElement_FP64 (A, (double) (k % 7),
+            simple_rand_i ( ) % N, simple_rand_i ( ) % N)) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+
+    OK (GrB_Matrix_get_INT32 (A, &i32, GxB_HYPER_PIN)) ;
+    CHECK (i32 == 0) ;
+    OK (GrB_Matrix_set_INT32 (A, true, GxB_HYPER_PIN)) ;
+    OK (GrB_Matrix_get_INT32 (A, &i32, GxB_HYPER_PIN)) ;
+    CHECK (i32 == 1) ;
+    OK (GxB_Matrix_Option_get_INT32 (A, GxB_HYPER_PIN, &i32)) ;
+    CHECK (i32 == 1) ;
+
+    // A has many non-empty vectors, but stays hypersparse when pinned
+    OK (GxB_Matrix_Option_set_INT32 (A, GxB_SPARSITY_CONTROL,
+        GxB_HYPERSPARSE + GxB_SPARSE)) ;
+    OK (GxB_Matrix_Option_set_INT32 (A, GxB_SPARSITY_CONTROL,
+        GxB_HYPERSPARSE)) ;
+    OK (GxB_Matrix_Option_set_INT32 (A, GxB_SPARSITY_CONTROL,
+        GxB_HYPERSPARSE + GxB_SPARSE)) ;
+    OK (GrB_Matrix_get_INT32 (A, &i32, GxB_SPARSITY_STATUS)) ;
+    CHECK (i32 == GxB_HYPERSPARSE) ;
+
+    // a pinned matrix stays hypersparse when it is modified or cleared, and
+    // the pin is not copied by GrB_Matrix_dup
+    OK (GrB_Matrix_assign_FP64 (A, NULL, GrB_PLUS_FP64, 1, GrB_ALL, N,
+        GrB_ALL, N, NULL)) ;
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_get_INT32 (A, &i32, GxB_SPARSITY_STATUS)) ;
+    CHECK (i32 == GxB_HYPERSPARSE) ;
+    OK (GrB_Matrix_dup (&C, A)) ;
+    OK (GrB_Matrix_get_INT32 (C, &i32, GxB_HYPER_PIN)) ;
+    CHECK (i32 == 0) ;
+    GrB_free (&C) ;
+    OK (GrB_Matrix_clear (A)) ;
+    OK (GrB_Matrix_get_INT32 (A, &i32, GxB_SPARSITY_STATUS)) ;
+    CHECK (i32 == GxB_HYPERSPARSE) ;
+    for (int k = 0 ; k < 4*N ; k++)
+    {
+        OK (GrB_Matrix_setElement_FP64 (A, (double) (k % 7),
+            simple_rand_i ( ) % N, simple_rand_i ( ) % N)) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+
+    // once unpinned, A becomes sparse again
+    OK (GxB_Matrix_Option_set_INT32 (A, GxB_HYPER_PIN, false)) ;
+    OK (GrB_Matrix_get_INT32 (A, &i32, GxB_HYPER_PIN)) ;
+    CHECK (i32 == 0) ;
+    OK (GxB_Matrix_Option_set_INT32 (A, GxB_SPARSITY_CONTROL,
+        GxB_AUTO_SPARSITY)) ;
+    OK (GrB_Matrix_get_INT32 (A, &i32, GxB_SPARSITY_STATUS)) ;
+    CHECK (i32 == GxB_SPARSE) ;
+    GrB_free (&A) ;
+
+    // a GrB_Vector is never hypersparse
+    expected = GrB_INVALID_VALUE ;
+    ERR (GrB_Vector_set_INT32 (v, true, GxB_HYPER_PIN)) ;
+    GrB_free (&v) ;
+
+    //--------------------------------------------------------------------------
+    // sparse to hypersparse
+    //--------------------------------------------------------------------------
+
+    // a matrix with few entries in many columns (found by binary search), and
+    // one with more entries than columns (found by a scan)
+    int64_t ncols_list [2] = { 200000, 2000 } ;
+    int64_t nz_list [2] = { 500, 6000 } ;
+    for (int d = 0 ; d < 2 ; d++)
+    {
+        int64_t nrows = 50, ncols = ncols_list [d], nz = nz_list [d] ;
+        CHECK (GB_nonempty_by_search (nz, ncols) == (d == 0)) ;
+
+        // H: built as hypersparse, for comparison.  Column 0 and the last
+        // column are not empty, and some columns have several entries.
+        OK (GrB_Matrix_new (&H, GrB_FP64, nrows, ncols)) ;
+        OK (GxB_Matrix_Option_set_INT32 (H, GxB_SPARSITY_CONTROL,
+            GxB_HYPERSPARSE)) ;
+        simple_rand_seed (d) ;
+        for (int64_t k = 0 ; k < nz ; k++)
+        {
+            GrB_Index j = (k == 0) ? 0 : ((k == 1) ? (ncols-1) :
+                ((simple_rand_i ( ) % (ncols / 4)) * 4)) ;
+            OK (GrB_Matrix_setElement_FP64 (H, (double) k,
+                simple_rand_i ( ) % nrows, j)) ;
+        }
+        OK (GrB_Matrix_wait (H, GrB_MATERIALIZE)) ;
+        int64_t nvec = H->nvec ;
+
+        for (int nthreads = 1 ; nthreads <= 4 ; nthreads += 3)
+        {
+            // a small chunk, so several threads are used
+            OK (GxB_Global_Option_set_INT32 (GxB_NTHREADS, nthreads)) ;
+            OK (GxB_Global_Option_set_FP64 (GxB_CHUNK, 1)) ;
+
+            // S: H held as sparse
+            OK (GrB_Matrix_dup (&S, H)) ;
+            OK (GxB_Matrix_Option_set_INT32 (S, GxB_SPARSITY_CONTROL,
+                GxB_SPARSE)) ;
+            OK (GrB_Matrix_get_INT32 (S, &i32, GxB_SPARSITY_STATUS)) ;
+            CHECK (i32 == GxB_SPARSE) ;
+            CHECK (GB_nvec_nonempty (S) == nvec) ;
+
+            // convert S back to hypersparse
+            OK (GxB_Matrix_Option_set_INT32 (S, GxB_SPARSITY_CONTROL,
+                GxB_HYPERSPARSE)) ;
+            OK (GrB_Matrix_get_INT32 (S, &i32, GxB_SPARSITY_STATUS)) ;
+            CHECK (i32 == GxB_HYPERSPARSE) ;
+            CHECK (S->nvec == nvec) ;
+            CHECK (S->nvec_nonempty == nvec) ;
+            CHECK (GB_mx_same ((char *) S->h, (char *) H->h,
+                nvec * sizeof (int64_t))) ;
+            CHECK (GB_mx_same ((char *) S->p, (char *) H->p,
+                (nvec+1) * sizeof (int64_t))) ;
+            CHECK (GB_mx_isequal_entries (S, H, 0)) ;
+            GrB_free (&S) ;
+            ntrials++ ;
+        }
+        GrB_free (&H) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    OK (GxB_Global_Option_set_INT32 (GxB_NTHREADS, save_nthreads)) ;
+    OK (GxB_Global_Option_set_FP64 (GxB_CHUNK, save_chunk)) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test46:  all tests passed (%d trials).\n\n", ntrials) ;
+}
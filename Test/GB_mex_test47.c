@@ -0,0 +1,226 @@
+//------------------------------------------------------------------------------
+// GB_mex_test47: test GxB_CHUNK_FAMILY and GxB_chunk_calibrate
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Tests the get/set round trips and the invalid values of GxB_CHUNK_FAMILY,
+// the scaling of each family by the Context chunk, and GxB_chunk_calibrate.
+// The kernel of each family gives the same result with a tiny chunk (so many
+// threads are used) as with the default table.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test47"
+
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+#define N 100
+#define NOPS 8
+
+//------------------------------------------------------------------------------
+// run_families: compute one result with the kernels of each family
+//------------------------------------------------------------------------------
+
+static GrB_Info run_families (GrB_Matrix *C, GrB_Matrix A, GrB_Matrix B,
+    GrB_Index *I, GrB_Index *J, double *X, GrB_Index nz)
+{
+    GrB_Info info ;
+    GrB_Descriptor saxpy = NULL, dot = NULL ;
+    OK (GrB_Descriptor_new (&saxpy)) ;
+    OK (GrB_Descriptor_set_INT32 (saxpy, GxB_AxB_SAXPY,
+        (GrB_Field) GxB_AxB_METHOD)) ;
+    OK (GrB_Descriptor_new (&dot)) ;
+    OK (GrB_Descriptor_set_INT32 (dot, GrB_TRAN, GrB_INP0)) ;
+    OK (GrB_Descriptor_set_INT32 (dot, GxB_AxB_DOT,
+        (GrB_Field) GxB_AxB_METHOD)) ;
+    for (int k = 0 ; k < NOPS ; k++)
+    {
+        OK (GrB_Matrix_new (&C [k], GrB_FP64, N, N)) ;
+    }
+    OK (GrB_Matrix_apply (C [0], NULL, NULL, GrB_AINV_FP64, A, NULL)) ;
+    OK (GrB_Matrix_eWiseAdd_BinaryOp (C [1], NULL, NULL, GrB_PLUS_FP64, A, B,
+        NULL)) ;
+    OK (GrB_Matrix_eWiseMult_BinaryOp (C [2], NULL, NULL, GrB_TIMES_FP64, A,
+        B, NULL)) ;
+    OK (GrB_mxm (C [3], NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, B,
+        saxpy)) ;
+    OK (GrB_mxm (C [4], NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, B,
+        dot)) ;
+    double s = 0 ;
+    OK (GrB_Matrix_reduce_FP64 (&s, NULL, GrB_PLUS_MONOID_FP64, A, NULL)) ;
+    OK (GrB_Matrix_setElement_FP64 (C [5], s, 0, 0)) ;
+    OK (GrB_Matrix_build_FP64 (C [6], I, J, X, nz, GrB_PLUS_FP64)) ;
+    OK (GrB_transpose (C [7], NULL, NULL, A, NULL)) ;
+    GrB_free (&saxpy) ;
+    GrB_free (&dot) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test47 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, B = NULL, C1 [NOPS], C2 [NOPS] ;
+    GxB_Context Context = NULL ;
+    size_t size ;
+    int save_nthreads ;
+    OK (GxB_Global_Option_get_INT32 (GxB_NTHREADS, &save_nthreads)) ;
+
+    // A and B have small integer values, so the results are exact
+    #define NZ (4*N)
+    GrB_Index I [NZ], J [NZ] ;
+    double X [NZ] ;
+    OK (GrB_Matrix_new (&A, GrB_FP64, N, N)) ;
+    OK (GrB_Matrix_new (&B, GrB_FP64, N, N)) ;
+    simple_rand_seed (47) ;
+    for (int k = 0 ; k < NZ ; k++)
+    {
+        I [k] = simple_rand_i ( ) % N ;
+        J [k] = simple_rand_i ( ) % N ;
+        X [k] = (double) (k % 7) ;
+        OK (GrB_Matrix_setElement_FP64 (A, X [k], I [k], J [k])) ;
+        OK (GrB_Matrix_setElement_FP64 (B, (double) (k % 5),
+            simple_rand_i ( ) % N, simple_rand_i ( ) % N)) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (B, GrB_MATERIALIZE)) ;
+    OK (GxB_Context_new (&Context)) ;
+
+    //--------------------------------------------------------------------------
+    // GxB_CHUNK_FAMILY
+    //--------------------------------------------------------------------------
+
+    double c [GxB_NCHUNK_FAMILY], c2 [GxB_NCHUNK_FAMILY] ;
+    OK (GrB_Global_get_SIZE (GrB_GLOBAL, &size, GxB_CHUNK_FAMILY)) ;
+    CHECK (size == GxB_NCHUNK_FAMILY * sizeof (double)) ;
+    OK (GrB_Global_get_VOID (GrB_GLOBAL, (void *) c, GxB_CHUNK_FAMILY)) ;
+    for (int k = 0 ; k < GxB_NCHUNK_FAMILY ; k++)
+    {
+        CHECK (c [k] == 0) ;
+        c [k] = 1000 * (k+1) ;
+    }
+
+    OK (GrB_Global_set_VOID (GrB_GLOBAL, (void *) c, GxB_CHUNK_FAMILY,
+        GxB_NCHUNK_FAMILY * sizeof (double))) ;
+    OK (GrB_Global_get_VOID (GrB_GLOBAL, (void *) c2, GxB_CHUNK_FAMILY)) ;
+    for (int k = 0 ; k < GxB_NCHUNK_FAMILY ; k++)
+    {
+        CHECK (c2 [k] == c [k]) ;
+    }
+
+    // each tuned family is scaled by the ratio of the Context chunk to the
+    // default chunk
+    OK (GxB_Context_set_FP64 (Context, GxB_CHUNK, 2 * GB_CHUNK_DEFAULT)) ;
+    OK (GxB_Context_engage (Context)) ;
+    CHECK (GB_Context_chunk_family (GxB_CHUNK_DOT) == 2 * c [GxB_CHUNK_DOT]) ;
+    OK (GxB_Context_disengage (Context)) ;
+
+    // negative entries are treated as zero, and are not tuned
+    c [GxB_CHUNK_ADD] = -1 ;
+    OK (GxB_Global_Option_set_FP64_ARRAY (GxB_CHUNK_FAMILY, c)) ;
+    OK (GxB_Global_Option_get_FP64 (GxB_CHUNK_FAMILY, c2)) ;
+    CHECK (c2 [GxB_CHUNK_ADD] == 0) ;
+    CHECK (c2 [GxB_CHUNK_APPLY] == c [GxB_CHUNK_APPLY]) ;
+    CHECK (GB_Context_chunk_family (GxB_CHUNK_ADD) == GB_Context_chunk ( )) ;
+
+    // the array is too small
+    expected = GrB_INVALID_VALUE ;
+    ERR (GrB_Global_set_VOID (GrB_GLOBAL, (void *) c, GxB_CHUNK_FAMILY,
+        (GxB_NCHUNK_FAMILY-1) * sizeof (double))) ;
+    ERR (GrB_Global_set_INT32 (GrB_GLOBAL, 1, GxB_CHUNK_FAMILY)) ;
+    OK (GrB_Global_get_VOID (GrB_GLOBAL, (void *) c2, GxB_CHUNK_FAMILY)) ;
+    CHECK (c2 [GxB_CHUNK_APPLY] == c [GxB_CHUNK_APPLY]) ;
+
+    // reset the table
+    OK (GrB_Global_set_VOID (GrB_GLOBAL, NULL, GxB_CHUNK_FAMILY, 0)) ;
+    OK (GrB_Global_get_VOID (GrB_GLOBAL, (void *) c2, GxB_CHUNK_FAMILY)) ;
+    for (int k = 0 ; k < GxB_NCHUNK_FAMILY ; k++)
+    {
+        CHECK (c2 [k] == 0) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // the results do not depend on the chunk of each family
+    //--------------------------------------------------------------------------
+
+    OK (GxB_Global_Option_set_INT32 (GxB_NTHREADS, 4)) ;
+    OK (run_families (C2, A, B, I, J, X, NZ)) ;
+    for (int k = 0 ; k < GxB_NCHUNK_FAMILY ; k++)
+    {
+        // a tiny chunk, so each kernel uses all 4 threads
+        c [k] = 1 ;
+    }
+    OK (GrB_Global_set_VOID (GrB_GLOBAL, (void *) c, GxB_CHUNK_FAMILY,
+        GxB_NCHUNK_FAMILY * sizeof (double))) ;
+    OK (run_families (C1, A, B, I, J, X, NZ)) ;
+    for (int k = 0 ; k < NOPS ; k++)
+    {
+        CHECK (GB_mx_isequal_entries (C1 [k], C2 [k], 0)) ;
+        GrB_free (&C1 [k]) ;
+    }
+    OK (GrB_Global_set_VOID (GrB_GLOBAL, NULL, GxB_CHUNK_FAMILY, 0)) ;
+
+    //--------------------------------------------------------------------------
+    // GxB_chunk_calibrate
+    //--------------------------------------------------------------------------
+
+    // calibrate from a user thread with an engaged Context, which is restored
+    OK (GxB_Context_set_INT (Context, 3, GxB_NTHREADS)) ;
+    OK (GxB_Context_engage (Context)) ;
+    OK (GxB_chunk_calibrate ( )) ;
+    CHECK (GB_Context_current ( ) == Context) ;
+    CHECK (GB_Context_nthreads_max ( ) == 3) ;
+    OK (GxB_Context_disengage (Context)) ;
+
+    OK (GrB_Global_get_VOID (GrB_GLOBAL, (void *) c2, GxB_CHUNK_FAMILY)) ;
+    #if defined ( _OPENMP )
+    for (int k = 0 ; k < GxB_NCHUNK_FAMILY ; k++)
+    {
+        CHECK (c2 [k] >= GB_CHUNK_DEFAULT / 64) ;
+        CHECK (c2 [k] <= GB_CHUNK_DEFAULT * 64) ;
+    }
+    #endif
+
+    // the calibrated table gives the same results
+    OK (run_families (C1, A, B, I, J, X, NZ)) ;
+    for (int k = 0 ; k < NOPS ; k++)
+    {
+        CHECK (GB_mx_isequal_entries (C1 [k], C2 [k], 0)) ;
+        GrB_free (&C1 [k]) ;
+        GrB_free (&C2 [k]) ;
+    }
+    OK (GrB_Global_set_VOID (GrB_GLOBAL, NULL, GxB_CHUNK_FAMILY, 0)) ;
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_free (&A) ;
+    GrB_free (&B) ;
+    GrB_free (&Context) ;
+    OK (GxB_Global_Option_set_INT32 (GxB_NTHREADS, save_nthreads)) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test47:  all tests passed.\n\n") ;
+}
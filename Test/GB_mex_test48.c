@@ -0,0 +1,198 @@
+//------------------------------------------------------------------------------
+// GB_mex_test48: test GxB_CONTEXT_CPUS and GxB_CONTEXT_NUMA_NODE
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Tests the get/set round trips and the invalid values of GxB_CONTEXT_CPUS
+// and GxB_CONTEXT_NUMA_NODE, and checks that a computation gives the same
+// result in a Context bound to a CPU as in an unbound one.  CPU binding is
+// only available on Linux with OpenMP; elsewhere, only the errors are checked.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test48"
+
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+#define N 100
+
+//------------------------------------------------------------------------------
+// GB_mex_test48 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, C1 = NULL, C2 = NULL ;
+    GxB_Context Context = NULL ;
+    int32_t i32 ;
+    size_t size ;
+
+    OK (GrB_Matrix_new (&A, GrB_FP64, N, N)) ;
+    simple_rand_seed (48) ;
+    for (int k = 0 ; k < 4*N ; k++)
+    {
+        OK (GrB_Matrix_setElement_FP64 (A, (double) (k % 7),
+            simple_rand_i ( ) % N, simple_rand_i ( ) % N)) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+
+    // C1 = A*A, computed with no Context
+    OK (GrB_Matrix_new (&C1, GrB_FP64, N, N)) ;
+    OK (GrB_mxm (C1, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, A, NULL)) ;
+
+    //--------------------------------------------------------------------------
+    // GxB_CONTEXT_CPUS
+    //--------------------------------------------------------------------------
+
+    OK (GxB_Context_new (&Context)) ;
+    OK (GxB_Context_get_SIZE (Context, &size, GxB_CONTEXT_CPUS)) ;
+    CHECK (size == 0) ;
+    OK (GxB_Context_get_INT (Context, &i32, GxB_CONTEXT_NUMA_NODE)) ;
+    CHECK (i32 == -1) ;
+
+    int32_t cpus [2] = { 0, 0 }, cpus2 [2] = { -1, -1 } ;
+    info = GxB_Context_set_VOID (Context, (void *) cpus, GxB_CONTEXT_CPUS,
+        sizeof (int32_t)) ;
+    if (info == GrB_NOT_IMPLEMENTED)
+    {
+        // no OpenMP, or not Linux
+        printf ("CPU binding not available\n") ;
+    }
+    else
+    {
+        OK (info) ;
+        OK (GxB_Context_get_SIZE (Context, &size, GxB_CONTEXT_CPUS)) ;
+        CHECK (size == sizeof (int32_t)) ;
+        OK (GxB_Context_get_VOID (Context, (void *) cpus2, GxB_CONTEXT_CPUS)) ;
+        CHECK (cpus2 [0] == 0 && cpus2 [1] == -1) ;
+        OK (GxB_Context_get_INT (Context, &i32, GxB_CONTEXT_NUMA_NODE)) ;
+        CHECK (i32 == -1) ;
+
+        // a bound Context uses at most one thread per CPU
+        OK (GxB_Context_set_INT (Context, 4, GxB_NTHREADS)) ;
+        OK (GxB_Context_engage (Context)) ;
+        CHECK (GB_Context_nthreads_max ( ) == 1) ;
+
+        // the result does not depend on the binding
+        OK (GrB_Matrix_new (&C2, GrB_FP64, N, N)) ;
+        OK (GrB_mxm (C2, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, A,
+            NULL)) ;
+        OK (GxB_Context_disengage (Context)) ;
+        CHECK (GB_mx_isequal_entries (C1, C2, 0)) ;
+        GrB_free (&C2) ;
+
+        // invalid CPUs
+        expected = GrB_INVALID_VALUE ;
+        cpus [1] = -1 ;
+        ERR (GxB_Context_set_VOID (Context, (void *) cpus, GxB_CONTEXT_CPUS,
+            2 * sizeof (int32_t))) ;
+        cpus [1] = 1 << 20 ;
+        ERR (GxB_Context_set_VOID (Context, (void *) cpus, GxB_CONTEXT_CPUS,
+            2 * sizeof (int32_t))) ;
+        ERR (GxB_Context_set_VOID (Context, (void *) cpus, GxB_CONTEXT_CPUS,
+            3)) ;
+        OK (GxB_Context_get_SIZE (Context, &size, GxB_CONTEXT_CPUS)) ;
+        CHECK (size == sizeof (int32_t)) ;
+
+        // a CPU that is not available cannot be engaged, and the Context of
+        // this user thread is left unchanged
+        cpus [0] = 1023 ;
+        OK (GxB_Context_set_VOID (Context, (void *) cpus, GxB_CONTEXT_CPUS,
+            sizeof (int32_t))) ;
+        info = GxB_Context_engage (Context) ;
+        if (info != GrB_SUCCESS)
+        {
+            CHECK (info == GrB_INVALID_VALUE) ;
+            CHECK (GB_Context_current ( ) == NULL) ;
+        }
+        else
+        {
+            // this machine has a CPU 1023
+            OK (GxB_Context_disengage (Context)) ;
+        }
+
+        // remove the binding
+        OK (GxB_Context_set_VOID (Context, NULL, GxB_CONTEXT_CPUS, 0)) ;
+        OK (GxB_Context_get_SIZE (Context, &size, GxB_CONTEXT_CPUS)) ;
+        CHECK (size == 0) ;
+    }
+
+    // GxB_CONTEXT_WORLD cannot be bound
+    expected = GrB_INVALID_VALUE ;
+    cpus [0] = 0 ;
+    ERR (GxB_Context_set_VOID (GxB_CONTEXT_WORLD, (void *) cpus,
+        GxB_CONTEXT_CPUS, sizeof (int32_t))) ;
+
+    //--------------------------------------------------------------------------
+    // GxB_CONTEXT_NUMA_NODE
+    //--------------------------------------------------------------------------
+
+    info = GxB_Context_set_INT (Context, 0, GxB_CONTEXT_NUMA_NODE) ;
+    if (info == GrB_SUCCESS)
+    {
+        // node 0 exists, with at least one CPU
+        OK (GxB_Context_get_INT (Context, &i32, GxB_CONTEXT_NUMA_NODE)) ;
+        CHECK (i32 == 0) ;
+        OK (GxB_Context_get_SIZE (Context, &size, GxB_CONTEXT_CPUS)) ;
+        CHECK (size >= sizeof (int32_t)) ;
+        // setting the CPUs clears the NUMA node
+        OK (GxB_Context_set_VOID (Context, (void *) cpus, GxB_CONTEXT_CPUS,
+            sizeof (int32_t))) ;
+        OK (GxB_Context_get_INT (Context, &i32, GxB_CONTEXT_NUMA_NODE)) ;
+        CHECK (i32 == -1) ;
+        OK (GxB_Context_set_INT (Context, 0, GxB_CONTEXT_NUMA_NODE)) ;
+    }
+    else
+    {
+        // no NUMA information on this system
+        CHECK (info == GrB_INVALID_VALUE || info == GrB_NOT_IMPLEMENTED) ;
+    }
+
+    // a negative node removes the binding
+    OK (GxB_Context_set_INT (Context, -1, GxB_CONTEXT_NUMA_NODE)) ;
+    OK (GxB_Context_get_INT (Context, &i32, GxB_CONTEXT_NUMA_NODE)) ;
+    CHECK (i32 == -1) ;
+    OK (GxB_Context_get_SIZE (Context, &size, GxB_CONTEXT_CPUS)) ;
+    CHECK (size == 0) ;
+
+    // a node that does not exist
+    info = GxB_Context_set_INT (Context, 1000000, GxB_CONTEXT_NUMA_NODE) ;
+    CHECK (info == GrB_INVALID_VALUE || info == GrB_NOT_IMPLEMENTED) ;
+    OK (GxB_Context_get_INT (Context, &i32, GxB_CONTEXT_NUMA_NODE)) ;
+    CHECK (i32 == -1) ;
+
+    // GxB_CONTEXT_WORLD cannot be bound
+    expected = GrB_INVALID_VALUE ;
+    ERR (GxB_Context_set_INT (GxB_CONTEXT_WORLD, 0, GxB_CONTEXT_NUMA_NODE)) ;
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_free (&A) ;
+    GrB_free (&C1) ;
+    GrB_free (&C2) ;
+    GrB_free (&Context) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test48:  all tests passed.\n\n") ;
+}
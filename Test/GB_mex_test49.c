@@ -0,0 +1,147 @@
+//------------------------------------------------------------------------------
+// GB_mex_test49: test GxB_NUMA_POLICY
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Tests the get/set round trips and the invalid values of GxB_NUMA_POLICY.
+// Each policy gives the same results as the default, both for small matrices
+// and for a matrix large enough that its A->i and A->x arrays are bound to the
+// NUMA nodes (by GB_bix_alloc, GB_builder, and GB_transpose).
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test49"
+
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+#define N 100
+#define BIGN 4000
+#define BIGNZ (400*1000)
+
+//------------------------------------------------------------------------------
+// GB_mex_test49 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, B = NULL, C1 = NULL, C2 = NULL, T1 = NULL, T2 = NULL ;
+    GrB_Index *I = NULL, *J = NULL ;
+    double *X = NULL ;
+    int32_t i32 ;
+    int ntrials = 0 ;
+
+    OK (GrB_Matrix_new (&A, GrB_FP64, N, N)) ;
+    OK (GrB_Matrix_new (&B, GrB_FP64, N, N)) ;
+    simple_rand_seed (49) ;
+    for (int k = 0 ; k < 4*N ; k++)
+    {
+        OK (GrB_Matrix_setElement_FP64 (A, (double) (k % 7),
+            simple_rand_i ( ) % N, simple_rand_i ( ) % N)) ;
+        OK (GrB_Matrix_setElement_FP64 (B, (double) (k % 5),
+            simple_rand_i ( ) % N, simple_rand_i ( ) % N)) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (B, GrB_MATERIALIZE)) ;
+
+    // tuples for a large matrix, with more than 1MB in each of A->i and A->x
+    I = (GrB_Index *) mxMalloc (BIGNZ * sizeof (GrB_Index)) ;
+    J = (GrB_Index *) mxMalloc (BIGNZ * sizeof (GrB_Index)) ;
+    X = (double *) mxMalloc (BIGNZ * sizeof (double)) ;
+    CHECK (I != NULL && J != NULL && X != NULL) ;
+    for (int64_t k = 0 ; k < BIGNZ ; k++)
+    {
+        I [k] = simple_rand_i ( ) % BIGN ;
+        J [k] = simple_rand_i ( ) % BIGN ;
+        X [k] = (double) (k % 11) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // GxB_NUMA_POLICY
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Global_get_INT32 (GrB_GLOBAL, &i32, GxB_NUMA_POLICY)) ;
+    CHECK (i32 == GxB_NUMA_DEFAULT) ;
+    for (int policy = GxB_NUMA_DEFAULT ; policy <= GxB_NUMA_LOCAL ; policy++)
+    {
+        info = GrB_Global_set_INT32 (GrB_GLOBAL, policy, GxB_NUMA_POLICY) ;
+        if (info == GrB_NOT_IMPLEMENTED)
+        {
+            // GxB_NUMA_INTERLEAVE and GxB_NUMA_LOCAL require Linux
+            CHECK (policy == GxB_NUMA_INTERLEAVE || policy == GxB_NUMA_LOCAL) ;
+            continue ;
+        }
+        OK (info) ;
+        OK (GrB_Global_get_INT32 (GrB_GLOBAL, &i32, GxB_NUMA_POLICY)) ;
+        CHECK (i32 == policy) ;
+        OK (GxB_Global_Option_get_INT32 (GxB_NUMA_POLICY, &i32)) ;
+        CHECK (i32 == policy) ;
+
+        // the results do not depend on the policy
+        OK (GrB_Matrix_new (&C1, GrB_FP64, N, N)) ;
+        OK (GrB_mxm (C1, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, B,
+            NULL)) ;
+
+        // a large matrix: build, transpose, and multiply under the policy
+        OK (GrB_Matrix_new (&T1, GrB_FP64, BIGN, BIGN)) ;
+        OK (GrB_Matrix_build_FP64 (T1, I, J, X, BIGNZ, GrB_PLUS_FP64)) ;
+        OK (GrB_Matrix_wait (T1, GrB_MATERIALIZE)) ;
+        OK (GrB_transpose (T1, NULL, NULL, T1, NULL)) ;
+        OK (GrB_Matrix_wait (T1, GrB_MATERIALIZE)) ;
+
+        // the same with the default policy
+        OK (GxB_Global_Option_set_INT32 (GxB_NUMA_POLICY, GxB_NUMA_DEFAULT)) ;
+        OK (GrB_Matrix_new (&C2, GrB_FP64, N, N)) ;
+        OK (GrB_mxm (C2, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, B,
+            NULL)) ;
+        CHECK (GB_mx_isequal_entries (C1, C2, 0)) ;
+        OK (GrB_Matrix_new (&T2, GrB_FP64, BIGN, BIGN)) ;
+        OK (GrB_Matrix_build_FP64 (T2, J, I, X, BIGNZ, GrB_PLUS_FP64)) ;
+        CHECK (GB_mx_isequal_entries (T1, T2, 0)) ;
+
+        GrB_free (&C1) ;
+        GrB_free (&C2) ;
+        GrB_free (&T1) ;
+        GrB_free (&T2) ;
+        ntrials++ ;
+    }
+
+    expected = GrB_INVALID_VALUE ;
+    ERR (GrB_Global_set_INT32 (GrB_GLOBAL, -1, GxB_NUMA_POLICY)) ;
+    ERR (GrB_Global_set_INT32 (GrB_GLOBAL, 4, GxB_NUMA_POLICY)) ;
+    ERR (GxB_Global_Option_set_INT32 (GxB_NUMA_POLICY, 99)) ;
+    OK (GrB_Global_get_INT32 (GrB_GLOBAL, &i32, GxB_NUMA_POLICY)) ;
+    CHECK (i32 == GxB_NUMA_DEFAULT) ;
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_free (&A) ;
+    GrB_free (&B) ;
+    mxFree (I) ;
+    mxFree (J) ;
+    mxFree (X) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test49:  all tests passed (%d trials).\n\n", ntrials) ;
+}
+
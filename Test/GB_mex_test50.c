@@ -0,0 +1,191 @@
+//------------------------------------------------------------------------------
+// GB_mex_test50: test GxB_SPARSITY_ADAPTIVE
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Tests the get/set of GxB_SPARSITY_ADAPTIVE, and the formats chosen by the
+// cost model of GB_sparsity_adapt_test.  A matrix A with adaptive sparsity and
+// a matrix R with the default rules undergo the same workload.  A matrix with
+// few entries whose entries are accessed at random (by GrB_assign) is
+// converted to bitmap, once the regret pays for the conversion, and it stays
+// bitmap even though its density is below bitmap_switch/2.  Once the workload
+// becomes a scan of all of A (by GrB_reduce), A is converted back to sparse.
+// R stays sparse throughout, and A and R always have the same entries.
+
+// The workload records no operation times, so the cost of each conversion is
+// estimated from the size of A and the results do not depend on the timing.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test50"
+
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+#define N 200
+#define NI 20
+#define NITER 40
+
+//------------------------------------------------------------------------------
+// GB_mex_test50 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, R = NULL ;
+    GrB_Vector v = NULL ;
+    int32_t i32 ;
+    GrB_Index I [NI], J [NI], anz ;
+
+    //--------------------------------------------------------------------------
+    // GxB_SPARSITY_ADAPTIVE
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&R, GrB_FP64, N, N)) ;
+    OK (GrB_Matrix_get_INT32 (R, &i32, GxB_SPARSITY_ADAPTIVE)) ;
+    CHECK (i32 == 0) ;
+    OK (GrB_Vector_new (&v, GrB_FP64, N)) ;
+    OK (GrB_Vector_set_INT32 (v, true, GxB_SPARSITY_ADAPTIVE)) ;
+    OK (GrB_Vector_get_INT32 (v, &i32, GxB_SPARSITY_ADAPTIVE)) ;
+    CHECK (i32 == 1) ;
+    GrB_free (&v) ;
+
+    // R: about 4% dense, held as sparse
+    OK (GxB_Matrix_Option_set_FP64 (R, GxB_BITMAP_SWITCH, 0.1)) ;
+    simple_rand_seed (50) ;
+    for (int k = 0 ; k < 1600 ; k++)
+    {
+        OK (GrB_Matrix_setElement_FP64 (R, (double) (k % 7),
+            simple_rand_i ( ) % N, simple_rand_i ( ) % N)) ;
+    }
+    OK (GrB_Matrix_wait (R, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_get_INT32 (R, &i32, GxB_SPARSITY_STATUS)) ;
+    CHECK (i32 == GxB_SPARSE) ;
+
+    // A: a copy of R, with adaptive sparsity
+    OK (GrB_Matrix_dup (&A, R)) ;
+    OK (GxB_Matrix_Option_set_FP64 (A, GxB_BITMAP_SWITCH, 0.1)) ;
+    OK (GxB_Matrix_Option_set_INT32 (A, GxB_SPARSITY_ADAPTIVE, true)) ;
+    OK (GxB_Matrix_Option_get_INT32 (A, GxB_SPARSITY_ADAPTIVE, &i32)) ;
+    CHECK (i32 == 1) ;
+    OK (GrB_Matrix_get_INT32 (A, &i32, GxB_SPARSITY_STATUS)) ;
+    CHECK (i32 == GxB_SPARSE) ;
+
+    // the setting is not copied by GrB_Matrix_dup
+    GrB_Matrix C = NULL ;
+    OK (GrB_Matrix_dup (&C, A)) ;
+    OK (GrB_Matrix_get_INT32 (C, &i32, GxB_SPARSITY_ADAPTIVE)) ;
+    CHECK (i32 == 0) ;
+    GrB_free (&C) ;
+
+    //--------------------------------------------------------------------------
+    // random access: A becomes bitmap
+    //--------------------------------------------------------------------------
+
+    // A(I,J) += 1 accesses A at random, NI*NI times
+    for (int k = 0 ; k < NI ; k++)
+    {
+        I [k] = (k * 7) % N ;
+        J [k] = (k * 13 + 5) % N ;
+    }
+
+    int converted = -1 ;
+    for (int iter = 0 ; iter < NITER ; iter++)
+    {
+        OK (GrB_Matrix_assign_FP64 (A, NULL, GrB_PLUS_FP64, 1, I, NI, J, NI,
+            NULL)) ;
+        OK (GrB_Matrix_assign_FP64 (R, NULL, GrB_PLUS_FP64, 1, I, NI, J, NI,
+            NULL)) ;
+        OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+        OK (GrB_Matrix_wait (R, GrB_MATERIALIZE)) ;
+        CHECK (GB_mx_isequal_entries (A, R, 0)) ;
+        OK (GrB_Matrix_get_INT32 (R, &i32, GxB_SPARSITY_STATUS)) ;
+        CHECK (i32 == GxB_SPARSE) ;
+        OK (GrB_Matrix_get_INT32 (A, &i32, GxB_SPARSITY_STATUS)) ;
+        if (converted < 0 && i32 == GxB_BITMAP)
+        {
+            converted = iter ;
+        }
+        // once bitmap, A stays bitmap while its entries are accessed at
+        // random, even though the default rule would convert it to sparse
+        CHECK (i32 == ((converted >= 0) ? GxB_BITMAP : GxB_SPARSE)) ;
+    }
+
+    // A is not converted at its first use, but only once the regret exceeds
+    // the cost of the conversion
+    printf ("A converted to bitmap at iteration %d\n", converted) ;
+    CHECK (converted > 0 && converted < NITER - 1) ;
+    OK (GrB_Matrix_nvals (&anz, A)) ;
+    CHECK (anz <= 0.05 * N * N) ;
+    CHECK (GB_convert_bitmap_to_sparse_test (0.1, anz, N, N)) ;
+
+    //--------------------------------------------------------------------------
+    // scans: A becomes sparse again
+    //--------------------------------------------------------------------------
+
+    converted = -1 ;
+    for (int iter = 0 ; iter < NITER ; iter++)
+    {
+        // each reduction scans all of A, and A is then conformed to its
+        // sparsity control
+        double a = 0, r = 0 ;
+        for (int k = 0 ; k < 4 ; k++)
+        {
+            OK (GrB_Matrix_reduce_FP64 (&a, NULL, GrB_PLUS_MONOID_FP64, A,
+                NULL)) ;
+            OK (GrB_Matrix_reduce_FP64 (&r, NULL, GrB_PLUS_MONOID_FP64, R,
+                NULL)) ;
+            CHECK (a == r) ;
+        }
+        OK (GrB_Matrix_set_INT32 (A, GxB_AUTO_SPARSITY, GxB_SPARSITY_CONTROL)) ;
+        OK (GrB_Matrix_get_INT32 (A, &i32, GxB_SPARSITY_STATUS)) ;
+        if (converted < 0 && i32 == GxB_SPARSE)
+        {
+            converted = iter ;
+        }
+        CHECK (i32 == ((converted >= 0) ? GxB_SPARSE : GxB_BITMAP)) ;
+    }
+    printf ("A converted to sparse at iteration %d\n", converted) ;
+    CHECK (converted > 0 && converted < NITER - 1) ;
+    CHECK (GB_mx_isequal_entries (A, R, 0)) ;
+
+    //--------------------------------------------------------------------------
+    // without adaptive sparsity, A follows the default rule again
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_set_INT32 (A, GxB_BITMAP, GxB_SPARSITY_CONTROL)) ;
+    OK (GrB_Matrix_set_INT32 (A, false, GxB_SPARSITY_ADAPTIVE)) ;
+    OK (GrB_Matrix_set_INT32 (A, GxB_AUTO_SPARSITY, GxB_SPARSITY_CONTROL)) ;
+    OK (GrB_Matrix_get_INT32 (A, &i32, GxB_SPARSITY_STATUS)) ;
+    CHECK (i32 == GxB_SPARSE) ;
+    CHECK (GB_mx_isequal_entries (A, R, 0)) ;
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_free (&A) ;
+    GrB_free (&R) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test50:  all tests passed.\n\n") ;
+}
+
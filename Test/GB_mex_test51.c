@@ -0,0 +1,236 @@
+//------------------------------------------------------------------------------
+// GB_mex_test51: test extractElement with pending tuples and zombies
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Interleaves setElement, subassign with an accumulator, removeElement,
+// extractElement, and isStoredElement on a matrix with pending tuples and
+// zombies, and compares each result with a dense reference.  The entries are
+// drawn mostly from a small set of hot positions, so the pending tuples have
+// many duplicates, and the tuples sorted in place by GB_Pending_lookup are
+// appended to again afterwards.  A few pending tuples are searched directly
+// by extractElement, which must not assemble them.  This is done for a
+// sparse, hypersparse, and by-row matrix, and for a vector.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test51"
+
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+#define N 300
+#define NBASE 6000
+#define NOPS 20000
+#define NHOT 24
+
+//------------------------------------------------------------------------------
+// GB_mex_test51 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, R = NULL ;
+    GrB_Vector v = NULL ;
+    double *X = NULL ;
+    bool *B = NULL ;
+    int64_t nlookups = 0, nboth = 0 ;
+
+    X = (double *) mxMalloc (N * N * sizeof (double)) ;
+    B = (bool *) mxMalloc (N * N * sizeof (bool)) ;
+    CHECK (X != NULL && B != NULL) ;
+
+    for (int kind = 0 ; kind < 4 ; kind++)
+    {
+
+        //----------------------------------------------------------------------
+        // create the base matrix and its reference
+        //----------------------------------------------------------------------
+
+        // kind 0: sparse by column, 1: hypersparse, 2: by row, 3: a vector
+        bool is_vector = (kind == 3) ;
+        int64_t ncols = is_vector ? 1 : N ;
+        int64_t nrows = is_vector ? (N * N) : N ;
+        if (is_vector)
+        {
+            OK (GrB_Vector_new (&v, GrB_FP64, nrows)) ;
+            A = (GrB_Matrix) v ;
+        }
+        else
+        {
+            OK (GrB_Matrix_new (&A, GrB_FP64, nrows, ncols)) ;
+            OK (GxB_Matrix_Option_set_INT32 (A, GxB_SPARSITY_CONTROL,
+                (kind == 1) ? GxB_HYPERSPARSE : GxB_SPARSE)) ;
+            OK (GxB_Matrix_Option_set_INT32 (A, GxB_FORMAT,
+                (kind == 2) ? GxB_BY_ROW : GxB_BY_COL)) ;
+        }
+        memset (B, 0, N * N * sizeof (bool)) ;
+        simple_rand_seed (51 + kind) ;
+        for (int64_t k = 0 ; k < NBASE ; k++)
+        {
+            int64_t i = simple_rand_i ( ) % nrows ;
+            int64_t j = simple_rand_i ( ) % ncols ;
+            double x = (double) (k % 97) ;
+            OK (GrB_Matrix_setElement_FP64 (A, x, i, j)) ;
+            X [i + j*nrows] = x ;
+            B [i + j*nrows] = true ;
+        }
+        OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+
+        //----------------------------------------------------------------------
+        // interleave the updates and the lookups
+        //----------------------------------------------------------------------
+
+        for (int64_t k = 0 ; k < NOPS ; k++)
+        {
+            // pick an entry: mostly a hot one, sometimes anywhere
+            int64_t i, j ;
+            if (simple_rand_i ( ) % 4 == 0)
+            {
+                i = simple_rand_i ( ) % nrows ;
+                j = simple_rand_i ( ) % ncols ;
+            }
+            else
+            {
+                int64_t h = simple_rand_i ( ) % NHOT ;
+                i = (h * 37) % nrows ;
+                j = (h * 11 + 3) % ncols ;
+            }
+            int64_t p = i + j*nrows ;
+            GrB_Index I [1], J [1] ;
+            I [0] = i ;
+            J [0] = j ;
+            double x = (double) (k % 89) ;
+            int action = simple_rand_i ( ) % 16 ;
+            if (k % 1000 == 999)
+            {
+                // flush all pending work now and then
+                OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+                CHECK (!GB_ANY_PENDING_WORK (A)) ;
+            }
+
+            if (action < 5)
+            {
+                // A(i,j) = x
+                OK (GrB_Matrix_setElement_FP64 (A, x, i, j)) ;
+                X [p] = x ;
+                B [p] = true ;
+            }
+            else if (action < 7)
+            {
+                // A(i,j) += x, which leaves a pending tuple with the PLUS
+                // operator if A(i,j) is not present
+                OK (GxB_Matrix_subassign_FP64 (A, NULL, GrB_PLUS_FP64, x,
+                    I, 1, J, 1, NULL)) ;
+                X [p] = B [p] ? (X [p] + x) : x ;
+                B [p] = true ;
+            }
+            else if (action < 9)
+            {
+                // delete A(i,j), which leaves a zombie if it is in A itself
+                OK (GrB_Matrix_removeElement (A, i, j)) ;
+                B [p] = false ;
+            }
+            else
+            {
+                // x = A(i,j), which does not finish any pending work if A has
+                // only a few pending tuples
+                bool pending = (A->Pending != NULL) ;
+                bool lookup = pending && GB_PENDING_LOOKUP_OK (A) ;
+                int64_t npending = GB_Pending_n (A) ;
+                int64_t nzombies = A->nzombies ;
+                double y = -1 ;
+                info = GrB_Matrix_extractElement_FP64 (&y, A, i, j) ;
+                if (B [p])
+                {
+                    CHECK (info == GrB_SUCCESS) ;
+                    CHECK (y == X [p]) ;
+                }
+                else
+                {
+                    CHECK (info == GrB_NO_VALUE) ;
+                }
+                info = GxB_Matrix_isStoredElement (A, i, j) ;
+                CHECK (info == (B [p] ? GrB_SUCCESS : GrB_NO_VALUE)) ;
+                if (lookup)
+                {
+                    // the pending tuples are not assembled, but are sorted
+                    // in place if they were searched
+                    CHECK (GB_Pending_n (A) == npending) ;
+                    CHECK (B [p] || A->Pending->sorted) ;
+                    CHECK (A->nzombies == nzombies) ;
+                    nlookups++ ;
+                    if (nzombies > 0) nboth++ ;
+                }
+                if (is_vector)
+                {
+                    // the same, with the GrB_Vector methods
+                    info = GrB_Vector_extractElement_FP64 (&y, v, i) ;
+                    if (B [p])
+                    {
+                        CHECK (info == GrB_SUCCESS) ;
+                        CHECK (y == X [p]) ;
+                    }
+                    else
+                    {
+                        CHECK (info == GrB_NO_VALUE) ;
+                    }
+                    info = GxB_Vector_isStoredElement (v, i) ;
+                    CHECK (info == (B [p] ? GrB_SUCCESS : GrB_NO_VALUE)) ;
+                }
+            }
+        }
+
+        //----------------------------------------------------------------------
+        // compare the final matrix with the reference
+        //----------------------------------------------------------------------
+
+        OK (GrB_Matrix_new (&R, GrB_FP64, nrows, ncols)) ;
+        for (int64_t p = 0 ; p < N * N ; p++)
+        {
+            if (B [p])
+            {
+                OK (GrB_Matrix_setElement_FP64 (R, X [p], p % nrows,
+                    p / nrows)) ;
+            }
+        }
+        CHECK (GB_mx_isequal_entries (A, R, 0)) ;
+        GrB_free (&R) ;
+        GrB_free (&A) ;
+        v = NULL ;
+    }
+
+    // pending tuples were searched directly, some with zombies in A as well
+    printf ("lookups in the pending tuples: %ld, with zombies: %ld\n",
+        nlookups, nboth) ;
+    CHECK (nlookups > 0 && nboth > 0) ;
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    mxFree (X) ;
+    mxFree (B) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test51:  all tests passed.\n\n") ;
+}
+
@@ -0,0 +1,174 @@
+//------------------------------------------------------------------------------
+// GB_mex_test52: test GB_wait with few and many pending tuples
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Streams batches of setElement and removeElement into a matrix, followed by
+// GrB_Matrix_wait, and compares the result with a dense reference after each
+// batch.  The batches alternate between fewer pending tuples than
+// nnz(A)/GB_WAIT_MERGE_RATIO (so GB_wait merges them into A in place, with
+// GB_wait_merge) and more (so GB_wait appends them to A, or computes A+T).
+// Each kind of batch is spread over all of A, or limited to its last few
+// vectors.  This is done for a hypersparse, sparse, and by-row matrix.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test52"
+
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+#define N 1000
+#define NBASE 20000
+#define NBATCH 24
+
+//------------------------------------------------------------------------------
+// GB_mex_test52 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, R = NULL ;
+    double *X = NULL ;
+    bool *B = NULL ;
+    int32_t i32 ;
+    int nmerge = 0, nother = 0 ;
+
+    X = (double *) mxMalloc (N * N * sizeof (double)) ;
+    B = (bool *) mxMalloc (N * N * sizeof (bool)) ;
+    CHECK (X != NULL && B != NULL) ;
+
+    for (int kind = 0 ; kind < 3 ; kind++)
+    {
+
+        //----------------------------------------------------------------------
+        // create the matrix and its reference
+        //----------------------------------------------------------------------
+
+        // kind 0: hypersparse, 1: sparse by column, 2: sparse by row.  The
+        // hypersparse matrix has many empty vectors.
+        OK (GrB_Matrix_new (&A, GrB_FP64, N, N)) ;
+        OK (GxB_Matrix_Option_set_INT32 (A, GxB_SPARSITY_CONTROL,
+            (kind == 0) ? GxB_HYPERSPARSE : GxB_SPARSE)) ;
+        OK (GxB_Matrix_Option_set_INT32 (A, GxB_FORMAT,
+            (kind == 2) ? GxB_BY_ROW : GxB_BY_COL)) ;
+        int64_t stride = (kind == 0) ? 7 : 1 ;
+        memset (B, 0, N * N * sizeof (bool)) ;
+        simple_rand_seed (52 + kind) ;
+        for (int64_t k = 0 ; k < NBASE ; k++)
+        {
+            int64_t i = simple_rand_i ( ) % N ;
+            int64_t j = (simple_rand_i ( ) % (N / stride)) * stride ;
+            double x = (double) (k % 97) ;
+            OK (GrB_Matrix_setElement_FP64 (A, x, i, j)) ;
+            X [i + j*N] = x ;
+            B [i + j*N] = true ;
+        }
+        OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+
+        //----------------------------------------------------------------------
+        // stream the batches
+        //----------------------------------------------------------------------
+
+        for (int batch = 0 ; batch < NBATCH ; batch++)
+        {
+            // few or many pending tuples, anywhere in A or in its last few
+            // vectors (held as rows if A is by row)
+            bool few = (batch % 2 == 0) ;
+            bool tail = ((batch / 2) % 2 == 1) ;
+            int64_t anz = GB_nnz (A) ;
+            int64_t nnew = few ? (anz / (4 * GB_WAIT_MERGE_RATIO)) :
+                (anz / 4) ;
+            int64_t ndel = nnew / 4 ;
+            int64_t jstart = tail ? (N - 32) : 0 ;
+            for (int64_t k = 0 ; k < ndel + nnew ; k++)
+            {
+                int64_t i = simple_rand_i ( ) % N ;
+                int64_t j = jstart + simple_rand_i ( ) % (N - jstart) ;
+                int64_t row = (kind == 2) ? j : i ;
+                int64_t col = (kind == 2) ? i : j ;
+                int64_t p = row + col*N ;
+                if (k < ndel)
+                {
+                    // delete A(row,col), leaving a zombie.  Entries not in A
+                    // are skipped, since removing them would finish the
+                    // pending work.
+                    if (!B [p]) continue ;
+                    OK (GrB_Matrix_removeElement (A, row, col)) ;
+                    B [p] = false ;
+                }
+                else
+                {
+                    // A(row,col) = x, a pending tuple if not already in A
+                    double x = (double) (batch * 1000 + k) ;
+                    OK (GrB_Matrix_setElement_FP64 (A, x, row, col)) ;
+                    X [p] = x ;
+                    B [p] = true ;
+                }
+            }
+
+            // check the ratio of pending tuples to entries in A
+            int64_t tnz = GB_Pending_n (A) ;
+            int64_t alive = GB_nnz (A) - A->nzombies ;
+            if (tnz > 0 && tnz <= alive / GB_WAIT_MERGE_RATIO)
+            {
+                nmerge++ ;
+            }
+            else if (tnz > 0)
+            {
+                CHECK (!few) ;
+                nother++ ;
+            }
+            OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+            CHECK (!GB_ANY_PENDING_WORK (A)) ;
+            OK (GrB_Matrix_get_INT32 (A, &i32, GxB_SPARSITY_STATUS)) ;
+            CHECK (i32 == ((kind == 0) ? GxB_HYPERSPARSE : GxB_SPARSE)) ;
+
+            // compare with the reference
+            OK (GrB_Matrix_new (&R, GrB_FP64, N, N)) ;
+            for (int64_t p = 0 ; p < N * N ; p++)
+            {
+                if (B [p])
+                {
+                    OK (GrB_Matrix_setElement_FP64 (R, X [p], p % N, p / N)) ;
+                }
+            }
+            CHECK (GB_mx_isequal_entries (A, R, 0)) ;
+            GrB_free (&R) ;
+        }
+        GrB_free (&A) ;
+    }
+
+    // both the merge and the other methods were used
+    printf ("batches merged: %d, appended or added: %d\n", nmerge, nother) ;
+    CHECK (nmerge > 0 && nother > 0) ;
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    mxFree (X) ;
+    mxFree (B) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test52:  all tests passed.\n\n") ;
+}
+
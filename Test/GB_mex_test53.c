@@ -0,0 +1,252 @@
+//------------------------------------------------------------------------------
+// GB_mex_test53: test GrB_Matrix_build with the radix sort
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GB_builder uses a radix sort (GB_rsort) for at least GB_RSORT_MIN tuples,
+// if the (j,i) indices fit in a 64-bit key.  This test builds matrices and
+// vectors from unsorted tuples with many duplicates, just below, at, and
+// above the cutoff, with the PLUS, FIRST, and SECOND dup operators and with
+// iso values.  The dimensions range from small to 2^33-by-2^31 (which just
+// fits in a 64-bit key) and 2^40-by-2^30 (which does not, so the merge sort
+// is used instead).  Each result is compared with the tuples sorted and
+// assembled by qsort, with 1 and 4 threads.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test53"
+
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+#define NMAX (100*1000)
+
+//------------------------------------------------------------------------------
+// tuples for the reference result
+//------------------------------------------------------------------------------
+
+typedef struct
+{
+    uint64_t j, i, k ;
+    double x ;
+}
+tuple ;
+
+static int compare_tuples (const void *p, const void *q)
+{
+    const tuple *a = (const tuple *) p ;
+    const tuple *b = (const tuple *) q ;
+    if (a->j != b->j) return ((a->j < b->j) ? -1 : 1) ;
+    if (a->i != b->i) return ((a->i < b->i) ? -1 : 1) ;
+    if (a->k != b->k) return ((a->k < b->k) ? -1 : 1) ;
+    return (0) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test53 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL ;
+    GrB_Vector v = NULL ;
+    GrB_Scalar s = NULL ;
+    GrB_Index *I = NULL, *J = NULL, *I2 = NULL, *J2 = NULL ;
+    double *X = NULL, *X2 = NULL ;
+    tuple *T = NULL ;
+    int save_nthreads ;
+    double save_chunk ;
+    OK (GxB_Global_Option_get_INT32 (GxB_NTHREADS, &save_nthreads)) ;
+    OK (GxB_Global_Option_get_FP64 (GxB_CHUNK, &save_chunk)) ;
+    int ntrials = 0 ;
+
+    I  = (GrB_Index *) mxMalloc (NMAX * sizeof (GrB_Index)) ;
+    J  = (GrB_Index *) mxMalloc (NMAX * sizeof (GrB_Index)) ;
+    X  = (double *) mxMalloc (NMAX * sizeof (double)) ;
+    I2 = (GrB_Index *) mxMalloc (NMAX * sizeof (GrB_Index)) ;
+    J2 = (GrB_Index *) mxMalloc (NMAX * sizeof (GrB_Index)) ;
+    X2 = (double *) mxMalloc (NMAX * sizeof (double)) ;
+    T  = (tuple *) mxMalloc (NMAX * sizeof (tuple)) ;
+    CHECK (I != NULL && J != NULL && X != NULL && T != NULL) ;
+    CHECK (I2 != NULL && J2 != NULL && X2 != NULL) ;
+    OK (GrB_Scalar_new (&s, GrB_FP64)) ;
+    OK (GrB_Scalar_setElement_FP64 (s, 3)) ;
+
+    // dimensions: the last matrix does not fit in a 64-bit key, and the
+    // last one of all is a vector
+    GrB_Index nrows_list [5] = { 2000, 1 << 20, 1UL << 33, 1UL << 40,
+        1UL << 40 } ;
+    GrB_Index ncols_list [5] = { 3000, 1 << 20, 1UL << 31, 1UL << 30, 1 } ;
+    int64_t nvals_list [4] = { GB_RSORT_MIN - 1, GB_RSORT_MIN,
+        GB_RSORT_MIN + 1, NMAX } ;
+    GrB_BinaryOp dups [4] = { GrB_PLUS_FP64, GrB_FIRST_FP64,
+        GrB_SECOND_FP64, NULL } ;
+
+    for (int d = 0 ; d < 5 ; d++)
+    {
+        GrB_Index nrows = nrows_list [d] ;
+        GrB_Index ncols = ncols_list [d] ;
+        bool is_vector = (ncols == 1) ;
+        for (int t = 0 ; t < 4 ; t++)
+        {
+
+            //------------------------------------------------------------------
+            // create unsorted tuples with many duplicates
+            //------------------------------------------------------------------
+
+            // the tuples are drawn from a pool of nvals/3 entries, spread
+            // over the whole matrix, including its last row and column
+            int64_t nvals = nvals_list [t] ;
+            int64_t npool = nvals / 3 ;
+            simple_rand_seed (53 + d + 10*t) ;
+            for (int64_t k = 0 ; k < nvals ; k++)
+            {
+                int64_t h = simple_rand_i ( ) % npool ;
+                uint64_t hash = ((uint64_t) h) * 0x9E3779B97F4A7C15ULL ;
+                I [k] = (h == 0) ? (nrows - 1) : ((hash >> 7) % nrows) ;
+                J [k] = is_vector ? 0 :
+                    ((h == 0) ? (ncols - 1) : ((hash >> 19) % ncols)) ;
+                X [k] = (double) (simple_rand_i ( ) % 1000) ;
+                T [k].i = I [k] ;
+                T [k].j = J [k] ;
+                T [k].k = k ;
+                T [k].x = X [k] ;
+            }
+            qsort (T, nvals, sizeof (tuple), compare_tuples) ;
+
+            for (int op = 0 ; op < 4 ; op++)
+            {
+
+                //--------------------------------------------------------------
+                // reference result: assemble the sorted tuples
+                //--------------------------------------------------------------
+
+                GrB_BinaryOp dup = dups [op] ;
+                int64_t nref = 0 ;
+                for (int64_t k = 0 ; k < nvals ; k++)
+                {
+                    double x = (dup == NULL) ? 3 : T [k].x ;
+                    if (k > 0 && T [k].i == T [k-1].i && T [k].j == T [k-1].j)
+                    {
+                        // a duplicate of the prior tuple
+                        double *y = &(X2 [nref-1]) ;
+                        if (dup == GrB_PLUS_FP64) (*y) += x ;
+                        else if (dup == GrB_SECOND_FP64) (*y) = x ;
+                    }
+                    else
+                    {
+                        I2 [nref] = T [k].i ;
+                        J2 [nref] = T [k].j ;
+                        X2 [nref] = x ;
+                        nref++ ;
+                    }
+                }
+
+                for (int nthreads = 1 ; nthreads <= 4 ; nthreads += 3)
+                {
+                    OK (GxB_Global_Option_set_INT32 (GxB_NTHREADS, nthreads)) ;
+                    OK (GxB_Global_Option_set_FP64 (GxB_CHUNK, 1)) ;
+
+                    //----------------------------------------------------------
+                    // build the matrix or vector
+                    //----------------------------------------------------------
+
+                    if (is_vector)
+                    {
+                        OK (GrB_Vector_new (&v, GrB_FP64, nrows)) ;
+                        if (dup == NULL)
+                        {
+                            // iso build
+                            OK (GxB_Vector_build_Scalar (v, I, s, nvals)) ;
+                        }
+                        else
+                        {
+                            OK (GrB_Vector_build_FP64 (v, I, X, nvals, dup)) ;
+                        }
+                        A = (GrB_Matrix) v ;
+                    }
+                    else
+                    {
+                        OK (GrB_Matrix_new (&A, GrB_FP64, nrows, ncols)) ;
+                        if (dup == NULL)
+                        {
+                            // iso build
+                            OK (GxB_Matrix_build_Scalar (A, I, J, s, nvals)) ;
+                        }
+                        else
+                        {
+                            OK (GrB_Matrix_build_FP64 (A, I, J, X, nvals,
+                                dup)) ;
+                        }
+                    }
+
+                    //----------------------------------------------------------
+                    // compare with the reference
+                    //----------------------------------------------------------
+
+                    // A is held by column, so its tuples are in the same
+                    // order as the reference
+                    GrB_Index anz ;
+                    OK (GrB_Matrix_nvals (&anz, A)) ;
+                    CHECK (anz == nref) ;
+                    CHECK (A->iso == (dup == NULL)) ;
+                    int64_t *Ap = A->p, *Ah = A->h, *Ai = A->i ;
+                    double *Ax = (double *) A->x ;
+                    CHECK (Ap != NULL) ;
+                    int64_t p = 0 ;
+                    for (int64_t k = 0 ; k < A->nvec ; k++)
+                    {
+                        int64_t j = (Ah == NULL) ? k : Ah [k] ;
+                        for ( ; p < Ap [k+1] ; p++)
+                        {
+                            CHECK ((uint64_t) Ai [p] == I2 [p]) ;
+                            CHECK ((uint64_t) j == J2 [p]) ;
+                            CHECK (Ax [A->iso ? 0 : p] == X2 [p]) ;
+                        }
+                    }
+                    CHECK (p == nref) ;
+                    GrB_free (&A) ;
+                    v = NULL ;
+                    ntrials++ ;
+                }
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_free (&s) ;
+    mxFree (I) ;
+    mxFree (J) ;
+    mxFree (X) ;
+    mxFree (I2) ;
+    mxFree (J2) ;
+    mxFree (X2) ;
+    mxFree (T) ;
+    OK (GxB_Global_Option_set_INT32 (GxB_NTHREADS, save_nthreads)) ;
+    OK (GxB_Global_Option_set_FP64 (GxB_CHUNK, save_chunk)) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test53:  all tests passed (%d trials).\n\n", ntrials) ;
+}
+
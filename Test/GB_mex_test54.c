@@ -0,0 +1,206 @@
+//------------------------------------------------------------------------------
+// GB_mex_test54: test the incremental update of the A->Y hyper_hash
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Inserts and removes vectors of a hypersparse matrix A that has a hyper_hash
+// A->Y, with setElement, removeElement, and GrB_Matrix_wait.  GB_wait updates
+// A->Y in place with GB_hyper_hash_update when it merges a few new vectors
+// (GB_wait_merge), appends vectors at the end of A, or prunes the empty
+// vectors left by zombies.  After each update, GB_hyper_hash_lookup with A->Y
+// is checked for every vector in A->h and for vectors not in A->h, and A->Y
+// is compared with the hyper_hash of a copy of A rebuilt from scratch.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test54"
+
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+#define NROWS 100
+#define NCOLS (1UL << 40)
+#define NVEC 4000
+#define NROUNDS 32
+
+//------------------------------------------------------------------------------
+// check_Y: check A->Y against A->h and against a rebuilt hyper_hash
+//------------------------------------------------------------------------------
+
+static bool check_Y (GrB_Matrix A, GB_Werk Werk)
+{
+    GrB_Info info ;
+    GrB_Matrix Y = A->Y, D = NULL ;
+    if (Y == NULL) return (true) ;
+    const int64_t *Ah = A->h, *Ap = A->p ;
+    const int64_t anvec = A->nvec ;
+    const int64_t *Yp = Y->p, *Yi = Y->i, *Yx = (int64_t *) Y->x ;
+    const int64_t hash_bits = Y->vdim - 1 ;
+
+    // each vector in A->h is found, and each vector not in A->h is not
+    for (int64_t k = 0 ; k < anvec ; k++)
+    {
+        int64_t pstart, pend ;
+        int64_t j = Ah [k] ;
+        int64_t k2 = GB_hyper_hash_lookup (Ah, anvec, Ap, Yp, Yi, Yx,
+            hash_bits, j, &pstart, &pend) ;
+        if (k2 != k || pstart != Ap [k] || pend != Ap [k+1]) return (false) ;
+        if (k + 1 < anvec && Ah [k+1] == j + 1) continue ;
+        k2 = GB_hyper_hash_lookup (Ah, anvec, Ap, Yp, Yi, Yx, hash_bits, j+1,
+            &pstart, &pend) ;
+        if (k2 != -1 || pstart != pend) return (false) ;
+    }
+
+    // each bucket of A->Y holds the vectors that hash to it, in order
+    int64_t ynz = GB_nnz (Y) ;
+    if (ynz != anvec) return (false) ;
+    for (int64_t b = 0 ; b < Y->vdim ; b++)
+    {
+        for (int64_t p = Yp [b] ; p < Yp [b+1] ; p++)
+        {
+            int64_t j = Yi [p], k = Yx [p] ;
+            if (GB_HASHF2 (j, hash_bits) != b) return (false) ;
+            if (p > Yp [b] && Yi [p-1] >= j) return (false) ;
+            if (k < 0 || k >= anvec || Ah [k] != j) return (false) ;
+        }
+    }
+
+    // compare with the hyper_hash of a copy of A, rebuilt from scratch.  The
+    // number of buckets of A->Y may differ from that of a new hyper_hash by a
+    // factor of 2, but if it is the same, so is the hyper_hash.
+    if (GrB_Matrix_dup (&D, A) != GrB_SUCCESS) return (false) ;
+    GB_hyper_hash_free (D) ;
+    bool ok = (GB_hyper_hash_build (D, Werk) == GrB_SUCCESS) &&
+        (D->Y != NULL) && (GB_nnz (D->Y) == ynz) ;
+    if (ok && D->Y->vdim == Y->vdim)
+    {
+        ok = GB_mx_same ((char *) D->Y->p, (char *) Yp,
+                (Y->vdim + 1) * sizeof (int64_t)) &&
+            GB_mx_same ((char *) D->Y->i, (char *) Yi,
+                ynz * sizeof (int64_t)) &&
+            GB_mx_same ((char *) D->Y->x, (char *) Yx,
+                ynz * sizeof (int64_t)) ;
+    }
+    GrB_free (&D) ;
+    return (ok) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test54 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GB_WERK (USAGE) ;
+    GrB_Matrix A = NULL ;
+    int32_t i32 ;
+    int nkept = 0, nrebuilt = 0 ;
+
+    // A: hypersparse, with 2 entries in each of NVEC vectors
+    OK (GrB_Matrix_new (&A, GrB_FP64, NROWS, NCOLS)) ;
+    simple_rand_seed (54) ;
+    for (int64_t k = 0 ; k < NVEC ; k++)
+    {
+        GrB_Index j = (simple_rand_i ( ) * 1000003ULL) % NCOLS ;
+        OK (GrB_Matrix_setElement_FP64 (A, 1, k % NROWS, j)) ;
+        OK (GrB_Matrix_setElement_FP64 (A, 2, (k+1) % NROWS, j)) ;
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_get_INT32 (A, &i32, GxB_SPARSITY_STATUS)) ;
+    CHECK (i32 == GxB_HYPERSPARSE) ;
+    OK (GB_hyper_hash_build (A, Werk)) ;
+    CHECK (A->Y != NULL) ;
+    CHECK (check_Y (A, Werk)) ;
+
+    //--------------------------------------------------------------------------
+    // insert and remove vectors
+    //--------------------------------------------------------------------------
+
+    for (int round = 0 ; round < NROUNDS ; round++)
+    {
+        int64_t anvec = A->nvec ;
+        int64_t anz = GB_nnz (A) ;
+        int action = round % 4 ;
+        if (action == 2 || action == 3)
+        {
+            // remove all entries from some vectors, leaving them empty
+            for (int64_t t = 0 ; t < anvec / 32 ; t++)
+            {
+                int64_t k = simple_rand_i ( ) % anvec ;
+                GrB_Index j = A->h [k] ;
+                for (GrB_Index i = 0 ; i < NROWS ; i++)
+                {
+                    OK (GrB_Matrix_removeElement (A, i, j)) ;
+                }
+            }
+        }
+        if (action == 0 || action == 3)
+        {
+            // a few new vectors, which are merged into A in place
+            for (int64_t t = 0 ; t < anz / 64 ; t++)
+            {
+                GrB_Index j = (simple_rand_i ( ) * 999983ULL) % NCOLS ;
+                OK (GrB_Matrix_setElement_FP64 (A, 3, t % NROWS, j)) ;
+            }
+        }
+        else if (action == 1)
+        {
+            // many new vectors at the end of A, which are appended to A
+            GrB_Index jstart = A->h [anvec - anvec / 16] ;
+            for (int64_t t = 0 ; t < anz / 8 ; t++)
+            {
+                GrB_Index j = jstart +
+                    (simple_rand_i ( ) * 7919ULL) % (NCOLS - jstart) ;
+                OK (GrB_Matrix_setElement_FP64 (A, 4, t % NROWS, j)) ;
+            }
+        }
+        OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+        CHECK (!GB_ANY_PENDING_WORK (A)) ;
+        OK (GrB_Matrix_get_INT32 (A, &i32, GxB_SPARSITY_STATUS)) ;
+        CHECK (i32 == GxB_HYPERSPARSE) ;
+
+        // check the updated A->Y, or rebuild it if it was freed
+        if (A->Y != NULL)
+        {
+            CHECK (check_Y (A, Werk)) ;
+            nkept++ ;
+        }
+        else
+        {
+            OK (GB_hyper_hash_build (A, Werk)) ;
+            CHECK (check_Y (A, Werk)) ;
+            nrebuilt++ ;
+        }
+    }
+
+    printf ("A->Y updated: %d, rebuilt: %d\n", nkept, nrebuilt) ;
+    CHECK (nkept > NROUNDS / 2) ;
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_free (&A) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test54:  all tests passed.\n\n") ;
+}
+
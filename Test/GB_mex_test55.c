@@ -0,0 +1,321 @@
+//------------------------------------------------------------------------------
+// GB_mex_test55: test the in-place transpose of full and bitmap matrices
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Tests GB_transpose_in_place_full, which permutes A->x and A->b of a full or
+// bitmap matrix in-place.  A square matrix is transposed with C=C' by
+// GrB_transpose, and a square or rectangular matrix is transposed in-place
+// when its format is changed from by-column to by-row, or back.  Each entry
+// is compared with a dense reference, and A->x must not be reallocated.
+// Entries of 1, 2, 4, 8, and 16 bytes are tested, and of a user-defined type
+// of 3 bytes, with and without iso values, with 1 and 4 threads.  C=C' must
+// also free the cached transpose of C, if any.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test55"
+
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+#define NDIMS 12
+#define NTYPES 6
+
+typedef struct { uint8_t a, b, c ; } mytype3 ;
+
+//------------------------------------------------------------------------------
+// reference values
+//------------------------------------------------------------------------------
+
+static double value (int64_t i, int64_t j, bool iso, bool is_bool)
+{
+    double x = iso ? 3 : (double) ((i * 7 + j * 3) % 11 + 1) ;
+    return (is_bool ? (double) (((int64_t) x) % 2) : x) ;
+}
+
+static mytype3 value3 (int64_t i, int64_t j, bool iso)
+{
+    mytype3 x ;
+    x.a = iso ? 1 : (uint8_t) (i % 256) ;
+    x.b = iso ? 2 : (uint8_t) (j % 256) ;
+    x.c = iso ? 3 : (uint8_t) ((i + j) % 256) ;
+    return (x) ;
+}
+
+static bool present (int64_t i, int64_t j, bool bitmap)
+{
+    return (!bitmap || ((i + 2*j) % 3 != 0)) ;
+}
+
+//------------------------------------------------------------------------------
+// check: check A(i,j) against the reference value of (i,j), or of (j,i)
+//------------------------------------------------------------------------------
+
+static bool check (GrB_Matrix A, GrB_Type type, bool bitmap, bool iso,
+    bool transposed)
+{
+    GrB_Index m, n ;
+    if (GrB_Matrix_nrows (&m, A) != GrB_SUCCESS) return (false) ;
+    if (GrB_Matrix_ncols (&n, A) != GrB_SUCCESS) return (false) ;
+    for (int64_t i = 0 ; i < (int64_t) m ; i++)
+    {
+        for (int64_t j = 0 ; j < (int64_t) n ; j++)
+        {
+            int64_t i0 = transposed ? j : i ;
+            int64_t j0 = transposed ? i : j ;
+            GrB_Info info ;
+            if (type == GrB_FP64 || type == GrB_FP32 || type == GrB_INT16 ||
+                type == GrB_BOOL || type == GxB_FC64)
+            {
+                double x = -1 ;
+                info = GrB_Matrix_extractElement_FP64 (&x, A, i, j) ;
+                if (present (i0, j0, bitmap))
+                {
+                    if (info != GrB_SUCCESS) return (false) ;
+                    if (x != value (i0, j0, iso, type == GrB_BOOL))
+                    {
+                        return (false) ;
+                    }
+                }
+                else if (info != GrB_NO_VALUE) return (false) ;
+            }
+            else
+            {
+                mytype3 x, y = value3 (i0, j0, iso) ;
+                info = GrB_Matrix_extractElement_UDT ((void *) &x, A, i, j) ;
+                if (present (i0, j0, bitmap))
+                {
+                    if (info != GrB_SUCCESS) return (false) ;
+                    if (x.a != y.a || x.b != y.b || x.c != y.c) return (false) ;
+                }
+                else if (info != GrB_NO_VALUE) return (false) ;
+            }
+        }
+    }
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test55 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, B = NULL, R = NULL, C1 = NULL, C2 = NULL ;
+    GrB_Type Type3 = NULL ;
+    GrB_Scalar s = NULL ;
+    GrB_Index *I = NULL, *J = NULL ;
+    GrB_Descriptor desc = NULL ;
+    int32_t i32 ;
+    int save_nthreads ;
+    double save_chunk ;
+    OK (GxB_Global_Option_get_INT32 (GxB_NTHREADS, &save_nthreads)) ;
+    OK (GxB_Global_Option_get_FP64 (GxB_CHUNK, &save_chunk)) ;
+    int ntrials = 0 ;
+
+    OK (GrB_Type_new (&Type3, sizeof (mytype3))) ;
+    I = (GrB_Index *) mxMalloc (200 * 300 * sizeof (GrB_Index)) ;
+    J = (GrB_Index *) mxMalloc (200 * 300 * sizeof (GrB_Index)) ;
+    CHECK (I != NULL && J != NULL) ;
+    GrB_Type types [NTYPES] = { GrB_BOOL, GrB_INT16, GrB_FP32, GrB_FP64,
+        GxB_FC64, NULL } ;
+    types [5] = Type3 ;
+
+    // square and rectangular: g = gcd (m,n) is 1, or m, or in between, and
+    // some dimensions exceed the tile size of 64
+    int64_t mlist [NDIMS] = { 1, 1, 7, 5, 64, 130, 3, 6, 12, 100, 64, 200 } ;
+    int64_t nlist [NDIMS] = { 1, 7, 1, 5, 64, 130, 5, 4, 18,  37, 128, 300 } ;
+
+    //--------------------------------------------------------------------------
+    // C=C' and changes of format
+    //--------------------------------------------------------------------------
+
+    for (int nthreads = 1 ; nthreads <= 4 ; nthreads += 3)
+    {
+        // a small chunk, so several threads are used
+        OK (GxB_Global_Option_set_INT32 (GxB_NTHREADS, nthreads)) ;
+        OK (GxB_Global_Option_set_FP64 (GxB_CHUNK, 1)) ;
+
+        for (int d = 0 ; d < NDIMS ; d++)
+        for (int t = 0 ; t < NTYPES ; t++)
+        for (int bitmap = 0 ; bitmap <= 1 ; bitmap++)
+        for (int iso = 0 ; iso <= 1 ; iso++)
+        {
+            int64_t m = mlist [d], n = nlist [d] ;
+            GrB_Type type = types [t] ;
+
+            // create A, with GxB_Matrix_build_Scalar if A is iso
+            OK (GrB_Matrix_new (&A, type, m, n)) ;
+            int64_t nz = 0 ;
+            for (int64_t i = 0 ; i < m ; i++)
+            {
+                for (int64_t j = 0 ; j < n ; j++)
+                {
+                    if (!present (i, j, bitmap)) continue ;
+                    I [nz] = i ;
+                    J [nz] = j ;
+                    nz++ ;
+                    if (iso) continue ;
+                    if (type == Type3)
+                    {
+                        mytype3 x = value3 (i, j, iso) ;
+                        OK (GrB_Matrix_setElement_UDT (A, (void *) &x, i, j)) ;
+                    }
+                    else
+                    {
+                        OK (GrB_Matrix_setElement_FP64 (A,
+                            value (i, j, iso, type == GrB_BOOL), i, j)) ;
+                    }
+                }
+            }
+            if (iso)
+            {
+                OK (GrB_Scalar_new (&s, type)) ;
+                if (type == Type3)
+                {
+                    mytype3 x = value3 (0, 0, iso) ;
+                    OK (GrB_Scalar_setElement_UDT (s, (void *) &x)) ;
+                }
+                else
+                {
+                    OK (GrB_Scalar_setElement_FP64 (s,
+                        value (0, 0, iso, type == GrB_BOOL))) ;
+                }
+                OK (GxB_Matrix_build_Scalar (A, I, J, s, nz)) ;
+                GrB_free (&s) ;
+            }
+            OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+            OK (GxB_Matrix_Option_set_INT32 (A, GxB_SPARSITY_CONTROL,
+                bitmap ? GxB_BITMAP : GxB_FULL)) ;
+            OK (GrB_Matrix_get_INT32 (A, &i32, GxB_SPARSITY_STATUS)) ;
+            CHECK (i32 == (bitmap ? GxB_BITMAP : GxB_FULL)) ;
+            CHECK (A->iso == (bool) iso || nz == 1) ;
+            void *Ax = A->x ;
+
+            // change the format to by-row, transposing A->x in-place
+            OK (GxB_Matrix_Option_set_INT32 (A, GxB_FORMAT, GxB_BY_ROW)) ;
+            CHECK (!A->is_csc) ;
+            CHECK (A->x == Ax) ;
+            CHECK (check (A, type, bitmap, iso, false)) ;
+
+            if (m == n)
+            {
+                // A = A', in-place, held by row, and then by column
+                OK (GrB_transpose (A, NULL, NULL, A, NULL)) ;
+                CHECK (A->x == Ax) ;
+                CHECK (check (A, type, bitmap, iso, true)) ;
+                OK (GxB_Matrix_Option_set_INT32 (A, GxB_FORMAT, GxB_BY_COL)) ;
+                CHECK (A->x == Ax) ;
+                CHECK (check (A, type, bitmap, iso, true)) ;
+                OK (GrB_transpose (A, NULL, NULL, A, NULL)) ;
+                CHECK (A->x == Ax) ;
+            }
+            else
+            {
+                // back to by-column
+                OK (GxB_Matrix_Option_set_INT32 (A, GxB_FORMAT, GxB_BY_COL)) ;
+                CHECK (A->x == Ax) ;
+            }
+            CHECK (A->is_csc) ;
+            CHECK (check (A, type, bitmap, iso, false)) ;
+            OK (GrB_Matrix_get_INT32 (A, &i32, GxB_SPARSITY_STATUS)) ;
+            CHECK (i32 == (bitmap ? GxB_BITMAP : GxB_FULL)) ;
+            GrB_free (&A) ;
+            ntrials++ ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // C=C' frees the cached transpose of C
+    //--------------------------------------------------------------------------
+
+    #define N 50
+    OK (GrB_Descriptor_new (&desc)) ;
+    OK (GrB_Descriptor_set_INT32 (desc, GrB_TRAN, GrB_INP0)) ;
+    OK (GrB_Descriptor_set_INT32 (desc, GxB_AxB_SAXPY,
+        (GrB_Field) GxB_AxB_METHOD)) ;
+    OK (GrB_Matrix_new (&B, GrB_FP64, N, N)) ;
+    OK (GrB_Matrix_assign_FP64 (B, NULL, NULL, 1, GrB_ALL, N, GrB_ALL, N,
+        NULL)) ;
+    OK (GrB_Matrix_setElement_FP64 (B, 2, 0, 1)) ;
+    OK (GrB_Matrix_wait (B, GrB_MATERIALIZE)) ;
+    for (int bitmap = 0 ; bitmap <= 1 ; bitmap++)
+    {
+        OK (GrB_Matrix_new (&A, GrB_FP64, N, N)) ;
+        for (int64_t i = 0 ; i < N ; i++)
+        {
+            for (int64_t j = 0 ; j < N ; j++)
+            {
+                if (!present (i, j, bitmap)) continue ;
+                OK (GrB_Matrix_setElement_FP64 (A, value (i, j, false, false),
+                    i, j)) ;
+            }
+        }
+        OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+        OK (GxB_Matrix_Option_set_INT32 (A, GxB_SPARSITY_CONTROL,
+            bitmap ? GxB_BITMAP : GxB_FULL)) ;
+        OK (GrB_Matrix_set_INT32 (A, true, GxB_TRANSPOSE_CACHE)) ;
+
+        // C1 = A'*B constructs and keeps A->AT
+        OK (GrB_Matrix_new (&C1, GrB_FP64, N, N)) ;
+        OK (GrB_mxm (C1, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, B,
+            desc)) ;
+        CHECK (A->AT != NULL) ;
+
+        // A = A' frees A->AT, so the next A'*B uses the new A
+        OK (GrB_transpose (A, NULL, NULL, A, NULL)) ;
+        CHECK (A->AT == NULL) ;
+        CHECK (check (A, GrB_FP64, bitmap, false, true)) ;
+        OK (GrB_mxm (C1, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, A, B,
+            desc)) ;
+
+        // compare with R'*B, where R = A has no cached transpose
+        OK (GrB_Matrix_dup (&R, A)) ;
+        CHECK (R->AT == NULL) ;
+        OK (GrB_Matrix_new (&C2, GrB_FP64, N, N)) ;
+        OK (GrB_mxm (C2, NULL, NULL, GrB_PLUS_TIMES_SEMIRING_FP64, R, B,
+            desc)) ;
+        CHECK (R->AT == NULL) ;
+        CHECK (GB_mx_isequal_entries (C1, C2, 0)) ;
+        GrB_free (&A) ;
+        GrB_free (&R) ;
+        GrB_free (&C1) ;
+        GrB_free (&C2) ;
+        ntrials++ ;
+    }
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_free (&B) ;
+    GrB_free (&desc) ;
+    GrB_free (&Type3) ;
+    mxFree (I) ;
+    mxFree (J) ;
+    OK (GxB_Global_Option_set_INT32 (GxB_NTHREADS, save_nthreads)) ;
+    OK (GxB_Global_Option_set_FP64 (GxB_CHUNK, save_chunk)) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test55:  all tests passed (%d trials).\n\n", ntrials) ;
+}
+
@@ -0,0 +1,180 @@
+//------------------------------------------------------------------------------
+// GB_mex_test56: test the work-stealing scheduler of the dot3 method
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Computes C<M>=A'*B with the dot3 method, where a few columns of A and B are
+// dense and the rest have only a few entries, so that the work per entry of
+// C is very skewed, and the threads of the dot3 kernel must steal work from
+// each other (see GB_task_steal.h).  The result is computed with 1 to 8
+// threads, with a small chunk so that several threads are used, and compared
+// with the result with 1 thread, and with C<M>=A'*B computed by the saxpy
+// method.  Built-in semirings (the factory kernels) and a user-defined
+// semiring (the JIT kernels, or the generic kernel if the JIT is off) are
+// tested.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test56"
+
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+#define N 2000
+#define NDENSE 4
+
+void mytimes2 (double *z, const double *x, const double *y) ;
+void mytimes2 (double *z, const double *x, const double *y)
+{
+    (*z) = 2 * (*x) * (*y) ;
+}
+
+#define MYTIMES2_DEFN \
+"void mytimes2 (double *z, const double *x, const double *y)    \n" \
+"{                                                              \n" \
+"    (*z) = 2 * (*x) * (*y) ;                                   \n" \
+"}"
+
+//------------------------------------------------------------------------------
+// GB_mex_test56 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix A = NULL, B = NULL, M = NULL, C1 = NULL, C2 = NULL, C = NULL ;
+    GrB_Descriptor dot = NULL, saxpy = NULL ;
+    GrB_BinaryOp MyTimes2 = NULL ;
+    GrB_Semiring MySemiring = NULL ;
+    int save_nthreads, save_control ;
+    double save_chunk ;
+    OK (GxB_Global_Option_get_INT32 (GxB_NTHREADS, &save_nthreads)) ;
+    OK (GxB_Global_Option_get_FP64 (GxB_CHUNK, &save_chunk)) ;
+    OK (GxB_Global_Option_get_INT32 (GxB_JIT_C_CONTROL, &save_control)) ;
+    int ntrials = 0 ;
+
+    OK (GrB_Descriptor_new (&dot)) ;
+    OK (GrB_Descriptor_set_INT32 (dot, GrB_TRAN, GrB_INP0)) ;
+    OK (GrB_Descriptor_set_INT32 (dot, GxB_AxB_DOT,
+        (GrB_Field) GxB_AxB_METHOD)) ;
+    OK (GrB_Descriptor_new (&saxpy)) ;
+    OK (GrB_Descriptor_set_INT32 (saxpy, GrB_TRAN, GrB_INP0)) ;
+    OK (GrB_Descriptor_set_INT32 (saxpy, GxB_AxB_SAXPY,
+        (GrB_Field) GxB_AxB_METHOD)) ;
+    OK (GxB_BinaryOp_new (&MyTimes2, (GxB_binary_function) mytimes2,
+        GrB_FP64, GrB_FP64, GrB_FP64, "mytimes2", MYTIMES2_DEFN)) ;
+    OK (GrB_Semiring_new (&MySemiring, GrB_PLUS_MONOID_FP64, MyTimes2)) ;
+    GrB_Semiring semirings [3] = { GrB_PLUS_TIMES_SEMIRING_FP64,
+        GrB_MIN_PLUS_SEMIRING_FP64, MySemiring } ;
+
+    //--------------------------------------------------------------------------
+    // create the skewed inputs
+    //--------------------------------------------------------------------------
+
+    // A and B have NDENSE dense columns, and 3 entries in each other column.
+    // The entries are small integers, so the results are exact.
+    OK (GrB_Matrix_new (&A, GrB_FP64, N, N)) ;
+    OK (GrB_Matrix_new (&B, GrB_FP64, N, N)) ;
+    OK (GrB_Matrix_new (&M, GrB_BOOL, N, N)) ;
+    simple_rand_seed (56) ;
+    for (int64_t j = 0 ; j < N ; j++)
+    {
+        int64_t jnz = (j % (N / NDENSE) == 0) ? N : 3 ;
+        for (int64_t k = 0 ; k < jnz ; k++)
+        {
+            int64_t i = (jnz == N) ? k : (simple_rand_i ( ) % N) ;
+            OK (GrB_Matrix_setElement_FP64 (A, (double) (i % 5 + 1), i, j)) ;
+            i = (jnz == N) ? k : (simple_rand_i ( ) % N) ;
+            OK (GrB_Matrix_setElement_FP64 (B, (double) (i % 3 + 1), i, j)) ;
+        }
+    }
+
+    // M has about 8 entries per column, and includes all entries C(i,j)
+    // where column i of A and column j of B are both dense
+    for (int64_t k = 0 ; k < 8 * N ; k++)
+    {
+        OK (GrB_Matrix_setElement_BOOL (M, true, simple_rand_i ( ) % N,
+            simple_rand_i ( ) % N)) ;
+    }
+    for (int64_t i = 0 ; i < N ; i += (N / NDENSE))
+    {
+        for (int64_t j = 0 ; j < N ; j += (N / NDENSE))
+        {
+            OK (GrB_Matrix_setElement_BOOL (M, true, i, j)) ;
+        }
+    }
+    OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (B, GrB_MATERIALIZE)) ;
+    OK (GrB_Matrix_wait (M, GrB_MATERIALIZE)) ;
+
+    //--------------------------------------------------------------------------
+    // C<M>=A'*B with 1 to 8 threads
+    //--------------------------------------------------------------------------
+
+    for (int jit = 0 ; jit <= 1 ; jit++)
+    {
+        OK (GxB_Global_Option_set_INT32 (GxB_JIT_C_CONTROL,
+            jit ? GxB_JIT_ON : GxB_JIT_OFF)) ;
+        for (int s = 0 ; s < 3 ; s++)
+        {
+            // reference results: 1 thread, and the saxpy method
+            OK (GxB_Global_Option_set_INT32 (GxB_NTHREADS, 1)) ;
+            OK (GxB_Global_Option_set_FP64 (GxB_CHUNK, save_chunk)) ;
+            OK (GrB_Matrix_new (&C1, GrB_FP64, N, N)) ;
+            OK (GrB_mxm (C1, M, NULL, semirings [s], A, B, dot)) ;
+            OK (GrB_Matrix_new (&C2, GrB_FP64, N, N)) ;
+            OK (GrB_mxm (C2, M, NULL, semirings [s], A, B, saxpy)) ;
+            CHECK (GB_mx_isequal_entries (C1, C2, 0)) ;
+
+            for (int nthreads = 2 ; nthreads <= 8 ; nthreads++)
+            {
+                // a small chunk, so that all threads are used
+                OK (GxB_Global_Option_set_INT32 (GxB_NTHREADS, nthreads)) ;
+                OK (GxB_Global_Option_set_FP64 (GxB_CHUNK, 1)) ;
+                OK (GrB_Matrix_new (&C, GrB_FP64, N, N)) ;
+                OK (GrB_mxm (C, M, NULL, semirings [s], A, B, dot)) ;
+                CHECK (GB_mx_isequal_entries (C, C1, 0)) ;
+                GrB_free (&C) ;
+                ntrials++ ;
+            }
+            GrB_free (&C1) ;
+            GrB_free (&C2) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_free (&A) ;
+    GrB_free (&B) ;
+    GrB_free (&M) ;
+    GrB_free (&dot) ;
+    GrB_free (&saxpy) ;
+    GrB_free (&MySemiring) ;
+    GrB_free (&MyTimes2) ;
+    OK (GxB_Global_Option_set_INT32 (GxB_NTHREADS, save_nthreads)) ;
+    OK (GxB_Global_Option_set_FP64 (GxB_CHUNK, save_chunk)) ;
+    OK (GxB_Global_Option_set_INT32 (GxB_JIT_C_CONTROL, save_control)) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test56:  all tests passed (%d trials).\n\n", ntrials) ;
+}
+
@@ -0,0 +1,230 @@
+//------------------------------------------------------------------------------
+// GB_mex_test57: test GB_reduce_each_vector
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GrB_reduce to a vector reduces each vector of A directly with
+// GB_reduce_each_vector when A is reduced along the orientation it is held in
+// (the rows of a matrix held by row, or the columns of a matrix held by
+// column).  Otherwise, it computes A*x with the REDUCE_FIRST semiring.  This
+// test reduces the same matrix held both ways, so that each result from the
+// new kernel is compared with the A*x method.  Built-in monoids of many types
+// are tested (some with terminal values that appear in A), and a user-defined
+// monoid, for sparse, hypersparse, bitmap, full, and iso matrices, with a
+// mask and accumulator, with 1 and 4 threads, and with the JIT on and off.
+// If the JIT is off and the factory kernels are not compiled (with
+// GRAPHBLAS_COMPACT), both methods use A*x.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test57"
+
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+#define M 300
+#define N 200
+#define NMONOIDS 14
+
+void mymax (double *z, const double *x, const double *y) ;
+void mymax (double *z, const double *x, const double *y)
+{
+    (*z) = ((*x) > (*y)) ? (*x) : (*y) ;
+}
+
+#define MYMAX_DEFN \
+"void mymax (double *z, const double *x, const double *y)   \n" \
+"{                                                          \n" \
+"    (*z) = ((*x) > (*y)) ? (*x) : (*y) ;                   \n" \
+"}"
+
+//------------------------------------------------------------------------------
+// GB_mex_test57 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix Base = NULL, Arow = NULL, Acol = NULL ;
+    GrB_Vector w1 = NULL, w2 = NULL, mask = NULL ;
+    GrB_Descriptor T0 = NULL ;
+    GrB_BinaryOp MyMax = NULL ;
+    GrB_Monoid MyMaxMonoid = NULL ;
+    int save_nthreads, save_control ;
+    double save_chunk ;
+    OK (GxB_Global_Option_get_INT32 (GxB_NTHREADS, &save_nthreads)) ;
+    OK (GxB_Global_Option_get_FP64 (GxB_CHUNK, &save_chunk)) ;
+    OK (GxB_Global_Option_get_INT32 (GxB_JIT_C_CONTROL, &save_control)) ;
+    int ntrials = 0 ;
+
+    OK (GrB_Descriptor_new (&T0)) ;
+    OK (GrB_Descriptor_set_INT32 (T0, GrB_TRAN, GrB_INP0)) ;
+    OK (GxB_BinaryOp_new (&MyMax, (GxB_binary_function) mymax,
+        GrB_FP64, GrB_FP64, GrB_FP64, "mymax", MYMAX_DEFN)) ;
+    OK (GrB_Monoid_new_FP64 (&MyMaxMonoid, MyMax, (double) -INFINITY)) ;
+
+    GrB_Monoid monoids [NMONOIDS] = {
+        GrB_PLUS_MONOID_INT64, GrB_TIMES_MONOID_INT32, GrB_MIN_MONOID_INT32,
+        GrB_MAX_MONOID_FP64, GrB_PLUS_MONOID_FP32, GrB_LOR_MONOID_BOOL,
+        GrB_LAND_MONOID_BOOL, GrB_LXOR_MONOID_BOOL, GrB_LXNOR_MONOID_BOOL,
+        GxB_BOR_UINT8_MONOID, GxB_BXOR_UINT16_MONOID, GxB_PLUS_FC64_MONOID,
+        GxB_PLUS_FC32_MONOID, NULL } ;
+    GrB_Type types [NMONOIDS] = {
+        GrB_INT64, GrB_INT32, GrB_INT32,
+        GrB_FP64, GrB_FP32, GrB_BOOL,
+        GrB_BOOL, GrB_BOOL, GrB_BOOL,
+        GrB_UINT8, GrB_UINT16, GxB_FC64,
+        GxB_FC32, GrB_FP64 } ;
+    monoids [NMONOIDS-1] = MyMaxMonoid ;
+
+    //--------------------------------------------------------------------------
+    // create the base matrix
+    //--------------------------------------------------------------------------
+
+    // Base has small integers from -3 to 3, including zero (the terminal
+    // value of TIMES, and false for LAND).  Rows and columns 0 to 9 are
+    // dense, longer than the panel of the terminal check, and some rows and
+    // columns are empty.  MIN_INT32 and MAX appear in a few entries.
+    OK (GrB_Matrix_new (&Base, GrB_FP64, M, N)) ;
+    simple_rand_seed (57) ;
+    for (int64_t i = 0 ; i < M ; i++)
+    {
+        for (int64_t j = 0 ; j < N ; j++)
+        {
+            bool dense = (i < 10 || j < 10) ;
+            bool empty = (i % 37 == 36 || j % 41 == 40) ;
+            if (empty && !dense) continue ;
+            if (!dense && (simple_rand_i ( ) % 8 != 0)) continue ;
+            double x = (double) ((int64_t) (simple_rand_i ( ) % 7) - 3) ;
+            if (i == 5 && j == 150) x = (double) INT32_MIN ;
+            if (i == 150 && j == 5) x = 1e10 ;
+            OK (GrB_Matrix_setElement_FP64 (Base, x, i, j)) ;
+        }
+    }
+    OK (GrB_Matrix_wait (Base, GrB_MATERIALIZE)) ;
+
+    // a mask for some of the rows or columns
+    OK (GrB_Vector_new (&mask, GrB_BOOL, M)) ;
+    for (int64_t i = 0 ; i < M ; i += 3)
+    {
+        OK (GrB_Vector_setElement_BOOL (mask, true, i)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // reduce the matrix held by row and by column
+    //--------------------------------------------------------------------------
+
+    for (int jit = 0 ; jit <= 1 ; jit++)
+    for (int nthreads = 1 ; nthreads <= 4 ; nthreads += 3)
+    for (int s = 0 ; s < NMONOIDS ; s++)
+    for (int sparsity = 0 ; sparsity < 5 ; sparsity++)
+    {
+        OK (GxB_Global_Option_set_INT32 (GxB_JIT_C_CONTROL,
+            jit ? GxB_JIT_ON : GxB_JIT_OFF)) ;
+        OK (GxB_Global_Option_set_INT32 (GxB_NTHREADS, nthreads)) ;
+        OK (GxB_Global_Option_set_FP64 (GxB_CHUNK,
+            (nthreads == 1) ? save_chunk : 1)) ;
+        GrB_Monoid monoid = monoids [s] ;
+        GrB_Type type = types [s] ;
+
+        // Arow and Acol: Base typecasted to the monoid type, held by row and
+        // by column.  Sparsity 4 is an iso full matrix.
+        int control [5] = { GxB_SPARSE, GxB_HYPERSPARSE, GxB_BITMAP,
+            GxB_FULL, GxB_FULL } ;
+        OK (GrB_Matrix_new (&Arow, type, M, N)) ;
+        OK (GrB_Matrix_new (&Acol, type, M, N)) ;
+        OK (GxB_Matrix_Option_set_INT32 (Arow, GxB_FORMAT, GxB_BY_ROW)) ;
+        OK (GxB_Matrix_Option_set_INT32 (Acol, GxB_FORMAT, GxB_BY_COL)) ;
+        if (sparsity >= 3)
+        {
+            // a full matrix
+            bool iso = (sparsity == 4) ;
+            OK (GrB_Matrix_assign_FP64 (Arow, NULL, NULL, 2, GrB_ALL, M,
+                GrB_ALL, N, NULL)) ;
+            if (!iso)
+            {
+                OK (GrB_Matrix_assign (Arow, NULL, NULL, Base, GrB_ALL, M,
+                    GrB_ALL, N, NULL)) ;
+            }
+        }
+        else
+        {
+            OK (GrB_Matrix_assign (Arow, NULL, NULL, Base, GrB_ALL, M,
+                GrB_ALL, N, NULL)) ;
+        }
+        OK (GrB_Matrix_assign (Acol, NULL, NULL, Arow, GrB_ALL, M,
+            GrB_ALL, N, NULL)) ;
+        OK (GxB_Matrix_Option_set_INT32 (Arow, GxB_SPARSITY_CONTROL,
+            control [sparsity])) ;
+        OK (GxB_Matrix_Option_set_INT32 (Acol, GxB_SPARSITY_CONTROL,
+            control [sparsity])) ;
+        OK (GrB_Matrix_wait (Arow, GrB_MATERIALIZE)) ;
+        OK (GrB_Matrix_wait (Acol, GrB_MATERIALIZE)) ;
+        CHECK (Arow->iso == (sparsity == 4)) ;
+
+        // w1 = reduce each row of Arow (with GB_reduce_each_vector), and w2 =
+        // reduce each row of Acol (with A*x)
+        OK (GrB_Vector_new (&w1, type, M)) ;
+        OK (GrB_Vector_new (&w2, type, M)) ;
+        OK (GrB_Matrix_reduce_Monoid (w1, NULL, NULL, monoid, Arow, NULL)) ;
+        OK (GrB_Matrix_reduce_Monoid (w2, NULL, NULL, monoid, Acol, NULL)) ;
+        CHECK (GB_mx_isequal_entries ((GrB_Matrix) w1, (GrB_Matrix) w2, 0)) ;
+
+        // w1<mask> += reduce each row of Arow, and the same for w2 and Acol
+        GrB_BinaryOp accum = (s == NMONOIDS-1) ? MyMax :
+            (monoid->op) ;
+        OK (GrB_Matrix_reduce_Monoid (w1, mask, accum, monoid, Arow, NULL)) ;
+        OK (GrB_Matrix_reduce_Monoid (w2, mask, accum, monoid, Acol, NULL)) ;
+        CHECK (GB_mx_isequal_entries ((GrB_Matrix) w1, (GrB_Matrix) w2, 0)) ;
+        GrB_free (&w1) ;
+        GrB_free (&w2) ;
+
+        // w1 = reduce each column of Acol (with GB_reduce_each_vector), and
+        // w2 = reduce each column of Arow (with A'*x)
+        OK (GrB_Vector_new (&w1, type, N)) ;
+        OK (GrB_Vector_new (&w2, type, N)) ;
+        OK (GrB_Matrix_reduce_Monoid (w1, NULL, NULL, monoid, Acol, T0)) ;
+        OK (GrB_Matrix_reduce_Monoid (w2, NULL, NULL, monoid, Arow, T0)) ;
+        CHECK (GB_mx_isequal_entries ((GrB_Matrix) w1, (GrB_Matrix) w2, 0)) ;
+        GrB_free (&w1) ;
+        GrB_free (&w2) ;
+
+        GrB_free (&Arow) ;
+        GrB_free (&Acol) ;
+        ntrials++ ;
+    }
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_free (&Base) ;
+    GrB_free (&mask) ;
+    GrB_free (&T0) ;
+    GrB_free (&MyMaxMonoid) ;
+    GrB_free (&MyMax) ;
+    OK (GxB_Global_Option_set_INT32 (GxB_NTHREADS, save_nthreads)) ;
+    OK (GxB_Global_Option_set_FP64 (GxB_CHUNK, save_chunk)) ;
+    OK (GxB_Global_Option_set_INT32 (GxB_JIT_C_CONTROL, save_control)) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test57:  all tests passed (%d trials).\n\n", ntrials) ;
+}
+
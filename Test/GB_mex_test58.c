@@ -0,0 +1,278 @@
+//------------------------------------------------------------------------------
+// GB_mex_test58: test the in-place C=select(C)
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GrB_select prunes a sparse or hypersparse C in-place when C is aliased with
+// A, with no mask, accum, or transpose.  This test compares C=select(C) with
+// R=select(A), where A is an identical copy of C that is not aliased with the
+// output, for positional, value, and user-defined operators, iso and non-iso
+// matrices, matrices with zombies and pending tuples (which are assembled
+// before the selection), by row and by column, and with the JIT on and off.
+// A large matrix is selected with several threads, so that the compacted
+// slices are shifted into place in parallel.  The column selectors, the value
+// selectors on an iso matrix, and the bitmap and full cases do not select C
+// in-place, and are tested as well.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test58"
+
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+#define N 60
+#define NBIG 1000
+#define NOPS 13
+
+void myselect (bool *z, const double *x, GrB_Index i, GrB_Index j,
+    const int64_t *y) ;
+void myselect (bool *z, const double *x, GrB_Index i, GrB_Index j,
+    const int64_t *y)
+{
+    int64_t t = (int64_t) (*x) + (int64_t) (i + j) + (*y) ;
+    (*z) = (t % 3 != 0) ;
+}
+
+#define MYSELECT_DEFN \
+"void myselect (bool *z, const double *x, GrB_Index i, GrB_Index j,     \n" \
+"    const int64_t *y)                                                  \n" \
+"{                                                                      \n" \
+"    int64_t t = (int64_t) (*x) + (int64_t) (i + j) + (*y) ;            \n" \
+"    (*z) = (t % 3 != 0) ;                                              \n" \
+"}"
+
+//------------------------------------------------------------------------------
+// select_both: C = select (C) in-place, and R = select (A)
+//------------------------------------------------------------------------------
+
+// C and A must be identical on input.  C is pruned in-place (if the
+// conditions for the in-place method hold), and compared with R.
+
+static GrB_Info select_both (GrB_Matrix C, GrB_Matrix A,
+    GrB_IndexUnaryOp op, int64_t thunk)
+{
+    GrB_Info info ;
+    GrB_Matrix R = NULL ;
+    GrB_Type type ;
+    GrB_Index nrows, ncols ;
+    OK (GxB_Matrix_type (&type, A)) ;
+    OK (GrB_Matrix_nrows (&nrows, A)) ;
+    OK (GrB_Matrix_ncols (&ncols, A)) ;
+    OK (GrB_Matrix_new (&R, type, nrows, ncols)) ;
+    OK (GrB_Matrix_select_INT64 (R, NULL, NULL, op, A, thunk, NULL)) ;
+    OK (GrB_Matrix_select_INT64 (C, NULL, NULL, op, C, thunk, NULL)) ;
+    OK (GxB_Matrix_fprint (C, "C", GxB_SILENT, NULL)) ;
+    CHECK (!GB_ANY_PENDING_WORK (C)) ;
+    CHECK (GB_mx_isequal_entries (C, R, 0)) ;
+    CHECK (C->iso == R->iso || GB_nnz (C) == 0) ;
+    GrB_free (&R) ;
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test58 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix Base = NULL, C = NULL, A = NULL ;
+    GrB_IndexUnaryOp MySelect = NULL ;
+    int save_nthreads, save_control ;
+    double save_chunk ;
+    OK (GxB_Global_Option_get_INT32 (GxB_NTHREADS, &save_nthreads)) ;
+    OK (GxB_Global_Option_get_FP64 (GxB_CHUNK, &save_chunk)) ;
+    OK (GxB_Global_Option_get_INT32 (GxB_JIT_C_CONTROL, &save_control)) ;
+    int ntrials = 0 ;
+
+    OK (GxB_IndexUnaryOp_new (&MySelect,
+        (GxB_index_unary_function) myselect, GrB_BOOL, GrB_FP64, GrB_INT64,
+        "myselect", MYSELECT_DEFN)) ;
+
+    GrB_IndexUnaryOp ops [NOPS] = {
+        GrB_TRIL, GrB_TRIU, GrB_DIAG, GrB_OFFDIAG, GrB_ROWLE, GrB_ROWGT,
+        GrB_VALUEGT_FP64, GrB_VALUELE_FP64, GrB_VALUEEQ_FP64, GrB_VALUENE_FP64,
+        GrB_COLLE, GrB_COLGT, NULL } ;
+    ops [NOPS-1] = MySelect ;
+    GrB_Type types [3] = { GrB_FP64, GrB_INT8, GrB_BOOL } ;
+
+    //--------------------------------------------------------------------------
+    // create the base matrix
+    //--------------------------------------------------------------------------
+
+    // Base has small integer values from -3 to 3, and some empty rows and
+    // columns.
+    OK (GrB_Matrix_new (&Base, GrB_FP64, N, N)) ;
+    simple_rand_seed (58) ;
+    for (int64_t i = 0 ; i < N ; i++)
+    {
+        for (int64_t j = 0 ; j < N ; j++)
+        {
+            if (i % 13 == 12 || j % 11 == 10) continue ;
+            if (simple_rand_i ( ) % 3 != 0) continue ;
+            double x = (double) ((int64_t) (simple_rand_i ( ) % 7) - 3) ;
+            OK (GrB_Matrix_setElement_FP64 (Base, x, i, j)) ;
+        }
+    }
+    OK (GrB_Matrix_wait (Base, GrB_MATERIALIZE)) ;
+
+    //--------------------------------------------------------------------------
+    // C = select (C) for small matrices
+    //--------------------------------------------------------------------------
+
+    int sparsity_control [3] = { GxB_SPARSE, GxB_HYPERSPARSE, GxB_BITMAP } ;
+
+    for (int jit = 0 ; jit <= 1 ; jit++)
+    for (int nthreads = 1 ; nthreads <= 4 ; nthreads += 3)
+    for (int t = 0 ; t < 3 ; t++)
+    for (int sparsity = 0 ; sparsity < 3 ; sparsity++)
+    for (int by_row = 0 ; by_row <= 1 ; by_row++)
+    for (int iso = 0 ; iso <= 1 ; iso++)
+    for (int pending = 0 ; pending < 4 ; pending++)
+    for (int k = 0 ; k < NOPS ; k++)
+    {
+        OK (GxB_Global_Option_set_INT32 (GxB_JIT_C_CONTROL,
+            jit ? GxB_JIT_ON : GxB_JIT_OFF)) ;
+        OK (GxB_Global_Option_set_INT32 (GxB_NTHREADS, nthreads)) ;
+        OK (GxB_Global_Option_set_FP64 (GxB_CHUNK,
+            (nthreads == 1) ? save_chunk : 1)) ;
+
+        // C and A: Base typecasted to the type, or the pattern of Base with
+        // all entries equal to 1 if iso
+        GrB_Type type = types [t] ;
+        OK (GrB_Matrix_new (&C, type, N, N)) ;
+        OK (GxB_Matrix_Option_set_INT32 (C, GxB_FORMAT,
+            by_row ? GxB_BY_ROW : GxB_BY_COL)) ;
+        OK (GxB_Matrix_Option_set_INT32 (C, GxB_SPARSITY_CONTROL,
+            sparsity_control [sparsity])) ;
+        if (iso)
+        {
+            OK (GrB_Matrix_assign_FP64 (C, Base, NULL, 1, GrB_ALL, N,
+                GrB_ALL, N, GrB_DESC_S)) ;
+        }
+        else
+        {
+            OK (GrB_Matrix_assign (C, NULL, NULL, Base, GrB_ALL, N,
+                GrB_ALL, N, NULL)) ;
+        }
+        OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+        CHECK (C->iso == (bool) iso) ;
+        OK (GrB_Matrix_dup (&A, C)) ;
+
+        // add zombies (pending = 1 or 3) and pending tuples (pending = 2 or
+        // 3) to both C and A.  The pending tuples all have the value 1, so
+        // an iso matrix stays iso.
+        for (int pass = 0 ; pass <= 1 ; pass++)
+        {
+            GrB_Matrix X = (pass == 0) ? C : A ;
+            simple_rand_seed (k + 100 * pending) ;
+            if (pending & 1)
+            {
+                for (int64_t i = 0 ; i < N ; i += 2)
+                {
+                    for (int64_t j = i % 3 ; j < N ; j += 5)
+                    {
+                        double x ;
+                        if (GrB_Matrix_extractElement_FP64 (&x, Base, i, j)
+                            == GrB_SUCCESS)
+                        {
+                            OK (GrB_Matrix_removeElement (X, i, j)) ;
+                        }
+                    }
+                }
+            }
+            if (pending & 2)
+            {
+                for (int p = 0 ; p < N ; p++)
+                {
+                    OK (GrB_Matrix_setElement_FP64 (X, 1,
+                        simple_rand_i ( ) % N, simple_rand_i ( ) % N)) ;
+                }
+            }
+        }
+        if (sparsity <= 1)
+        {
+            CHECK ((C->nzombies > 0) == (bool) (pending & 1)) ;
+            CHECK ((GB_Pending_n (C) > 0) == (bool) (pending & 2)) ;
+        }
+
+        // C = select (C) and R = select (A), with a thunk from -3 to 3
+        int64_t thunk = (int64_t) (k % 7) - 3 ;
+        OK (select_both (C, A, ops [k], thunk)) ;
+        GrB_free (&C) ;
+        GrB_free (&A) ;
+        ntrials++ ;
+    }
+
+    //--------------------------------------------------------------------------
+    // C = select (C) for large matrices, with 4 threads
+    //--------------------------------------------------------------------------
+
+    // C has NBIG^2 entries, so the entries kept by each task are shifted by
+    // far more than 1MB, and are copied in parallel.
+
+    OK (GxB_Global_Option_set_INT32 (GxB_NTHREADS, 4)) ;
+    OK (GxB_Global_Option_set_FP64 (GxB_CHUNK, 1)) ;
+    for (int jit = 0 ; jit <= 1 ; jit++)
+    for (int iso = 0 ; iso <= 1 ; iso++)
+    for (int k = 0 ; k < 3 ; k++)
+    {
+        OK (GxB_Global_Option_set_INT32 (GxB_JIT_C_CONTROL,
+            jit ? GxB_JIT_ON : GxB_JIT_OFF)) ;
+        OK (GrB_Matrix_new (&C, GrB_FP64, NBIG, NBIG)) ;
+        OK (GxB_Matrix_Option_set_INT32 (C, GxB_SPARSITY_CONTROL,
+            GxB_SPARSE)) ;
+        OK (GrB_Matrix_assign_FP64 (C, NULL, NULL, 1, GrB_ALL, NBIG,
+            GrB_ALL, NBIG, NULL)) ;
+        if (!iso)
+        {
+            // C(i,j) = i + j
+            OK (GrB_Matrix_apply_IndexOp_INT64 (C, NULL, NULL,
+                GrB_ROWINDEX_INT64, C, 0, NULL)) ;
+            OK (GrB_Matrix_apply_IndexOp_INT64 (C, NULL, GrB_PLUS_FP64,
+                GrB_COLINDEX_INT64, C, 0, NULL)) ;
+        }
+        OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+        CHECK (C->iso == (bool) iso) ;
+        CHECK (GB_IS_SPARSE (C)) ;
+        OK (GrB_Matrix_dup (&A, C)) ;
+        GrB_IndexUnaryOp op = (k == 0) ? GrB_TRIU : ((k == 1) ? GrB_DIAG :
+            GrB_ROWGT) ;
+        OK (select_both (C, A, op, (k == 2) ? (NBIG/2) : 0)) ;
+        GrB_free (&C) ;
+        GrB_free (&A) ;
+        ntrials++ ;
+    }
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_free (&Base) ;
+    GrB_free (&MySelect) ;
+    OK (GxB_Global_Option_set_INT32 (GxB_NTHREADS, save_nthreads)) ;
+    OK (GxB_Global_Option_set_FP64 (GxB_CHUNK, save_chunk)) ;
+    OK (GxB_Global_Option_set_INT32 (GxB_JIT_C_CONTROL, save_control)) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test58:  all tests passed (%d trials).\n\n", ntrials) ;
+}
+
@@ -0,0 +1,274 @@
+//------------------------------------------------------------------------------
+// GB_mex_test59: test C=A(I,J) for each kind of index list
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Tests C=A(I,J) with the JIT on (with the subref_sparse and subref_bitmap JIT
+// kernels) and off (with the generic kernels), for each kind of index list
+// (all, range, stride, backwards stride, sorted list, and unsorted list with
+// duplicates) for both I and J.  A is sparse, hypersparse, bitmap, or full,
+// held by row or column, iso or non-iso, with types of 1, 2, 4, 8, and 16
+// bytes, and a user-defined type of 3 bytes.  Each C is compared with a
+// reference that extracts each entry of A(I,J) one at a time, and must be iso
+// if A is iso.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test59"
+
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+#define M 40
+#define N 30
+#define NTYPES 6
+#define NKINDS 6
+
+typedef struct { uint8_t a, b, c ; } mytype3 ;
+#define MYTYPE3_DEFN \
+"typedef struct { uint8_t a, b, c ; } mytype3 ;"
+
+//------------------------------------------------------------------------------
+// index_list: construct an index list of a given kind
+//------------------------------------------------------------------------------
+
+// Returns the list I and ni to pass to GrB_extract, and the explicit list of
+// indices Ilist [0:nlist-1] that it selects from 0:n-1.
+
+static const GrB_Index *index_list (GrB_Index *I, GrB_Index *ni,
+    GrB_Index *Ilist, int64_t *nlist, int kind, int64_t n)
+{
+    int64_t k = 0 ;
+    switch (kind)
+    {
+        case 0 :    // all: 0:n-1
+            for (int64_t i = 0 ; i < n ; i++) Ilist [k++] = i ;
+            (*ni) = n ;
+            (*nlist) = k ;
+            return (GrB_ALL) ;
+
+        case 1 :    // range: 3:n-5
+            I [GxB_BEGIN] = 3 ;
+            I [GxB_END] = n-5 ;
+            for (int64_t i = 3 ; i <= n-5 ; i++) Ilist [k++] = i ;
+            (*ni) = GxB_RANGE ;
+            break ;
+
+        case 2 :    // stride: 1:3:n-2
+            I [GxB_BEGIN] = 1 ;
+            I [GxB_END] = n-2 ;
+            I [GxB_INC] = 3 ;
+            for (int64_t i = 1 ; i <= n-2 ; i += 3) Ilist [k++] = i ;
+            (*ni) = GxB_STRIDE ;
+            break ;
+
+        case 3 :    // backwards stride: n-2:-4:2
+            I [GxB_BEGIN] = n-2 ;
+            I [GxB_END] = 2 ;
+            I [GxB_INC] = 4 ;
+            for (int64_t i = n-2 ; i >= 2 ; i -= 4) Ilist [k++] = i ;
+            (*ni) = GxB_BACKWARDS ;
+            break ;
+
+        case 4 :    // sorted list with no duplicates
+            for (int64_t i = 0 ; i < n ; i += 2) I [k++] = i ;
+            for (int64_t t = 0 ; t < k ; t++) Ilist [t] = I [t] ;
+            (*ni) = k ;
+            break ;
+
+        default :   // unsorted list with duplicates
+            for (int64_t t = 0 ; t < n + n/2 ; t++)
+            {
+                I [k++] = simple_rand_i ( ) % n ;
+            }
+            for (int64_t t = 0 ; t < k ; t++) Ilist [t] = I [t] ;
+            (*ni) = k ;
+            break ;
+    }
+    (*nlist) = k ;
+    return (I) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_mex_test59 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Matrix Base = NULL, A = NULL, C = NULL, Cref = NULL ;
+    GrB_Scalar s = NULL ;
+    GrB_Type MyType3 = NULL ;
+    int save_nthreads, save_control ;
+    double save_chunk ;
+    OK (GxB_Global_Option_get_INT32 (GxB_NTHREADS, &save_nthreads)) ;
+    OK (GxB_Global_Option_get_FP64 (GxB_CHUNK, &save_chunk)) ;
+    OK (GxB_Global_Option_get_INT32 (GxB_JIT_C_CONTROL, &save_control)) ;
+    int ntrials = 0 ;
+
+    OK (GxB_Type_new (&MyType3, sizeof (mytype3), "mytype3", MYTYPE3_DEFN)) ;
+    GrB_Type types [NTYPES] = { GrB_BOOL, GrB_INT16, GrB_FP32, GrB_FP64,
+        GxB_FC64, NULL } ;
+    types [NTYPES-1] = MyType3 ;
+    int sparsity_control [4] = { GxB_SPARSE, GxB_HYPERSPARSE, GxB_BITMAP,
+        GxB_FULL } ;
+
+    // Base: distinct values, with about half of the entries present
+    OK (GrB_Matrix_new (&Base, GrB_FP64, M, N)) ;
+    simple_rand_seed (59) ;
+    for (int64_t i = 0 ; i < M ; i++)
+    {
+        for (int64_t j = 0 ; j < N ; j++)
+        {
+            if (simple_rand_i ( ) % 2 == 0) continue ;
+            OK (GrB_Matrix_setElement_FP64 (Base, (double) (i * N + j), i, j)) ;
+        }
+    }
+    OK (GrB_Matrix_wait (Base, GrB_MATERIALIZE)) ;
+
+    GrB_Index I [3*M], J [3*M], Ilist [3*M], Jlist [3*M], ni, nj ;
+    int64_t nilist, njlist ;
+
+    for (int t = 0 ; t < NTYPES ; t++)
+    for (int sparsity = 0 ; sparsity < 4 ; sparsity++)
+    for (int by_row = 0 ; by_row <= 1 ; by_row++)
+    for (int iso = 0 ; iso <= 1 ; iso++)
+    {
+
+        //----------------------------------------------------------------------
+        // create A
+        //----------------------------------------------------------------------
+
+        // A has the pattern of Base (or all entries, if full), with the
+        // values of Base typecasted to the type of A, or a single value if iso
+        GrB_Type type = types [t] ;
+        bool full = (sparsity_control [sparsity] == GxB_FULL) ;
+        OK (GrB_Matrix_new (&A, type, M, N)) ;
+        OK (GxB_Matrix_Option_set_INT32 (A, GxB_FORMAT,
+            by_row ? GxB_BY_ROW : GxB_BY_COL)) ;
+        if (type == MyType3)
+        {
+            for (int64_t i = 0 ; i < M ; i++)
+            {
+                for (int64_t j = 0 ; j < N ; j++)
+                {
+                    double x ;
+                    info = GrB_Matrix_extractElement_FP64 (&x, Base, i, j) ;
+                    if (info != GrB_SUCCESS && !full) continue ;
+                    mytype3 y ;
+                    y.a = iso ? 1 : (uint8_t) i ;
+                    y.b = iso ? 2 : (uint8_t) j ;
+                    y.c = iso ? 3 : (uint8_t) (i + j) ;
+                    OK (GrB_Matrix_setElement_UDT (A, (void *) &y, i, j)) ;
+                }
+            }
+        }
+        else if (iso)
+        {
+            OK (GrB_Matrix_assign_FP64 (A, full ? NULL : Base, NULL, 1,
+                GrB_ALL, M, GrB_ALL, N, full ? NULL : GrB_DESC_S)) ;
+        }
+        else
+        {
+            if (full)
+            {
+                OK (GrB_Matrix_assign_FP64 (A, NULL, NULL, -1,
+                    GrB_ALL, M, GrB_ALL, N, NULL)) ;
+            }
+            OK (GrB_Matrix_assign (A, Base, NULL, Base,
+                GrB_ALL, M, GrB_ALL, N, GrB_DESC_S)) ;
+        }
+        OK (GrB_Matrix_wait (A, GrB_MATERIALIZE)) ;
+        OK (GxB_Matrix_Option_set_INT32 (A, GxB_SPARSITY_CONTROL,
+            sparsity_control [sparsity])) ;
+        CHECK (A->iso == (bool) iso) ;
+        CHECK (GB_sparsity (A) == sparsity_control [sparsity]) ;
+
+        for (int ikind = 0 ; ikind < NKINDS ; ikind++)
+        for (int jkind = 0 ; jkind < NKINDS ; jkind++)
+        {
+
+            //------------------------------------------------------------------
+            // construct I and J, and Cref = A(I,J) one entry at a time
+            //------------------------------------------------------------------
+
+            simple_rand_seed (ikind + 10 * jkind) ;
+            const GrB_Index *I0 = index_list (I, &ni, Ilist, &nilist, ikind,
+                M) ;
+            const GrB_Index *J0 = index_list (J, &nj, Jlist, &njlist, jkind,
+                N) ;
+            OK (GrB_Matrix_new (&Cref, type, nilist, njlist)) ;
+            OK (GrB_Scalar_new (&s, type)) ;
+            for (int64_t ci = 0 ; ci < nilist ; ci++)
+            {
+                for (int64_t cj = 0 ; cj < njlist ; cj++)
+                {
+                    OK (GrB_Matrix_extractElement_Scalar (s, A, Ilist [ci],
+                        Jlist [cj])) ;
+                    GrB_Index nvals ;
+                    OK (GrB_Scalar_nvals (&nvals, s)) ;
+                    if (nvals == 0) continue ;
+                    OK (GrB_Matrix_setElement_Scalar (Cref, s, ci, cj)) ;
+                }
+            }
+            OK (GrB_Matrix_wait (Cref, GrB_MATERIALIZE)) ;
+            GrB_free (&s) ;
+
+            //------------------------------------------------------------------
+            // C = A(I,J) with the JIT on and off, and with 1 and 4 threads
+            //------------------------------------------------------------------
+
+            for (int jit = 0 ; jit <= 1 ; jit++)
+            for (int nthreads = 1 ; nthreads <= 4 ; nthreads += 3)
+            {
+                OK (GxB_Global_Option_set_INT32 (GxB_JIT_C_CONTROL,
+                    jit ? GxB_JIT_ON : GxB_JIT_OFF)) ;
+                OK (GxB_Global_Option_set_INT32 (GxB_NTHREADS, nthreads)) ;
+                OK (GxB_Global_Option_set_FP64 (GxB_CHUNK,
+                    (nthreads == 1) ? save_chunk : 1)) ;
+                OK (GrB_Matrix_new (&C, type, nilist, njlist)) ;
+                OK (GrB_Matrix_extract (C, NULL, NULL, A, I0, ni, J0, nj,
+                    NULL)) ;
+                OK (GrB_Matrix_wait (C, GrB_MATERIALIZE)) ;
+                OK (GxB_Matrix_fprint (C, "C", GxB_SILENT, NULL)) ;
+                CHECK (GB_mx_isequal_entries (C, Cref, 0)) ;
+                CHECK (C->iso == (bool) iso || GB_nnz (C) == 0) ;
+                GrB_free (&C) ;
+                ntrials++ ;
+            }
+            GrB_free (&Cref) ;
+        }
+        GrB_free (&A) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_free (&Base) ;
+    GrB_free (&MyType3) ;
+    OK (GxB_Global_Option_set_INT32 (GxB_NTHREADS, save_nthreads)) ;
+    OK (GxB_Global_Option_set_FP64 (GxB_CHUNK, save_chunk)) ;
+    OK (GxB_Global_Option_set_INT32 (GxB_JIT_C_CONTROL, save_control)) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test59:  all tests passed (%d trials).\n\n", ntrials) ;
+}
+
@@ -0,0 +1,208 @@
+//------------------------------------------------------------------------------
+// GB_mex_test60: test GB_check_if_iso and GB_expand_iso
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// GB_check_if_iso checks the entries of A in blocks of 4096, after a quick
+// check of a few entries, and GB_expand_iso copies a scalar into an array.
+// Both have kernels for types of size 1, 2, 4, 8, and 16 bytes, and a generic
+// kernel for user-defined types of any other size.  This test expands a
+// scalar into arrays of many lengths (including the block boundaries), with
+// each kernel and with 1 and 4 threads, and then changes a single byte of a
+// single entry at many positions, each of which must be found by
+// GB_check_if_iso.  Finally, GrB_Vector_build, which uses GB_check_if_iso,
+// must return an iso vector only if all of its values are equal, with the JIT
+// on and off.
+
+#include "GB_mex.h"
+#include "GB_mex_errors.h"
+
+#define USAGE "GB_mex_test60"
+
+#define FREE_ALL ;
+#define GET_DEEP_COPY ;
+#define FREE_DEEP_COPY ;
+
+#define NTYPES 7
+#define NLEN 8
+#define NPOS 10
+#define NBUILD 5000
+
+//------------------------------------------------------------------------------
+// GB_mex_test60 mexFunction
+//------------------------------------------------------------------------------
+
+void mexFunction
+(
+    int nargout,
+    mxArray *pargout [ ],
+    int nargin,
+    const mxArray *pargin [ ]
+)
+{
+
+    //--------------------------------------------------------------------------
+    // startup GraphBLAS
+    //--------------------------------------------------------------------------
+
+    GrB_Info info, expected ;
+    bool malloc_debug = GB_mx_get_global (true) ;
+    GrB_Vector v = NULL ;
+    GrB_Type Type3 = NULL, Type24 = NULL ;
+    GB_void *X = NULL ;
+    GrB_Index *I = NULL ;
+    double *Xbuild = NULL ;
+    int save_nthreads, save_control ;
+    double save_chunk ;
+    OK (GxB_Global_Option_get_INT32 (GxB_NTHREADS, &save_nthreads)) ;
+    OK (GxB_Global_Option_get_FP64 (GxB_CHUNK, &save_chunk)) ;
+    OK (GxB_Global_Option_get_INT32 (GxB_JIT_C_CONTROL, &save_control)) ;
+    int ntrials = 0 ;
+
+    OK (GrB_Type_new (&Type3, 3)) ;
+    OK (GrB_Type_new (&Type24, 24)) ;
+    GrB_Type types [NTYPES] = { GrB_BOOL, GrB_INT16, GrB_FP32, GrB_FP64,
+        GxB_FC64, NULL, NULL } ;
+    types [5] = Type3 ;
+    types [6] = Type24 ;
+    int64_t nlist [NLEN] = { 1, 2, 3, 4095, 4096, 4097, 8193, 100000 } ;
+
+    for (int nthreads = 1 ; nthreads <= 4 ; nthreads += 3)
+    for (int t = 0 ; t < NTYPES ; t++)
+    for (int k = 0 ; k < NLEN ; k++)
+    {
+        // a tiny chunk, so that all threads are used
+        OK (GxB_Global_Option_set_INT32 (GxB_NTHREADS, nthreads)) ;
+        OK (GxB_Global_Option_set_FP64 (GxB_CHUNK,
+            (nthreads == 1) ? save_chunk : 1)) ;
+        GrB_Type type = types [t] ;
+        size_t size = type->size ;
+        int64_t n = nlist [k] ;
+
+        //----------------------------------------------------------------------
+        // expand a zero and a nonzero scalar into X
+        //----------------------------------------------------------------------
+
+        GB_void scalar [24], zero [24] ;
+        memset (zero, 0, 24) ;
+        for (int b = 0 ; b < 24 ; b++)
+        {
+            scalar [b] = (GB_void) (b * 37 + 11) ;
+        }
+        X = (GB_void *) mxMalloc (n * size) ;
+        memset (X, 1, n * size) ;
+        GB_expand_iso (X, n, zero, size) ;
+        for (int64_t p = 0 ; p < n ; p++)
+        {
+            CHECK (memcmp (X + p*size, zero, size) == 0) ;
+        }
+        GB_expand_iso (X, n, scalar, size) ;
+        for (int64_t p = 0 ; p < n ; p++)
+        {
+            CHECK (memcmp (X + p*size, scalar, size) == 0) ;
+        }
+        mxFree (X) ;
+        X = NULL ;
+
+        //----------------------------------------------------------------------
+        // v = a non-iso full vector with all entries equal to the scalar
+        //----------------------------------------------------------------------
+
+        OK (GrB_Vector_new (&v, type, n)) ;
+        if (type == Type3 || type == Type24)
+        {
+            OK (GrB_Vector_assign_UDT (v, NULL, NULL, (void *) scalar,
+                GrB_ALL, n, NULL)) ;
+        }
+        else
+        {
+            OK (GrB_Vector_assign_FP64 (v, NULL, NULL, 1, GrB_ALL, n,
+                NULL)) ;
+            memcpy (v->x, scalar, size) ;
+        }
+        OK (GrB_Vector_wait (v, GrB_MATERIALIZE)) ;
+        CHECK (v->iso) ;
+        OK (GB_convert_any_to_non_iso ((GrB_Matrix) v, true)) ;
+        CHECK (!v->iso) ;
+        GB_void *Vx = (GB_void *) v->x ;
+        for (int64_t p = 0 ; p < n ; p++)
+        {
+            CHECK (memcmp (Vx + p*size, scalar, size) == 0) ;
+        }
+        CHECK (GB_check_if_iso ((GrB_Matrix) v)) ;
+
+        //----------------------------------------------------------------------
+        // change one byte of one entry, at many positions
+        //----------------------------------------------------------------------
+
+        int64_t plist [NPOS] = { 0, 1, 2, n/2, n/2+1, 4095, 4096, 4097,
+            n-2, n-1 } ;
+        for (int i = 0 ; i < NPOS ; i++)
+        {
+            int64_t p = plist [i] ;
+            if (p < 0 || p >= n || n == 1) continue ;
+            for (int b = 0 ; b < size ; b += GB_IMAX (1, size-1))
+            {
+                // change byte b of v(p), then restore it
+                Vx [p*size + b] ^= 0x10 ;
+                CHECK (!GB_check_if_iso ((GrB_Matrix) v)) ;
+                Vx [p*size + b] ^= 0x10 ;
+                CHECK (GB_check_if_iso ((GrB_Matrix) v)) ;
+            }
+        }
+        GrB_free (&v) ;
+        ntrials++ ;
+    }
+
+    //--------------------------------------------------------------------------
+    // GrB_Vector_build returns an iso vector only if its values are equal
+    //--------------------------------------------------------------------------
+
+    I = (GrB_Index *) mxMalloc (NBUILD * sizeof (GrB_Index)) ;
+    Xbuild = (double *) mxMalloc (NBUILD * sizeof (double)) ;
+    for (int64_t p = 0 ; p < NBUILD ; p++)
+    {
+        I [p] = p ;
+        Xbuild [p] = 3 ;
+    }
+
+    for (int jit = 0 ; jit <= 1 ; jit++)
+    for (int nthreads = 1 ; nthreads <= 4 ; nthreads += 3)
+    for (int t = 0 ; t < 5 ; t++)
+    for (int64_t p = -1 ; p < NBUILD ; p += 1237)
+    {
+        OK (GxB_Global_Option_set_INT32 (GxB_JIT_C_CONTROL,
+            jit ? GxB_JIT_ON : GxB_JIT_OFF)) ;
+        OK (GxB_Global_Option_set_INT32 (GxB_NTHREADS, nthreads)) ;
+        OK (GxB_Global_Option_set_FP64 (GxB_CHUNK,
+            (nthreads == 1) ? save_chunk : 1)) ;
+        // all values are 3, except Xbuild [p] = 2 if p >= 0
+        if (p >= 0) Xbuild [p] = 2 ;
+        OK (GrB_Vector_new (&v, types [t], NBUILD)) ;
+        OK (GrB_Vector_build_FP64 (v, I, Xbuild, NBUILD, GrB_PLUS_FP64)) ;
+        OK (GrB_Vector_wait (v, GrB_MATERIALIZE)) ;
+        CHECK (v->iso == (p < 0)) ;
+        if (p >= 0) Xbuild [p] = 3 ;
+        GrB_free (&v) ;
+        ntrials++ ;
+    }
+
+    //--------------------------------------------------------------------------
+    // finalize GraphBLAS
+    //--------------------------------------------------------------------------
+
+    mxFree (I) ;
+    mxFree (Xbuild) ;
+    GrB_free (&Type3) ;
+    GrB_free (&Type24) ;
+    OK (GxB_Global_Option_set_INT32 (GxB_NTHREADS, save_nthreads)) ;
+    OK (GxB_Global_Option_set_FP64 (GxB_CHUNK, save_chunk)) ;
+    OK (GxB_Global_Option_set_INT32 (GxB_JIT_C_CONTROL, save_control)) ;
+    GB_mx_put_global (true) ;
+    printf ("\nGB_mex_test60:  all tests passed (%d trials).\n\n", ntrials) ;
+}
+
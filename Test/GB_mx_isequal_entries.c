@@ -0,0 +1,47 @@
+//------------------------------------------------------------------------------
+// GB_mx_isequal_entries: check if two matrices have the same entries
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+//------------------------------------------------------------------------------
+
+// Unlike GB_mx_isequal, A and B can be held in any format, and can have
+// pending work.  Copies of A and B are finished and converted to sparse by
+// column, and then compared with GB_mx_isequal.  Any pending work on A and B
+// is finished, but they are not otherwise modified.
+
+#include "GB_mex.h"
+
+bool GB_mx_isequal_entries  // true if A and B have the same entries
+(
+    GrB_Matrix A,
+    GrB_Matrix B,
+    double eps      // as in GB_mx_isequal
+)
+{
+    if (A == B) return (true) ;
+    if (A == NULL) return (false) ;
+    if (B == NULL) return (false) ;
+
+    GrB_Matrix A2 = NULL, B2 = NULL ;
+    bool ok = (GrB_Matrix_dup (&A2, A) == GrB_SUCCESS) &&
+              (GrB_Matrix_dup (&B2, B) == GrB_SUCCESS) ;
+    if (ok)
+    {
+        // the format is set before A2 and B2 are finished, since changing it
+        // afterwards can leave them jumbled
+        GxB_Matrix_Option_set_(A2, GxB_FORMAT, GxB_BY_COL) ;
+        GxB_Matrix_Option_set_(B2, GxB_FORMAT, GxB_BY_COL) ;
+        GxB_Matrix_Option_set_(A2, GxB_SPARSITY_CONTROL, GxB_SPARSE) ;
+        GxB_Matrix_Option_set_(B2, GxB_SPARSITY_CONTROL, GxB_SPARSE) ;
+        GrB_Matrix_wait (A2, GrB_MATERIALIZE) ;
+        GrB_Matrix_wait (B2, GrB_MATERIALIZE) ;
+        ok = GB_mx_isequal (A2, B2, eps) ;
+    }
+    GrB_Matrix_free (&A2) ;
+    GrB_Matrix_free (&B2) ;
+    return (ok) ;
+}
+
@@ -0,0 +1,8 @@
+function test280
+%TEST280 test GxB_Matrix_setElements and GxB_Matrix_removeElements
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test36 ;
+fprintf ('test280 all tests passed.\n') ;
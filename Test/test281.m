@@ -0,0 +1,8 @@
+function test281
+%TEST281 test the blocked bucket transpose
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test37 ;
+fprintf ('test281 all tests passed.\n') ;
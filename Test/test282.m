@@ -0,0 +1,8 @@
+function test282
+%TEST282 test GrB_get/set for GxB_TRANSPOSE_CACHE
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test38 ;
+fprintf ('test282 all tests passed.\n') ;
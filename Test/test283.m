@@ -0,0 +1,8 @@
+function test283
+%TEST283 test GxB_Matrix_pack_COO
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test39 ;
+fprintf ('test283 all tests passed.\n') ;
@@ -0,0 +1,8 @@
+function test284
+%TEST284 test GxB_Matrix_build_File
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test40 ;
+fprintf ('test284 all tests passed.\n') ;
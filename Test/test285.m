@@ -0,0 +1,8 @@
+function test285
+%TEST285 test GxB_Matrix_reduce_Monoids
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test41 ;
+fprintf ('test285 all tests passed.\n') ;
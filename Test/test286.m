@@ -0,0 +1,8 @@
+function test286
+%TEST286 test GxB_Iterator_partition and GxB_Iterator_getBlock
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test42 ;
+fprintf ('test286 all tests passed.\n') ;
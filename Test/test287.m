@@ -0,0 +1,8 @@
+function test287
+%TEST287 test GxB_Matrix_selectTopK
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test43 ;
+fprintf ('test287 all tests passed.\n') ;
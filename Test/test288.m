@@ -0,0 +1,8 @@
+function test288
+%TEST288 test GxB_Matrix_reduce_SelectApply
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test44 ;
+fprintf ('test288 all tests passed.\n') ;
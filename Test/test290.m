@@ -0,0 +1,8 @@
+function test290
+%TEST290 test GxB_HYPER_PIN and sparse-to-hypersparse conversion
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test46 ;
+fprintf ('test290 all tests passed.\n') ;
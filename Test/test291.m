@@ -0,0 +1,8 @@
+function test291
+%TEST291 test GxB_CHUNK_FAMILY and GxB_chunk_calibrate
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test47 ;
+fprintf ('test291 all tests passed.\n') ;
@@ -0,0 +1,8 @@
+function test292
+%TEST292 test GxB_CONTEXT_CPUS and GxB_CONTEXT_NUMA_NODE
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test48 ;
+fprintf ('test292 all tests passed.\n') ;
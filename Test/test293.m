@@ -0,0 +1,8 @@
+function test293
+%TEST293 test GxB_NUMA_POLICY
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test49 ;
+fprintf ('test293 all tests passed.\n') ;
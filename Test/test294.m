@@ -0,0 +1,8 @@
+function test294
+%TEST294 test GxB_SPARSITY_ADAPTIVE
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test50 ;
+fprintf ('test294 all tests passed.\n') ;
@@ -0,0 +1,8 @@
+function test295
+%TEST295 test extractElement with pending tuples and zombies
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test51 ;
+fprintf ('test295 all tests passed.\n') ;
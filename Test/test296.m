@@ -0,0 +1,8 @@
+function test296
+%TEST296 test GrB_Matrix_wait with few and many pending tuples
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test52 ;
+fprintf ('test296 all tests passed.\n') ;
@@ -0,0 +1,8 @@
+function test297
+%TEST297 test GrB_Matrix_build with the radix sort
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test53 ;
+fprintf ('test297 all tests passed.\n') ;
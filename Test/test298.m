@@ -0,0 +1,8 @@
+function test298
+%TEST298 test the incremental update of the hyper_hash
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test54 ;
+fprintf ('test298 all tests passed.\n') ;
@@ -0,0 +1,8 @@
+function test299
+%TEST299 test the in-place transpose of full and bitmap matrices
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test55 ;
+fprintf ('test299 all tests passed.\n') ;
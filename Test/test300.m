@@ -0,0 +1,8 @@
+function test300
+%TEST300 test the work-stealing scheduler of the dot3 method
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test56 ;
+fprintf ('test300 all tests passed.\n') ;
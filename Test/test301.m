@@ -0,0 +1,8 @@
+function test301
+%TEST301 test GB_reduce_each_vector against the A*x method of GrB_reduce
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test57 ;
+fprintf ('test301 all tests passed.\n') ;
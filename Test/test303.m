@@ -0,0 +1,8 @@
+function test303
+%TEST303 test C=A(I,J) for each kind of index list, with the JIT on and off
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test59 ;
+fprintf ('test303 all tests passed.\n') ;
@@ -0,0 +1,8 @@
+function test304
+%TEST304 test GB_check_if_iso and GB_expand_iso
+
+% SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2024, All Rights Reserved.
+% SPDX-License-Identifier: Apache-2.0
+
+GB_mex_test60 ;
+fprintf ('test304 all tests passed.\n') ;
@@ -101,6 +101,31 @@ malloc_debugging = stat ;
 
 logstat ('test169'    ,t, j0  , f1  ) ; % C<M>=A+B with many formats
 logstat ('test250'    ,t, j44 , f10 ) ; % JIT tests, set/get, other tests
+logstat ('test304'    ,t, j4  , f1  ) ; % iso check and expand, each type size
+logstat ('test303'    ,t, j4  , f1  ) ; % C=A(I,J): subref JIT, all I,J kinds
+logstat ('test302'    ,t, j4  , f1  ) ; % in-place select: iso, zombies, pending
+logstat ('test301'    ,t, j4  , f1  ) ; % reduce to vector: each vector vs A*x
+logstat ('test300'    ,t, j4  , f1  ) ; % dot3: work stealing, skewed work
+logstat ('test299'    ,t, j0  , f1  ) ; % in-place transpose: full, bitmap
+logstat ('test298'    ,t, j0  , f1  ) ; % hyper_hash update
+logstat ('test297'    ,t, j0  , f1  ) ; % build: radix sort, large dimensions
+logstat ('test296'    ,t, j0  , f1  ) ; % wait: merge, append, and add
+logstat ('test295'    ,t, j0  , f1  ) ; % extractElement: pending, zombies
+logstat ('test294'    ,t, j0  , f1  ) ; % GxB_SPARSITY_ADAPTIVE
+logstat ('test293'    ,t, j0  , f1  ) ; % GxB_NUMA_POLICY
+logstat ('test292'    ,t, j0  , f1  ) ; % GxB_CONTEXT_CPUS and NUMA_NODE
+logstat ('test291'    ,t, j0  , f1  ) ; % GxB_CHUNK_FAMILY, GxB_chunk_calibrate
+logstat ('test290'    ,t, j0  , f1  ) ; % GxB_HYPER_PIN, sparse to hyper
+logstat ('test289'    ,t, j4  , f1  ) ; % GxB_Matrix_axpby, GxB_Vector_axpby
+logstat ('test288'    ,t, j4  , f1  ) ; % GxB_Matrix_reduce_SelectApply
+logstat ('test287'    ,t, j4  , f1  ) ; % GxB_Matrix_selectTopK
+logstat ('test286'    ,t, j0  , f1  ) ; % GxB_Iterator_partition, getBlock
+logstat ('test285'    ,t, j4  , f1  ) ; % GxB_Matrix_reduce_Monoids
+logstat ('test284'    ,t, j0  , f1  ) ; % GxB_Matrix_build_File
+logstat ('test283'    ,t, j0  , f1  ) ; % GxB_Matrix_pack_COO
+logstat ('test282'    ,t, j4  , f1  ) ; % get/set: GxB_TRANSPOSE_CACHE
+logstat ('test281'    ,t, j40 , f10 ) ; % blocked bucket transpose
+logstat ('test280'    ,t, j0  , f1  ) ; % setElements, removeElements
 logstat ('test279'    ,t, j0  , f1  ) ; % blob get/set
 logstat ('test278'    ,t, j0  , f1  ) ; % descriptor get/set
 logstat ('test277'    ,t, j0  , f1  ) ; % context get/set
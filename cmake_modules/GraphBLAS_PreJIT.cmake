@@ -67,10 +67,16 @@ foreach ( PSRC ${PRE1} )
         list ( APPEND PREPRO "JIT_EM8  (" ${F} ")\n" )
     elseif ( ${F} MATCHES "^GB_jit__emult_bitmap" )
         list ( APPEND PREPRO "JIT_EMB  (" ${F} ")\n" )
+    elseif ( ${F} MATCHES "^GB_jit__ewise_axpby" )
+        list ( APPEND PREPRO "JIT_AXPB (" ${F} ")\n" )
     elseif ( ${F} MATCHES "^GB_jit__ewise_fulla" )
         list ( APPEND PREPRO "JIT_EWFA (" ${F} ")\n" )
     elseif ( ${F} MATCHES "^GB_jit__ewise_fulln" )
         list ( APPEND PREPRO "JIT_EWFN (" ${F} ")\n" )
+    elseif ( ${F} MATCHES "^GB_jit__reduce_each_vector" )
+        list ( APPEND PREPRO "JIT_REDV (" ${F} ")\n" )
+    elseif ( ${F} MATCHES "^GB_jit__reduce_select_apply" )
+        list ( APPEND PREPRO "JIT_REDF (" ${F} ")\n" )
     elseif ( ${F} MATCHES "^GB_jit__reduce" )
         list ( APPEND PREPRO "JIT_RED  (" ${F} ")\n" )
     elseif ( ${F} MATCHES "^GB_jit__rowscale" )
@@ -89,6 +95,10 @@ foreach ( PSRC ${PRE1} )
         list ( APPEND PREPRO "JIT_SPS  (" ${F} ")\n" )
     elseif ( ${F} MATCHES "^GB_jit__subassign" )
         list ( APPEND PREPRO "JIT_SUB  (" ${F} ")\n" )
+    elseif ( ${F} MATCHES "^GB_jit__subref_bitmap" )
+        list ( APPEND PREPRO "JIT_SRB  (" ${F} ")\n" )
+    elseif ( ${F} MATCHES "^GB_jit__subref_sparse" )
+        list ( APPEND PREPRO "JIT_SRS  (" ${F} ")\n" )
     elseif ( ${F} MATCHES "^GB_jit__trans_bind1" )
         list ( APPEND PREPRO "JIT_TR1  (" ${F} ")\n" )
     elseif ( ${F} MATCHES "^GB_jit__trans_bind2" )
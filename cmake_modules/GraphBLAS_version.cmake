@@ -8,9 +8,9 @@
 #-------------------------------------------------------------------------------
 
 # version of SuiteSparse:GraphBLAS
-set ( GraphBLAS_DATE "Mar 22, 2024" )
+set ( GraphBLAS_DATE "Oct 18, 2026" )
 set ( GraphBLAS_VERSION_MAJOR 9 CACHE STRING "" FORCE )
-set ( GraphBLAS_VERSION_MINOR 1 CACHE STRING "" FORCE )
+set ( GraphBLAS_VERSION_MINOR 2 CACHE STRING "" FORCE )
 set ( GraphBLAS_VERSION_SUB   0 CACHE STRING "" FORCE )
 
 # GraphBLAS C API Specification version, at graphblas.org